@@ -1,23 +1,176 @@
 #!/usr/bin/env python3
 # emoji-test.txt from https://unicode.org/Public/emoji/16.0/emoji-test.txt
+#
+# Generates skywalker/emoji_table.h:
+#   ./generate_emoji_table.py > ../skywalker/emoji_table.h
+#
+# The emoji names are put in a minimal perfect hash table (hash and displace),
+# such that a lookup takes two hashes and a single compare. All tables are
+# constexpr, so there is no initialization at startup.
 
-print('static const std::unordered_map<QString, QString> emojiNameMap = {')
+# MANUALLY ADDED: missing from file
+EXTRA_EMOJIS = [
+    ('\u2728\ufe0f', 'sparkles'),
+    ('\u2614\ufe0f', 'umbrella with rain drops'),
+]
 
-file = open('emoji-test.txt')
+MASK = 0xFFFFFFFF
 
-for line in file:
-    l = line.strip()
+def utf16_units(s):
+    data = s.encode('utf-16-le')
+    return [data[i] | (data[i + 1] << 8) for i in range(0, len(data), 2)]
 
-    if not l:
-        continue 
+# Must be the same as emojiHash in emoji_names.cpp
+def emoji_hash(units, seed):
+    h = (2166136261 ^ ((seed * 0x9E3779B1) & MASK)) & MASK
 
-    if l[0] == '#':
-        continue
+    for u in units:
+        h ^= u
+        h = (h * 16777619) & MASK
 
-    parts = l.split('#', 1)
-    info = parts[1].lstrip().split(' ', 2)
-    code = '"{emoji}", "{name}"'.format(emoji=info[0], name=info[2])
-    code = '    {' + code + '},'
-    print(code)
+    return h
+
+def read_emojis(file_name):
+    emojis = []
+    seen = set()
+
+    with open(file_name, encoding='utf-8') as file:
+        for line in file:
+            l = line.strip()
+
+            if not l:
+                continue
+
+            if l[0] == '#':
+                continue
+
+            parts = l.split('#', 1)
+            info = parts[1].lstrip().split(' ', 2)
+            emoji, name = info[0], info[2]
+
+            if emoji not in seen:
+                seen.add(emoji)
+                emojis.append((emoji, name))
+
+    for emoji, name in EXTRA_EMOJIS:
+        if emoji not in seen:
+            seen.add(emoji)
+            emojis.append((emoji, name))
+
+    return emojis
+
+def create_perfect_hash(keys):
+    size = len(keys)
+    bucket_count = max(1, size // 4)
+    buckets = [[] for _ in range(bucket_count)]
+
+    for key in keys:
+        buckets[emoji_hash(key, 0) % bucket_count].append(key)
+
+    displacements = [0] * bucket_count
+    slots = [None] * size
+
+    for bucket_index in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        bucket = buckets[bucket_index]
+
+        if not bucket:
+            continue
+
+        seed = 1
+
+        while True:
+            positions = [emoji_hash(key, seed) % size for key in bucket]
+
+            if len(set(positions)) == len(positions) and all(slots[p] is None for p in positions):
+                break
+
+            seed += 1
+
+        displacements[bucket_index] = seed
+
+        for key, pos in zip(bucket, positions):
+            slots[pos] = key
+
+    return displacements, slots
+
+def cpp_string(s):
+    return s.replace('\\', '\\\\').replace('"', '\\"')
+
+def print_array(name, elem_type, values, per_line):
+    print(f'static constexpr {elem_type} {name}[] = {{')
+
+    for i in range(0, len(values), per_line):
+        print('    ' + ', '.join(str(v) for v in values[i:i + per_line]) + ',')
+
+    print('};')
+    print()
+
+def print_code_point_bitset(emojis):
+    code_points = set()
+
+    for emoji, _ in emojis:
+        for c in emoji:
+            code_points.add(ord(c))
+
+    page_count = (max(code_points) >> 8) + 1
+    pages = [[0] * 8]
+    page_index = [0] * page_count
+
+    for page in range(page_count):
+        bits = [0] * 8
+
+        for c in range(page << 8, (page + 1) << 8):
+            if c in code_points:
+                bits[(c & 0xFF) >> 5] |= 1 << (c & 31)
+
+        if any(bits):
+            page_index[page] = len(pages)
+            pages.append(bits)
+
+    print('// Code points occurring in emoji, in pages of 256 code points.')
+    print(f'static constexpr uint EMOJI_CODE_POINT_PAGE_COUNT = {page_count};')
+    print()
+    print_array('EMOJI_CODE_POINT_PAGE_INDEX', 'uint8_t', page_index, 32)
+    print('static constexpr uint32_t EMOJI_CODE_POINT_BITS[][8] = {')
+
+    for bits in pages:
+        print('    { ' + ', '.join(f'0x{b:08x}' for b in bits) + ' },')
+
+    print('};')
+    print()
+
+emojis = read_emojis('emoji-test.txt')
+names = dict(emojis)
+keys = [emoji for emoji, _ in emojis]
+displacements, slots = create_perfect_hash([utf16_units(k) for k in keys])
+key_by_units = {tuple(utf16_units(k)): k for k in keys}
+
+print('// Copyright (C) 2026 Michel de Boer')
+print('// License: GPLv3')
+print('// Generated by scripts/generate_emoji_table.py, do not edit.')
+print('#pragma once')
+print('#include <QtGlobal>')
+print('#include <string_view>')
+print()
+print('namespace Skywalker::EmojiTable {')
+print()
+print('struct Entry')
+print('{')
+print('    std::u16string_view mEmoji;')
+print('    std::string_view mName;')
+print('};')
+print()
+print(f'static constexpr uint32_t BUCKET_COUNT = {len(displacements)};')
+print(f'static constexpr uint32_t TABLE_SIZE = {len(slots)};')
+print()
+print_array('DISPLACEMENTS', 'uint16_t', displacements, 16)
+print('static constexpr Entry TABLE[] = {')
+
+for units in slots:
+    emoji = key_by_units[tuple(units)]
+    print(f'    {{ u"{cpp_string(emoji)}", "{cpp_string(names[emoji])}" }},')
 
 print('};')
+print()
+print_code_point_bitset(emojis)
+print('}')
@@ -30,6 +30,7 @@ AbstractPostFeedModel::AbstractPostFeedModel(QObject* parent) :
     mFocusHashtags(NULL_FOCUS_HASHTAGS),
     mHashtags(NULL_HASHTAG_INDEX)
 {
+    connectSnapshotInvalidation();
 }
 
 AbstractPostFeedModel::AbstractPostFeedModel(const QString& userDid,
@@ -58,6 +59,8 @@ AbstractPostFeedModel::AbstractPostFeedModel(const QString& userDid,
 
     connect(&ListCache::instance(), &ListCache::listAdded, this,
             [this](const QString& uri){ listAdded(uri); }, Qt::QueuedConnection);
+
+    connectSnapshotInvalidation();
 }
 
 void AbstractPostFeedModel::setContentFilterStatsEnabled(bool enabled)
@@ -549,6 +552,171 @@ QVariant AbstractPostFeedModel::data(const QModelIndex& index, int role) const
 
     const int physicalIndex = toPhysicalIndex(index.row());
     const auto& post = mFeed[physicalIndex];
+
+    if (!isSnapshotRole(Role(role)))
+        return getPostData(post, role);
+
+    auto& snapshot = getRowSnapshot(index.row(), post);
+    auto it = snapshot.mRoleValues.find(role);
+
+    if (it != snapshot.mRoleValues.end())
+        return it->second;
+
+    switch (Role(role))
+    {
+    case Role::PostContentVisibility:
+    case Role::PostContentWarning:
+    case Role::PostContentLabeler:
+        materializeContentVisibility(post, snapshot);
+        return snapshot.mRoleValues[role];
+    default:
+        break;
+    }
+
+    return snapshot.mRoleValues[role] = getPostData(post, role);
+}
+
+bool AbstractPostFeedModel::isSnapshotRole(Role role)
+{
+    switch (role)
+    {
+    case Role::Author:
+    case Role::PostTextMetaInfo:
+    case Role::PostLanguages:
+    case Role::PostImages:
+    case Role::PostVideo:
+    case Role::PostExternal:
+    case Role::PostRecord:
+    case Role::PostRecordWithMedia:
+    case Role::PostRepostedByAuthor:
+    case Role::PostBlockedAuthor:
+    case Role::PostReplyToAuthor:
+    case Role::PostMentionDids:
+    case Role::PostLabels:
+    case Role::PostContentVisibility:
+    case Role::PostContentWarning:
+    case Role::PostContentLabeler:
+    case Role::PostMutedReason:
+        return true;
+    default:
+        return false;
+    }
+}
+
+AbstractPostFeedModel::RowSnapshot& AbstractPostFeedModel::getRowSnapshot(int row, const Post& post) const
+{
+    auto it = mRowSnapshots.find(row);
+
+    if (it != mRowSnapshots.end())
+    {
+        // Guard against a post replaced without a signal.
+        if (it->second.mCid == post.getCid())
+            return it->second;
+
+        it->second.mRoleValues.clear();
+        it->second.mCid = post.getCid();
+        return it->second;
+    }
+
+    if ((int)mRowSnapshots.size() >= MAX_ROW_SNAPSHOTS)
+    {
+        // Keep the snapshots around the row in view.
+        std::erase_if(mRowSnapshots, [row](const auto& item){
+            return std::abs(item.first - row) > MAX_ROW_SNAPSHOTS / 4; });
+    }
+
+    auto& snapshot = mRowSnapshots[row];
+    snapshot.mCid = post.getCid();
+    return snapshot;
+}
+
+void AbstractPostFeedModel::materializeContentVisibility(const Post& post, RowSnapshot& snapshot) const
+{
+    const auto& labels = post.getLabelsIncludingAuthorLabels();
+    const auto [visibility, warning, labelIndex] = mContentFilter.getVisibilityAndWarning(
+        post.getAuthor(), labels, mOverrideAdultVisibility);
+    snapshot.mRoleValues[int(Role::PostContentVisibility)] = visibility;
+    snapshot.mRoleValues[int(Role::PostContentWarning)] = warning;
+    snapshot.mRoleValues[int(Role::PostContentLabeler)] = QVariant::fromValue(getContentLabeler(visibility, labels, labelIndex));
+}
+
+void AbstractPostFeedModel::connectSnapshotInvalidation()
+{
+    connect(this, &QAbstractItemModel::dataChanged, this,
+            [this](const QModelIndex& topLeft, const QModelIndex& bottomRight, const QList<int>& roles){
+                invalidateRowSnapshots(topLeft, bottomRight, roles); });
+
+    // Any change in the row layout shifts the rows.
+    connect(this, &QAbstractItemModel::rowsInserted, this, [this]{ rowLayoutChanged(); });
+    connect(this, &QAbstractItemModel::rowsRemoved, this, [this]{ rowLayoutChanged(); });
+    connect(this, &QAbstractItemModel::rowsMoved, this, [this]{ rowLayoutChanged(); });
+    connect(this, &QAbstractItemModel::modelReset, this, [this]{ rowLayoutChanged(); });
+    connect(this, &QAbstractItemModel::layoutChanged, this, [this]{ rowLayoutChanged(); });
+
+    // Changes in filter settings do not signal data changes on the models.
+    if (const auto* contentFilter = dynamic_cast<const ContentFilter*>(&mContentFilter))
+    {
+        connect(contentFilter, &ContentFilter::contentGroupsChanged, this, [this]{ clearRowSnapshots(); });
+        connect(contentFilter, &ContentFilter::subscribedLabelersChanged, this, [this]{ clearRowSnapshots(); });
+        connect(contentFilter, &ContentFilter::listPrefsChanged, this, [this]{ clearRowSnapshots(); });
+        connect(contentFilter, &ContentFilter::hasFollowingPrefsChanged, this, [this]{ clearRowSnapshots(); });
+    }
+
+    if (const auto* mutedWords = dynamic_cast<const MutedWords*>(&mMutedWords))
+        connect(mutedWords, &MutedWords::entriesChanged, this, [this]{ clearRowSnapshots(); });
+}
+
+void AbstractPostFeedModel::rowLayoutChanged()
+{
+    clearRowSnapshots();
+    mRowIndexDirty = true;
+}
+
+void AbstractPostFeedModel::invalidateRowSnapshots(const QModelIndex& topLeft, const QModelIndex& bottomRight, const QList<int>& roles)
+{
+    if (mRowSnapshots.empty())
+        return;
+
+    const int firstRow = topLeft.row();
+    const int lastRow = bottomRight.row();
+
+    for (auto it = mRowSnapshots.begin(); it != mRowSnapshots.end(); )
+    {
+        if (it->first < firstRow || it->first > lastRow)
+        {
+            ++it;
+            continue;
+        }
+
+        if (roles.empty())
+        {
+            it = mRowSnapshots.erase(it);
+            continue;
+        }
+
+        for (const int role : roles)
+        {
+            switch (Role(role))
+            {
+            case Role::PostContentVisibility:
+            case Role::PostContentWarning:
+            case Role::PostContentLabeler:
+                it->second.mRoleValues.erase(int(Role::PostContentVisibility));
+                it->second.mRoleValues.erase(int(Role::PostContentWarning));
+                it->second.mRoleValues.erase(int(Role::PostContentLabeler));
+                break;
+            default:
+                it->second.mRoleValues.erase(role);
+                break;
+            }
+        }
+
+        ++it;
+    }
+}
+
+QVariant AbstractPostFeedModel::getPostData(const Post& post, int role) const
+{
     const auto* change = getLocalChange(post.getCid());
 
     switch (Role(role))
@@ -1078,94 +1246,93 @@ void AbstractPostFeedModel::postIndexedSecondsAgoChanged()
     changeData({ int(Role::PostIndexedSecondsAgo) });
 }
 
-// For a change on a single post a single row change would be sufficient.
-// However the model may have changed while waiting for a confirmation from the
-// network about the change, so we don't know which row this CID is anymore.
-// Also for reposts a CID may apply to multiple rows. Therefor all rows
-// are marked as change. Performance seems not an issue.
-void AbstractPostFeedModel::likeCountChanged()
+// The model may have changed while waiting for a confirmation from the network
+// about the change, so the rows of a CID are looked up when the change comes in.
+// For reposts a CID may apply to multiple rows. Changes on a thread root, e.g.
+// threadgate, also apply to the rows of replies in that thread.
+void AbstractPostFeedModel::likeCountChanged(const QString& cid)
 {
-    changeData({ int(Role::PostLikeCount) });
+    changeRowData(cid, { int(Role::PostLikeCount) });
 }
 
-void AbstractPostFeedModel::repostTransientChanged()
+void AbstractPostFeedModel::repostTransientChanged(const QString& cid)
 {
-    changeData({ int(Role::PostRepostTransient) });
+    changeRowData(cid, { int(Role::PostRepostTransient) });
 }
 
-void AbstractPostFeedModel::likeUriChanged()
+void AbstractPostFeedModel::likeUriChanged(const QString& cid)
 {
-    changeData({ int(Role::PostLikeUri) });
+    changeRowData(cid, { int(Role::PostLikeUri) });
 }
 
-void AbstractPostFeedModel::likeTransientChanged()
+void AbstractPostFeedModel::likeTransientChanged(const QString& cid)
 {
-    changeData({ int(Role::PostLikeTransient) });
+    changeRowData(cid, { int(Role::PostLikeTransient) });
 }
 
-void AbstractPostFeedModel::replyCountChanged()
+void AbstractPostFeedModel::replyCountChanged(const QString& cid)
 {
-    changeData({ int(Role::PostReplyCount) });
+    changeRowData(cid, { int(Role::PostReplyCount) });
 }
 
-void AbstractPostFeedModel::repostCountChanged()
+void AbstractPostFeedModel::repostCountChanged(const QString& cid)
 {
-    changeData({ int(Role::PostRepostCount) });
+    changeRowData(cid, { int(Role::PostRepostCount) });
 }
 
-void AbstractPostFeedModel::quoteCountChanged()
+void AbstractPostFeedModel::quoteCountChanged(const QString& cid)
 {
-    changeData({ int(Role::PostQuoteCount) });
+    changeRowData(cid, { int(Role::PostQuoteCount) });
 }
 
-void AbstractPostFeedModel::repostUriChanged()
+void AbstractPostFeedModel::repostUriChanged(const QString& cid)
 {
-    changeData({ int(Role::PostRepostUri), int(Role::PostLocallyDeleted) });
+    changeRowData(cid, { int(Role::PostRepostUri), int(Role::PostLocallyDeleted) });
 }
 
-void AbstractPostFeedModel::threadgateUriChanged()
+void AbstractPostFeedModel::threadgateUriChanged(const QString& cid)
 {
-    changeData({ int(Role::PostThreadgateUri) });
+    changeRowData(cid, { int(Role::PostThreadgateUri) });
 }
 
-void AbstractPostFeedModel::replyRestrictionChanged()
+void AbstractPostFeedModel::replyRestrictionChanged(const QString& cid)
 {
-    changeData({ int(Role::PostReplyRestriction) });
+    changeRowData(cid, { int(Role::PostReplyRestriction) });
 }
 
-void AbstractPostFeedModel::replyRestrictionListsChanged()
+void AbstractPostFeedModel::replyRestrictionListsChanged(const QString& cid)
 {
-    changeData({ int(Role::PostReplyRestrictionLists) });
+    changeRowData(cid, { int(Role::PostReplyRestrictionLists) });
 }
 
-void AbstractPostFeedModel::hiddenRepliesChanged()
+void AbstractPostFeedModel::hiddenRepliesChanged(const QString& cid)
 {
-    changeData({ int(Role::PostHiddenReplies), int(Role::PostIsHiddenReply) });
+    changeRowData(cid, { int(Role::PostHiddenReplies), int(Role::PostIsHiddenReply) });
 }
 
-void AbstractPostFeedModel::threadMutedChanged()
+void AbstractPostFeedModel::threadMutedChanged(const QString& uri)
 {
-    changeData({ int(Role::PostThreadMuted) });
+    changeRowData(uri, { int(Role::PostThreadMuted) });
 }
 
-void AbstractPostFeedModel::detachedRecordChanged()
+void AbstractPostFeedModel::detachedRecordChanged(const QString& cid)
 {
-    changeData({ int(Role::PostRecord), int(Role::PostRecordWithMedia) });
+    changeRowData(cid, { int(Role::PostRecord), int(Role::PostRecordWithMedia) });
 }
 
-void AbstractPostFeedModel::reAttachedRecordChanged()
+void AbstractPostFeedModel::reAttachedRecordChanged(const QString& cid)
 {
-    changeData({ int(Role::PostRecord), int(Role::PostRecordWithMedia) });
+    changeRowData(cid, { int(Role::PostRecord), int(Role::PostRecordWithMedia) });
 }
 
-void AbstractPostFeedModel::viewerStatePinnedChanged()
+void AbstractPostFeedModel::viewerStatePinnedChanged(const QString& cid)
 {
-    changeData({ int(Role::PostViewerStatePinned) });
+    changeRowData(cid, { int(Role::PostViewerStatePinned) });
 }
 
-void AbstractPostFeedModel::postDeletedChanged()
+void AbstractPostFeedModel::postDeletedChanged(const QString& cid)
 {
-    changeData({ int(Role::PostLocallyDeleted) });
+    changeRowData(cid, { int(Role::PostLocallyDeleted) });
 }
 
 void AbstractPostFeedModel::profileChanged()
@@ -1178,24 +1345,24 @@ void AbstractPostFeedModel::locallyBlockedChanged()
     changeData({ int(Role::PostBlocked), int(Role::PostLocallyDeleted) });
 }
 
-void AbstractPostFeedModel::bookmarkedChanged()
+void AbstractPostFeedModel::bookmarkedChanged(const QString& cid)
 {
-    changeData({ int(Role::PostBookmarked) });
+    changeRowData(cid, { int(Role::PostBookmarked) });
 }
 
-void AbstractPostFeedModel::bookmarkTransientChanged()
+void AbstractPostFeedModel::bookmarkTransientChanged(const QString& cid)
 {
-    changeData({ int(Role::PostBookmarkTransient) });
+    changeRowData(cid, { int(Role::PostBookmarkTransient) });
 }
 
-void AbstractPostFeedModel::feedbackChanged()
+void AbstractPostFeedModel::feedbackChanged(const QString& cid)
 {
-    changeData({ int(Role::PostFeedback) });
+    changeRowData(cid, { int(Role::PostFeedback) });
 }
 
-void AbstractPostFeedModel::feedbackTransientChanged()
+void AbstractPostFeedModel::feedbackTransientChanged(const QString& cid)
 {
-    changeData({ int(Role::PostFeedbackTransient) });
+    changeRowData(cid, { int(Role::PostFeedbackTransient) });
 }
 
 void AbstractPostFeedModel::changeData(const QList<int>& roles)
@@ -1203,6 +1370,57 @@ void AbstractPostFeedModel::changeData(const QList<int>& roles)
     emit dataChanged(createIndex(0, 0), createIndex(mFeed.size() - 1, 0), roles);
 }
 
+void AbstractPostFeedModel::changeRowData(const QString& key, const QList<int>& roles)
+{
+    if (key.isEmpty())
+        return;
+
+    if (mRowIndexDirty)
+        rebuildRowIndex();
+
+    auto it = mRowIndex.find(key);
+
+    if (it == mRowIndex.end())
+        return;
+
+    for (const int row : it->second)
+    {
+        const auto index = createIndex(row, 0);
+        emit dataChanged(index, index, roles);
+    }
+}
+
+void AbstractPostFeedModel::changePhysicalRowData(int physicalIndex, const QList<int>& roles)
+{
+    const auto index = createIndex(toVisibleIndex(physicalIndex), 0);
+    emit dataChanged(index, index, roles);
+}
+
+void AbstractPostFeedModel::rebuildRowIndex()
+{
+    mRowIndex.clear();
+
+    for (int i = 0; i < (int)mFeed.size(); ++i)
+    {
+        const Post& post = mFeed[i];
+        const int row = toVisibleIndex(i);
+
+        for (const QString& key : { post.getCid(), post.getUri(), post.getReplyRootCid(), post.getReplyRootUri() })
+        {
+            if (key.isEmpty())
+                continue;
+
+            auto& rows = mRowIndex[key];
+
+            if (rows.empty() || rows.back() != row)
+                rows.push_back(row);
+        }
+    }
+
+    mRowIndexDirty = false;
+    qDebug() << "Rebuilt row index:" << mRowIndex.size() << "rows:" << mFeed.size() << "modelId:" << mModelId;
+}
+
 // Easier would be to do this:
 //
 // changeData({ int(Role::PostIsThread), int(Role::PostRecord), int(Role::PostRecordWithMedia) });
@@ -1222,12 +1440,12 @@ void AbstractPostFeedModel::postIsThreadChanged(const QString& postUri)
         const auto& post = mFeed[i];
 
         if (post.getUri() == postUri)
-            emit dataChanged(createIndex(i, 0), createIndex(i, 0), { int(Role::PostIsThread) });
+            changePhysicalRowData(i, { int(Role::PostIsThread) });
 
         const auto postRecord = post.getRecordView();
 
         if (postRecord && postRecord->getUri() == postUri)
-            emit dataChanged(createIndex(i, 0), createIndex(i, 0), { int(Role::PostRecord) });
+            changePhysicalRowData(i, { int(Role::PostRecord) });
 
         const auto recordWithMedia = post.getRecordWithMediaView();
 
@@ -1236,7 +1454,7 @@ void AbstractPostFeedModel::postIsThreadChanged(const QString& postUri)
             const auto record = recordWithMedia->getRecordPtr();
 
             if (record && record->getUri() == postUri)
-                emit dataChanged(createIndex(i, 0), createIndex(i, 0), { int(Role::PostRecordWithMedia) });
+                changePhysicalRowData(i, { int(Role::PostRecordWithMedia) });
         }
     }
 }
@@ -1248,18 +1466,18 @@ void AbstractPostFeedModel::authorAdded(const QString& did)
         const auto& post = mFeed[i];
 
         if (post.getReplyToAuthorDid() == did)
-            emit dataChanged(createIndex(i, 0), createIndex(i, 0), { int(Role::PostReplyToAuthor) });
+            changePhysicalRowData(i, { int(Role::PostReplyToAuthor) });
 
         if (post.getBlockedAuthor().getDid() == did)
-            emit dataChanged(createIndex(i, 0), createIndex(i, 0), { int(Role::PostBlockedAuthor), int(Role::Author) });
+            changePhysicalRowData(i, { int(Role::PostBlockedAuthor), int(Role::Author) });
 
         const auto postRecord = post.getRecordView();
 
         if (postRecord && postRecord->getReplyToAuthorDid() == did)
-            emit dataChanged(createIndex(i, 0), createIndex(i, 0), { int(Role::PostRecord) });
+            changePhysicalRowData(i, { int(Role::PostRecord) });
 
         if (postRecord && postRecord->getBlockedAuthor().getDid() == did)
-            emit dataChanged(createIndex(i, 0), createIndex(i, 0), { int(Role::PostRecord) });
+            changePhysicalRowData(i, { int(Role::PostRecord) });
 
         const auto recordWithMedia = post.getRecordWithMediaView();
 
@@ -1268,10 +1486,10 @@ void AbstractPostFeedModel::authorAdded(const QString& did)
             const auto record = recordWithMedia->getRecordPtr();
 
             if (record && record->getReplyToAuthorDid() == did)
-                emit dataChanged(createIndex(i, 0), createIndex(i, 0), { int(Role::PostRecordWithMedia) });
+                changePhysicalRowData(i, { int(Role::PostRecordWithMedia) });
 
             if (record && record->getBlockedAuthor().getDid() == did)
-                emit dataChanged(createIndex(i, 0), createIndex(i, 0), { int(Role::PostRecordWithMedia) });
+                changePhysicalRowData(i, { int(Role::PostRecordWithMedia) });
         }
     }
 }
@@ -1291,12 +1509,12 @@ void AbstractPostFeedModel::listAdded(const QString& uri)
         const auto& post = mFeed[i];
 
         if (post.getBlockedAuthor().getBlockingByListUri() == uri)
-            emit dataChanged(createIndex(i, 0), createIndex(i, 0), { int(Role::PostBlockedAuthor) });
+            changePhysicalRowData(i, { int(Role::PostBlockedAuthor) });
 
         const auto postRecord = post.getRecordView();
 
         if (postRecord && postRecord->getBlockedAuthor().getBlockingByListUri() == uri)
-            emit dataChanged(createIndex(i, 0), createIndex(i, 0), { int(Role::PostRecord) });
+            changePhysicalRowData(i, { int(Role::PostRecord) });
 
         const auto recordWithMedia = post.getRecordWithMediaView();
 
@@ -1305,7 +1523,7 @@ void AbstractPostFeedModel::listAdded(const QString& uri)
             const auto record = recordWithMedia->getRecordPtr();
 
             if (record && record->getBlockedAuthor().getBlockingByListUri() == uri)
-                emit dataChanged(createIndex(i, 0), createIndex(i, 0), { int(Role::PostRecordWithMedia) });
+                changePhysicalRowData(i, { int(Role::PostRecordWithMedia) });
         }
     }
 }
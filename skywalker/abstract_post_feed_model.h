@@ -12,6 +12,7 @@
 #include <QAbstractListModel>
 #include <deque>
 #include <queue>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace Skywalker {
@@ -163,8 +164,8 @@ public:
 
     virtual QString getFeedName() const = 0;
 
-    void setOverrideAdultVisibility(const QEnums::ContentVisibility visibility) { mOverrideAdultVisibility = visibility; }
-    void clearOverrideAdultVisibility() { mOverrideAdultVisibility = {}; }
+    void setOverrideAdultVisibility(const QEnums::ContentVisibility visibility) { mOverrideAdultVisibility = visibility; clearRowSnapshots(); }
+    void clearOverrideAdultVisibility() { mOverrideAdultVisibility = {}; clearRowSnapshots(); }
 
     Q_INVOKABLE void setOverrideLinkColor(const QString& color);
     Q_INVOKABLE void clearOverrideLinkColor();
@@ -276,27 +277,27 @@ protected:
 
     // LocalPostModelChanges
     virtual void postIndexedSecondsAgoChanged() override;
-    virtual void likeCountChanged() override;
-    virtual void repostTransientChanged() override;
-    virtual void likeUriChanged() override;
-    virtual void likeTransientChanged() override;
-    virtual void replyCountChanged() override;
-    virtual void repostCountChanged() override;
-    virtual void quoteCountChanged() override;
-    virtual void repostUriChanged() override;
-    virtual void threadgateUriChanged() override;
-    virtual void replyRestrictionChanged() override;
-    virtual void replyRestrictionListsChanged() override;
-    virtual void hiddenRepliesChanged() override;
-    virtual void threadMutedChanged() override;
-    virtual void bookmarkedChanged() override;
-    virtual void bookmarkTransientChanged() override;
-    virtual void feedbackChanged() override;
-    virtual void feedbackTransientChanged() override;
-    virtual void detachedRecordChanged() override;
-    virtual void reAttachedRecordChanged() override;
-    virtual void viewerStatePinnedChanged() override;
-    virtual void postDeletedChanged() override;
+    virtual void likeCountChanged(const QString& cid) override;
+    virtual void repostTransientChanged(const QString& cid) override;
+    virtual void likeUriChanged(const QString& cid) override;
+    virtual void likeTransientChanged(const QString& cid) override;
+    virtual void replyCountChanged(const QString& cid) override;
+    virtual void repostCountChanged(const QString& cid) override;
+    virtual void quoteCountChanged(const QString& cid) override;
+    virtual void repostUriChanged(const QString& cid) override;
+    virtual void threadgateUriChanged(const QString& cid) override;
+    virtual void replyRestrictionChanged(const QString& cid) override;
+    virtual void replyRestrictionListsChanged(const QString& cid) override;
+    virtual void hiddenRepliesChanged(const QString& cid) override;
+    virtual void threadMutedChanged(const QString& uri) override;
+    virtual void bookmarkedChanged(const QString& cid) override;
+    virtual void bookmarkTransientChanged(const QString& cid) override;
+    virtual void feedbackChanged(const QString& cid) override;
+    virtual void feedbackTransientChanged(const QString& cid) override;
+    virtual void detachedRecordChanged(const QString& cid) override;
+    virtual void reAttachedRecordChanged(const QString& cid) override;
+    virtual void viewerStatePinnedChanged(const QString& cid) override;
+    virtual void postDeletedChanged(const QString& cid) override;
 
     // LocalProfileChanges
     virtual void profileChanged() override;
@@ -304,6 +305,12 @@ protected:
 
     void changeData(const QList<int>& roles) override;
 
+    // Emits a data change for the rows having the key as CID, URI, root CID or root URI.
+    void changeRowData(const QString& key, const QList<int>& roles);
+
+    // Emits a data change for the row of the post at physicalIndex in mFeed.
+    void changePhysicalRowData(int physicalIndex, const QList<int>& roles);
+
     TimelineFeed mFeed;
     TimelineFeed mBackupFeed;
     bool mReverseFeed = false;
@@ -319,6 +326,28 @@ protected:
     int mModelId = -1;
 
 private:
+    // Materialized values of roles that are expensive to compute, e.g. embed views
+    // and content visibility. A delegate binding many roles of a row gets them
+    // computed once. Values are dropped when the model signals a change of their
+    // row and role, or of the row layout.
+    struct RowSnapshot
+    {
+        QString mCid;
+        std::unordered_map<int, QVariant> mRoleValues;
+    };
+
+    static constexpr int MAX_ROW_SNAPSHOTS = 200;
+
+    static bool isSnapshotRole(Role role);
+    QVariant getPostData(const Post& post, int role) const;
+    RowSnapshot& getRowSnapshot(int row, const Post& post) const;
+    void materializeContentVisibility(const Post& post, RowSnapshot& snapshot) const;
+    void connectSnapshotInvalidation();
+    void invalidateRowSnapshots(const QModelIndex& topLeft, const QModelIndex& bottomRight, const QList<int>& roles);
+    void clearRowSnapshots() { mRowSnapshots.clear(); }
+    void rowLayoutChanged();
+    void rebuildRowIndex();
+
     static const QString NULL_STRING;
     static const ListStore NULL_LIST_STORE;
     static const ContentFilterShowAll NULL_CONTENT_FILTER;
@@ -351,6 +380,11 @@ private:
     QString mFeedError;
     QString mFeedSyncWarning;
     bool mChronological = true;
+    mutable std::unordered_map<int, RowSnapshot> mRowSnapshots; // visible row -> snapshot
+
+    // Rebuilt on the first local change after a change in the row layout.
+    std::unordered_map<QString, std::vector<int>> mRowIndex; // CID/URI -> visible rows
+    bool mRowIndexDirty = true;
 };
 
 }
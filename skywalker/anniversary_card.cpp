@@ -109,7 +109,7 @@ void AnniversaryCard::initCard()
     if (!mImageSource.isEmpty())
         imageProvider->removeImage(mImageSource);
 
-    mImageSource = imageProvider->addImage(cardImage);
+    mImageSource = imageProvider->addImage(std::move(cardImage));
     emit imageSourceChanged();
 }
 
@@ -61,8 +61,7 @@ int AuthorFeedModel::addFeed(ATProto::AppBskyFeed::OutputFeed::SharedPtr&& feed)
         if (mCursorNextPage.isEmpty() && !mFeed.empty())
         {
             mFeed.back().setEndOfFeed(true);
-            const auto index = createIndex(mFeed.size() - 1, 0);
-            emit dataChanged(index, index, { int(Role::EndOfFeed) });
+            changePhysicalRowData(mFeed.size() - 1, { int(Role::EndOfFeed) });
         }
 
         return 0;
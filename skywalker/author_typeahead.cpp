@@ -0,0 +1,201 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#include "author_typeahead.h"
+#include "search_utils.h"
+
+namespace Skywalker {
+
+using namespace std::chrono_literals;
+
+static constexpr auto DEBOUNCE_INTERVAL = 250ms;
+static constexpr auto CACHE_EXPIRY = 5min;
+static constexpr int MAX_CACHE_ENTRIES = 200;
+
+AuthorTypeahead::AuthorTypeahead(const ClientGetter& getClient, QObject* parent) :
+    QObject(parent),
+    mGetClient(getClient),
+    mCache(CACHE_EXPIRY, MAX_CACHE_ENTRIES)
+{
+    mDebounceTimer.setSingleShot(true);
+    mDebounceTimer.setInterval(DEBOUNCE_INTERVAL);
+    connect(&mDebounceTimer, &QTimer::timeout, this, [this]{ sendRequest(); });
+}
+
+QString AuthorTypeahead::makeKey(const QString& typed)
+{
+    return SearchUtils::normalizeText(typed.trimmed());
+}
+
+bool AuthorTypeahead::matchesPrefix(const ATProto::AppBskyActor::ProfileViewBasic& profile, const QString& normalizedPrefix)
+{
+    if (profile.mHandle.startsWith(normalizedPrefix, Qt::CaseInsensitive))
+        return true;
+
+    if (!profile.mDisplayName)
+        return false;
+
+    const auto words = SearchUtils::getNormalizedWords(*profile.mDisplayName);
+
+    for (const auto& word : words)
+    {
+        if (word.startsWith(normalizedPrefix))
+            return true;
+    }
+
+    return SearchUtils::normalizeText(*profile.mDisplayName).startsWith(normalizedPrefix);
+}
+
+AuthorTypeahead::ProfileList AuthorTypeahead::refine(const ProfileList& profiles, const QString& key, int limit)
+{
+    ProfileList refined;
+
+    for (const auto& profile : profiles)
+    {
+        if ((int)refined.size() >= limit)
+            break;
+
+        if (matchesPrefix(*profile, key))
+            refined.push_back(profile);
+    }
+
+    return refined;
+}
+
+AuthorTypeahead::CacheLookup AuthorTypeahead::lookup(const QString& key, int limit) const
+{
+    CacheLookup partial;
+
+    for (auto len = key.size(); len > 0; --len)
+    {
+        const auto* entry = mCache.object(key.first(len));
+
+        if (!entry)
+            continue;
+
+        const bool exact = (len == key.size());
+
+        if (entry->isComplete() || (exact && entry->mLimit >= limit))
+            return { entry, exact, true };
+
+        // Keep the longest prefix with partial results for a provisional answer.
+        if (!partial.mEntry)
+            partial = { entry, exact, false };
+    }
+
+    return partial;
+}
+
+void AuthorTypeahead::addToCache(const QString& key, const ProfileList& profiles, int limit)
+{
+    const auto* entry = mCache.object(key);
+
+    // Do not replace complete results by a smaller result set.
+    if (entry && entry->mLimit > limit)
+        return;
+
+    mCache.insert(key, new CacheEntry{profiles, limit});
+}
+
+void AuthorTypeahead::search(const QString& typed, int limit, const ResultCb& resultCb)
+{
+    // Responses for previous searches are stale now.
+    ++mSearchSeq;
+    mDebounceTimer.stop();
+    mPendingResultCb = nullptr;
+
+    const QString key = makeKey(typed);
+
+    if (key.isEmpty() || limit <= 0)
+    {
+        resultCb({});
+        return;
+    }
+
+    const auto cached = lookup(key, limit);
+
+    if (cached.mEntry)
+    {
+        if (cached.mExact)
+        {
+            const auto& profiles = cached.mEntry->mProfiles;
+            const auto size = std::min((int)profiles.size(), limit);
+            resultCb(ProfileList(profiles.begin(), profiles.begin() + size));
+        }
+        else
+        {
+            resultCb(refine(cached.mEntry->mProfiles, key, limit));
+        }
+
+        if (cached.mFinal)
+        {
+            qDebug() << "Typeahead from cache:" << typed;
+            return;
+        }
+    }
+
+    mPendingTyped = typed;
+    mPendingLimit = limit;
+    mPendingResultCb = resultCb;
+    mDebounceTimer.start();
+}
+
+void AuthorTypeahead::cancel()
+{
+    ++mSearchSeq;
+    mDebounceTimer.stop();
+    mPendingResultCb = nullptr;
+}
+
+void AuthorTypeahead::clearCache()
+{
+    mCache.clear();
+}
+
+void AuthorTypeahead::sendRequest()
+{
+    if (!mPendingResultCb)
+        return;
+
+    auto* client = mGetClient();
+
+    if (!client)
+    {
+        qWarning() << "No client for typeahead search";
+        return;
+    }
+
+    const QString typed = mPendingTyped;
+    const QString key = makeKey(typed);
+    const int limit = mPendingLimit;
+    const auto seq = mSearchSeq;
+    qDebug() << "Typeahead search:" << typed << "limit:" << limit;
+
+    client->searchActorsTypeahead(typed, limit,
+        [this, presence=getPresence(), key, limit, seq](auto searchOutput){
+            if (!presence)
+                return;
+
+            // Stale responses are still useful for future lookups.
+            addToCache(key, searchOutput->mActors, limit);
+
+            if (seq != mSearchSeq)
+            {
+                qDebug() << "Discard stale typeahead response:" << key;
+                return;
+            }
+
+            auto resultCb = std::move(mPendingResultCb);
+            mPendingResultCb = nullptr;
+
+            if (resultCb)
+                resultCb(searchOutput->mActors);
+        },
+        [presence=getPresence()](const QString& error, const QString& msg){
+            if (!presence)
+                return;
+
+            qWarning() << "Type ahead search failed:" << error << " - " << msg;
+        });
+}
+
+}
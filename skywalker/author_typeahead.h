@@ -0,0 +1,70 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include "expiry_cache.h"
+#include "presence.h"
+#include <atproto/lib/client.h>
+#include <QObject>
+#include <QTimer>
+
+namespace Skywalker {
+
+// Remote author typeahead with debouncing, cancellation of stale responses and
+// a prefix result cache. When the results for a prefix of the typed text are
+// complete (less than the requested limit), then the results for the typed text
+// are refined locally without a network request.
+class AuthorTypeahead : public QObject, public Presence
+{
+    Q_OBJECT
+
+public:
+    using ProfileList = ATProto::AppBskyActor::ProfileViewBasic::List;
+    using ClientGetter = std::function<ATProto::Client*()>;
+    using ResultCb = std::function<void(const ProfileList&)>;
+
+    explicit AuthorTypeahead(const ClientGetter& getClient, QObject* parent = nullptr);
+
+    // The result callback may be called multiple times for a single search, e.g.
+    // first with locally refined results from cache, later with network results.
+    // Results for a search get discarded once a new search starts.
+    void search(const QString& typed, int limit, const ResultCb& resultCb);
+    void cancel();
+    void clearCache();
+
+    static bool matchesPrefix(const ATProto::AppBskyActor::ProfileViewBasic& profile, const QString& normalizedPrefix);
+
+private:
+    struct CacheEntry
+    {
+        ProfileList mProfiles;
+        int mLimit = 0;
+
+        // The server returned less results than requested, so these are all matches.
+        bool isComplete() const { return (int)mProfiles.size() < mLimit; }
+    };
+
+    struct CacheLookup
+    {
+        const CacheEntry* mEntry = nullptr;
+        bool mExact = false;
+
+        // No network request is needed when the lookup is final.
+        bool mFinal = false;
+    };
+
+    static QString makeKey(const QString& typed);
+    static ProfileList refine(const ProfileList& profiles, const QString& key, int limit);
+    CacheLookup lookup(const QString& key, int limit) const;
+    void addToCache(const QString& key, const ProfileList& profiles, int limit);
+    void sendRequest();
+
+    ClientGetter mGetClient;
+    ExpiryCache<QString, CacheEntry> mCache;
+    QTimer mDebounceTimer;
+    QString mPendingTyped;
+    int mPendingLimit = 0;
+    ResultCb mPendingResultCb;
+    uint64_t mSearchSeq = 0;
+};
+
+}
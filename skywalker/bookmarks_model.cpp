@@ -53,8 +53,7 @@ void BookmarksModel::addBookmarks(const ATProto::AppBskyBookmark::GetBookmarksOu
     if (isEndOfFeed() && !mFeed.empty())
     {
         mFeed.back().setEndOfFeed(true);
-        const auto index = createIndex(mFeed.size() - 1, 0);
-        emit dataChanged(index, index, { int(Role::EndOfFeed) });
+        changePhysicalRowData(mFeed.size() - 1, { int(Role::EndOfFeed) });
     }
 }
 
@@ -8,14 +8,18 @@ namespace Skywalker {
 
 using namespace std::chrono_literals;
 
-static constexpr auto MESSAGES_UPDATE_INTERVAL = 9s;
+static constexpr auto MESSAGES_UPDATE_MIN_INTERVAL = 3s;
+static constexpr auto MESSAGES_UPDATE_MAX_INTERVAL = 60s;
+static constexpr int MESSAGES_SYNC_LIMIT = 10;
 static constexpr auto CONVOS_UPDATE_INTERVAL = 31s;
+static constexpr auto CONVOS_UPDATE_MAX_INTERVAL = 4min;
 static constexpr char const* DM_ACCESS_ERROR = "Your APP password does not allow access to your direct messages. Create a new APP password that allows access.";
 
 Chat::Chat(ATProto::Client::SharedPtr& bsky, const QString& userDid,
            const IProfileStore& timelineHide,
            const ContentFilter& contentFilter,
-           FollowsActivityStore& followsActivityStore, QObject* parent) :
+           FollowsActivityStore& followsActivityStore,
+           PollScheduler& pollScheduler, QObject* parent) :
     QObject(parent),
     mPresence(std::make_unique<Presence>()),
     mBsky(bsky),
@@ -23,15 +27,22 @@ Chat::Chat(ATProto::Client::SharedPtr& bsky, const QString& userDid,
     mTimelineHide(timelineHide),
     mContentFilter(contentFilter),
     mFollowsActivityStore(followsActivityStore),
+    mPollScheduler(pollScheduler),
     mAcceptedConvoListModel(userDid, mFollowsActivityStore, this),
     mRequestConvoListModel(userDid, mFollowsActivityStore, this)
 {
     connect(&mMessagesUpdateTimer, &QTimer::timeout, this, [this]{ updateMessages(); });
-    connect(&mConvosUnreadUpdateTimer, &QTimer::timeout, this, [this]{ getConvosUnreadCounts(); });
+    mConvosUnreadUpdateJob = mPollScheduler.addJob("chat-unread", CONVOS_UPDATE_INTERVAL, CONVOS_UPDATE_MAX_INTERVAL,
+        [this](const PollScheduler::DoneCb& done){ getConvosUnreadCounts(done); });
     connect(&mAcceptedConvoListModel, &ConvoListModel::unreadCountChanged, this, [this]{ updateTotalUnreadCount(); });
     connect(&mRequestConvoListModel, &ConvoListModel::unreadCountChanged, this, [this]{ updateTotalUnreadCount(); });
 }
 
+Chat::~Chat()
+{
+    mPollScheduler.removeJob(mConvosUnreadUpdateJob);
+}
+
 void Chat::reset()
 {
     qDebug() << "Reset chat";
@@ -48,6 +59,7 @@ void Chat::reset()
 
     mMessageListModels.clear();
     mConvoIdUpdatingMessages.clear();
+    mSyncConvosInProgress = false;
     setUnreadCount(QEnums::CONVO_STATUS_ACCEPTED, 0);
     setUnreadCount(QEnums::CONVO_STATUS_REQUEST, 0);
     setStartConvoInProgress(false);
@@ -333,25 +345,80 @@ QString Chat::getLastRevIncludingReactions(ConvoListModel* model, ATProto::ChatB
     return lastRev;
 }
 
-void Chat::getConvosUnreadCounts()
+void Chat::getConvosUnreadCounts(const PollScheduler::DoneCb& doneCb)
 {
     Q_ASSERT(mBsky);
     qDebug() << "Get unread counts";
 
     mBsky->getConvoUnreadCounts(true,
-        [this, presence=*mPresence](ATProto::ChatBskyConvo::ConvoUnreadCountsOutput::SharedPtr output){
+        [this, presence=*mPresence, doneCb](ATProto::ChatBskyConvo::ConvoUnreadCountsOutput::SharedPtr output){
             if (!presence)
                 return;
 
             qDebug() << "Unread accecpted:" << output->mUnreadAcceptedConvos << "requests:" << output->mUnreadRequestConvos;
+            const bool changed = output->mUnreadAcceptedConvos != mAcceptedConvoListModel.getUnreadCount() ||
+                                 output->mUnreadRequestConvos != mRequestConvoListModel.getUnreadCount();
             mAcceptedConvoListModel.setUnreadCount(output->mUnreadAcceptedConvos);
             mRequestConvoListModel.setUnreadCount(output->mUnreadRequestConvos);
+
+            if (changed)
+                syncConvos();
+
+            if (doneCb)
+                doneCb(changed ? PollScheduler::Result::CHANGED : PollScheduler::Result::UNCHANGED);
         },
-        [](const QString& error, const QString& msg){
+        [doneCb](const QString& error, const QString& msg){
             qDebug() << "getUnreadCounts FAILED:" << error << " - " << msg;
+
+            if (doneCb)
+                doneCb(PollScheduler::Result::FAILED);
         });
 }
 
+void Chat::syncConvos()
+{
+    Q_ASSERT(mBsky);
+
+    if (!mAcceptedConvoListModel.isLoaded() || mAcceptedConvoListModel.isGetConvosInProgress())
+    {
+        qDebug() << "Accepted convos not loaded";
+        return;
+    }
+
+    if (mSyncConvosInProgress)
+    {
+        qDebug() << "Sync convos still in progress";
+        return;
+    }
+
+    qDebug() << "Sync convos";
+    mSyncConvosInProgress = true;
+
+    // Changes in read state and members show up in the newest convos.
+    mBsky->listConvos({}, false, ATProto::ChatBskyConvo::ConvoStatus::ACCEPTED, {}, {}, {},
+        [this, presence=*mPresence](ATProto::ChatBskyConvo::ConvoListOutput::SharedPtr output){
+            if (!presence)
+                return;
+
+            mSyncConvosInProgress = false;
+
+            // A full reload may have started meanwhile.
+            if (mAcceptedConvoListModel.isGetConvosInProgress())
+                return;
+
+            const int changed = mAcceptedConvoListModel.syncConvos(output->mConvos);
+            qDebug() << "Synced convos:" << changed;
+        },
+        [this, presence=*mPresence](const QString& error, const QString& msg){
+            if (!presence)
+                return;
+
+            qDebug() << "syncConvos FAILED:" << error << " - " << msg;
+            mSyncConvosInProgress = false;
+        }
+    );
+}
+
 void Chat::startConvoForMembers(const QStringList& dids, const QString& msg)
 {
     Q_ASSERT(mBsky);
@@ -1547,6 +1614,7 @@ MessageListModel* Chat::getMessageListModel(const QString& convoId)
         ChatBasicProfileList profiles;
         profiles = convo->getMembers();
         model = std::make_unique<MessageListModel>(mUserDid, profiles, mFollowsActivityStore, this);
+        resetMessagesUpdateInterval();
         startMessagesUpdateTimer();
     }
 
@@ -1642,6 +1710,55 @@ void Chat::updateMessages(const QString& convoId)
 
     setMessagesUpdating(convoId, true);
 
+    // Only get the newest messages. Mostly nothing changed, or a few messages
+    // got added. A full page is only needed when there is a gap.
+    mBsky->getMessages(convoId, MESSAGES_SYNC_LIMIT, {},
+        [this, presence=*mPresence, convoId](ATProto::ChatBskyConvo::GetMessagesOutput::SharedPtr output){
+            if (!presence)
+                return;
+
+            auto* model = getMessageListModel(convoId);
+
+            if (!model)
+            {
+                qDebug() << "Model already closed for convo:" << convoId;
+                setMessagesUpdating(convoId, false);
+                return;
+            }
+
+            const int changed = model->mergeNewMessages(output->mMessages);
+
+            if (changed < 0)
+            {
+                reloadMessages(convoId);
+                return;
+            }
+
+            setMessagesUpdating(convoId, false);
+
+            if (changed > 0)
+            {
+                resetMessagesUpdateInterval();
+
+                // New messages change the read state of the convo, and may be
+                // system messages for members joining or leaving.
+                syncConvos();
+            }
+        },
+        [this, presence=*mPresence, convoId](const QString& error, const QString& msg){
+            if (!presence)
+                return;
+
+            qDebug() << "updateMessages FAILED:" << error << " - " << msg;
+            setMessagesUpdating(convoId, false);
+        });
+}
+
+void Chat::reloadMessages(const QString& convoId)
+{
+    Q_ASSERT(mBsky);
+    qDebug() << "Reload messages, convoId:" << convoId;
+
     mBsky->getMessages(convoId, {}, {},
         [this, presence=*mPresence, convoId](ATProto::ChatBskyConvo::GetMessagesOutput::SharedPtr output){
             if (!presence)
@@ -1657,19 +1774,25 @@ void Chat::updateMessages(const QString& convoId)
             }
 
             model->updateMessages(output->mMessages, output->mCursor.value_or(""));
+            resetMessagesUpdateInterval();
         },
         [this, presence=*mPresence, convoId](const QString& error, const QString& msg){
             if (!presence)
                 return;
 
-            qDebug() << "updateMessages FAILED:" << error << " - " << msg;
+            qDebug() << "reloadMessages FAILED:" << error << " - " << msg;
             setMessagesUpdating(convoId, false);
         });
 }
 
 void Chat::updateMessages()
 {
-    qDebug() << "Update messages";
+    qDebug() << "Update messages, interval:" << mMessagesUpdateTimer.interval();
+
+    // Back off while the open convos are idle.
+    const auto interval = std::min(mMessagesUpdateTimer.intervalAsDuration() * 2,
+                                   std::chrono::milliseconds(MESSAGES_UPDATE_MAX_INTERVAL));
+    mMessagesUpdateTimer.setInterval(interval);
 
     for (const auto& [convoId, model] : mMessageListModels)
     {
@@ -1889,6 +2012,7 @@ void Chat::continueSendMessage(const QString& convoId, ATProto::ChatBskyConvo::M
                 return;
 
             qDebug() << "Message sent:" << messageView->mId;
+            resetMessagesUpdateInterval();
             emit sendMessageOk();
         },
         [this, presence=*mPresence](const QString& error, const QString& msg){
@@ -1985,10 +2109,19 @@ void Chat::startMessagesUpdateTimer()
     if (!mMessagesUpdateTimer.isActive())
     {
         qDebug() << "Start messages update timer";
-        mMessagesUpdateTimer.start(MESSAGES_UPDATE_INTERVAL);
+        mMessagesUpdateTimer.start(MESSAGES_UPDATE_MIN_INTERVAL);
     }
 }
 
+void Chat::resetMessagesUpdateInterval()
+{
+    if (mMessagesUpdateTimer.intervalAsDuration() == MESSAGES_UPDATE_MIN_INTERVAL)
+        return;
+
+    qDebug() << "Reset messages update interval";
+    mMessagesUpdateTimer.setInterval(MESSAGES_UPDATE_MIN_INTERVAL);
+}
+
 void Chat::stopMessagesUpdateTimer()
 {
     qDebug() << "Stop messages update timer";
@@ -2006,13 +2139,13 @@ void Chat::setMessagesUpdating(const QString& convoId, bool updating)
 void Chat::startConvosUnreadUpdateTimer()
 {
     qDebug() << "Start convos unread update timer";
-    mConvosUnreadUpdateTimer.start(CONVOS_UPDATE_INTERVAL);
+    mPollScheduler.startJob(mConvosUnreadUpdateJob);
 }
 
 void Chat::stopConvosUnreadUpdateTimer()
 {
     qDebug() << "Stop convos unread update timer";
-    mConvosUnreadUpdateTimer.stop();
+    mPollScheduler.stopJob(mConvosUnreadUpdateJob);
 }
 
 void Chat::pause()
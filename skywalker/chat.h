@@ -8,6 +8,7 @@
 #include "message_list_model.h"
 #include "presence.h"
 #include "named_link.h"
+#include "poll_scheduler.h"
 #include <atproto/lib/chat_master.h>
 #include <atproto/lib/client.h>
 #include <atproto/lib/post_master.h>
@@ -32,7 +33,9 @@ public:
     explicit Chat(ATProto::Client::SharedPtr& bsky, const QString& mUserDid,
                   const IProfileStore& timelineHide,
                   const ContentFilter& contentFilter,
-                  FollowsActivityStore& followsActivityStore, QObject* parent = nullptr);
+                  FollowsActivityStore& followsActivityStore,
+                  PollScheduler& pollScheduler, QObject* parent = nullptr);
+    ~Chat();
 
     void reset();
     void initSettings();
@@ -44,7 +47,7 @@ public:
     Q_INVOKABLE void start();
     Q_INVOKABLE void getConvos(QEnums::ConvoStatus status, const QString& cursor = "");
     Q_INVOKABLE void getConvosNextPage(QEnums::ConvoStatus status);
-    void getConvosUnreadCounts();
+    void getConvosUnreadCounts(const PollScheduler::DoneCb& doneCb = {});
     Q_INVOKABLE void startConvoForMembers(const QStringList& dids, const QString& msg = {});
     Q_INVOKABLE void startConvoForMember(const QString& did, const QString& msg = {});
     Q_INVOKABLE void startConvoIfNotPresent(ConvoView convo);
@@ -171,7 +174,10 @@ private:
     QString getLastReadMessageId(const ConvoView& convo) const;
     QString getLastRevIncludingReactions(ConvoListModel* model, ATProto::ChatBskyConvo::ConvoView::List& convos);
     void updateMessages();
+    void reloadMessages(const QString& convoId);
+    void syncConvos();
     void startMessagesUpdateTimer();
+    void resetMessagesUpdateInterval();
     void stopMessagesUpdateTimer();
     void startConvosUnreadUpdateTimer();
     void stopConvosUnreadUpdateTimer();
@@ -191,6 +197,7 @@ private:
     const IProfileStore& mTimelineHide;
     const ContentFilter& mContentFilter;
     FollowsActivityStore& mFollowsActivityStore;
+    PollScheduler& mPollScheduler;
     ConvoListModel mAcceptedConvoListModel;
     ConvoListModel mRequestConvoListModel;
     int mUnreadCount = 0;
@@ -208,9 +215,10 @@ private:
     bool mStartConvoInProgress = false;
     bool mAcceptConvoInProgress = false;
     bool mConvoUpdateInProgress = false;
+    bool mSyncConvosInProgress = false;
     std::unordered_set<QString> mRequestJoinInProgess; // set of join codes
     QTimer mMessagesUpdateTimer;
-    QTimer mConvosUnreadUpdateTimer;
+    PollScheduler::JobId mConvosUnreadUpdateJob = 0;
     QEnums::AllowIncomingChat mAllowIncomingChat = QEnums::ALLOW_INCOMING_CHAT_FOLLOWING;
     QEnums::AllowIncomingChat mAllowGroupInvites = QEnums::ALLOW_INCOMING_CHAT_FOLLOWING;
 };
@@ -179,6 +179,7 @@ bool ContentFilter::isOverridableSytemLabelId(const QString& labelId)
 ContentFilter::ContentFilter(QObject* parent) :
     QObject(parent)
 {
+    connectCacheInvalidation();
 }
 
 ContentFilter::ContentFilter(const QString& userDid,
@@ -193,6 +194,20 @@ ContentFilter::ContentFilter(const QString& userDid,
 {
     connect(mListsWithPolicies, &ListStore::listRemoved, this,
             [this](const QString& uri){ removeListPrefs(uri); });
+    connectCacheInvalidation();
+}
+
+void ContentFilter::connectCacheInvalidation()
+{
+    connect(this, &ContentFilter::contentGroupsChanged, this, [this]{ clearVisibilityCache(); });
+    connect(this, &ContentFilter::subscribedLabelersChanged, this, [this]{ clearVisibilityCache(); });
+    connect(this, &ContentFilter::listPrefsChanged, this, [this]{ clearVisibilityCache(); });
+    connect(this, &ContentFilter::hasFollowingPrefsChanged, this, [this]{ clearVisibilityCache(); });
+}
+
+void ContentFilter::clearVisibilityCache() const
+{
+    mVisibilityCache.clear();
 }
 
 void ContentFilter::clear()
@@ -200,6 +215,7 @@ void ContentFilter::clear()
     mLabelerGroupMap.clear();
     clearFollowingPrefs();
     mListPrefs.clear();
+    clearVisibilityCache();
 }
 
 void ContentFilter::initListPrefs()
@@ -463,16 +479,24 @@ std::tuple<QEnums::ContentVisibility, QString, int> ContentFilter::getVisibility
     QString warning;
     int labelIndex = -1;
 
+    if (contentLabels.empty())
+        return {visibility, warning, labelIndex};
+
+    VisibilityKey key;
+    key.mFollowing = isFollowingForPrefs(author);
+    key.mListUris = getAuthorPolicyListUris(author);
+    key.mAdultOverride = adultOverrideVisibility;
+
     for (int i = 0; i < contentLabels.size(); ++i)
     {
         const auto& label = contentLabels[i];
-        const auto v = getVisibility(author, label, adultOverrideVisibility);
+        const auto& decision = getVisibilityDecision(author, label, key);
 
-        if (v <= visibility)
+        if (decision.mVisibility <= visibility)
             continue;
 
-        visibility = v;
-        warning = getWarning(label);
+        visibility = decision.mVisibility;
+        warning = decision.mWarning;
         labelIndex = i;
 
         if (visibility == QEnums::CONTENT_VISIBILITY_LAST)
@@ -482,6 +506,62 @@ std::tuple<QEnums::ContentVisibility, QString, int> ContentFilter::getVisibility
     return {visibility, warning, labelIndex};
 }
 
+bool ContentFilter::isFollowingForPrefs(const BasicProfile& author) const
+{
+    return !author.isNull() && !mFollowingPrefs.empty() && author.getViewer().isFollowing();
+}
+
+QString ContentFilter::getAuthorPolicyListUris(const BasicProfile& author) const
+{
+    QString listUris;
+
+    if (author.isNull())
+        return listUris;
+
+    for (const auto& [listUri, _] : mListPrefs)
+    {
+        if (mListsWithPolicies->containsListMember(listUri, author.getDid()))
+        {
+            listUris.append(listUri);
+            listUris.append(' ');
+        }
+    }
+
+    return listUris;
+}
+
+const ContentFilter::VisibilityDecision& ContentFilter::getVisibilityDecision(
+    const BasicProfile& author,
+    const ContentLabel& label,
+    VisibilityKey& key) const
+{
+    static constexpr size_t MAX_VISIBILITY_CACHE_SIZE = 5000;
+
+    const auto* group = mUserPreferences ? getContentGroup(label.getDid(), label.getLabelId()) : nullptr;
+    const auto defaultPrefs = group ? getVisibilityDefaultPrefs(*group) : ATProto::UserPreferences::LabelVisibility::UNKNOWN;
+    const bool adultContent = mUserPreferences && getAdultContent();
+
+    key.mLabelerDid = label.getDid();
+    key.mLabelId = label.getLabelId();
+    auto it = mVisibilityCache.find(key);
+
+    if (it != mVisibilityCache.end())
+    {
+        if (it->second.mDefaultPrefs == defaultPrefs && it->second.mAdultContent == adultContent)
+            return it->second;
+
+        // The user preferences have been changed since the decision was cached.
+        clearVisibilityCache();
+    }
+
+    if (mVisibilityCache.size() >= MAX_VISIBILITY_CACHE_SIZE)
+        mVisibilityCache.clear();
+
+    VisibilityDecision decision{ getVisibility(author, label, key.mAdultOverride), getWarning(label),
+                                 defaultPrefs, adultContent };
+    return mVisibilityCache.emplace(key, std::move(decision)).first->second;
+}
+
 bool ContentFilter::isSubscribedToLabeler(const QString& did) const
 {
     if (isFixedLabelerSubscription(did))
@@ -572,6 +652,7 @@ void ContentFilter::addContentGroupMap(const QString& did, const ContentGroupMap
     Q_ASSERT(!did.isEmpty());
     qDebug() << "Add content group map for did:" << did;
     mLabelerGroupMap[did] = contentGroupMap;
+    clearVisibilityCache();
 }
 
 void ContentFilter::addContentGroups(const QString& did, const std::vector<ContentGroup>& contentGroups)
@@ -583,6 +664,8 @@ void ContentFilter::addContentGroups(const QString& did, const std::vector<Conte
     for (const auto& group : contentGroups)
         groupMap[group.getLabelId()] = group;
 
+    clearVisibilityCache();
+
     saveLabelIdsToSettings(did);
 }
 
@@ -590,6 +673,7 @@ void ContentFilter::removeContentGroups(const QString& did)
 {
     Q_ASSERT(!did.isEmpty());
     mLabelerGroupMap.erase(did);
+    clearVisibilityCache();
     removeLabelIdsFromSettings(did);
 }
 
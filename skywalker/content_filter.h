@@ -137,6 +137,38 @@ signals:
     void listAddingFailed(const QString& listUri, const QString& error);
 
 private:
+    // The visibility of a label depends on the author only through the following
+    // state and the membership of lists with label preferences.
+    struct VisibilityKey
+    {
+        QString mLabelerDid;
+        QString mLabelId;
+        bool mFollowing = false;
+        QString mListUris;
+        std::optional<QEnums::ContentVisibility> mAdultOverride;
+
+        bool operator==(const VisibilityKey&) const = default;
+
+        struct Hash
+        {
+            size_t operator()(const VisibilityKey& key) const
+            {
+                return qHashMulti(0, key.mLabelerDid, key.mLabelId, key.mFollowing, key.mListUris,
+                                  key.mAdultOverride ? (int)*key.mAdultOverride : -1);
+            }
+        };
+    };
+
+    // The user preferences can be changed in place. The preferences a decision was
+    // based on are kept to detect that.
+    struct VisibilityDecision
+    {
+        QEnums::ContentVisibility mVisibility;
+        QString mWarning;
+        ATProto::UserPreferences::LabelVisibility mDefaultPrefs;
+        bool mAdultContent;
+    };
+
     static GlobalContentGroupMap CONTENT_GROUPS;
 
     static void initContentGroups();
@@ -157,6 +189,15 @@ private:
     QString getGroupWarning(const ContentGroup& group) const;
     QString getWarning(const ContentLabel& label) const;
 
+    void connectCacheInvalidation();
+    void clearVisibilityCache() const;
+    bool isFollowingForPrefs(const BasicProfile& author) const;
+    QString getAuthorPolicyListUris(const BasicProfile& author) const;
+    const VisibilityDecision& getVisibilityDecision(
+        const BasicProfile& author,
+        const ContentLabel& label,
+        VisibilityKey& key) const;
+
     QStringList getLabelIds(const QString& labelerDid) const;
     ATProto::UserPreferences::LabelVisibility getVisibilityDefaultPrefs(const ContentGroup& group) const;
     ATProto::UserPreferences::LabelVisibility getVisibilityAuthorPrefs(const BasicProfile& author, const ContentGroup& group) const;
@@ -173,6 +214,7 @@ private:
 
     ATProto::UserPreferences::ContentLabelPrefs mFollowingPrefs; // labeler DID -> label visibility
     std::unordered_map<QString, ATProto::UserPreferences::ContentLabelPrefs> mListPrefs; // list uri -> prefs
+    mutable std::unordered_map<VisibilityKey, VisibilityDecision, VisibilityKey::Hash> mVisibilityCache;
 };
 
 class ContentFilterShowAll : public IContentFilter
@@ -196,6 +196,62 @@ void ConvoListModel::updateConvo(const ConvoView& convo)
     changeData({ int(Role::Convo) }, index, index);
 }
 
+int ConvoListModel::syncConvos(const ATProto::ChatBskyConvo::ConvoView::List& convos)
+{
+    int changed = 0;
+
+    for (const auto& atConvo : convos)
+    {
+        ConvoView convo(*atConvo, mUserDid);
+        auto it = mConvoIdIndexMap.find(convo.getId());
+
+        if (it == mConvoIdIndexMap.end() || !checkIndex(it->second))
+        {
+            insertConvo(convo);
+            ++changed;
+            continue;
+        }
+
+        const auto& oldConvo = mConvos[it->second];
+
+        if (convo.getRev() == oldConvo.getRev() &&
+            convo.getUnreadCount() == oldConvo.getUnreadCount() &&
+            !hasMembersChanged(oldConvo, convo))
+        {
+            continue;
+        }
+
+        qDebug() << "Sync convo:" << convo.getId() << "rev:" << convo.getRev() << "unread:" << convo.getUnreadCount();
+        const bool wasUnread = oldConvo.getUnreadCount() > 0;
+        const bool isUnread = convo.getUnreadCount() > 0;
+
+        updateConvo(convo);
+        ++changed;
+
+        if (wasUnread != isUnread)
+            setUnreadCount(mUnreadCount + (isUnread ? 1 : -1));
+    }
+
+    return changed;
+}
+
+bool ConvoListModel::hasMembersChanged(const ConvoView& oldConvo, const ConvoView& newConvo)
+{
+    const auto& oldMembers = oldConvo.getMembers();
+    const auto& newMembers = newConvo.getMembers();
+
+    if (oldMembers.size() != newMembers.size())
+        return true;
+
+    for (const auto& member : newMembers)
+    {
+        if (oldConvo.getMember(member.getBasicProfile().getDid()).isNull())
+            return true;
+    }
+
+    return false;
+}
+
 void ConvoListModel::updateBlockingUri(const QString& did, const QString& blockingUri)
 {
     const auto& convoIds = mDidConvoIdMap[did];
@@ -34,6 +34,10 @@ public:
     void addConvos(const ATProto::ChatBskyConvo::ConvoRequestListOutput::RequestList& convoRequests, const QString& cursor);
     void updateConvo(const ATProto::ChatBskyConvo::ConvoView& convo);
     void updateConvo(const ConvoView& convo);
+
+    // Apply changes in read state, members and last message of convos in the model.
+    // New convos are inserted. Returns the number of changed convos.
+    int syncConvos(const ATProto::ChatBskyConvo::ConvoView::List& convos);
     void updateBlockingUri(const QString& did, const QString& blockingUri);
     void insertConvo(const ConvoView& convo);
     void deleteConvo(const QString& convoId);
@@ -64,6 +68,7 @@ protected:
 private:
     void changeData(const QList<int>& roles, int begin = 0, int end = -1);
     bool checkIndex(int index) const;
+    static bool hasMembersChanged(const ConvoView& oldConvo, const ConvoView& newConvo);
     void addConvoToDidMap(const ConvoView& convo);
     void reportActivity(const ConvoView& convo);
     void reportActivity(const MessageView& message, const ConvoView& convo);
@@ -0,0 +1,198 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#include "draft_index.h"
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QTimeZone>
+#include <unordered_set>
+
+namespace Skywalker {
+
+DraftIndex::DraftIndex(const QString& draftsPath) :
+    mDraftsPath(draftsPath)
+{
+    load();
+}
+
+const DraftIndex::Entry* DraftIndex::getEntry(const QString& id) const
+{
+    auto it = std::find_if(mEntries.begin(), mEntries.end(),
+                           [&id](const Entry& entry){ return entry.mId == id; });
+
+    return it != mEntries.end() ? &*it : nullptr;
+}
+
+std::vector<DraftIndex::Entry> DraftIndex::getEntries(int offset, int count) const
+{
+    if (offset < 0 || offset >= (int)mEntries.size())
+        return {};
+
+    const int end = count < 0 ? (int)mEntries.size() : std::min(offset + count, (int)mEntries.size());
+    return std::vector<Entry>(mEntries.begin() + offset, mEntries.begin() + end);
+}
+
+void DraftIndex::putDraft(const Entry& entry)
+{
+    qDebug() << "Put draft in index:" << entry.mId;
+    load();
+    std::erase_if(mEntries, [&entry](const Entry& e){ return e.mId == entry.mId; });
+    mEntries.push_back(entry);
+    sortEntries();
+    save();
+}
+
+void DraftIndex::removeDraft(const QString& id)
+{
+    load();
+
+    if (std::erase_if(mEntries, [&id](const Entry& e){ return e.mId == id; }) == 0)
+        return;
+
+    qDebug() << "Removed draft from index:" << id;
+    save();
+}
+
+void DraftIndex::sync(const QStringList& draftFiles, const CreateEntryCb& createEntryCb)
+{
+    load();
+    const std::unordered_set<QString> fileSet(draftFiles.begin(), draftFiles.end());
+    bool changed = !mExists;
+
+    const auto removed = std::erase_if(mEntries, [&fileSet](const Entry& e){ return !fileSet.contains(e.mId); });
+
+    if (removed > 0)
+    {
+        qDebug() << "Removed missing drafts from index:" << removed;
+        changed = true;
+    }
+
+    for (const auto& file : draftFiles)
+    {
+        if (getEntry(file))
+            continue;
+
+        qDebug() << "Add draft to index:" << file;
+        auto entry = createEntryCb(file);
+
+        if (entry)
+            mEntries.push_back(*entry);
+
+        changed = true;
+    }
+
+    if (changed)
+    {
+        sortEntries();
+        save();
+    }
+}
+
+QString DraftIndex::getFileName() const
+{
+    if (mDraftsPath.isEmpty())
+        return {};
+
+    return QDir(mDraftsPath).filePath("draft_index.json");
+}
+
+void DraftIndex::sortEntries()
+{
+    // Newest first. Draft file names contain the creation time.
+    std::sort(mEntries.begin(), mEntries.end(),
+              [](const Entry& lhs, const Entry& rhs){
+                  if (lhs.mTimestamp != rhs.mTimestamp)
+                      return lhs.mTimestamp > rhs.mTimestamp;
+
+                  return lhs.mId > rhs.mId;
+              });
+}
+
+void DraftIndex::load()
+{
+    mEntries.clear();
+    mExists = false;
+    QFile file(getFileName());
+
+    if (file.fileName().isEmpty() || !file.exists())
+        return;
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qWarning() << "Cannot open file:" << file.fileName();
+        return;
+    }
+
+    const QJsonObject json = QJsonDocument::fromJson(file.readAll()).object();
+    const QJsonArray drafts = json.value("drafts").toArray();
+
+    for (const auto& draftJson : drafts)
+    {
+        const QJsonObject obj = draftJson.toObject();
+        Entry entry;
+        entry.mId = obj.value("id").toString();
+
+        if (entry.mId.isEmpty())
+            continue;
+
+        entry.mTimestamp = QDateTime::fromMSecsSinceEpoch(obj.value("timestamp").toInteger(), QTimeZone::UTC);
+        entry.mPreviewText = obj.value("text").toString();
+        entry.mThumbPath = obj.value("thumb").toString();
+        entry.mThreadLength = std::max(obj.value("threadLength").toInt(1), 1);
+        mEntries.push_back(entry);
+    }
+
+    sortEntries();
+    mExists = true;
+    qDebug() << "Loaded draft index:" << mEntries.size();
+}
+
+void DraftIndex::save()
+{
+    QSaveFile file(getFileName());
+
+    if (file.fileName().isEmpty())
+        return;
+
+    QJsonArray drafts;
+
+    for (const auto& entry : mEntries)
+    {
+        QJsonObject obj;
+        obj.insert("id", entry.mId);
+        obj.insert("timestamp", entry.mTimestamp.toMSecsSinceEpoch());
+        obj.insert("text", entry.mPreviewText);
+
+        if (!entry.mThumbPath.isEmpty())
+            obj.insert("thumb", entry.mThumbPath);
+
+        if (entry.mThreadLength > 1)
+            obj.insert("threadLength", entry.mThreadLength);
+
+        drafts.append(obj);
+    }
+
+    QJsonObject json;
+    json.insert("drafts", drafts);
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning() << "Cannot open file:" << file.fileName();
+        return;
+    }
+
+    file.write(QJsonDocument(json).toJson(QJsonDocument::Compact));
+
+    if (!file.commit())
+    {
+        qWarning() << "Failed to save file:" << file.fileName() << file.errorString();
+        return;
+    }
+
+    mExists = true;
+}
+
+}
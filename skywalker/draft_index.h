@@ -0,0 +1,63 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <QDateTime>
+#include <QString>
+#include <QStringList>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace Skywalker {
+
+// Index of the file drafts of a user. The draft list is built from the index,
+// such that a draft file only needs to be parsed when the user opens the draft.
+//
+// The index is updated when a draft is saved or removed. Draft files that are
+// missing from the index, e.g. drafts saved by an older version, are added
+// when the index gets synced with the draft files.
+class DraftIndex
+{
+public:
+    struct Entry
+    {
+        QString mId; // draft post file name
+        QDateTime mTimestamp;
+        QString mPreviewText;
+        QString mThumbPath; // absolute path, empty if the draft has no image
+        int mThreadLength = 1;
+    };
+
+    using CreateEntryCb = std::function<std::optional<Entry>(const QString& id)>;
+
+    explicit DraftIndex(const QString& draftsPath);
+
+    // False if there is no index stored yet.
+    bool exists() const { return mExists; }
+
+    int size() const { return (int)mEntries.size(); }
+    const Entry* getEntry(const QString& id) const;
+
+    // Returns entries newest first.
+    std::vector<Entry> getEntries(int offset = 0, int count = -1) const;
+
+    void putDraft(const Entry& entry);
+    void removeDraft(const QString& id);
+
+    // Adds entries for draft files that are not in the index and removes
+    // entries for files that do not exist anymore. createEntryCb returns
+    // nullopt if the draft file cannot be read.
+    void sync(const QStringList& draftFiles, const CreateEntryCb& createEntryCb);
+
+private:
+    QString getFileName() const;
+    void sortEntries();
+    void load();
+    void save();
+
+    QString mDraftsPath;
+    bool mExists = false;
+    std::vector<Entry> mEntries; // newest first
+};
+
+}
@@ -0,0 +1,170 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#include "draft_media_manifest.h"
+#include "file_utils.h"
+#include <QDir>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QTimeZone>
+
+namespace Skywalker {
+
+DraftMediaManifest::DraftMediaManifest(const QString& userDid) :
+    mUserDid(userDid)
+{
+    load();
+}
+
+void DraftMediaManifest::addDraft(const QString& draftId, const QString& baseName)
+{
+    qDebug() << "Add draft to media manifest:" << draftId << "baseName:" << baseName;
+    load();
+    mDrafts[draftId] = Entry{ baseName, QDateTime::currentDateTimeUtc() };
+    save();
+}
+
+void DraftMediaManifest::removeDraft(const QString& draftId)
+{
+    load();
+
+    if (mDrafts.erase(draftId) == 0)
+        return;
+
+    qDebug() << "Removed draft from media manifest:" << draftId;
+    save();
+}
+
+std::unordered_set<QString> DraftMediaManifest::getBaseNames() const
+{
+    std::unordered_set<QString> baseNames;
+
+    for (const auto& [_, entry] : mDrafts)
+        baseNames.insert(entry.mBaseName);
+
+    return baseNames;
+}
+
+void DraftMediaManifest::setDrafts(const std::unordered_map<QString, QString>& drafts, const QDateTime& verificationStart)
+{
+    qDebug() << "Set media manifest drafts:" << drafts.size() << "verification start:" << verificationStart;
+    load();
+
+    std::unordered_map<QString, Entry> verifiedDrafts;
+
+    for (const auto& [draftId, baseName] : drafts)
+    {
+        auto it = mDrafts.find(draftId);
+        const QDateTime added = it != mDrafts.end() ? it->second.mAdded : verificationStart;
+        verifiedDrafts[draftId] = Entry{ baseName, added };
+    }
+
+    for (const auto& [draftId, entry] : mDrafts)
+    {
+        if (!verifiedDrafts.contains(draftId) && entry.mAdded.isValid() && entry.mAdded >= verificationStart)
+        {
+            qDebug() << "Keep draft added during verification:" << draftId;
+            verifiedDrafts[draftId] = entry;
+        }
+    }
+
+    mDrafts = std::move(verifiedDrafts);
+    mLastVerification = QDateTime::currentDateTimeUtc();
+    save();
+}
+
+QString DraftMediaManifest::getFileName() const
+{
+    const QString path = FileUtils::getAppDataPath(mUserDid);
+
+    if (path.isEmpty())
+    {
+        qWarning() << "No path for draft media manifest:" << mUserDid;
+        return {};
+    }
+
+    return QDir(path).filePath("draft_media_manifest.json");
+}
+
+void DraftMediaManifest::load()
+{
+    mDrafts.clear();
+    mLastVerification = {};
+    mExists = false;
+    QFile file(getFileName());
+
+    if (file.fileName().isEmpty() || !file.exists())
+        return;
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qWarning() << "Cannot open file:" << file.fileName();
+        return;
+    }
+
+    const QJsonObject json = QJsonDocument::fromJson(file.readAll()).object();
+    const QJsonObject drafts = json.value("drafts").toObject();
+
+    for (auto it = drafts.begin(); it != drafts.end(); ++it)
+    {
+        const QJsonObject entry = it.value().toObject();
+        QDateTime added;
+
+        if (entry.contains("added"))
+            added = QDateTime::fromMSecsSinceEpoch(entry.value("added").toInteger(), QTimeZone::UTC);
+
+        mDrafts[it.key()] = Entry{ entry.value("baseName").toString(), added };
+    }
+
+    if (json.contains("lastVerification"))
+        mLastVerification = QDateTime::fromSecsSinceEpoch(json.value("lastVerification").toInteger(), QTimeZone::UTC);
+
+    mExists = true;
+    qDebug() << "Loaded draft media manifest:" << mDrafts.size() << "last verification:" << mLastVerification;
+}
+
+void DraftMediaManifest::save()
+{
+    QSaveFile file(getFileName());
+
+    if (file.fileName().isEmpty())
+        return;
+
+    QJsonObject drafts;
+
+    for (const auto& [draftId, entry] : mDrafts)
+    {
+        QJsonObject jsonEntry;
+        jsonEntry.insert("baseName", entry.mBaseName);
+
+        if (entry.mAdded.isValid())
+            jsonEntry.insert("added", entry.mAdded.toMSecsSinceEpoch());
+
+        drafts.insert(draftId, jsonEntry);
+    }
+
+    QJsonObject json;
+    json.insert("drafts", drafts);
+
+    if (mLastVerification.isValid())
+        json.insert("lastVerification", mLastVerification.toSecsSinceEpoch());
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning() << "Cannot open file:" << file.fileName();
+        return;
+    }
+
+    file.write(QJsonDocument(json).toJson(QJsonDocument::Compact));
+
+    if (!file.commit())
+    {
+        qWarning() << "Failed to save file:" << file.fileName() << file.errorString();
+        return;
+    }
+
+    mExists = true;
+}
+
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <QDateTime>
+#include <QString>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Skywalker {
+
+// Keeps track of which Bluesky drafts of a user have media files stored
+// locally. The media file names of a draft contain the base name of the
+// draft. The manifest maps draft IDs to these base names.
+//
+// The manifest is updated when a draft is saved or deleted on this device.
+// Drafts deleted by other devices are only noticed by a full verification
+// against Bluesky.
+//
+// Multiple instances may exist at the same time, e.g. one in the orphaned
+// media checker and a temporary one when a draft gets saved. Each change
+// reloads the manifest from disk before saving it.
+class DraftMediaManifest
+{
+public:
+    explicit DraftMediaManifest(const QString& userDid);
+
+    // False if there is no manifest stored yet.
+    bool exists() const { return mExists; }
+
+    void addDraft(const QString& draftId, const QString& baseName);
+    void removeDraft(const QString& draftId);
+    std::unordered_set<QString> getBaseNames() const;
+
+    // Replace all drafts after a full verification that started at
+    // verificationStart. Drafts added after that are kept, as the verification
+    // may not have seen them.
+    void setDrafts(const std::unordered_map<QString, QString>& drafts, const QDateTime& verificationStart);
+    const QDateTime& getLastVerification() const { return mLastVerification; }
+
+private:
+    struct Entry
+    {
+        QString mBaseName;
+        QDateTime mAdded;
+    };
+
+    QString getFileName() const;
+    void load();
+    void save();
+
+    QString mUserDid;
+    bool mExists = false;
+    std::unordered_map<QString, Entry> mDrafts; // draft ID -> entry
+    QDateTime mLastVerification;
+};
+
+}
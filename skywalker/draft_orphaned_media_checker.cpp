@@ -6,9 +6,23 @@
 
 namespace Skywalker {
 
+using namespace std::chrono_literals;
+
+// Interval for verifying the media files against the drafts on Bluesky.
+static constexpr auto FULL_VERIFICATION_INTERVAL = 7 * 24h;
+
+// Delay between fetching draft pages during a full verification, such that
+// the verification does not compete with loading the timeline.
+static constexpr auto PAGE_DELAY = 1s;
+
+// A recent media file that is not in the manifest or on Bluesky may belong to
+// a draft that is being saved.
+static constexpr auto MIN_ORPHAN_AGE = 1h;
+
 DraftOrphanedMediaChecker::DraftOrphanedMediaChecker(const QString& userDid, ATProto::Client::SharedPtr& bsky) :
     mUserDid(userDid),
-    mBsky(bsky)
+    mBsky(bsky),
+    mManifest(userDid)
 {
     qDebug() << "Created draft orphaned media checker:" << mUserDid;
 }
@@ -21,11 +35,6 @@ DraftOrphanedMediaChecker::~DraftOrphanedMediaChecker()
 void DraftOrphanedMediaChecker::start(const std::function<void()>& finishedCb)
 {
     qDebug() << "Start draft orphaned media check:" << mUserDid;
-    Q_ASSERT(mBsky);
-
-    if (!mBsky)
-        return;
-
     const QStringList fileNames = getMediaFileNames();
 
     if (fileNames.empty())
@@ -39,11 +48,63 @@ void DraftOrphanedMediaChecker::start(const std::function<void()>& finishedCb)
     }
 
     qDebug() << "Media files:" << fileNames.size() << "names:" << fileNames;
-    mFileNamesToCheck.insert(fileNames.begin(), fileNames.end());
     mFinishedCb = finishedCb;
+
+    if (!needsFullVerification())
+    {
+        checkManifest(fileNames);
+        QTimer::singleShot(0, [this, presence=getPresence()]{
+            if (presence)
+                callFinishCb();
+        });
+
+        return;
+    }
+
+    mFileNamesToCheck.insert(fileNames.begin(), fileNames.end());
+    mVerifiedDrafts.clear();
+    mVerificationStart = QDateTime::currentDateTimeUtc();
     checkMediaFiles();
 }
 
+bool DraftOrphanedMediaChecker::needsFullVerification() const
+{
+    if (!mManifest.exists())
+    {
+        qDebug() << "No draft media manifest";
+        return true;
+    }
+
+    const QDateTime& lastVerification = mManifest.getLastVerification();
+
+    if (!lastVerification.isValid())
+        return true;
+
+    return QDateTime::currentDateTimeUtc() - lastVerification > FULL_VERIFICATION_INTERVAL;
+}
+
+void DraftOrphanedMediaChecker::checkManifest(const QStringList& fileNames)
+{
+    qDebug() << "Check media files against manifest";
+    const QString mediaPath = getPictureDraftsPath();
+
+    if (mediaPath.isEmpty())
+        return;
+
+    const auto baseNames = mManifest.getBaseNames();
+
+    for (const auto& fileName : fileNames)
+    {
+        if (!baseNames.contains(getBaseName(fileName)))
+            mFileNamesToCheck.insert(fileName);
+    }
+
+    if (!mFileNamesToCheck.empty())
+        cleanupOrphans();
+    else
+        qDebug() << "No orphaned media files.";
+}
+
 void DraftOrphanedMediaChecker::checkMediaFiles(int maxPages, const QString& cursor)
 {
     qDebug() << "Check media files, maxPages:" << maxPages << "cursor:" << cursor;
@@ -55,7 +116,7 @@ void DraftOrphanedMediaChecker::checkMediaFiles(int maxPages, const QString& cur
         return;
     }
 
-    mBsky->getDrafts(25, Utils::makeOptionalString(cursor),
+    getDrafts(cursor,
         [this, presence=getPresence(), maxPages](ATProto::AppBskyDraft::GetDraftsOutput::SharedPtr output){
             if (!presence)
                 return;
@@ -65,17 +126,23 @@ void DraftOrphanedMediaChecker::checkMediaFiles(int maxPages, const QString& cur
             if (mFileNamesToCheck.empty())
             {
                 qDebug() << "No orphaned media files.";
+                mManifest.setDrafts(mVerifiedDrafts, mVerificationStart);
                 callFinishCb();
                 return;
             }
 
             if (output->mCursor && !output->mCursor->isEmpty())
             {
-                checkMediaFiles(maxPages - 1, *output->mCursor);
+                const QString nextCursor = *output->mCursor;
+                QTimer::singleShot(PAGE_DELAY, [this, presence=getPresence(), maxPages, nextCursor]{
+                    if (presence)
+                        checkMediaFiles(maxPages - 1, nextCursor);
+                });
             }
             else
             {
                 cleanupOrphans();
+                mManifest.setDrafts(mVerifiedDrafts, mVerificationStart);
                 callFinishCb();
             }
         },
@@ -89,6 +156,20 @@ void DraftOrphanedMediaChecker::checkMediaFiles(int maxPages, const QString& cur
         });
 }
 
+void DraftOrphanedMediaChecker::getDrafts(const QString& cursor, const GetDraftsSuccessCb& successCb,
+                                          const ATProto::Client::ErrorCb& errorCb)
+{
+    Q_ASSERT(mBsky);
+
+    if (!mBsky)
+    {
+        errorCb("NoClient", "No Bluesky client");
+        return;
+    }
+
+    mBsky->getDrafts(25, Utils::makeOptionalString(cursor), successCb, errorCb);
+}
+
 void DraftOrphanedMediaChecker::updateMediaFiles(const ATProto::AppBskyDraft::DraftView::List& drafts)
 {
     const QString mediaPath = getPictureDraftsPath();
@@ -103,7 +184,7 @@ void DraftOrphanedMediaChecker::updateMediaFiles(const ATProto::AppBskyDraft::Dr
     {
         for (const auto& draftPost : draft->mDraft->mPosts)
         {
-            updateMediaFiles(draftPost);
+            updateMediaFiles(draft->mId, draftPost);
 
             if (mFileNamesToCheck.empty())
                 return;
@@ -111,20 +192,24 @@ void DraftOrphanedMediaChecker::updateMediaFiles(const ATProto::AppBskyDraft::Dr
     }
 }
 
-void DraftOrphanedMediaChecker::updateMediaFiles(const ATProto::AppBskyDraft::DraftPost::SharedPtr& draftPost)
+void DraftOrphanedMediaChecker::updateMediaFiles(const QString& draftId, const ATProto::AppBskyDraft::DraftPost::SharedPtr& draftPost)
 {
     for (const auto& embedImage : draftPost->mEmbedImages)
     {
         const QString fileName = embedImage->mLocalRef->mPath;
         qDebug() << "Found file:" << fileName;
-        mFileNamesToCheck.erase(fileName);
+
+        if (mFileNamesToCheck.erase(fileName))
+            mVerifiedDrafts[draftId] = getBaseName(fileName);
     }
 
     for (const auto& embedVideo : draftPost->mEmbedVideos)
     {
         const QString fileName = embedVideo->mLocalRef->mPath;
         qDebug() << "Found file:" << fileName;
-        mFileNamesToCheck.erase(fileName);
+
+        if (mFileNamesToCheck.erase(fileName))
+            mVerifiedDrafts[draftId] = getBaseName(fileName);
     }
 
     qDebug() << "File names left:" << mFileNamesToCheck.size();
@@ -149,6 +234,18 @@ QStringList DraftOrphanedMediaChecker::getMediaFileNames() const
     return mediaFileNames;
 }
 
+QString DraftOrphanedMediaChecker::getBaseName(const QString& mediaFileName)
+{
+    // Example: SWI1_20251226131809-0.jpg -> 20251226131809
+    const QString base = QFileInfo(mediaFileName).baseName();
+    const auto parts = base.split('_');
+
+    if (parts.size() != 2)
+        return {};
+
+    return parts[1].section('-', 0, 0);
+}
+
 void DraftOrphanedMediaChecker::cleanupOrphans()
 {
     qDebug() << "Cleanup orphans:" << mFileNamesToCheck;
@@ -159,9 +256,18 @@ void DraftOrphanedMediaChecker::cleanupOrphans()
         return;
 
     QDir dir(mediaPath);
+    const QDateTime now = QDateTime::currentDateTimeUtc();
 
     for (const auto& fileName : mFileNamesToCheck)
     {
+        const QFileInfo fileInfo(dir.filePath(fileName));
+
+        if (now - fileInfo.lastModified().toUTC() < MIN_ORPHAN_AGE)
+        {
+            qDebug() << "Keep recent media file:" << fileName;
+            continue;
+        }
+
         if (dir.remove(fileName))
             qDebug() << "Removed orphaned media file:" << fileName << "in dir:" << mediaPath;
         else
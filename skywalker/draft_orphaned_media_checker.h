@@ -2,6 +2,7 @@
 // License: GPLv3
 #pragma once
 
+#include "draft_media_manifest.h"
 #include "presence.h"
 #include <atproto/lib/client.h>
 
@@ -11,27 +12,44 @@ namespace Skywalker {
 // If a draft created on device A gets deleted by device B, then the media files
 // still exists on device A. This checker cross checks the draft media files
 // against Bluesky drafts. Orphaned files will be deleted.
+//
+// Normally the media files are only checked against the local media manifest.
+// Once in a while a full verification against the Bluesky drafts is done to
+// find drafts deleted by other devices. That also rebuilds the manifest.
 class DraftOrphanedMediaChecker : public Presence
 {
 public:
+    using GetDraftsSuccessCb = std::function<void(ATProto::AppBskyDraft::GetDraftsOutput::SharedPtr)>;
+
     explicit DraftOrphanedMediaChecker(const QString& userDid, ATProto::Client::SharedPtr& bsky);
-    ~DraftOrphanedMediaChecker();
+    virtual ~DraftOrphanedMediaChecker();
 
     void start(const std::function<void()>& finishedCb);
 
+protected:
+    // Virtual for testing.
+    virtual void getDrafts(const QString& cursor, const GetDraftsSuccessCb& successCb,
+                           const ATProto::Client::ErrorCb& errorCb);
+
 private:
+    bool needsFullVerification() const;
+    void checkManifest(const QStringList& fileNames);
     void checkMediaFiles(int maxPages = 100, const QString& cursor = {});
     void updateMediaFiles(const ATProto::AppBskyDraft::DraftView::List& drafts);
-    void updateMediaFiles(const ATProto::AppBskyDraft::DraftPost::SharedPtr& draftPost);
+    void updateMediaFiles(const QString& draftId, const ATProto::AppBskyDraft::DraftPost::SharedPtr& draftPost);
     void cleanupOrphans();
     void callFinishCb();
 
     QString getPictureDraftsPath() const;
     QStringList getMediaFileNames() const;
+    static QString getBaseName(const QString& mediaFileName);
 
     QString mUserDid;
     ATProto::Client::SharedPtr& mBsky;
+    DraftMediaManifest mManifest;
     std::unordered_set<QString> mFileNamesToCheck;
+    std::unordered_map<QString, QString> mVerifiedDrafts; // draft ID -> base name
+    QDateTime mVerificationStart;
     std::function<void()> mFinishedCb;
 };
 
@@ -3,6 +3,7 @@
 #include "draft_posts.h"
 #include "draft_posts_model.h"
 #include "content_filter.h"
+#include "draft_media_manifest.h"
 #include "file_utils.h"
 #include "gif_utils.h"
 #include "image_utils.h"
@@ -54,7 +55,11 @@ bool DraftPosts::canSaveDraft() const
     switch (mStorageType)
     {
     case STORAGE_FILE:
-        return mDraftPostsModel->rowCount() < MAX_DRAFTS;
+    {
+        // The model may not have all drafts loaded.
+        const QString draftsPath = getDraftsPath();
+        return !draftsPath.isEmpty() && getDraftPostFiles(draftsPath).size() < MAX_DRAFTS;
+    }
     case STORAGE_BLUESKY:
         return true;
     }
@@ -225,6 +230,8 @@ bool DraftPosts::saveFileDraftPost(const DraftPostData* draftPost, const QList<D
         return false;
     }
 
+    const QString fileName = createDraftPostFileName(dateTime);
+    DraftIndex(draftsPath).putDraft(createDraftIndexEntry(fileName, *draft));
     return true;
 }
 
@@ -287,7 +294,7 @@ ATProto::AppBskyFeed::Record::Post::SharedPtr DraftPosts::createPost(const Draft
 
 void DraftPosts::loadDraftPosts()
 {
-    switch(mStorageType)
+    switch (mStorageType)
     {
     case STORAGE_FILE:
         loadDraftFeed();
@@ -300,8 +307,15 @@ void DraftPosts::loadDraftPosts()
 
 void DraftPosts::loadDraftPostsNextPage()
 {
-    if (mStorageType == STORAGE_BLUESKY)
+    switch (mStorageType)
+    {
+    case STORAGE_FILE:
+        loadDraftFeedNextPage();
+        break;
+    case STORAGE_BLUESKY:
         loadBlueskyDraftsNextPage();
+        break;
+    }
 }
 
 DraftPostsModel* DraftPosts::getDraftPostsModel()
@@ -553,7 +567,8 @@ QList<DraftPostData*> DraftPosts::getDraftPostData(int index)
     }
 
     QList<DraftPostData*> draftPostData;
-    const std::vector<Post>& thread = mDraftPostsModel->getThread(index);
+    const std::vector<Post> thread = mStorageType == STORAGE_FILE ?
+            loadDraftThread(index) : mDraftPostsModel->getThread(index);
 
     for (const auto& post : thread)
     {
@@ -587,7 +602,7 @@ void DraftPosts::removeDraftPost(int index)
     if (rkey.isEmpty())
         return;
 
-    switch(mStorageType)
+    switch (mStorageType)
     {
     case STORAGE_FILE:
     {
@@ -1582,7 +1597,7 @@ ATProto::AppBskyEmbed::ImagesView::SharedPtr DraftPosts::createImagesView(const
         if (QFile::exists(path))
         {
             const QString imgSource = "file://" + path;
-            const auto aspectRatio = ImageUtils::getImageAspectRatio(path);
+            const auto aspectRatio = getDraftImageAspectRatio(path);
             auto imgView = createImageView(image->mJson, imgSource, image->mAlt.value_or(""), aspectRatio);
             view->mImages.push_back(std::move(imgView));
         }
@@ -1622,7 +1637,7 @@ ATProto::AppBskyEmbed::GalleryView::SharedPtr DraftPosts::createGalleryView(cons
         if (QFile::exists(path))
         {
             const QString imgSource = "file://" + path;
-            const auto aspectRatio = ImageUtils::getImageAspectRatio(path);
+            const auto aspectRatio = getDraftImageAspectRatio(path);
             auto imgView = createGalleryViewImage((*image)->mJson, imgSource, (*image)->mAlt.value_or(""), aspectRatio);
             view->mItems.push_back(std::move(imgView));
         }
@@ -1775,38 +1790,176 @@ void DraftPosts::loadDraftFeed()
         return;
 
     getDraftPostsModel();
+    DraftIndex draftIndex(draftsPath);
+    draftIndex.sync(getDraftPostFiles(draftsPath),
+        [this, draftsPath](const QString& fileName){
+            return readDraftIndexEntry(fileName, draftsPath);
+        });
 
-    const auto fileList = getDraftPostFiles(draftsPath);
-    std::vector<ATProto::AppBskyFeed::PostFeed> postThreads;
+    mDraftEntries = draftIndex.getEntries();
+    mNextDraftEntryIndex = 0;
+    qDebug() << "Draft entries:" << mDraftEntries.size();
 
-    for (const auto& file : fileList)
-    {
-        auto draft = loadDraft(file, draftsPath);
+    std::vector<int> threadLengths;
+    auto postThreads = loadDraftFeedPage(threadLengths);
+    const QString cursor = mNextDraftEntryIndex < (int)mDraftEntries.size() ? QString::number(mNextDraftEntryIndex) : "";
+    mDraftPostsModel->setFeed(std::move(postThreads), cursor, std::move(threadLengths));
+    emit draftsChanged();
+    emit loadDraftPostsOk();
+}
 
-        if (draft)
-        {
-            try {
-                auto postFeed = convertDraftToFeedViewPost(*draft, getDraftUri(file));
-                postThreads.push_back(std::move(postFeed));
-            } catch (ATProto::InvalidJsonException& e) {
-                qWarning() << "Draft format error:" << e.msg();
-            }
-        }
-        else
-        {
-            dropDraftPostFiles(draftsPath, file);
-            const QString picDraftsPath = getPictureDraftsPath();
+void DraftPosts::loadDraftFeedNextPage()
+{
+    Q_ASSERT(mStorageType == STORAGE_FILE);
 
-            if (!picDraftsPath.isEmpty())
-                dropDraftPostFiles(picDraftsPath, file);
-        }
+    if (!mDraftPostsModel || mDraftPostsModel->getCursor().isEmpty())
+    {
+        qDebug() << "End of feed";
+        return;
     }
 
-    mDraftPostsModel->setFeed(std::move(postThreads), {});
+    std::vector<int> threadLengths;
+    auto postThreads = loadDraftFeedPage(threadLengths);
+    const QString cursor = mNextDraftEntryIndex < (int)mDraftEntries.size() ? QString::number(mNextDraftEntryIndex) : "";
+    mDraftPostsModel->addFeed(std::move(postThreads), cursor, std::move(threadLengths));
     emit draftsChanged();
     emit loadDraftPostsOk();
 }
 
+std::vector<ATProto::AppBskyFeed::PostFeed> DraftPosts::loadDraftFeedPage(std::vector<int>& threadLengths)
+{
+    Q_ASSERT(mStorageType == STORAGE_FILE);
+    std::vector<ATProto::AppBskyFeed::PostFeed> postThreads;
+
+    while (mNextDraftEntryIndex < (int)mDraftEntries.size() && (int)postThreads.size() < DRAFT_PAGE_SIZE)
+    {
+        const auto& entry = mDraftEntries[mNextDraftEntryIndex++];
+        postThreads.push_back(convertDraftIndexEntryToFeedViewPost(entry));
+        threadLengths.push_back(entry.mThreadLength);
+    }
+
+    qDebug() << "Loaded drafts:" << postThreads.size() << "next:" << mNextDraftEntryIndex;
+    return postThreads;
+}
+
+std::vector<Post> DraftPosts::loadDraftThread(int index)
+{
+    Q_ASSERT(mStorageType == STORAGE_FILE);
+    const QString draftsPath = getDraftsPath();
+
+    if (draftsPath.isEmpty())
+        return {};
+
+    const Post& post = mDraftPostsModel->getPost(index);
+    const QString fileName = getRefFromDraftUri(post.getUri());
+
+    if (fileName.isEmpty())
+        return {};
+
+    auto draft = loadDraft(fileName, draftsPath);
+
+    if (!draft)
+        return {};
+
+    std::vector<Post> thread;
+
+    try {
+        const auto postFeed = convertDraftToFeedViewPost(*draft, getDraftUri(fileName));
+
+        for (const auto& feedViewPost : postFeed)
+            thread.push_back(Post(feedViewPost));
+    } catch (ATProto::InvalidJsonException& e) {
+        qWarning() << "Draft format error:" << e.msg();
+        return {};
+    }
+
+    return thread;
+}
+
+std::optional<DraftIndex::Entry> DraftPosts::readDraftIndexEntry(const QString& fileName, const QString& draftsPath)
+{
+    auto draft = loadDraft(fileName, draftsPath);
+
+    if (!draft)
+    {
+        dropDraftPostFiles(draftsPath, fileName);
+        const QString picDraftsPath = getPictureDraftsPath();
+
+        if (!picDraftsPath.isEmpty())
+            dropDraftPostFiles(picDraftsPath, fileName);
+
+        return {};
+    }
+
+    return createDraftIndexEntry(fileName, *draft);
+}
+
+DraftIndex::Entry DraftPosts::createDraftIndexEntry(const QString& fileName, const Draft::Draft& draft) const
+{
+    DraftIndex::Entry entry;
+    entry.mId = fileName;
+    entry.mThreadLength = 1 + (int)draft.mThreadPosts.size();
+
+    if (!draft.mPost)
+        return entry;
+
+    entry.mTimestamp = draft.mPost->mCreatedAt;
+    entry.mPreviewText = draft.mPost->mText;
+    const auto& embed = draft.mPost->mEmbed;
+    QString thumbRef;
+
+    if (!embed)
+        return entry;
+
+    if (ATProto::holdsNonNull<ATProto::AppBskyEmbed::Images::SharedPtr>(*embed))
+    {
+        const auto& images = std::get<ATProto::AppBskyEmbed::Images::SharedPtr>(*embed)->mImages;
+
+        if (!images.empty())
+            thumbRef = images.front()->mImage->mRefLink;
+    }
+    else if (ATProto::holdsNonNull<ATProto::AppBskyEmbed::Gallery::SharedPtr>(*embed))
+    {
+        const auto& items = std::get<ATProto::AppBskyEmbed::Gallery::SharedPtr>(*embed)->mItems;
+        const auto* image = items.empty() ? nullptr : std::get_if<ATProto::AppBskyEmbed::GalleryImage::SharedPtr>(&items.front());
+
+        if (image)
+            thumbRef = (*image)->mImage->mRefLink;
+    }
+
+    const QString picDraftsPath = thumbRef.isEmpty() ? "" : getPictureDraftsPath();
+
+    if (!picDraftsPath.isEmpty())
+        entry.mThumbPath = createAbsPath(picDraftsPath, thumbRef);
+
+    return entry;
+}
+
+ATProto::AppBskyFeed::PostFeed DraftPosts::convertDraftIndexEntryToFeedViewPost(const DraftIndex::Entry& entry)
+{
+    const QString recordUri = getDraftUri(entry.mId);
+    auto postRecord = std::make_shared<ATProto::AppBskyFeed::Record::Post>();
+    postRecord->mText = entry.mPreviewText;
+    postRecord->mCreatedAt = entry.mTimestamp;
+
+    auto postView = std::make_shared<ATProto::AppBskyFeed::PostView>();
+    postView->mUri = recordUri;
+    postView->mAuthor = createProfileViewBasic(mSkywalker->getUser());
+    postView->mIndexedAt = entry.mTimestamp;
+    postView->mRecord = postRecord;
+
+    if (!entry.mThumbPath.isEmpty())
+    {
+        auto imagesView = std::make_shared<ATProto::AppBskyEmbed::ImagesView>();
+        imagesView->mImages.push_back(createImageView({}, "file://" + entry.mThumbPath, "", nullptr));
+        postView->mEmbed = imagesView;
+    }
+
+    auto feedView = std::make_shared<ATProto::AppBskyFeed::FeedViewPost>();
+    feedView->mPost = postView;
+    return { feedView };
+}
+
 QStringList DraftPosts::getDraftPostFiles(const QString& draftsPath) const
 {
     Q_ASSERT(mStorageType == STORAGE_FILE);
@@ -2113,7 +2266,10 @@ void DraftPosts::dropDraftPost(const QString& fileName)
     Q_ASSERT(mStorageType == STORAGE_FILE);
     const QString draftsPath = getDraftsPath();
     if (!draftsPath.isEmpty())
+    {
         dropDraftPostFiles(draftsPath, fileName);
+        DraftIndex(draftsPath).removeDraft(fileName);
+    }
 
     const QString picsPath = getPictureDraftsPath();
     if (!picsPath.isEmpty())
@@ -2137,31 +2293,31 @@ void DraftPosts::loadBlueskyDrafts(const QString& cursor)
 
     mDraftPostsModel->setGetFeedInProgress(true);
 
+    if (cursor.isEmpty())
+        mImageSizes.clear();
+
     bskyClient()->getDrafts({}, Utils::makeOptionalString(cursor),
         [this, presence=getPresence()](ATProto::AppBskyDraft::GetDraftsOutput::SharedPtr output){
             if (!presence)
                 return;
 
-            mDraftPostsModel->setGetFeedInProgress(false);
-            std::vector<ATProto::AppBskyFeed::PostFeed> postThreads;
+            // Reading the image sizes from storage is too slow for the GUI thread.
+            const QStringList paths = getDraftImagePaths(*output);
 
-            for (const auto& draftView : output->mDrafts)
-            {
-                // NOTE: we store the draft ID as rkey in the post URI
-
-                try {
-                    const QString& recordUri = getDraftUri(draftView->mId);
-                    auto postFeed = convertDraftToFeedViewPost(*draftView, recordUri);
-                    postThreads.push_back(std::move(postFeed));
-                } catch (ATProto::InvalidJsonException& e) {
-                    qWarning() << "Draft format error:" << e.msg();
-                    qWarning() << draftView->mDraft->mJson;
-                }
-            }
+            mImageWorker.run<std::unordered_map<QString, QSize>>(
+                [paths]{
+                    std::unordered_map<QString, QSize> sizes;
+
+                    for (const auto& path : paths)
+                        sizes[path] = ImageUtils::getImageSize(path);
 
-            mDraftPostsModel->setFeed(std::move(postThreads), output->mCursor.value_or(""));
-            emit draftsChanged();
-            emit loadDraftPostsOk();
+                    return sizes;
+                },
+                [this, output](std::unordered_map<QString, QSize> sizes){
+                    mImageSizes.merge(sizes);
+                    mDraftPostsModel->setGetFeedInProgress(false);
+                    setBlueskyDrafts(*output);
+                });
         },
         [this, presence=getPresence()](const QString& error, const QString& msg) {
             if (!presence)
@@ -2173,6 +2329,71 @@ void DraftPosts::loadBlueskyDrafts(const QString& cursor)
         });
 }
 
+QStringList DraftPosts::getDraftImagePaths(const ATProto::AppBskyDraft::GetDraftsOutput& output) const
+{
+    const auto draftsPath = getPictureDraftsPath();
+
+    if (draftsPath.isEmpty())
+        return {};
+
+    QStringList paths;
+
+    for (const auto& draftView : output.mDrafts)
+    {
+        for (const auto& draftPost : draftView->mDraft->mPosts)
+        {
+            for (const auto& image : draftPost->mEmbedImages)
+                paths.push_back(createAbsPath(draftsPath, image->mLocalRef->mPath));
+
+            if (!draftPost->mEmbedGallery)
+                continue;
+
+            for (const auto& item : draftPost->mEmbedGallery->mItems)
+            {
+                const auto* image = std::get_if<ATProto::AppBskyDraft::DraftEmbedImage::SharedPtr>(&item);
+
+                if (image)
+                    paths.push_back(createAbsPath(draftsPath, (*image)->mLocalRef->mPath));
+            }
+        }
+    }
+
+    return paths;
+}
+
+void DraftPosts::setBlueskyDrafts(const ATProto::AppBskyDraft::GetDraftsOutput& output)
+{
+    std::vector<ATProto::AppBskyFeed::PostFeed> postThreads;
+
+    for (const auto& draftView : output.mDrafts)
+    {
+        // NOTE: we store the draft ID as rkey in the post URI
+
+        try {
+            const QString& recordUri = getDraftUri(draftView->mId);
+            auto postFeed = convertDraftToFeedViewPost(*draftView, recordUri);
+            postThreads.push_back(std::move(postFeed));
+        } catch (ATProto::InvalidJsonException& e) {
+            qWarning() << "Draft format error:" << e.msg();
+            qWarning() << draftView->mDraft->mJson;
+        }
+    }
+
+    mDraftPostsModel->setFeed(std::move(postThreads), output.mCursor.value_or(""));
+    emit draftsChanged();
+    emit loadDraftPostsOk();
+}
+
+ATProto::AppBskyEmbed::AspectRatio::SharedPtr DraftPosts::getDraftImageAspectRatio(const QString& path) const
+{
+    auto it = mImageSizes.find(path);
+
+    if (it != mImageSizes.end())
+        return ImageUtils::makeAspectRatio(it->second);
+
+    return ImageUtils::getImageAspectRatio(path);
+}
+
 void DraftPosts::loadBlueskyDraftsNextPage()
 {
     if (!mDraftPostsModel)
@@ -2207,11 +2428,12 @@ bool DraftPosts::saveBlueskyDraftPost(const DraftPostData* draftPost, const QLis
     }
 
     bskyClient()->createDraft(draft,
-        [this, presence=getPresence()](ATProto::AppBskyDraft::CreateDraftOutput::SharedPtr output){
+        [this, presence=getPresence(), dateTime](ATProto::AppBskyDraft::CreateDraftOutput::SharedPtr output){
             if (!presence)
                 return;
 
             qDebug() << "Saved draft:" << output->mId;
+            DraftMediaManifest(mSkywalker->getUserDid()).addDraft(output->mId, dateTime);
             emit saveDraftPostOk();
         },
         [this, presence=getPresence(), draftPost, draftThread, dateTime](const QString& error, const QString& msg) {
@@ -2603,9 +2825,10 @@ void DraftPosts::deleteBlueskyDraft(const QString& draftId, int index)
     getDraftPostsModel();
 
     bskyClient()->deleteDraft(draftId,
-        [this, presence=getPresence(), index]{
+        [this, presence=getPresence(), draftId, index]{
             if (presence)
             {
+                DraftMediaManifest(mSkywalker->getUserDid()).removeDraft(draftId);
                 deleteMediaFiles(index);
                 mDraftPostsModel->deleteDraft(index);
             }
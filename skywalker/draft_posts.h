@@ -1,8 +1,10 @@
 // Copyright (C) 2024 Michel de Boer
 // License: GPLv3
 #pragma once
+#include "draft_index.h"
 #include "draft_post_data.h"
 #include "generator_view.h"
+#include "image_worker.h"
 #include "link_card.h"
 #include "list_view.h"
 #include "post.h"
@@ -40,6 +42,7 @@ public:
     Q_ENUM(StorageType)
 
     static constexpr int MAX_DRAFTS = 100;
+    static constexpr int DRAFT_PAGE_SIZE = 20;
 
     static QString getPictureDraftsPath(StorageType storageType, const QString& did);
     static void setReplyRestrictions(DraftPostData* data, const Post& post);
@@ -176,8 +179,14 @@ private:
 
     // FILE STORAGE
     void loadDraftFeed();
+    void loadDraftFeedNextPage();
+    std::vector<ATProto::AppBskyFeed::PostFeed> loadDraftFeedPage(std::vector<int>& threadLengths);
     QStringList getDraftPostFiles(const QString& draftsPath) const;
     Draft::Draft::SharedPtr loadDraft(const QString& fileName, const QString& draftsPath) const;
+    std::vector<Post> loadDraftThread(int index);
+    std::optional<DraftIndex::Entry> readDraftIndexEntry(const QString& fileName, const QString& draftsPath);
+    DraftIndex::Entry createDraftIndexEntry(const QString& fileName, const Draft::Draft& draft) const;
+    ATProto::AppBskyFeed::PostFeed convertDraftIndexEntryToFeedViewPost(const DraftIndex::Entry& entry);
     bool saveFileDraftPost(const DraftPostData* draftPost, const QList<DraftPostData*>& draftThread);
     bool save(const Draft::Draft& draft, const QString& draftsPath, const QString& baseName);
     bool addImagesToPost(ATProto::AppBskyFeed::Record::Post& post,
@@ -201,6 +210,9 @@ private:
     // BLUESKY STORAGE
     void loadBlueskyDrafts(const QString& cursor = {});
     void loadBlueskyDraftsNextPage();
+    QStringList getDraftImagePaths(const ATProto::AppBskyDraft::GetDraftsOutput& output) const;
+    void setBlueskyDrafts(const ATProto::AppBskyDraft::GetDraftsOutput& output);
+    ATProto::AppBskyEmbed::AspectRatio::SharedPtr getDraftImageAspectRatio(const QString& path) const;
     bool saveBlueskyDraftPost(const DraftPostData* draftPost, const QList<DraftPostData*>& draftThread);
     ATProto::AppBskyDraft::Draft::SharedPtr createBlueskyDraft(const DraftPostData* draftPost, const QList<DraftPostData*>& draftThread, const QString& baseName);
     ATProto::AppBskyDraft::DraftPost::SharedPtr createBlueskyDraftPost(const DraftPostData* draftPost, const QString& baseName, int threadIndex);
@@ -225,6 +237,16 @@ private:
 
     std::unique_ptr<DraftPostsModel> mDraftPostsModel;
     StorageType mStorageType = STORAGE_FILE;
+
+    // Draft index entries, newest first, at the last load of the draft feed.
+    // The draft list shows a page of entries at a time.
+    std::vector<DraftIndex::Entry> mDraftEntries;
+    int mNextDraftEntryIndex = 0;
+
+    // Sizes of the Bluesky draft images, read on a worker thread when a page
+    // of drafts is loaded.
+    std::unordered_map<QString, QSize> mImageSizes;
+    ImageWorker mImageWorker;
 };
 
 }
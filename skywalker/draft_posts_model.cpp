@@ -2,8 +2,10 @@
 // License: GPLv3
 #include "draft_posts_model.h"
 #include "draft_posts.h"
+#include "file_utils.h"
 #include "list_store.h"
 #include "meme_maker.h"
+#include "photo_picker.h"
 #include "unicode_fonts.h"
 
 namespace Skywalker {
@@ -33,13 +35,16 @@ void DraftPostsModel::clear()
         beginRemoveRows({}, 0, mFeed.size() - 1);
         clearFeed();
         mRawFeed.clear();
+        mThreadLengths.clear();
         endRemoveRows();
     }
 }
 
-void DraftPostsModel::setFeed(std::vector<ATProto::AppBskyFeed::PostFeed> feed, const QString& cursor)
+void DraftPostsModel::setFeed(std::vector<ATProto::AppBskyFeed::PostFeed> feed, const QString& cursor,
+                              std::vector<int> threadLengths)
 {
     qDebug() << "Set feed:" << feed.size() << "cursor:" << cursor;
+    Q_ASSERT(threadLengths.empty() || threadLengths.size() == feed.size());
 
     mCursor = cursor;
 
@@ -47,6 +52,7 @@ void DraftPostsModel::setFeed(std::vector<ATProto::AppBskyFeed::PostFeed> feed,
         clear();
 
     mRawFeed = std::move(feed);
+    mThreadLengths = std::move(threadLengths);
 
     if (!mRawFeed.empty())
     {
@@ -69,6 +75,39 @@ void DraftPostsModel::setFeed(std::vector<ATProto::AppBskyFeed::PostFeed> feed,
     }
 }
 
+void DraftPostsModel::addFeed(std::vector<ATProto::AppBskyFeed::PostFeed> feed, const QString& cursor,
+                              std::vector<int> threadLengths)
+{
+    qDebug() << "Add feed:" << feed.size() << "cursor:" << cursor;
+    Q_ASSERT(threadLengths.size() == feed.size() || (threadLengths.empty() && mThreadLengths.empty()));
+
+    mCursor = cursor;
+
+    if (!feed.empty())
+    {
+        const size_t oldSize = mRawFeed.size();
+        beginInsertRows({}, oldSize, oldSize + feed.size() - 1);
+
+        for (auto& postFeed : feed)
+        {
+            Post post(postFeed[0]);
+            mFeed.push_back(post);
+            mRawFeed.push_back(std::move(postFeed));
+        }
+
+        mThreadLengths.insert(mThreadLengths.end(), threadLengths.begin(), threadLengths.end());
+
+        endInsertRows();
+    }
+
+    if (!mFeed.empty() && mCursor.isEmpty())
+    {
+        qDebug() << "End of feed:" << mFeed.back().getText();
+        mFeed.back().setEndOfFeed(true);
+        changeData({ int(Role::EndOfFeed) });
+    }
+}
+
 void DraftPostsModel::deleteDraft(int index)
 {
     qDebug() << "Delete draft:" << index;
@@ -81,6 +120,10 @@ void DraftPostsModel::deleteDraft(int index)
     beginRemoveRows({}, index, index);
     deletePost(index);
     mRawFeed.erase(mRawFeed.begin() + index);
+
+    if (index < (int)mThreadLengths.size())
+        mThreadLengths.erase(mThreadLengths.begin() + index);
+
     endRemoveRows();
 
     if (endOfFeed && !mFeed.empty())
@@ -167,7 +210,7 @@ QVariant DraftPostsModel::data(const QModelIndex& index, int role) const
     }
 
     QVariant result = AbstractPostFeedModel::data(index, role);
-    const int threadLength = mRawFeed[index.row()].size();
+    const int threadLength = getThreadLength(index.row());
 
     if (threadLength <= 1)
         return result;
@@ -193,6 +236,14 @@ QVariant DraftPostsModel::data(const QModelIndex& index, int role) const
     return result;
 }
 
+int DraftPostsModel::getThreadLength(int index) const
+{
+    if (index < (int)mThreadLengths.size())
+        return mThreadLengths[index];
+
+    return mRawFeed[index].size();
+}
+
 QList<ImageView> DraftPostsModel::createDraftImages(const Post& post) const
 {
     const QList<ImageView> imageViews = post.getDraftImages();
@@ -203,40 +254,84 @@ QList<ImageView> DraftPostsModel::createDraftImages(const Post& post) const
     if (mPostUriDraftImagesMap.contains(post.getUri()))
         return mPostUriDraftImagesMap.at(post.getUri());
 
+    const bool hasMeme = std::any_of(imageViews.begin(), imageViews.end(),
+        [](const ImageView& view){ return !view.getMemeTopText().isEmpty() || !view.getMemeBottomText().isEmpty(); });
+
+    // Until the memes are rendered, the images are shown without text.
+    if (hasMeme)
+        const_cast<DraftPostsModel*>(this)->renderDraftMemes(post, imageViews);
+
+    return imageViews;
+}
+
+void DraftPostsModel::renderDraftMemes(const Post& post, const QList<ImageView>& imageViews)
+{
+    const QString postUri = post.getUri();
+
+    if (mRenderingMemes.contains(postUri))
+        return;
+
+    mRenderingMemes.insert(postUri);
+
+    // The permission check may need the GUI thread.
+    const bool readPermission = FileUtils::checkReadMediaPermission();
+
+    mImageWorker.run<std::vector<QImage>>(
+        [imageViews, readPermission]{
+            std::vector<QImage> memes;
+
+            for (const auto& view : imageViews)
+            {
+                const QString imgSource = view.getFullSizeUrl();
+
+                if ((view.getMemeTopText().isEmpty() && view.getMemeBottomText().isEmpty()) ||
+                    (imgSource.startsWith("file://") && !readPermission))
+                {
+                    memes.push_back({});
+                    continue;
+                }
+
+                const QImage img = PhotoPicker::loadImage(imgSource, false);
+
+                if (img.isNull())
+                    qWarning() << "Cannot load image:" << imgSource;
+
+                memes.push_back(img.isNull() ? img : MemeMaker::renderMeme(img, view.getMemeTopText(), view.getMemeBottomText()));
+            }
+
+            return memes;
+        },
+        [this, postUri, imageViews](std::vector<QImage> memes){
+            setDraftMemes(postUri, imageViews, std::move(memes));
+        });
+}
+
+void DraftPostsModel::setDraftMemes(const QString& postUri, const QList<ImageView>& imageViews, std::vector<QImage> memes)
+{
+    Q_ASSERT((int)memes.size() == imageViews.size());
+    mRenderingMemes.erase(postUri);
+    auto* imgProvider = SharedImageProvider::getProvider(SharedImageProvider::SHARED_IMAGE);
     QList<ImageView> draftViews;
     draftViews.reserve(imageViews.size());
 
-    for (const auto& view : imageViews)
+    for (int i = 0; i < imageViews.size(); ++i)
     {
-        if (view.getMemeTopText().isEmpty() && view.getMemeBottomText().isEmpty())
+        const auto& view = imageViews[i];
+
+        if (memes[i].isNull())
         {
             draftViews.push_back(view);
+            continue;
         }
-        else
-        {
-            MemeMaker memeMaker;
-
-            if (!memeMaker.setOrigImage(view.getFullSizeUrl()))
-            {
-                qWarning() << "Cannot load image:" << view.getFullSizeUrl();
-                draftViews.push_back(view);
-                continue;
-            }
 
-            auto* imgProvider = SharedImageProvider::getProvider(SharedImageProvider::SHARED_IMAGE);
-            memeMaker.setTopText(view.getMemeTopText());
-            memeMaker.setBottomText(view.getMemeBottomText());
-            ImageView draftView(memeMaker.getMemeImgSource(), view.getAlt(), view.getMemeTopText(), view.getMemeBottomText());
-            draftViews.push_back(draftView);
-            auto source = std::make_unique<SharedImageSource>(memeMaker.getMemeImgSource(), imgProvider);
-            const_cast<DraftPostsModel*>(this)->mMemeSources.emplace_back(std::move(source));
-            memeMaker.releaseMemeOwnership();
-        }
+        auto source = std::make_unique<SharedImageSource>(imgProvider->addImage(std::move(memes[i])), imgProvider);
+        ImageView draftView(source->getSource(), view.getAlt(), view.getMemeTopText(), view.getMemeBottomText());
+        draftViews.push_back(draftView);
+        mMemeSources.emplace_back(std::move(source));
     }
 
-    Q_ASSERT(draftViews.size() == imageViews.size());
-    const_cast<DraftPostsModel*>(this)->mPostUriDraftImagesMap[post.getUri()] = draftViews;
-    return draftViews;
+    mPostUriDraftImagesMap[postUri] = draftViews;
+    changeData({ int(Role::PostImages) });
 }
 
 void DraftPostsModel::getPostExternal(int index) const
@@ -2,6 +2,7 @@
 // License: GPLv3
 #pragma once
 #include "abstract_post_feed_model.h"
+#include "image_worker.h"
 #include "shared_image_provider.h"
 
 namespace Skywalker {
@@ -26,7 +27,13 @@ public:
     void setDraftPosts(DraftPosts* draftPosts);
     QString getFeedName() const override { return "Draft posts"; }
     Q_INVOKABLE void clear();
-    void setFeed(std::vector<ATProto::AppBskyFeed::PostFeed> feed, const QString& cursor);
+
+    // threadLengths gives the length of each thread if the feed only holds
+    // previews of the first posts.
+    void setFeed(std::vector<ATProto::AppBskyFeed::PostFeed> feed, const QString& cursor,
+                 std::vector<int> threadLengths = {});
+    void addFeed(std::vector<ATProto::AppBskyFeed::PostFeed> feed, const QString& cursor,
+                 std::vector<int> threadLengths = {});
     void deleteDraft(int index);
     std::vector<Post> getThread(int index) const;
     QString getStoredMediaWarning(int index) const;
@@ -39,14 +46,20 @@ public:
     void updatePostRecordFailed(const Post& post, int index);
 
 private:
+    int getThreadLength(int index) const;
     QList<ImageView> createDraftImages(const Post& post) const;
+    void renderDraftMemes(const Post& post, const QList<ImageView>& imageViews);
+    void setDraftMemes(const QString& postUri, const QList<ImageView>& imageViews, std::vector<QImage> memes);
     void getPostExternal(int index) const;
     void getPostRecord(int index) const;
 
     QString mCursor;
     std::vector<ATProto::AppBskyFeed::PostFeed> mRawFeed;
+    std::vector<int> mThreadLengths; // empty if mRawFeed holds the full threads
     std::unordered_map<QString, QList<ImageView>> mPostUriDraftImagesMap;
     std::vector<SharedImageSource::Ptr> mMemeSources;
+    std::unordered_set<QString> mRenderingMemes; // post URIs
+    ImageWorker mImageWorker;
     DraftPosts* mDraftPosts = nullptr;
     std::unordered_set<QString> mGettingPostRecord;
     std::unordered_set<QString> mGettingPostExternal;
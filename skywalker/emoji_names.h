@@ -12,11 +12,13 @@ class EmojiNames : public QObject
     QML_ELEMENT
 
 public:
-    bool static isEmoji(const QString& grapheme) { return EMOJI_NAMES_MAP.contains(grapheme); };
-    Q_INVOKABLE static QString getEmojiName(const QString emoji);
+    static bool isEmoji(const QString& grapheme);
+
+    // True if the code point occurs in any emoji, including ZWJ, variation
+    // selectors, tags and the ASCII characters of keycaps.
+    static bool isEmojiCodePoint(uint c);
 
-private:
-    static const std::unordered_map<QString, QString> EMOJI_NAMES_MAP;
+    Q_INVOKABLE static QString getEmojiName(const QString emoji);
 };
 
 }
@@ -0,0 +1,5296 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+// Generated by scripts/generate_emoji_table.py, do not edit.
+#pragma once
+#include <QtGlobal>
+#include <string_view>
+
+namespace Skywalker::EmojiTable {
+
+struct Entry
+{
+    std::u16string_view mEmoji;
+    std::string_view mName;
+};
+
+static constexpr uint32_t BUCKET_COUNT = 1261;
+static constexpr uint32_t TABLE_SIZE = 5045;
+
+static constexpr uint16_t DISPLACEMENTS[] = {
+    10, 1, 0, 28, 6, 131, 5, 3, 47, 57, 12, 2, 152, 1, 6, 5,
+    23, 17, 1, 15, 1, 50, 61, 18, 8, 4, 2, 5, 8, 4, 16, 112,
+    23, 20, 2, 38, 7, 58, 2, 1, 7, 22, 4, 1, 17, 82, 54, 1,
+    6, 30, 22, 13, 5, 28, 220, 52, 50, 69, 0, 1, 812, 1, 1, 46,
+    6, 32, 117, 1, 174, 63, 3, 42, 77, 1, 16, 1, 3, 386, 99, 226,
+    2, 9, 386, 55, 28, 24, 129, 13, 9, 4, 1, 1, 1, 27, 7, 1,
+    31, 122, 1, 79, 45, 289, 156, 6, 1, 5, 168, 5, 177, 13, 168, 3,
+    12, 12, 3, 18, 75, 8, 18, 61, 10, 24, 109, 2, 12, 27, 64, 125,
+    76, 44, 55, 1, 4, 12, 8, 5, 17, 6, 217, 9, 1, 2, 72, 2,
+    16, 111, 10, 33, 447, 11, 57, 1, 7, 6, 104, 17, 0, 4, 115, 6,
+    1, 112, 0, 427, 7, 1, 39, 155, 14, 6, 29, 1, 43, 41, 21, 3,
+    15, 79, 171, 1, 2, 10, 41, 1, 156, 36, 112, 2, 1, 286, 56, 2,
+    2, 1, 12, 6, 1, 16, 48, 114, 48, 10, 10, 2, 10, 94, 14, 1,
+    98, 19, 59, 1, 60, 258, 153, 87, 8, 1, 74, 26, 49, 2, 44, 2,
+    12, 14, 65, 48, 2, 4, 1, 4, 53, 3, 3, 1, 115, 6, 46, 22,
+    36, 47, 4, 95, 2, 36, 90, 4, 779, 1, 1, 4, 182, 14, 13, 21,
+    163, 82, 101, 28, 194, 7, 149, 8, 31, 19, 38, 12, 395, 4, 22, 8,
+    29, 16, 425, 1, 13, 8, 49, 150, 2, 4, 23, 411, 9, 13, 28, 2,
+    1, 3, 3, 164, 10, 1, 52, 18, 2, 14, 142, 39, 9, 50, 93, 3,
+    48, 508, 405, 53, 236, 2, 358, 10, 81, 7, 17, 28, 75, 19, 20, 5,
+    65, 20, 473, 233, 19, 3, 126, 50, 1, 2, 44, 4, 271, 77, 19, 30,
+    2, 10, 20, 35, 2, 14, 4, 25, 0, 1, 2, 3, 8, 135, 18, 256,
+    26, 15, 47, 26, 1, 189, 46, 28, 5, 53, 86, 5, 41, 460, 195, 5,
+    114, 1, 9, 63, 73, 31, 13, 1, 37, 8, 200, 11, 28, 52, 68, 62,
+    4, 10, 1, 11, 115, 4, 99, 1, 25, 1, 11, 33, 21, 11, 2, 4,
+    37, 439, 14, 282, 26, 36, 14, 17, 5, 150, 1, 23, 47, 173, 161, 21,
+    5, 242, 110, 318, 126, 5, 10, 34, 350, 6, 7, 107, 342, 19, 48, 90,
+    62, 11, 101, 1, 3, 98, 7, 5, 2, 46, 50, 300, 110, 78, 58, 34,
+    12, 4, 100, 22, 1, 27, 1, 11, 9, 26, 26, 57, 5, 338, 15, 3,
+    23, 6, 4, 5, 1, 11, 179, 101, 250, 30, 6, 39, 740, 2, 10, 36,
+    82, 7, 2, 5, 23, 190, 39, 112, 12, 55, 930, 42, 8, 10, 104, 367,
+    3, 8, 153, 212, 150, 28, 5, 53, 154, 47, 201, 73, 19, 6, 1, 1,
+    247, 38, 108, 3, 225, 13, 140, 10, 2, 460, 141, 1, 207, 8, 32, 71,
+    1, 3, 170, 18, 23, 99, 8, 9, 270, 1113, 353, 7, 10, 122, 23, 6,
+    9, 23, 9, 17, 3, 1005, 58, 37, 100, 16, 37, 112, 370, 9, 42, 118,
+    30, 831, 24, 52, 6, 3, 3, 16, 40, 21, 133, 60, 53, 522, 219, 26,
+    55, 147, 128, 13, 6, 261, 3, 18, 354, 2, 20, 8, 25, 1, 203, 307,
+    5, 164, 1, 1, 73, 31, 261, 27, 20, 1, 498, 205, 8, 50, 58, 1,
+    1, 2, 18, 428, 37, 39, 29, 9, 41, 8, 10, 207, 19, 155, 23, 4,
+    42, 30, 1, 120, 56, 12, 3, 2, 4, 227, 162, 19, 40, 11, 272, 54,
+    9, 3, 17, 320, 13, 6, 3, 790, 173, 178, 6, 8, 12, 285, 63, 10,
+    32, 151, 3, 53, 20, 40, 27, 96, 1, 5, 255, 73, 484, 2, 153, 24,
+    42, 5, 338, 1, 389, 102, 1, 21, 13, 25, 131, 88, 863, 321, 3, 166,
+    93, 4, 27, 2, 48, 30, 59, 20, 360, 54, 204, 31, 118, 7, 88, 224,
+    128, 1, 14, 8, 0, 571, 503, 282, 541, 426, 1, 4, 781, 131, 22, 86,
+    16, 8, 181, 29, 5, 1, 285, 59, 552, 104, 628, 8, 46, 25, 10, 5,
+    334, 3, 1, 22, 110, 1, 128, 30, 14, 58, 2911, 157, 87, 56, 138, 15,
+    8, 2, 40, 224, 282, 37, 8, 386, 131, 914, 3, 17, 8, 11, 188, 269,
+    505, 86, 9, 42, 565, 85, 100, 3, 9, 9, 29, 13, 24, 69, 587, 776,
+    443, 472, 279, 100, 0, 160, 1815, 288, 6, 31, 15, 245, 41, 1, 7, 49,
+    0, 47, 659, 90, 17, 4, 486, 7, 20, 71, 236, 1, 172, 22, 103, 2,
+    76, 18, 5, 37, 867, 1162, 2, 18, 38, 14, 491, 839, 0, 96, 741, 3,
+    237, 1, 44, 103, 24, 555, 82, 1, 9, 23, 26, 916, 718, 152, 1, 4,
+    524, 266, 6, 28, 76, 69, 218, 13, 0, 16, 194, 149, 25, 1, 202, 2,
+    332, 8, 65, 105, 108, 68, 15, 29, 11, 634, 80, 2, 166, 65, 1, 1125,
+    986, 1, 203, 22, 0, 689, 1190, 17, 23, 4, 496, 11, 60, 100, 116, 1,
+    71, 27, 223, 50, 501, 15, 2, 1, 115, 108, 1, 205, 31, 471, 228, 10,
+    220, 916, 382, 168, 13, 9, 525, 83, 7, 1230, 378, 0, 163, 8, 839, 783,
+    173, 611, 5, 2, 131, 477, 37, 604, 63, 312, 138, 1, 1594, 1825, 631, 1843,
+    4, 18, 5, 239, 173, 244, 366, 84, 246, 2, 222, 479, 63, 1045, 21, 362,
+    0, 93, 1, 191, 33, 619, 70, 360, 130, 267, 776, 480, 2, 217, 647, 141,
+    3, 274, 6, 473, 227, 14, 94, 310, 977, 51, 7, 1036, 26, 115, 2, 69,
+    12, 5, 85, 2, 2267, 673, 14, 30, 218, 375, 0, 1, 33, 0, 338, 2,
+    3, 1122, 8, 307, 480, 175, 18, 290, 159, 30, 2, 185, 169, 356, 118, 26,
+    1, 956, 141, 278, 6, 50, 1040, 799, 6, 540, 15, 984, 8, 240, 174, 48,
+    71, 235, 1, 81, 383, 39, 1, 86, 9, 256, 450, 280, 435, 63, 1413, 5,
+    2, 92, 64, 770, 5, 8, 6, 107, 268, 1410, 132, 20, 1658, 14, 11, 616,
+    61, 1, 934, 3, 117, 986, 1, 70, 2, 4, 25, 2, 1, 549, 67, 2,
+    61, 237, 5, 48, 249, 1, 24, 408, 543, 1, 1, 399, 407, 5, 275, 2406,
+    11, 53, 856, 1, 1, 252, 44, 185, 1, 10, 13, 141, 128, 47, 7, 51,
+    19, 48, 535, 1125, 388, 10, 2, 303, 102, 7, 11, 153, 72, 316, 8412, 509,
+    2, 303, 24, 604, 28, 7, 3, 6, 871, 104, 2, 194, 200, 6, 30, 42,
+    955, 52, 1, 3, 225, 1444, 1225, 522, 3, 448, 642, 1, 3, 2503, 45, 1409,
+    19, 18, 61, 3, 483, 25, 162, 1652, 3672, 36, 3, 8, 3, 3324, 1, 1,
+    204, 3439, 265, 1173, 17, 125, 958, 3381, 13, 2, 91, 1132, 2, 196, 2, 1102,
+    23, 47, 219, 918, 5129, 1884, 1, 0, 4, 154, 1, 4, 108, 27, 19, 570,
+    12, 2565, 77, 6443, 4439, 3942, 4268, 25, 2, 1, 3609, 1, 5, 1940, 20, 726,
+    296, 7, 206, 2657, 10838, 431, 1, 2, 2074, 0, 256, 470, 14, 3958, 2395, 48,
+    47, 5444, 3061, 32, 109, 2, 248, 5200, 56, 477, 2, 2180, 961,
+};
+
+static constexpr Entry TABLE[] = {
+    { u"🇦🇷", "flag: Argentina" },
+    { u"🌡️", "thermometer" },
+    { u"👨🏼‍❤️‍👨🏼", "couple with heart: man, man, medium-light skin tone" },
+    { u"⏯️", "play or pause button" },
+    { u"🐢", "turtle" },
+    { u"👩🏿‍🤝‍👩🏾", "women holding hands: dark skin tone, medium-dark skin tone" },
+    { u"👨🏻‍❤‍💋‍👨🏿", "kiss: man, man, light skin tone, dark skin tone" },
+    { u"✍", "writing hand" },
+    { u"🕛", "twelve o’clock" },
+    { u"🈷️", "Japanese “monthly amount” button" },
+    { u"👩🏻‍🦳", "woman: light skin tone, white hair" },
+    { u"🧏🏽‍♀", "deaf woman: medium skin tone" },
+    { u"💁🏽‍♂️", "man tipping hand: medium skin tone" },
+    { u"🤾🏿‍♂️", "man playing handball: dark skin tone" },
+    { u"🤌🏼", "pinched fingers: medium-light skin tone" },
+    { u"🧑🏻‍💻", "technologist: light skin tone" },
+    { u"👶🏽", "baby: medium skin tone" },
+    { u"🤎", "brown heart" },
+    { u"🙆🏿", "person gesturing OK: dark skin tone" },
+    { u"↕️", "up-down arrow" },
+    { u"⛹‍♂", "man bouncing ball" },
+    { u"🧘🏾‍♂", "man in lotus position: medium-dark skin tone" },
+    { u"🤷‍♂️", "man shrugging" },
+    { u"🖼️", "framed picture" },
+    { u"🥃", "tumbler glass" },
+    { u"👩🏼‍🤝‍👩🏻", "women holding hands: medium-light skin tone, light skin tone" },
+    { u"®️", "registered" },
+    { u"🏄🏿‍♀", "woman surfing: dark skin tone" },
+    { u"🧍🏿‍♂", "man standing: dark skin tone" },
+    { u"👭🏽", "women holding hands: medium skin tone" },
+    { u"🦵🏼", "leg: medium-light skin tone" },
+    { u"🖕🏿", "middle finger: dark skin tone" },
+    { u"🧎🏽‍♀", "woman kneeling: medium skin tone" },
+    { u"💪🏿", "flexed biceps: dark skin tone" },
+    { u"🧑🏼‍❤️‍🧑🏻", "couple with heart: person, person, medium-light skin tone, light skin tone" },
+    { u"🧑🏿‍🦽‍➡️", "person in manual wheelchair facing right: dark skin tone" },
+    { u"🚣🏼‍♀️", "woman rowing boat: medium-light skin tone" },
+    { u"☸️", "wheel of dharma" },
+    { u"🪿", "goose" },
+    { u"🏃🏽‍♀️‍➡️", "woman running facing right: medium skin tone" },
+    { u"🧖🏾‍♀", "woman in steamy room: medium-dark skin tone" },
+    { u"👩🏽‍🦱", "woman: medium skin tone, curly hair" },
+    { u"🕺🏼", "man dancing: medium-light skin tone" },
+    { u"🤌🏻", "pinched fingers: light skin tone" },
+    { u"🎽", "running shirt" },
+    { u"🗒", "spiral notepad" },
+    { u"👨🏿‍⚖", "man judge: dark skin tone" },
+    { u"🏃🏾‍♂‍➡️", "man running facing right: medium-dark skin tone" },
+    { u"🤽🏼‍♀", "woman playing water polo: medium-light skin tone" },
+    { u"💁🏼‍♀️", "woman tipping hand: medium-light skin tone" },
+    { u"▪", "black small square" },
+    { u"✳️", "eight-spoked asterisk" },
+    { u"💂🏽", "guard: medium skin tone" },
+    { u"🧘", "person in lotus position" },
+    { u"🏃", "person running" },
+    { u"👳‍♂", "man wearing turban" },
+    { u"☀", "sun" },
+    { u"🦸🏻‍♂️", "man superhero: light skin tone" },
+    { u"👩🏻‍❤‍💋‍👨🏿", "kiss: woman, man, light skin tone, dark skin tone" },
+    { u"🙍🏻", "person frowning: light skin tone" },
+    { u"🪥", "toothbrush" },
+    { u"👨🏼‍🤝‍👨🏽", "men holding hands: medium-light skin tone, medium skin tone" },
+    { u"🇨🇾", "flag: Cyprus" },
+    { u"👩🏽‍🦰", "woman: medium skin tone, red hair" },
+    { u"🚹", "men’s room" },
+    { u"👩🏽‍❤️‍💋‍👩🏼", "kiss: woman, woman, medium skin tone, medium-light skin tone" },
+    { u"🫳🏻", "palm down hand: light skin tone" },
+    { u"🏋‍♀", "woman lifting weights" },
+    { u"🉐", "Japanese “bargain” button" },
+    { u"👋🏽", "waving hand: medium skin tone" },
+    { u"🌚", "new moon face" },
+    { u"🇧🇬", "flag: Bulgaria" },
+    { u"🇵🇱", "flag: Poland" },
+    { u"🗓️", "spiral calendar" },
+    { u"👏🏾", "clapping hands: medium-dark skin tone" },
+    { u"👨‍🚀", "man astronaut" },
+    { u"👩🏿‍❤‍👩🏿", "couple with heart: woman, woman, dark skin tone" },
+    { u"🤸🏿‍♀", "woman cartwheeling: dark skin tone" },
+    { u"⛽", "fuel pump" },
+    { u"🏌🏻", "person golfing: light skin tone" },
+    { u"💁🏾", "person tipping hand: medium-dark skin tone" },
+    { u"🫲🏼", "leftwards hand: medium-light skin tone" },
+    { u"🫱🏿‍🫲🏾", "handshake: dark skin tone, medium-dark skin tone" },
+    { u"😱", "face screaming in fear" },
+    { u"🎃", "jack-o-lantern" },
+    { u"👩🏼‍🎨", "woman artist: medium-light skin tone" },
+    { u"⬇", "down arrow" },
+    { u"🧎‍♂‍➡", "man kneeling facing right" },
+    { u"🔟", "keycap: 10" },
+    { u"🏌🏼‍♂", "man golfing: medium-light skin tone" },
+    { u"👨🏿‍✈️", "man pilot: dark skin tone" },
+    { u"🙊", "speak-no-evil monkey" },
+    { u"📋", "clipboard" },
+    { u"⛹️", "person bouncing ball" },
+    { u"🏊🏽‍♀", "woman swimming: medium skin tone" },
+    { u"🉑", "Japanese “acceptable” button" },
+    { u"😚", "kissing face with closed eyes" },
+    { u"👨🏿‍🦽", "man in manual wheelchair: dark skin tone" },
+    { u"💇🏼‍♀", "woman getting haircut: medium-light skin tone" },
+    { u"☔", "umbrella with rain drops" },
+    { u"🇲🇵", "flag: Northern Mariana Islands" },
+    { u"🇧🇼", "flag: Botswana" },
+    { u"🚶🏼‍➡", "person walking facing right: medium-light skin tone" },
+    { u"🏃🏻‍♀‍➡️", "woman running facing right: light skin tone" },
+    { u"🖨", "printer" },
+    { u"💂🏻", "guard: light skin tone" },
+    { u"🧑🏽‍🎤", "singer: medium skin tone" },
+    { u"👩🏿‍🦯", "woman with white cane: dark skin tone" },
+    { u"🇧🇱", "flag: St. Barthélemy" },
+    { u"👭", "women holding hands" },
+    { u"🧎🏾", "person kneeling: medium-dark skin tone" },
+    { u"🕵🏽‍♂", "man detective: medium skin tone" },
+    { u"🧚‍♂️", "man fairy" },
+    { u"👒", "woman’s hat" },
+    { u"💇‍♂", "man getting haircut" },
+    { u"⤴️", "right arrow curving up" },
+    { u"👱🏾‍♀️", "woman: medium-dark skin tone, blond hair" },
+    { u"🧔🏿‍♂️", "man: dark skin tone, beard" },
+    { u"🐜", "ant" },
+    { u"🔯", "dotted six-pointed star" },
+    { u"🚴🏽", "person biking: medium skin tone" },
+    { u"🙋🏿‍♂️", "man raising hand: dark skin tone" },
+    { u"👩🏾‍🦽", "woman in manual wheelchair: medium-dark skin tone" },
+    { u"🌩️", "cloud with lightning" },
+    { u"🧜🏽‍♀️", "mermaid: medium skin tone" },
+    { u"🏼", "medium-light skin tone" },
+    { u"🫄🏾", "pregnant person: medium-dark skin tone" },
+    { u"👩🏾‍❤‍💋‍👩🏼", "kiss: woman, woman, medium-dark skin tone, medium-light skin tone" },
+    { u"⛏️", "pick" },
+    { u"👧🏾", "girl: medium-dark skin tone" },
+    { u"⏭️", "next track button" },
+    { u"🙍🏻‍♂️", "man frowning: light skin tone" },
+    { u"👩🏻‍🍼", "woman feeding baby: light skin tone" },
+    { u"🚵🏻", "person mountain biking: light skin tone" },
+    { u"🎭", "performing arts" },
+    { u"👩🏾‍🤝‍👩🏻", "women holding hands: medium-dark skin tone, light skin tone" },
+    { u"🏌🏽‍♀", "woman golfing: medium skin tone" },
+    { u"🙎🏽‍♀️", "woman pouting: medium skin tone" },
+    { u"👰🏾", "person with veil: medium-dark skin tone" },
+    { u"👨🏾‍🔬", "man scientist: medium-dark skin tone" },
+    { u"🏋️", "person lifting weights" },
+    { u"🇧🇻", "flag: Bouvet Island" },
+    { u"🎨", "artist palette" },
+    { u"🇱🇮", "flag: Liechtenstein" },
+    { u"👩🏿‍❤️‍💋‍👨🏼", "kiss: woman, man, dark skin tone, medium-light skin tone" },
+    { u"🐲", "dragon face" },
+    { u"🤸🏽‍♂", "man cartwheeling: medium skin tone" },
+    { u"🦹🏿‍♀", "woman supervillain: dark skin tone" },
+    { u"🌴", "palm tree" },
+    { u"🏴‍☠", "pirate flag" },
+    { u"🏹", "bow and arrow" },
+    { u"🙍‍♀", "woman frowning" },
+    { u"👩🏻‍🦱", "woman: light skin tone, curly hair" },
+    { u"👨🏻‍❤‍👨🏻", "couple with heart: man, man, light skin tone" },
+    { u"🏊‍♂️", "man swimming" },
+    { u"👳‍♀️", "woman wearing turban" },
+    { u"⏲️", "timer clock" },
+    { u"👮🏿", "police officer: dark skin tone" },
+    { u"🕵", "detective" },
+    { u"🐟", "fish" },
+    { u"🕖", "seven o’clock" },
+    { u"🍆", "eggplant" },
+    { u"🇹🇷", "flag: Türkiye" },
+    { u"🖥", "desktop computer" },
+    { u"🈁", "Japanese “here” button" },
+    { u"👭🏻", "women holding hands: light skin tone" },
+    { u"👨🏻‍❤️‍💋‍👨🏽", "kiss: man, man, light skin tone, medium skin tone" },
+    { u"👦🏿", "boy: dark skin tone" },
+    { u"☝🏼", "index pointing up: medium-light skin tone" },
+    { u"🧜🏽‍♀", "mermaid: medium skin tone" },
+    { u"🇭🇷", "flag: Croatia" },
+    { u"🇬🇹", "flag: Guatemala" },
+    { u"🚶‍♂️‍➡", "man walking facing right" },
+    { u"👀", "eyes" },
+    { u"🧑🏼‍🎤", "singer: medium-light skin tone" },
+    { u"👷🏻‍♂", "man construction worker: light skin tone" },
+    { u"👩🏻‍❤‍💋‍👩🏻", "kiss: woman, woman, light skin tone" },
+    { u"👩🏽‍❤️‍💋‍👨🏼", "kiss: woman, man, medium skin tone, medium-light skin tone" },
+    { u"🧑🏼‍❤‍💋‍🧑🏽", "kiss: person, person, medium-light skin tone, medium skin tone" },
+    { u"👩🏻‍⚕️", "woman health worker: light skin tone" },
+    { u"🙅🏿‍♂", "man gesturing NO: dark skin tone" },
+    { u"🏊‍♀️", "woman swimming" },
+    { u"💇🏼‍♀️", "woman getting haircut: medium-light skin tone" },
+    { u"🙋🏾‍♀️", "woman raising hand: medium-dark skin tone" },
+    { u"📳", "vibration mode" },
+    { u"🧛🏽‍♂", "man vampire: medium skin tone" },
+    { u"👩🏽‍🤝‍👩🏾", "women holding hands: medium skin tone, medium-dark skin tone" },
+    { u"👩🏻‍❤‍💋‍👩🏼", "kiss: woman, woman, light skin tone, medium-light skin tone" },
+    { u"🫳🏽", "palm down hand: medium skin tone" },
+    { u"👮🏾‍♂️", "man police officer: medium-dark skin tone" },
+    { u"👩🏿‍🔬", "woman scientist: dark skin tone" },
+    { u"☣", "biohazard" },
+    { u"🌫", "fog" },
+    { u"📐", "triangular ruler" },
+    { u"🤸", "person cartwheeling" },
+    { u"🏌‍♂", "man golfing" },
+    { u"📧", "e-mail" },
+    { u"⛹🏽‍♀️", "woman bouncing ball: medium skin tone" },
+    { u"👨🏿‍❤️‍👨🏻", "couple with heart: man, man, dark skin tone, light skin tone" },
+    { u"🤽🏾‍♀️", "woman playing water polo: medium-dark skin tone" },
+    { u"👨🏻‍❤️‍👨🏼", "couple with heart: man, man, light skin tone, medium-light skin tone" },
+    { u"👩🏾‍❤️‍💋‍👩🏿", "kiss: woman, woman, medium-dark skin tone, dark skin tone" },
+    { u"🛤️", "railway track" },
+    { u"🫂", "people hugging" },
+    { u"🕒", "three o’clock" },
+    { u"🙍🏾‍♂️", "man frowning: medium-dark skin tone" },
+    { u"🩲", "briefs" },
+    { u"🚌", "bus" },
+    { u"💁‍♀️", "woman tipping hand" },
+    { u"⏏️", "eject button" },
+    { u"🕚", "eleven o’clock" },
+    { u"🪾", "leafless tree" },
+    { u"🕴", "person in suit levitating" },
+    { u"🇪🇺", "flag: European Union" },
+    { u"🙇🏻", "person bowing: light skin tone" },
+    { u"👨🏾‍💼", "man office worker: medium-dark skin tone" },
+    { u"👰", "person with veil" },
+    { u"🏃🏻‍♂️", "man running: light skin tone" },
+    { u"🧟", "zombie" },
+    { u"🏌🏼‍♀", "woman golfing: medium-light skin tone" },
+    { u"🧝🏻", "elf: light skin tone" },
+    { u"🏆", "trophy" },
+    { u"👨🏻", "man: light skin tone" },
+    { u"🔏", "locked with pen" },
+    { u"👩🏻‍🦰", "woman: light skin tone, red hair" },
+    { u"🇭🇲", "flag: Heard & McDonald Islands" },
+    { u"🚴🏿‍♂", "man biking: dark skin tone" },
+    { u"🤟🏾", "love-you gesture: medium-dark skin tone" },
+    { u"👨‍🔧", "man mechanic" },
+    { u"🏃🏻‍♂‍➡️", "man running facing right: light skin tone" },
+    { u"🤹🏿‍♀", "woman juggling: dark skin tone" },
+    { u"🇾🇪", "flag: Yemen" },
+    { u"👊", "oncoming fist" },
+    { u"🧑🏼‍🤝‍🧑🏼", "people holding hands: medium-light skin tone" },
+    { u"👨🏾‍❤️‍👨🏿", "couple with heart: man, man, medium-dark skin tone, dark skin tone" },
+    { u"🔹", "small blue diamond" },
+    { u"🫱🏽‍🫲🏿", "handshake: medium skin tone, dark skin tone" },
+    { u"🚺", "women’s room" },
+    { u"🤦🏽‍♂", "man facepalming: medium skin tone" },
+    { u"🤤", "drooling face" },
+    { u"🗃", "card file box" },
+    { u"🏣", "Japanese post office" },
+    { u"🇫🇮", "flag: Finland" },
+    { u"⛰", "mountain" },
+    { u"👩🏾‍❤‍💋‍👨🏻", "kiss: woman, man, medium-dark skin tone, light skin tone" },
+    { u"👩🏿‍🎨", "woman artist: dark skin tone" },
+    { u"🧍‍♀️", "woman standing" },
+    { u"🛋", "couch and lamp" },
+    { u"🧑🏽‍❤‍🧑🏻", "couple with heart: person, person, medium skin tone, light skin tone" },
+    { u"🤳", "selfie" },
+    { u"👳🏻‍♀", "woman wearing turban: light skin tone" },
+    { u"⭕", "hollow red circle" },
+    { u"🙍🏼‍♂️", "man frowning: medium-light skin tone" },
+    { u"🔒", "locked" },
+    { u"👩🏻‍🔧", "woman mechanic: light skin tone" },
+    { u"💜", "purple heart" },
+    { u"🚶🏻‍➡", "person walking facing right: light skin tone" },
+    { u"🪀", "yo-yo" },
+    { u"🇸🇧", "flag: Solomon Islands" },
+    { u"🗃️", "card file box" },
+    { u"🦹‍♂", "man supervillain" },
+    { u"🤦🏻‍♀", "woman facepalming: light skin tone" },
+    { u"👩🏻‍🦼‍➡", "woman in motorized wheelchair facing right: light skin tone" },
+    { u"🤷🏾‍♂️", "man shrugging: medium-dark skin tone" },
+    { u"🙇🏿‍♀️", "woman bowing: dark skin tone" },
+    { u"🧿", "nazar amulet" },
+    { u"⛸️", "ice skate" },
+    { u"🇸🇲", "flag: San Marino" },
+    { u"🚽", "toilet" },
+    { u"🦯", "white cane" },
+    { u"🧚🏽‍♂", "man fairy: medium skin tone" },
+    { u"🏌🏽‍♂", "man golfing: medium skin tone" },
+    { u"🌤️", "sun behind small cloud" },
+    { u"🟠", "orange circle" },
+    { u"👨🏽‍🦼‍➡️", "man in motorized wheelchair facing right: medium skin tone" },
+    { u"👵🏿", "old woman: dark skin tone" },
+    { u"💂🏽‍♂", "man guard: medium skin tone" },
+    { u"🇬🇾", "flag: Guyana" },
+    { u"🦵🏻", "leg: light skin tone" },
+    { u"🕌", "mosque" },
+    { u"🔜", "SOON arrow" },
+    { u"😘", "face blowing a kiss" },
+    { u"👯‍♀️", "women with bunny ears" },
+    { u"🧗🏿", "person climbing: dark skin tone" },
+    { u"🍰", "shortcake" },
+    { u"🦠", "microbe" },
+    { u"🥖", "baguette bread" },
+    { u"🤵‍♀️", "woman in tuxedo" },
+    { u"🇨🇦", "flag: Canada" },
+    { u"⏫", "fast up button" },
+    { u"⌛", "hourglass done" },
+    { u"🏃🏿", "person running: dark skin tone" },
+    { u"🤹🏾‍♀", "woman juggling: medium-dark skin tone" },
+    { u"👷🏿‍♂", "man construction worker: dark skin tone" },
+    { u"🦏", "rhinoceros" },
+    { u"👣", "footprints" },
+    { u"💂‍♂", "man guard" },
+    { u"👨🏼", "man: medium-light skin tone" },
+    { u"🧞‍♀️", "woman genie" },
+    { u"🧜‍♀", "mermaid" },
+    { u"🔲", "black square button" },
+    { u"🧑🏽‍⚕️", "health worker: medium skin tone" },
+    { u"🫸🏼", "rightwards pushing hand: medium-light skin tone" },
+    { u"⁉️", "exclamation question mark" },
+    { u"🧜🏿‍♂", "merman: dark skin tone" },
+    { u"🤽🏽‍♀", "woman playing water polo: medium skin tone" },
+    { u"🖕🏻", "middle finger: light skin tone" },
+    { u"👯‍♂️", "men with bunny ears" },
+    { u"🖕", "middle finger" },
+    { u"🍁", "maple leaf" },
+    { u"🇨🇽", "flag: Christmas Island" },
+    { u"🧍🏼‍♀️", "woman standing: medium-light skin tone" },
+    { u"💆🏽‍♂", "man getting massage: medium skin tone" },
+    { u"👩🏿‍💼", "woman office worker: dark skin tone" },
+    { u"👩🏼‍❤️‍💋‍👩🏿", "kiss: woman, woman, medium-light skin tone, dark skin tone" },
+    { u"🔑", "key" },
+    { u"🏃🏼", "person running: medium-light skin tone" },
+    { u"🫆", "fingerprint" },
+    { u"👩🏾‍🏭", "woman factory worker: medium-dark skin tone" },
+    { u"🙋🏽‍♀️", "woman raising hand: medium skin tone" },
+    { u"👩🏾‍🚒", "woman firefighter: medium-dark skin tone" },
+    { u"🪩", "mirror ball" },
+    { u"👨🏿‍❤‍💋‍👨🏻", "kiss: man, man, dark skin tone, light skin tone" },
+    { u"🧫", "petri dish" },
+    { u"😈", "smiling face with horns" },
+    { u"🧑🏿‍❤‍🧑🏻", "couple with heart: person, person, dark skin tone, light skin tone" },
+    { u"🐦‍🔥", "phoenix" },
+    { u"☺", "smiling face" },
+    { u"👱🏾‍♂", "man: medium-dark skin tone, blond hair" },
+    { u"🚴‍♂", "man biking" },
+    { u"🖌️", "paintbrush" },
+    { u"🙆🏻‍♀", "woman gesturing OK: light skin tone" },
+    { u"🍢", "oden" },
+    { u"🌞", "sun with face" },
+    { u"👩🏽‍❤‍👨🏼", "couple with heart: woman, man, medium skin tone, medium-light skin tone" },
+    { u"🧛‍♀️", "woman vampire" },
+    { u"🧑🏾‍🦯‍➡️", "person with white cane facing right: medium-dark skin tone" },
+    { u"🧗🏽‍♀", "woman climbing: medium skin tone" },
+    { u"🚣🏼‍♂", "man rowing boat: medium-light skin tone" },
+    { u"👩🏼‍❤‍👩🏻", "couple with heart: woman, woman, medium-light skin tone, light skin tone" },
+    { u"🏵️", "rosette" },
+    { u"⛹🏻‍♀", "woman bouncing ball: light skin tone" },
+    { u"🚣🏻‍♂", "man rowing boat: light skin tone" },
+    { u"🛳", "passenger ship" },
+    { u"🕰️", "mantelpiece clock" },
+    { u"🤵🏿‍♀️", "woman in tuxedo: dark skin tone" },
+    { u"🤾‍♂️", "man playing handball" },
+    { u"🤹🏼‍♀", "woman juggling: medium-light skin tone" },
+    { u"🤷🏿‍♂", "man shrugging: dark skin tone" },
+    { u"😻", "smiling cat with heart-eyes" },
+    { u"🧍🏾‍♂", "man standing: medium-dark skin tone" },
+    { u"⤴", "right arrow curving up" },
+    { u"🐸", "frog" },
+    { u"🇪🇨", "flag: Ecuador" },
+    { u"🖐", "hand with fingers splayed" },
+    { u"🏴󠁧󠁢󠁥󠁮󠁧󠁿", "flag: England" },
+    { u"🤸🏽‍♀", "woman cartwheeling: medium skin tone" },
+    { u"🍾", "bottle with popping cork" },
+    { u"💇🏻‍♂", "man getting haircut: light skin tone" },
+    { u"🥩", "cut of meat" },
+    { u"🤠", "cowboy hat face" },
+    { u"🇻🇪", "flag: Venezuela" },
+    { u"🇨🇷", "flag: Costa Rica" },
+    { u"💁🏻‍♀", "woman tipping hand: light skin tone" },
+    { u"🧔🏾", "person: medium-dark skin tone, beard" },
+    { u"🎊", "confetti ball" },
+    { u"🧝🏾", "elf: medium-dark skin tone" },
+    { u"🏧", "ATM sign" },
+    { u"🏾", "medium-dark skin tone" },
+    { u"✋🏼", "raised hand: medium-light skin tone" },
+    { u"🛷", "sled" },
+    { u"😨", "fearful face" },
+    { u"👩🏿‍❤‍👨🏽", "couple with heart: woman, man, dark skin tone, medium skin tone" },
+    { u"⛹🏾‍♂️", "man bouncing ball: medium-dark skin tone" },
+    { u"🤷🏿‍♀", "woman shrugging: dark skin tone" },
+    { u"🦹🏼‍♂️", "man supervillain: medium-light skin tone" },
+    { u"🧑‍🦯‍➡", "person with white cane facing right" },
+    { u"👩🏻", "woman: light skin tone" },
+    { u"✋🏿", "raised hand: dark skin tone" },
+    { u"👩🏽‍❤‍👩🏻", "couple with heart: woman, woman, medium skin tone, light skin tone" },
+    { u"🇹🇹", "flag: Trinidad & Tobago" },
+    { u"🚣🏼", "person rowing boat: medium-light skin tone" },
+    { u"👰🏿‍♂️", "man with veil: dark skin tone" },
+    { u"🫷🏾", "leftwards pushing hand: medium-dark skin tone" },
+    { u"👨🏻‍✈", "man pilot: light skin tone" },
+    { u"👩🏼‍❤‍👨🏼", "couple with heart: woman, man, medium-light skin tone" },
+    { u"🧞‍♀", "woman genie" },
+    { u"👩🏽‍❤‍👩🏾", "couple with heart: woman, woman, medium skin tone, medium-dark skin tone" },
+    { u"🧑🏻‍❤‍🧑🏾", "couple with heart: person, person, light skin tone, medium-dark skin tone" },
+    { u"👷", "construction worker" },
+    { u"🤵🏾‍♀", "woman in tuxedo: medium-dark skin tone" },
+    { u"👩🏻‍🦼‍➡️", "woman in motorized wheelchair facing right: light skin tone" },
+    { u"👩🏽‍🤝‍👨🏿", "woman and man holding hands: medium skin tone, dark skin tone" },
+    { u"👡", "woman’s sandal" },
+    { u"💇‍♀", "woman getting haircut" },
+    { u"🧴", "lotion bottle" },
+    { u"♟", "chess pawn" },
+    { u"👳🏽‍♀️", "woman wearing turban: medium skin tone" },
+    { u"📫", "closed mailbox with raised flag" },
+    { u"🏃🏾‍♀‍➡️", "woman running facing right: medium-dark skin tone" },
+    { u"👩🏼‍🦲", "woman: medium-light skin tone, bald" },
+    { u"🧑🏻‍✈", "pilot: light skin tone" },
+    { u"🧑‍⚖️", "judge" },
+    { u"🤹🏿‍♀️", "woman juggling: dark skin tone" },
+    { u"🌖", "waning gibbous moon" },
+    { u"👧🏻", "girl: light skin tone" },
+    { u"👨🏿‍❤‍👨🏽", "couple with heart: man, man, dark skin tone, medium skin tone" },
+    { u"🚶🏿‍♀️‍➡", "woman walking facing right: dark skin tone" },
+    { u"🦸🏾‍♂", "man superhero: medium-dark skin tone" },
+    { u"👁️‍🗨️", "eye in speech bubble" },
+    { u"😷", "face with medical mask" },
+    { u"👩🏾‍❤️‍👩🏼", "couple with heart: woman, woman, medium-dark skin tone, medium-light skin tone" },
+    { u"👉🏻", "backhand index pointing right: light skin tone" },
+    { u"👩‍🦽‍➡", "woman in manual wheelchair facing right" },
+    { u"🏃🏿‍➡", "person running facing right: dark skin tone" },
+    { u"🦁", "lion" },
+    { u"🛻", "pickup truck" },
+    { u"👷🏼", "construction worker: medium-light skin tone" },
+    { u"🔕", "bell with slash" },
+    { u"🧑‍💼", "office worker" },
+    { u"👩‍⚖️", "woman judge" },
+    { u"⛺", "tent" },
+    { u"🗣", "speaking head" },
+    { u"🏃🏼‍♂️‍➡", "man running facing right: medium-light skin tone" },
+    { u"👃🏽", "nose: medium skin tone" },
+    { u"🚵🏾‍♂", "man mountain biking: medium-dark skin tone" },
+    { u"🔵", "blue circle" },
+    { u"🙇🏼‍♂️", "man bowing: medium-light skin tone" },
+    { u"🔼", "upwards button" },
+    { u"💅🏿", "nail polish: dark skin tone" },
+    { u"👩🏽‍🤝‍👩🏻", "women holding hands: medium skin tone, light skin tone" },
+    { u"🏃🏽‍♂‍➡️", "man running facing right: medium skin tone" },
+    { u"🦘", "kangaroo" },
+    { u"👨🏻‍❤‍💋‍👨🏾", "kiss: man, man, light skin tone, medium-dark skin tone" },
+    { u"🦲", "bald" },
+    { u"🥣", "bowl with spoon" },
+    { u"🫜", "root vegetable" },
+    { u"👨‍🏫", "man teacher" },
+    { u"⛄️", "snowman without snow" },
+    { u"🧗🏽", "person climbing: medium skin tone" },
+    { u"🏃🏽‍➡", "person running facing right: medium skin tone" },
+    { u"👨🏼‍🎤", "man singer: medium-light skin tone" },
+    { u"🧎🏼‍♀‍➡️", "woman kneeling facing right: medium-light skin tone" },
+    { u"👨‍👦‍👦", "family: man, boy, boy" },
+    { u"💂‍♀️", "woman guard" },
+    { u"👜", "handbag" },
+    { u"🛢️", "oil drum" },
+    { u"🏃🏻‍➡", "person running facing right: light skin tone" },
+    { u"👨🏻‍🌾", "man farmer: light skin tone" },
+    { u"🦦", "otter" },
+    { u"😒", "unamused face" },
+    { u"2️⃣", "keycap: 2" },
+    { u"🚶‍♀‍➡️", "woman walking facing right" },
+    { u"🤳🏿", "selfie: dark skin tone" },
+    { u"👤", "bust in silhouette" },
+    { u"🦸🏿‍♀️", "woman superhero: dark skin tone" },
+    { u"🚣", "person rowing boat" },
+    { u"🧨", "firecracker" },
+    { u"🫱🏻‍🫲🏽", "handshake: light skin tone, medium skin tone" },
+    { u"👩‍🦽", "woman in manual wheelchair" },
+    { u"🤵🏽‍♀", "woman in tuxedo: medium skin tone" },
+    { u"🧎🏻‍➡", "person kneeling facing right: light skin tone" },
+    { u"🤌🏽", "pinched fingers: medium skin tone" },
+    { u"👨‍🦯", "man with white cane" },
+    { u"🦸🏼", "superhero: medium-light skin tone" },
+    { u"🧔🏻‍♀️", "woman: light skin tone, beard" },
+    { u"🧝🏿", "elf: dark skin tone" },
+    { u"🏃🏻‍♀️", "woman running: light skin tone" },
+    { u"💆‍♀", "woman getting massage" },
+    { u"🚵🏼‍♀️", "woman mountain biking: medium-light skin tone" },
+    { u"💆🏿‍♀️", "woman getting massage: dark skin tone" },
+    { u"🚣🏻", "person rowing boat: light skin tone" },
+    { u"🧙🏿", "mage: dark skin tone" },
+    { u"🤍", "white heart" },
+    { u"🧲", "magnet" },
+    { u"👨🏻‍🦯", "man with white cane: light skin tone" },
+    { u"🎱", "pool 8 ball" },
+    { u"👨‍⚕️", "man health worker" },
+    { u"🧏🏿‍♂️", "deaf man: dark skin tone" },
+    { u"🗑️", "wastebasket" },
+    { u"✊", "raised fist" },
+    { u"🧒", "child" },
+    { u"🕯️", "candle" },
+    { u"🤸🏾‍♂️", "man cartwheeling: medium-dark skin tone" },
+    { u"🧎🏾‍♂️‍➡", "man kneeling facing right: medium-dark skin tone" },
+    { u"📓", "notebook" },
+    { u"🧑🏾‍⚕", "health worker: medium-dark skin tone" },
+    { u"➰", "curly loop" },
+    { u"💇🏾‍♂️", "man getting haircut: medium-dark skin tone" },
+    { u"🫵🏼", "index pointing at the viewer: medium-light skin tone" },
+    { u"🛡", "shield" },
+    { u"👨🏿‍🦲", "man: dark skin tone, bald" },
+    { u"⛹‍♀️", "woman bouncing ball" },
+    { u"🧝", "elf" },
+    { u"🤴🏼", "prince: medium-light skin tone" },
+    { u"🍕", "pizza" },
+    { u"👨🏿‍❤️‍💋‍👨🏼", "kiss: man, man, dark skin tone, medium-light skin tone" },
+    { u"🧎🏽‍♀️‍➡", "woman kneeling facing right: medium skin tone" },
+    { u"🦀", "crab" },
+    { u"🧑🏻‍🦳", "person: light skin tone, white hair" },
+    { u"🤵🏻", "person in tuxedo: light skin tone" },
+    { u"9⃣", "keycap: 9" },
+    { u"♋", "Cancer" },
+    { u"✌🏿", "victory hand: dark skin tone" },
+    { u"👐🏽", "open hands: medium skin tone" },
+    { u"🚶🏽‍♀️", "woman walking: medium skin tone" },
+    { u"🧎🏿‍♂️", "man kneeling: dark skin tone" },
+    { u"🏋‍♀️", "woman lifting weights" },
+    { u"🧑🏽‍❤️‍💋‍🧑🏿", "kiss: person, person, medium skin tone, dark skin tone" },
+    { u"🛌", "person in bed" },
+    { u"🧑🏼‍🦯‍➡", "person with white cane facing right: medium-light skin tone" },
+    { u"🤾‍♀", "woman playing handball" },
+    { u"🙅🏾", "person gesturing NO: medium-dark skin tone" },
+    { u"🕵🏼‍♀", "woman detective: medium-light skin tone" },
+    { u"🚶🏾‍♀️‍➡", "woman walking facing right: medium-dark skin tone" },
+    { u"🧔🏿", "person: dark skin tone, beard" },
+    { u"💏🏼", "kiss: medium-light skin tone" },
+    { u"🏃🏽", "person running: medium skin tone" },
+    { u"🧍🏾", "person standing: medium-dark skin tone" },
+    { u"👩🏿‍❤‍👩🏼", "couple with heart: woman, woman, dark skin tone, medium-light skin tone" },
+    { u"🍇", "grapes" },
+    { u"🧑🏿‍🦰", "person: dark skin tone, red hair" },
+    { u"🇰🇪", "flag: Kenya" },
+    { u"🟣", "purple circle" },
+    { u"💈", "barber pole" },
+    { u"📼", "videocassette" },
+    { u"👩🏾‍🦽‍➡️", "woman in manual wheelchair facing right: medium-dark skin tone" },
+    { u"🐇", "rabbit" },
+    { u"👨🏾‍❤️‍👨🏽", "couple with heart: man, man, medium-dark skin tone, medium skin tone" },
+    { u"🛑", "stop sign" },
+    { u"🧘🏼‍♀️", "woman in lotus position: medium-light skin tone" },
+    { u"🇰🇷", "flag: South Korea" },
+    { u"🤼‍♀️", "women wrestling" },
+    { u"🤹🏽‍♂️", "man juggling: medium skin tone" },
+    { u"🧑🏽‍🦲", "person: medium skin tone, bald" },
+    { u"🇮🇸", "flag: Iceland" },
+    { u"🧑🏾‍🦯", "person with white cane: medium-dark skin tone" },
+    { u"🤦‍♀", "woman facepalming" },
+    { u"🛍️", "shopping bags" },
+    { u"🎒", "backpack" },
+    { u"🏋🏽‍♂", "man lifting weights: medium skin tone" },
+    { u"🥥", "coconut" },
+    { u"👮🏽‍♂", "man police officer: medium skin tone" },
+    { u"🤽🏼‍♂", "man playing water polo: medium-light skin tone" },
+    { u"🇿🇼", "flag: Zimbabwe" },
+    { u"👩🏽‍🦯‍➡️", "woman with white cane facing right: medium skin tone" },
+    { u"🧑🏾‍🤝‍🧑🏿", "people holding hands: medium-dark skin tone, dark skin tone" },
+    { u"🦸🏽‍♀", "woman superhero: medium skin tone" },
+    { u"🕵🏾‍♀️", "woman detective: medium-dark skin tone" },
+    { u"🧑🏾‍💼", "office worker: medium-dark skin tone" },
+    { u"🖱", "computer mouse" },
+    { u"🧑🏿‍🌾", "farmer: dark skin tone" },
+    { u"🤵🏼‍♀", "woman in tuxedo: medium-light skin tone" },
+    { u"🫄🏿", "pregnant person: dark skin tone" },
+    { u"💆🏻‍♀️", "woman getting massage: light skin tone" },
+    { u"👩🏽‍⚖️", "woman judge: medium skin tone" },
+    { u"👵🏽", "old woman: medium skin tone" },
+    { u"🧎🏽‍♂‍➡️", "man kneeling facing right: medium skin tone" },
+    { u"🇸🇩", "flag: Sudan" },
+    { u"🏊🏽‍♂️", "man swimming: medium skin tone" },
+    { u"👩🏾", "woman: medium-dark skin tone" },
+    { u"🙍", "person frowning" },
+    { u"🧛🏼", "vampire: medium-light skin tone" },
+    { u"🤹🏼", "person juggling: medium-light skin tone" },
+    { u"👃", "nose" },
+    { u"💇🏿‍♂️", "man getting haircut: dark skin tone" },
+    { u"🐏", "ram" },
+    { u"🏍️", "motorcycle" },
+    { u"🚶🏼‍♂️‍➡", "man walking facing right: medium-light skin tone" },
+    { u"👨🏽‍🍳", "man cook: medium skin tone" },
+    { u"👷‍♀️", "woman construction worker" },
+    { u"🥢", "chopsticks" },
+    { u"🦹🏿‍♂️", "man supervillain: dark skin tone" },
+    { u"👩🏽‍🦯‍➡", "woman with white cane facing right: medium skin tone" },
+    { u"✂️", "scissors" },
+    { u"🥭", "mango" },
+    { u"👨‍👨‍👧", "family: man, man, girl" },
+    { u"🔱", "trident emblem" },
+    { u"👨🏿‍❤️‍👨🏾", "couple with heart: man, man, dark skin tone, medium-dark skin tone" },
+    { u"🚶‍➡", "person walking facing right" },
+    { u"👷🏿‍♂️", "man construction worker: dark skin tone" },
+    { u"🦹‍♀", "woman supervillain" },
+    { u"👱🏽", "person: medium skin tone, blond hair" },
+    { u"🧑🏽‍🌾", "farmer: medium skin tone" },
+    { u"👩🏻‍⚕", "woman health worker: light skin tone" },
+    { u"🫠", "melting face" },
+    { u"👩🏿‍🚀", "woman astronaut: dark skin tone" },
+    { u"🏋", "person lifting weights" },
+    { u"🧑🏽‍❤‍🧑🏼", "couple with heart: person, person, medium skin tone, medium-light skin tone" },
+    { u"🔽", "downwards button" },
+    { u"🎢", "roller coaster" },
+    { u"🧛🏼‍♂", "man vampire: medium-light skin tone" },
+    { u"🏃‍♂️", "man running" },
+    { u"🐁", "mouse" },
+    { u"🇺🇲", "flag: U.S. Outlying Islands" },
+    { u"👨🏿‍🔧", "man mechanic: dark skin tone" },
+    { u"👩🏻‍❤‍👩🏼", "couple with heart: woman, woman, light skin tone, medium-light skin tone" },
+    { u"🇳🇨", "flag: New Caledonia" },
+    { u"🧗‍♀️", "woman climbing" },
+    { u"🙎🏽‍♀", "woman pouting: medium skin tone" },
+    { u"🧑‍🦱", "person: curly hair" },
+    { u"👨🏼‍🦱", "man: medium-light skin tone, curly hair" },
+    { u"👩🏻‍❤‍👨🏻", "couple with heart: woman, man, light skin tone" },
+    { u"✌🏼", "victory hand: medium-light skin tone" },
+    { u"🪓", "axe" },
+    { u"🧜🏿‍♂️", "merman: dark skin tone" },
+    { u"🏃‍♀", "woman running" },
+    { u"🧑🏻‍🎓", "student: light skin tone" },
+    { u"🇬🇶", "flag: Equatorial Guinea" },
+    { u"🧑🏻‍❤️‍🧑🏾", "couple with heart: person, person, light skin tone, medium-dark skin tone" },
+    { u"🤚🏿", "raised back of hand: dark skin tone" },
+    { u"👨‍⚕", "man health worker" },
+    { u"🏘️", "houses" },
+    { u"🐯", "tiger face" },
+    { u"🇽🇰", "flag: Kosovo" },
+    { u"🦪", "oyster" },
+    { u"🏳‍⚧", "transgender flag" },
+    { u"👩🏽‍❤️‍💋‍👩🏽", "kiss: woman, woman, medium skin tone" },
+    { u"👩🏼‍❤️‍👨🏾", "couple with heart: woman, man, medium-light skin tone, medium-dark skin tone" },
+    { u"⛹🏼", "person bouncing ball: medium-light skin tone" },
+    { u"🤽🏻", "person playing water polo: light skin tone" },
+    { u"🇲🇨", "flag: Monaco" },
+    { u"🧎🏾‍♂️", "man kneeling: medium-dark skin tone" },
+    { u"🧚🏾‍♂", "man fairy: medium-dark skin tone" },
+    { u"🪁", "kite" },
+    { u"🧙‍♂️", "man mage" },
+    { u"🏒", "ice hockey" },
+    { u"📮", "postbox" },
+    { u"👩🏽‍❤️‍👨🏿", "couple with heart: woman, man, medium skin tone, dark skin tone" },
+    { u"🧑🏿‍❤️‍💋‍🧑🏻", "kiss: person, person, dark skin tone, light skin tone" },
+    { u"🇵🇪", "flag: Peru" },
+    { u"👨🏾‍❤‍💋‍👨🏿", "kiss: man, man, medium-dark skin tone, dark skin tone" },
+    { u"🇰🇾", "flag: Cayman Islands" },
+    { u"♑", "Capricorn" },
+    { u"🐘", "elephant" },
+    { u"🧑🏼‍⚖", "judge: medium-light skin tone" },
+    { u"🚵🏻‍♀️", "woman mountain biking: light skin tone" },
+    { u"👨🏽‍🏭", "man factory worker: medium skin tone" },
+    { u"🇬🇭", "flag: Ghana" },
+    { u"👨‍💻", "man technologist" },
+    { u"👩🏽‍❤‍👩🏽", "couple with heart: woman, woman, medium skin tone" },
+    { u"🏌🏿‍♀", "woman golfing: dark skin tone" },
+    { u"👩🏿‍🦽‍➡️", "woman in manual wheelchair facing right: dark skin tone" },
+    { u"👩🏻‍❤‍👨🏾", "couple with heart: woman, man, light skin tone, medium-dark skin tone" },
+    { u"🏌🏽‍♂️", "man golfing: medium skin tone" },
+    { u"👳🏻‍♀️", "woman wearing turban: light skin tone" },
+    { u"🧑🏿‍🤝‍🧑🏾", "people holding hands: dark skin tone, medium-dark skin tone" },
+    { u"💏🏻", "kiss: light skin tone" },
+    { u"🥞", "pancakes" },
+    { u"🧍🏽", "person standing: medium skin tone" },
+    { u"👩🏿‍⚕", "woman health worker: dark skin tone" },
+    { u"🗝", "old key" },
+    { u"👩🏿‍❤‍💋‍👨🏾", "kiss: woman, man, dark skin tone, medium-dark skin tone" },
+    { u"☁", "cloud" },
+    { u"👩🏼‍⚕️", "woman health worker: medium-light skin tone" },
+    { u"🧖🏿‍♀", "woman in steamy room: dark skin tone" },
+    { u"👰🏼‍♀", "woman with veil: medium-light skin tone" },
+    { u"👩🏾‍🤝‍👩🏽", "women holding hands: medium-dark skin tone, medium skin tone" },
+    { u"🇴🇲", "flag: Oman" },
+    { u"👰🏻‍♀", "woman with veil: light skin tone" },
+    { u"👊🏻", "oncoming fist: light skin tone" },
+    { u"💂🏽‍♀️", "woman guard: medium skin tone" },
+    { u"👨🏿‍🎓", "man student: dark skin tone" },
+    { u"🐿️", "chipmunk" },
+    { u"🇩🇪", "flag: Germany" },
+    { u"👨🏻‍🍳", "man cook: light skin tone" },
+    { u"🏋🏽‍♀️", "woman lifting weights: medium skin tone" },
+    { u"👨🏼‍🌾", "man farmer: medium-light skin tone" },
+    { u"👨‍🦽‍➡", "man in manual wheelchair facing right" },
+    { u"🤸🏻‍♂", "man cartwheeling: light skin tone" },
+    { u"🫱🏻", "rightwards hand: light skin tone" },
+    { u"🤦🏿‍♂", "man facepalming: dark skin tone" },
+    { u"👨🏻‍❤‍💋‍👨🏼", "kiss: man, man, light skin tone, medium-light skin tone" },
+    { u"🛹", "skateboard" },
+    { u"🏴‍☠️", "pirate flag" },
+    { u"🧑🏾‍🏭", "factory worker: medium-dark skin tone" },
+    { u"👩🏻‍🤝‍👨🏽", "woman and man holding hands: light skin tone, medium skin tone" },
+    { u"🚵", "person mountain biking" },
+    { u"💁‍♂️", "man tipping hand" },
+    { u"🧑🏽‍🤝‍🧑🏼", "people holding hands: medium skin tone, medium-light skin tone" },
+    { u"🪃", "boomerang" },
+    { u"🚣🏽‍♀", "woman rowing boat: medium skin tone" },
+    { u"🧩", "puzzle piece" },
+    { u"👩🏿‍❤️‍💋‍👩🏻", "kiss: woman, woman, dark skin tone, light skin tone" },
+    { u"🟨", "yellow square" },
+    { u"🇦🇸", "flag: American Samoa" },
+    { u"🧏🏿‍♀", "deaf woman: dark skin tone" },
+    { u"🇰🇭", "flag: Cambodia" },
+    { u"🏃🏼‍♀", "woman running: medium-light skin tone" },
+    { u"👩🏿‍❤‍💋‍👩🏽", "kiss: woman, woman, dark skin tone, medium skin tone" },
+    { u"🕵️‍♀️", "woman detective" },
+    { u"👩🏼‍🦼‍➡", "woman in motorized wheelchair facing right: medium-light skin tone" },
+    { u"🤼‍♀", "women wrestling" },
+    { u"👩‍🍳", "woman cook" },
+    { u"💆🏿‍♂️", "man getting massage: dark skin tone" },
+    { u"🥾", "hiking boot" },
+    { u"👩🏾‍❤️‍👩🏿", "couple with heart: woman, woman, medium-dark skin tone, dark skin tone" },
+    { u"🤌", "pinched fingers" },
+    { u"🎖", "military medal" },
+    { u"🤌🏿", "pinched fingers: dark skin tone" },
+    { u"🚶🏽‍♂‍➡", "man walking facing right: medium skin tone" },
+    { u"🍑", "peach" },
+    { u"🐦", "bird" },
+    { u"✖️", "multiply" },
+    { u"👩🏻‍⚖", "woman judge: light skin tone" },
+    { u"🚶🏾‍♀", "woman walking: medium-dark skin tone" },
+    { u"🚵🏼‍♂", "man mountain biking: medium-light skin tone" },
+    { u"🤹🏾‍♂", "man juggling: medium-dark skin tone" },
+    { u"🧝‍♀", "woman elf" },
+    { u"🖊️", "pen" },
+    { u"🏴", "black flag" },
+    { u"👩🏼‍❤‍💋‍👨🏾", "kiss: woman, man, medium-light skin tone, medium-dark skin tone" },
+    { u"🪆", "nesting dolls" },
+    { u"♀️", "female sign" },
+    { u"🎗", "reminder ribbon" },
+    { u"👷🏻", "construction worker: light skin tone" },
+    { u"🇬🇩", "flag: Grenada" },
+    { u"🥕", "carrot" },
+    { u"👺", "goblin" },
+    { u"✴", "eight-pointed star" },
+    { u"⚛️", "atom symbol" },
+    { u"🇳🇮", "flag: Nicaragua" },
+    { u"👨🏽‍❤‍💋‍👨🏽", "kiss: man, man, medium skin tone" },
+    { u"🧑🏻‍🔧", "mechanic: light skin tone" },
+    { u"🇻🇬", "flag: British Virgin Islands" },
+    { u"👩🏿‍🤝‍👩🏻", "women holding hands: dark skin tone, light skin tone" },
+    { u"🔢", "input numbers" },
+    { u"🦱", "curly hair" },
+    { u"🦎", "lizard" },
+    { u"📿", "prayer beads" },
+    { u"💁🏿‍♂️", "man tipping hand: dark skin tone" },
+    { u"🚵🏿‍♀", "woman mountain biking: dark skin tone" },
+    { u"🦛", "hippopotamus" },
+    { u"🥗", "green salad" },
+    { u"👱🏿‍♀", "woman: dark skin tone, blond hair" },
+    { u"🧋", "bubble tea" },
+    { u"🧑‍🦼‍➡️", "person in motorized wheelchair facing right" },
+    { u"🚶🏽‍♀‍➡️", "woman walking facing right: medium skin tone" },
+    { u"👮🏼‍♀️", "woman police officer: medium-light skin tone" },
+    { u"🧏🏾‍♀️", "deaf woman: medium-dark skin tone" },
+    { u"🙏🏼", "folded hands: medium-light skin tone" },
+    { u"👩🏼‍🦼‍➡️", "woman in motorized wheelchair facing right: medium-light skin tone" },
+    { u"🧜🏾‍♀", "mermaid: medium-dark skin tone" },
+    { u"👩🏾‍❤️‍💋‍👨🏾", "kiss: woman, man, medium-dark skin tone" },
+    { u"👋🏻", "waving hand: light skin tone" },
+    { u"🟰", "heavy equals sign" },
+    { u"👨🏾‍🦼‍➡", "man in motorized wheelchair facing right: medium-dark skin tone" },
+    { u"🅾", "O button (blood type)" },
+    { u"👨🏽‍❤️‍👨🏽", "couple with heart: man, man, medium skin tone" },
+    { u"🇱🇦", "flag: Laos" },
+    { u"👩🏼‍🔬", "woman scientist: medium-light skin tone" },
+    { u"🏽", "medium skin tone" },
+    { u"👩🏾‍❤️‍💋‍👩🏻", "kiss: woman, woman, medium-dark skin tone, light skin tone" },
+    { u"👨🏻‍🦼‍➡️", "man in motorized wheelchair facing right: light skin tone" },
+    { u"👩🏿‍🤝‍👨🏽", "woman and man holding hands: dark skin tone, medium skin tone" },
+    { u"👨🏻‍🦽‍➡️", "man in manual wheelchair facing right: light skin tone" },
+    { u"🕵‍♂️", "man detective" },
+    { u"👨🏿‍❤️‍💋‍👨🏽", "kiss: man, man, dark skin tone, medium skin tone" },
+    { u"😿", "crying cat" },
+    { u"🏃🏿‍♀", "woman running: dark skin tone" },
+    { u"👩‍🦱", "woman: curly hair" },
+    { u"©", "copyright" },
+    { u"🤷🏽‍♂️", "man shrugging: medium skin tone" },
+    { u"⚱️", "funeral urn" },
+    { u"🧖🏻‍♀️", "woman in steamy room: light skin tone" },
+    { u"🏃‍➡️", "person running facing right" },
+    { u"🇬🇮", "flag: Gibraltar" },
+    { u"🚶🏿‍♂️", "man walking: dark skin tone" },
+    { u"🧜🏻‍♂", "merman: light skin tone" },
+    { u"⚡", "high voltage" },
+    { u"☘️", "shamrock" },
+    { u"🧑🏼‍✈️", "pilot: medium-light skin tone" },
+    { u"👷🏿‍♀", "woman construction worker: dark skin tone" },
+    { u"👨🏿‍⚖️", "man judge: dark skin tone" },
+    { u"🇻🇨", "flag: St. Vincent & Grenadines" },
+    { u"🦸🏾", "superhero: medium-dark skin tone" },
+    { u"🫅", "person with crown" },
+    { u"🧎🏼‍♀", "woman kneeling: medium-light skin tone" },
+    { u"🚶🏻‍♂‍➡️", "man walking facing right: light skin tone" },
+    { u"🤟🏼", "love-you gesture: medium-light skin tone" },
+    { u"👨🏼‍❤️‍👨🏽", "couple with heart: man, man, medium-light skin tone, medium skin tone" },
+    { u"⏱", "stopwatch" },
+    { u"⏯", "play or pause button" },
+    { u"🎲", "game die" },
+    { u"👨🏼‍❤‍👨🏽", "couple with heart: man, man, medium-light skin tone, medium skin tone" },
+    { u"🧑🏻‍⚕", "health worker: light skin tone" },
+    { u"🏂🏻", "snowboarder: light skin tone" },
+    { u"👨🏽‍🏫", "man teacher: medium skin tone" },
+    { u"🧚🏾‍♀️", "woman fairy: medium-dark skin tone" },
+    { u"💁🏼‍♀", "woman tipping hand: medium-light skin tone" },
+    { u"⚽", "soccer ball" },
+    { u"🧑🏾‍❤️‍💋‍🧑🏻", "kiss: person, person, medium-dark skin tone, light skin tone" },
+    { u"💂🏾‍♂️", "man guard: medium-dark skin tone" },
+    { u"👱‍♂️", "man: blond hair" },
+    { u"👩🏻‍🤝‍👩🏼", "women holding hands: light skin tone, medium-light skin tone" },
+    { u"🧚🏼‍♀", "woman fairy: medium-light skin tone" },
+    { u"👩🏼‍❤️‍💋‍👨🏽", "kiss: woman, man, medium-light skin tone, medium skin tone" },
+    { u"👨🏽‍🌾", "man farmer: medium skin tone" },
+    { u"🧑🏼‍🦯‍➡️", "person with white cane facing right: medium-light skin tone" },
+    { u"🗯", "right anger bubble" },
+    { u"🔡", "input latin lowercase" },
+    { u"🏃🏽‍♀️", "woman running: medium skin tone" },
+    { u"🛶", "canoe" },
+    { u"🤸🏾", "person cartwheeling: medium-dark skin tone" },
+    { u"👩🏽‍❤‍👨🏻", "couple with heart: woman, man, medium skin tone, light skin tone" },
+    { u"🌬️", "wind face" },
+    { u"🛀🏼", "person taking bath: medium-light skin tone" },
+    { u"✏", "pencil" },
+    { u"👩🏻‍❤️‍💋‍👩🏽", "kiss: woman, woman, light skin tone, medium skin tone" },
+    { u"🩼", "crutch" },
+    { u"🔀", "shuffle tracks button" },
+    { u"〽", "part alternation mark" },
+    { u"👩🏾‍❤‍👩🏿", "couple with heart: woman, woman, medium-dark skin tone, dark skin tone" },
+    { u"👩🏾‍🦼‍➡️", "woman in motorized wheelchair facing right: medium-dark skin tone" },
+    { u"⚕", "medical symbol" },
+    { u"🚵🏾‍♂️", "man mountain biking: medium-dark skin tone" },
+    { u"🖇", "linked paperclips" },
+    { u"🏋🏿", "person lifting weights: dark skin tone" },
+    { u"🤾🏽‍♂️", "man playing handball: medium skin tone" },
+    { u"🌌", "milky way" },
+    { u"🧓🏻", "older person: light skin tone" },
+    { u"💻", "laptop" },
+    { u"💆🏼‍♀", "woman getting massage: medium-light skin tone" },
+    { u"🧚🏼‍♂", "man fairy: medium-light skin tone" },
+    { u"👩🏻‍🤝‍👩🏽", "women holding hands: light skin tone, medium skin tone" },
+    { u"🇮🇩", "flag: Indonesia" },
+    { u"🧚🏻‍♂️", "man fairy: light skin tone" },
+    { u"🧙‍♂", "man mage" },
+    { u"🙅🏼‍♀", "woman gesturing NO: medium-light skin tone" },
+    { u"🫶🏻", "heart hands: light skin tone" },
+    { u"🏄🏽", "person surfing: medium skin tone" },
+    { u"🧑🏿‍❤️‍💋‍🧑🏾", "kiss: person, person, dark skin tone, medium-dark skin tone" },
+    { u"👵🏾", "old woman: medium-dark skin tone" },
+    { u"5️⃣", "keycap: 5" },
+    { u"🧖‍♂️", "man in steamy room" },
+    { u"🤷🏽‍♀", "woman shrugging: medium skin tone" },
+    { u"👩🏾‍❤‍💋‍👩🏾", "kiss: woman, woman, medium-dark skin tone" },
+    { u"👨🏻‍❤‍💋‍👨🏻", "kiss: man, man, light skin tone" },
+    { u"🛢", "oil drum" },
+    { u"❄", "snowflake" },
+    { u"🏳️‍🌈", "rainbow flag" },
+    { u"👩🏼‍🦼", "woman in motorized wheelchair: medium-light skin tone" },
+    { u"🚲", "bicycle" },
+    { u"🤷🏼‍♂", "man shrugging: medium-light skin tone" },
+    { u"👨🏻‍🦽", "man in manual wheelchair: light skin tone" },
+    { u"🇲🇴", "flag: Macao SAR China" },
+    { u"🥸", "disguised face" },
+    { u"🎷", "saxophone" },
+    { u"🩶", "grey heart" },
+    { u"🧙‍♀", "woman mage" },
+    { u"🙍🏾‍♀️", "woman frowning: medium-dark skin tone" },
+    { u"🧛‍♂", "man vampire" },
+    { u"🙇🏻‍♀", "woman bowing: light skin tone" },
+    { u"👰🏽", "person with veil: medium skin tone" },
+    { u"🏃🏼‍♂", "man running: medium-light skin tone" },
+    { u"🧎🏽‍♀‍➡", "woman kneeling facing right: medium skin tone" },
+    { u"🪛", "screwdriver" },
+    { u"💁🏾‍♀️", "woman tipping hand: medium-dark skin tone" },
+    { u"🙋🏽‍♂️", "man raising hand: medium skin tone" },
+    { u"☢️", "radioactive" },
+    { u"🔌", "electric plug" },
+    { u"🩺", "stethoscope" },
+    { u"🧝‍♂", "man elf" },
+    { u"🤲🏿", "palms up together: dark skin tone" },
+    { u"👗", "dress" },
+    { u"🧚🏿‍♂️", "man fairy: dark skin tone" },
+    { u"👱🏽‍♀️", "woman: medium skin tone, blond hair" },
+    { u"🏊🏻‍♂️", "man swimming: light skin tone" },
+    { u"🧑🏾‍❤️‍🧑🏿", "couple with heart: person, person, medium-dark skin tone, dark skin tone" },
+    { u"👮🏼", "police officer: medium-light skin tone" },
+    { u"🚶🏻‍♀‍➡", "woman walking facing right: light skin tone" },
+    { u"🇳🇺", "flag: Niue" },
+    { u"〰️", "wavy dash" },
+    { u"⏭", "next track button" },
+    { u"👨🏾‍❤‍👨🏿", "couple with heart: man, man, medium-dark skin tone, dark skin tone" },
+    { u"🧏🏾‍♀", "deaf woman: medium-dark skin tone" },
+    { u"🤦🏾", "person facepalming: medium-dark skin tone" },
+    { u"🫴🏾", "palm up hand: medium-dark skin tone" },
+    { u"1️⃣", "keycap: 1" },
+    { u"👼🏿", "baby angel: dark skin tone" },
+    { u"🆙", "UP! button" },
+    { u"🤰🏽", "pregnant woman: medium skin tone" },
+    { u"🇲🇺", "flag: Mauritius" },
+    { u"🦸🏿", "superhero: dark skin tone" },
+    { u"🤦🏾‍♂️", "man facepalming: medium-dark skin tone" },
+    { u"⚪", "white circle" },
+    { u"🥯", "bagel" },
+    { u"🏃🏼‍♀️", "woman running: medium-light skin tone" },
+    { u"👨‍🦲", "man: bald" },
+    { u"🧎🏻‍♀️", "woman kneeling: light skin tone" },
+    { u"👨🏽‍✈️", "man pilot: medium skin tone" },
+    { u"🕵🏾‍♂️", "man detective: medium-dark skin tone" },
+    { u"🌝", "full moon face" },
+    { u"👩🏾‍🤝‍👩🏼", "women holding hands: medium-dark skin tone, medium-light skin tone" },
+    { u"🤳🏻", "selfie: light skin tone" },
+    { u"👩🏼‍🦽", "woman in manual wheelchair: medium-light skin tone" },
+    { u"🚵🏼‍♂️", "man mountain biking: medium-light skin tone" },
+    { u"👨🏻‍❤️‍👨🏻", "couple with heart: man, man, light skin tone" },
+    { u"👂🏼", "ear: medium-light skin tone" },
+    { u"👮", "police officer" },
+    { u"👨‍🍼", "man feeding baby" },
+    { u"🥬", "leafy green" },
+    { u"🧑🏼‍❤️‍💋‍🧑🏻", "kiss: person, person, medium-light skin tone, light skin tone" },
+    { u"⚜", "fleur-de-lis" },
+    { u"🙆🏾‍♂️", "man gesturing OK: medium-dark skin tone" },
+    { u"🙅‍♂", "man gesturing NO" },
+    { u"🧑🏼‍🚀", "astronaut: medium-light skin tone" },
+    { u"👩🏼‍❤‍💋‍👨🏿", "kiss: woman, man, medium-light skin tone, dark skin tone" },
+    { u"🚣🏾", "person rowing boat: medium-dark skin tone" },
+    { u"🇨🇩", "flag: Congo - Kinshasa" },
+    { u"🔘", "radio button" },
+    { u"🚵‍♂️", "man mountain biking" },
+    { u"👩🏿‍🎤", "woman singer: dark skin tone" },
+    { u"🔦", "flashlight" },
+    { u"🍏", "green apple" },
+    { u"🤸🏼‍♀", "woman cartwheeling: medium-light skin tone" },
+    { u"🧝🏼‍♀️", "woman elf: medium-light skin tone" },
+    { u"🤦🏻‍♂", "man facepalming: light skin tone" },
+    { u"🦿", "mechanical leg" },
+    { u"🧑🏽‍⚖️", "judge: medium skin tone" },
+    { u"🙅🏽‍♂️", "man gesturing NO: medium skin tone" },
+    { u"🔪", "kitchen knife" },
+    { u"🕴🏾", "person in suit levitating: medium-dark skin tone" },
+    { u"🅱️", "B button (blood type)" },
+    { u"🧑🏿‍⚕️", "health worker: dark skin tone" },
+    { u"❤", "red heart" },
+    { u"🧑🏾‍🤝‍🧑🏽", "people holding hands: medium-dark skin tone, medium skin tone" },
+    { u"🧎🏻‍♂‍➡️", "man kneeling facing right: light skin tone" },
+    { u"👩🏽‍❤️‍💋‍👩🏿", "kiss: woman, woman, medium skin tone, dark skin tone" },
+    { u"🤱🏾", "breast-feeding: medium-dark skin tone" },
+    { u"🇯🇴", "flag: Jordan" },
+    { u"👫", "woman and man holding hands" },
+    { u"🧑🏼‍🦳", "person: medium-light skin tone, white hair" },
+    { u"🙆🏼", "person gesturing OK: medium-light skin tone" },
+    { u"🪝", "hook" },
+    { u"🪤", "mouse trap" },
+    { u"👨🏿‍⚕", "man health worker: dark skin tone" },
+    { u"😄", "grinning face with smiling eyes" },
+    { u"🐐", "goat" },
+    { u"🚶🏾‍♀‍➡", "woman walking facing right: medium-dark skin tone" },
+    { u"🚴🏻‍♂", "man biking: light skin tone" },
+    { u"🧌", "troll" },
+    { u"🐚", "spiral shell" },
+    { u"🙆🏻‍♀️", "woman gesturing OK: light skin tone" },
+    { u"🧑", "person" },
+    { u"🦼", "motorized wheelchair" },
+    { u"👳🏿", "person wearing turban: dark skin tone" },
+    { u"🧑‍🎨", "artist" },
+    { u"👨🏾‍🦯", "man with white cane: medium-dark skin tone" },
+    { u"🙆🏽‍♂", "man gesturing OK: medium skin tone" },
+    { u"🦹", "supervillain" },
+    { u"🏂🏾", "snowboarder: medium-dark skin tone" },
+    { u"🫷", "leftwards pushing hand" },
+    { u"🕯", "candle" },
+    { u"🇦🇩", "flag: Andorra" },
+    { u"✂", "scissors" },
+    { u"🦒", "giraffe" },
+    { u"🤵🏾‍♀️", "woman in tuxedo: medium-dark skin tone" },
+    { u"🤷🏽‍♀️", "woman shrugging: medium skin tone" },
+    { u"🤵‍♂", "man in tuxedo" },
+    { u"◻", "white medium square" },
+    { u"👱🏿‍♂", "man: dark skin tone, blond hair" },
+    { u"👨🏼‍💼", "man office worker: medium-light skin tone" },
+    { u"🏘", "houses" },
+    { u"👩🏾‍❤‍💋‍👨🏿", "kiss: woman, man, medium-dark skin tone, dark skin tone" },
+    { u"👩🏿‍❤‍💋‍👨🏿", "kiss: woman, man, dark skin tone" },
+    { u"🤼", "people wrestling" },
+    { u"💂🏿‍♂", "man guard: dark skin tone" },
+    { u"🙃", "upside-down face" },
+    { u"🤙", "call me hand" },
+    { u"☪", "star and crescent" },
+    { u"💁🏻", "person tipping hand: light skin tone" },
+    { u"👩🏼‍❤️‍💋‍👨🏻", "kiss: woman, man, medium-light skin tone, light skin tone" },
+    { u"🧚‍♀", "woman fairy" },
+    { u"🧝🏼‍♂", "man elf: medium-light skin tone" },
+    { u"🧗🏻‍♀️", "woman climbing: light skin tone" },
+    { u"🧑🏽‍🚒", "firefighter: medium skin tone" },
+    { u"👩🏿‍🌾", "woman farmer: dark skin tone" },
+    { u"🪪", "identification card" },
+    { u"🤷🏾‍♀", "woman shrugging: medium-dark skin tone" },
+    { u"🌲", "evergreen tree" },
+    { u"🙋🏾‍♂️", "man raising hand: medium-dark skin tone" },
+    { u"🤘", "sign of the horns" },
+    { u"💁‍♀", "woman tipping hand" },
+    { u"👩🏼‍❤️‍👨🏿", "couple with heart: woman, man, medium-light skin tone, dark skin tone" },
+    { u"🧑🏾‍🦼‍➡", "person in motorized wheelchair facing right: medium-dark skin tone" },
+    { u"✍️", "writing hand" },
+    { u"👩🏻‍❤️‍👨🏾", "couple with heart: woman, man, light skin tone, medium-dark skin tone" },
+    { u"👩🏿‍❤️‍👨🏿", "couple with heart: woman, man, dark skin tone" },
+    { u"🐺", "wolf" },
+    { u"♊", "Gemini" },
+    { u"💁🏿", "person tipping hand: dark skin tone" },
+    { u"👩🏾‍❤️‍💋‍👨🏿", "kiss: woman, man, medium-dark skin tone, dark skin tone" },
+    { u"🧛🏾‍♂", "man vampire: medium-dark skin tone" },
+    { u"😠", "angry face" },
+    { u"👨🏼‍❤‍👨🏿", "couple with heart: man, man, medium-light skin tone, dark skin tone" },
+    { u"👼", "baby angel" },
+    { u"💚", "green heart" },
+    { u"🏌🏼‍♀️", "woman golfing: medium-light skin tone" },
+    { u"🚔", "oncoming police car" },
+    { u"👰🏽‍♂️", "man with veil: medium skin tone" },
+    { u"💇🏻‍♀️", "woman getting haircut: light skin tone" },
+    { u"🖐️", "hand with fingers splayed" },
+    { u"🇨🇿", "flag: Czechia" },
+    { u"🥰", "smiling face with hearts" },
+    { u"⚛", "atom symbol" },
+    { u"🐕", "dog" },
+    { u"🚿", "shower" },
+    { u"🚶🏻‍♂️", "man walking: light skin tone" },
+    { u"🐰", "rabbit face" },
+    { u"✏️", "pencil" },
+    { u"🦐", "shrimp" },
+    { u"🧎🏿‍♀️‍➡️", "woman kneeling facing right: dark skin tone" },
+    { u"🇱🇰", "flag: Sri Lanka" },
+    { u"🇹🇻", "flag: Tuvalu" },
+    { u"🧑🏻‍❤️‍💋‍🧑🏿", "kiss: person, person, light skin tone, dark skin tone" },
+    { u"🥹", "face holding back tears" },
+    { u"💱", "currency exchange" },
+    { u"🎀", "ribbon" },
+    { u"🥓", "bacon" },
+    { u"👩🏽‍🏭", "woman factory worker: medium skin tone" },
+    { u"🧑🏿‍🦽‍➡", "person in manual wheelchair facing right: dark skin tone" },
+    { u"👩🏾‍❤‍💋‍👨🏼", "kiss: woman, man, medium-dark skin tone, medium-light skin tone" },
+    { u"👝", "clutch bag" },
+    { u"🔐", "locked with key" },
+    { u"⚱", "funeral urn" },
+    { u"🧂", "salt" },
+    { u"🚨", "police car light" },
+    { u"🚴‍♂️", "man biking" },
+    { u"🙆🏼‍♀", "woman gesturing OK: medium-light skin tone" },
+    { u"🔇", "muted speaker" },
+    { u"🫃🏼", "pregnant man: medium-light skin tone" },
+    { u"🦝", "raccoon" },
+    { u"👱🏾‍♂️", "man: medium-dark skin tone, blond hair" },
+    { u"🌼", "blossom" },
+    { u"🤴🏾", "prince: medium-dark skin tone" },
+    { u"🕰", "mantelpiece clock" },
+    { u"🇵🇰", "flag: Pakistan" },
+    { u"💁🏻‍♀️", "woman tipping hand: light skin tone" },
+    { u"🤜🏼", "right-facing fist: medium-light skin tone" },
+    { u"🤦", "person facepalming" },
+    { u"🤦🏻", "person facepalming: light skin tone" },
+    { u"📶", "antenna bars" },
+    { u"🌥", "sun behind large cloud" },
+    { u"🧑🏿‍💻", "technologist: dark skin tone" },
+    { u"🧑🏿‍🦳", "person: dark skin tone, white hair" },
+    { u"🚴", "person biking" },
+    { u"👩🏿‍❤️‍💋‍👩🏽", "kiss: woman, woman, dark skin tone, medium skin tone" },
+    { u"👨‍🦼", "man in motorized wheelchair" },
+    { u"👩🏼", "woman: medium-light skin tone" },
+    { u"👨🏽‍🤝‍👨🏻", "men holding hands: medium skin tone, light skin tone" },
+    { u"🙂‍↕️", "head shaking vertically" },
+    { u"🇦🇹", "flag: Austria" },
+    { u"👨🏾‍❤‍👨🏻", "couple with heart: man, man, medium-dark skin tone, light skin tone" },
+    { u"💑🏿", "couple with heart: dark skin tone" },
+    { u"🟡", "yellow circle" },
+    { u"👩🏼‍✈", "woman pilot: medium-light skin tone" },
+    { u"🤸🏾‍♀", "woman cartwheeling: medium-dark skin tone" },
+    { u"❤️‍🩹", "mending heart" },
+    { u"👋🏿", "waving hand: dark skin tone" },
+    { u"⬆", "up arrow" },
+    { u"🤹‍♂️", "man juggling" },
+    { u"🧔🏼‍♂", "man: medium-light skin tone, beard" },
+    { u"🧑🏿‍🦼", "person in motorized wheelchair: dark skin tone" },
+    { u"🏌️‍♀", "woman golfing" },
+    { u"🧑🏿‍❤‍💋‍🧑🏽", "kiss: person, person, dark skin tone, medium skin tone" },
+    { u"🧗🏾", "person climbing: medium-dark skin tone" },
+    { u"🤘🏼", "sign of the horns: medium-light skin tone" },
+    { u"☯", "yin yang" },
+    { u"🧎‍♂", "man kneeling" },
+    { u"🚶🏿‍♀️‍➡️", "woman walking facing right: dark skin tone" },
+    { u"💅🏽", "nail polish: medium skin tone" },
+    { u"🧑🏾‍⚖", "judge: medium-dark skin tone" },
+    { u"🫱🏾‍🫲🏿", "handshake: medium-dark skin tone, dark skin tone" },
+    { u"🎅🏻", "Santa Claus: light skin tone" },
+    { u"🧹", "broom" },
+    { u"🏃🏼‍➡️", "person running facing right: medium-light skin tone" },
+    { u"🧑🏾‍🦽", "person in manual wheelchair: medium-dark skin tone" },
+    { u"👩🏾‍❤‍💋‍👩🏿", "kiss: woman, woman, medium-dark skin tone, dark skin tone" },
+    { u"🇦🇴", "flag: Angola" },
+    { u"🍟", "french fries" },
+    { u"👨🏿‍❤‍💋‍👨🏾", "kiss: man, man, dark skin tone, medium-dark skin tone" },
+    { u"💁🏼‍♂️", "man tipping hand: medium-light skin tone" },
+    { u"👩🏻‍❤‍💋‍👩🏿", "kiss: woman, woman, light skin tone, dark skin tone" },
+    { u"👨🏿‍❤️‍👨🏼", "couple with heart: man, man, dark skin tone, medium-light skin tone" },
+    { u"🇨🇶", "flag: Sark" },
+    { u"🎯", "bullseye" },
+    { u"🫃🏻", "pregnant man: light skin tone" },
+    { u"👨🏽‍💼", "man office worker: medium skin tone" },
+    { u"🧚🏻‍♂", "man fairy: light skin tone" },
+    { u"🤖", "robot" },
+    { u"🧏🏼‍♂️", "deaf man: medium-light skin tone" },
+    { u"🚣🏻‍♀️", "woman rowing boat: light skin tone" },
+    { u"👨🏾‍🏭", "man factory worker: medium-dark skin tone" },
+    { u"🤱🏻", "breast-feeding: light skin tone" },
+    { u"🫰", "hand with index finger and thumb crossed" },
+    { u"🏌🏻‍♂️", "man golfing: light skin tone" },
+    { u"Ⓜ️", "circled M" },
+    { u"💁🏽‍♀", "woman tipping hand: medium skin tone" },
+    { u"👩🏾‍❤️‍👨🏼", "couple with heart: woman, man, medium-dark skin tone, medium-light skin tone" },
+    { u"👩🏽‍🦯", "woman with white cane: medium skin tone" },
+    { u"🚦", "vertical traffic light" },
+    { u"🧔🏼‍♂️", "man: medium-light skin tone, beard" },
+    { u"🧑🏿‍❤‍🧑🏼", "couple with heart: person, person, dark skin tone, medium-light skin tone" },
+    { u"👩🏾‍❤‍👨🏼", "couple with heart: woman, man, medium-dark skin tone, medium-light skin tone" },
+    { u"🕵🏽‍♂️", "man detective: medium skin tone" },
+    { u"👨🏻‍✈️", "man pilot: light skin tone" },
+    { u"📗", "green book" },
+    { u"🧑🏻‍⚖️", "judge: light skin tone" },
+    { u"🙎🏼‍♂️", "man pouting: medium-light skin tone" },
+    { u"🕊", "dove" },
+    { u"🎅🏽", "Santa Claus: medium skin tone" },
+    { u"🧘🏼‍♂", "man in lotus position: medium-light skin tone" },
+    { u"🚵🏾", "person mountain biking: medium-dark skin tone" },
+    { u"❎", "cross mark button" },
+    { u"👨🏻‍⚖", "man judge: light skin tone" },
+    { u"👟", "running shoe" },
+    { u"🤽🏿‍♀️", "woman playing water polo: dark skin tone" },
+    { u"💋", "kiss mark" },
+    { u"💁🏽‍♀️", "woman tipping hand: medium skin tone" },
+    { u"🧖🏼‍♂️", "man in steamy room: medium-light skin tone" },
+    { u"😓", "downcast face with sweat" },
+    { u"📽", "film projector" },
+    { u"🤞🏾", "crossed fingers: medium-dark skin tone" },
+    { u"🧖🏻‍♂️", "man in steamy room: light skin tone" },
+    { u"🇾🇹", "flag: Mayotte" },
+    { u"➡️", "right arrow" },
+    { u"🌉", "bridge at night" },
+    { u"🌟", "glowing star" },
+    { u"👨🏿", "man: dark skin tone" },
+    { u"👩‍❤️‍💋‍👨", "kiss: woman, man" },
+    { u"🧏🏻‍♀", "deaf woman: light skin tone" },
+    { u"👩🏾‍🦽‍➡", "woman in manual wheelchair facing right: medium-dark skin tone" },
+    { u"🌧️", "cloud with rain" },
+    { u"🥦", "broccoli" },
+    { u"🤾🏻‍♂", "man playing handball: light skin tone" },
+    { u"🫶🏼", "heart hands: medium-light skin tone" },
+    { u"🤶", "Mrs. Claus" },
+    { u"☄", "comet" },
+    { u"✒", "black nib" },
+    { u"🔊", "speaker high volume" },
+    { u"⛹🏽", "person bouncing ball: medium skin tone" },
+    { u"🛞", "wheel" },
+    { u"🔆", "bright button" },
+    { u"🧑🏽‍🏫", "teacher: medium skin tone" },
+    { u"🚾", "water closet" },
+    { u"🚮", "litter in bin sign" },
+    { u"👌🏿", "OK hand: dark skin tone" },
+    { u"👩‍👩‍👧", "family: woman, woman, girl" },
+    { u"🗼", "Tokyo tower" },
+    { u"🤵🏽‍♀️", "woman in tuxedo: medium skin tone" },
+    { u"🍘", "rice cracker" },
+    { u"🧘🏿‍♂", "man in lotus position: dark skin tone" },
+    { u"🧚‍♀️", "woman fairy" },
+    { u"👩🏼‍❤‍👩🏿", "couple with heart: woman, woman, medium-light skin tone, dark skin tone" },
+    { u"🇭🇳", "flag: Honduras" },
+    { u"🌹", "rose" },
+    { u"👩🏽‍❤‍👩🏼", "couple with heart: woman, woman, medium skin tone, medium-light skin tone" },
+    { u"🚶🏾‍♂️", "man walking: medium-dark skin tone" },
+    { u"🗽", "Statue of Liberty" },
+    { u"🙌🏽", "raising hands: medium skin tone" },
+    { u"👨🏾‍🏫", "man teacher: medium-dark skin tone" },
+    { u"🦂", "scorpion" },
+    { u"🇯🇪", "flag: Jersey" },
+    { u"⏺", "record button" },
+    { u"🙋🏻‍♀️", "woman raising hand: light skin tone" },
+    { u"👳🏼‍♀", "woman wearing turban: medium-light skin tone" },
+    { u"🚴🏾‍♀️", "woman biking: medium-dark skin tone" },
+    { u"🔈", "speaker low volume" },
+    { u"📚", "books" },
+    { u"👄", "mouth" },
+    { u"🏋️‍♂️", "man lifting weights" },
+    { u"🧎🏻‍♀️‍➡️", "woman kneeling facing right: light skin tone" },
+    { u"🤹🏻‍♀️", "woman juggling: light skin tone" },
+    { u"👳🏿‍♂", "man wearing turban: dark skin tone" },
+    { u"👰🏿‍♂", "man with veil: dark skin tone" },
+    { u"👨‍👩‍👧", "family: man, woman, girl" },
+    { u"🧑🏼‍🍼", "person feeding baby: medium-light skin tone" },
+    { u"🇺🇬", "flag: Uganda" },
+    { u"🏪", "convenience store" },
+    { u"💧", "droplet" },
+    { u"🤦🏽‍♀", "woman facepalming: medium skin tone" },
+    { u"👨🏿‍✈", "man pilot: dark skin tone" },
+    { u"👩🏿‍🦳", "woman: dark skin tone, white hair" },
+    { u"🖐🏿", "hand with fingers splayed: dark skin tone" },
+    { u"🧑🏻‍🔬", "scientist: light skin tone" },
+    { u"🫸🏿", "rightwards pushing hand: dark skin tone" },
+    { u"🛤", "railway track" },
+    { u"🧎🏼‍♂️", "man kneeling: medium-light skin tone" },
+    { u"🧑🏻‍🦯‍➡️", "person with white cane facing right: light skin tone" },
+    { u"⬜", "white large square" },
+    { u"🚴🏻‍♂️", "man biking: light skin tone" },
+    { u"4⃣", "keycap: 4" },
+    { u"👨🏻‍🚒", "man firefighter: light skin tone" },
+    { u"🗞️", "rolled-up newspaper" },
+    { u"🇸🇳", "flag: Senegal" },
+    { u"🧑🏼‍🤝‍🧑🏾", "people holding hands: medium-light skin tone, medium-dark skin tone" },
+    { u"🥽", "goggles" },
+    { u"🇺🇿", "flag: Uzbekistan" },
+    { u"👩🏾‍✈", "woman pilot: medium-dark skin tone" },
+    { u"✈", "airplane" },
+    { u"🧑🏽‍❤‍💋‍🧑🏾", "kiss: person, person, medium skin tone, medium-dark skin tone" },
+    { u"💇🏾", "person getting haircut: medium-dark skin tone" },
+    { u"⚔", "crossed swords" },
+    { u"🧙🏿‍♀️", "woman mage: dark skin tone" },
+    { u"🚶🏻", "person walking: light skin tone" },
+    { u"🇬🇺", "flag: Guam" },
+    { u"🤽‍♂️", "man playing water polo" },
+    { u"👩‍👩‍👧‍👦", "family: woman, woman, girl, boy" },
+    { u"♿", "wheelchair symbol" },
+    { u"4️⃣", "keycap: 4" },
+    { u"👨🏻‍🍼", "man feeding baby: light skin tone" },
+    { u"🦭", "seal" },
+    { u"🏃🏾‍♂️‍➡", "man running facing right: medium-dark skin tone" },
+    { u"🦻", "ear with hearing aid" },
+    { u"⛄", "snowman without snow" },
+    { u"🧜🏽", "merperson: medium skin tone" },
+    { u"🫱🏽‍🫲🏻", "handshake: medium skin tone, light skin tone" },
+    { u"🙍🏽‍♂", "man frowning: medium skin tone" },
+    { u"🧑🏾‍❤‍🧑🏻", "couple with heart: person, person, medium-dark skin tone, light skin tone" },
+    { u"👩🏿‍❤‍👩🏾", "couple with heart: woman, woman, dark skin tone, medium-dark skin tone" },
+    { u"🙋🏾‍♀", "woman raising hand: medium-dark skin tone" },
+    { u"🏌‍♂️", "man golfing" },
+    { u"🧑🏾‍🦳", "person: medium-dark skin tone, white hair" },
+    { u"👩🏾‍🦳", "woman: medium-dark skin tone, white hair" },
+    { u"🇪🇹", "flag: Ethiopia" },
+    { u"🐛", "bug" },
+    { u"🙅🏻", "person gesturing NO: light skin tone" },
+    { u"🙅🏼‍♂", "man gesturing NO: medium-light skin tone" },
+    { u"💑🏼", "couple with heart: medium-light skin tone" },
+    { u"👨🏼‍🦳", "man: medium-light skin tone, white hair" },
+    { u"🥶", "cold face" },
+    { u"❓", "red question mark" },
+    { u"🇧🇩", "flag: Bangladesh" },
+    { u"🙎🏿‍♂", "man pouting: dark skin tone" },
+    { u"🧑🏽‍⚕", "health worker: medium skin tone" },
+    { u"👆🏾", "backhand index pointing up: medium-dark skin tone" },
+    { u"🪽", "wing" },
+    { u"🇭🇺", "flag: Hungary" },
+    { u"🥝", "kiwi fruit" },
+    { u"👨🏾‍🦼", "man in motorized wheelchair: medium-dark skin tone" },
+    { u"👨🏾‍🎤", "man singer: medium-dark skin tone" },
+    { u"♣", "club suit" },
+    { u"👳🏻‍♂", "man wearing turban: light skin tone" },
+    { u"🧍🏻", "person standing: light skin tone" },
+    { u"🕉️", "om" },
+    { u"🏎", "racing car" },
+    { u"🦰", "red hair" },
+    { u"👩🏻‍❤️‍👩🏿", "couple with heart: woman, woman, light skin tone, dark skin tone" },
+    { u"🕑", "two o’clock" },
+    { u"🇱🇻", "flag: Latvia" },
+    { u"🤪", "zany face" },
+    { u"🌪", "tornado" },
+    { u"🐽", "pig nose" },
+    { u"👩🏾‍🤝‍👨🏼", "woman and man holding hands: medium-dark skin tone, medium-light skin tone" },
+    { u"🤝", "handshake" },
+    { u"🪳", "cockroach" },
+    { u"🧑🏽‍⚖", "judge: medium skin tone" },
+    { u"👆🏽", "backhand index pointing up: medium skin tone" },
+    { u"🕉", "om" },
+    { u"👩🏾‍❤️‍💋‍👨🏽", "kiss: woman, man, medium-dark skin tone, medium skin tone" },
+    { u"🍄‍🟫", "brown mushroom" },
+    { u"🗜️", "clamp" },
+    { u"🫴🏼", "palm up hand: medium-light skin tone" },
+    { u"🧑🏼‍✈", "pilot: medium-light skin tone" },
+    { u"🚊", "tram" },
+    { u"👨🏿‍🦽‍➡", "man in manual wheelchair facing right: dark skin tone" },
+    { u"🧑🏾‍🔧", "mechanic: medium-dark skin tone" },
+    { u"✍🏼", "writing hand: medium-light skin tone" },
+    { u"👃🏼", "nose: medium-light skin tone" },
+    { u"👩🏻‍❤️‍💋‍👨🏻", "kiss: woman, man, light skin tone" },
+    { u"👰‍♂️", "man with veil" },
+    { u"🫟", "splatter" },
+    { u"👭🏾", "women holding hands: medium-dark skin tone" },
+    { u"🏃🏼‍♂‍➡️", "man running facing right: medium-light skin tone" },
+    { u"🇩🇿", "flag: Algeria" },
+    { u"🤝🏻", "handshake: light skin tone" },
+    { u"👨🏼‍🦽‍➡️", "man in manual wheelchair facing right: medium-light skin tone" },
+    { u"👨‍❤‍👨", "couple with heart: man, man" },
+    { u"🙄", "face with rolling eyes" },
+    { u"🏛", "classical building" },
+    { u"🙆‍♂", "man gesturing OK" },
+    { u"😊", "smiling face with smiling eyes" },
+    { u"🕵🏽‍♀", "woman detective: medium skin tone" },
+    { u"0️⃣", "keycap: 0" },
+    { u"🧔🏾‍♂", "man: medium-dark skin tone, beard" },
+    { u"🧝🏿‍♀️", "woman elf: dark skin tone" },
+    { u"👷🏼‍♂️", "man construction worker: medium-light skin tone" },
+    { u"🚶🏿‍♂️‍➡", "man walking facing right: dark skin tone" },
+    { u"⏬", "fast down button" },
+    { u"👰🏽‍♀", "woman with veil: medium skin tone" },
+    { u"🧁", "cupcake" },
+    { u"👷🏾‍♂", "man construction worker: medium-dark skin tone" },
+    { u"🧜🏿‍♀", "mermaid: dark skin tone" },
+    { u"👯‍♂", "men with bunny ears" },
+    { u"📩", "envelope with arrow" },
+    { u"🤸🏿‍♀️", "woman cartwheeling: dark skin tone" },
+    { u"🧑‍🔧", "mechanic" },
+    { u"👨🏽‍🚒", "man firefighter: medium skin tone" },
+    { u"👩🏾‍❤‍👩🏼", "couple with heart: woman, woman, medium-dark skin tone, medium-light skin tone" },
+    { u"🙆🏽", "person gesturing OK: medium skin tone" },
+    { u"👩🏻‍❤️‍👨🏿", "couple with heart: woman, man, light skin tone, dark skin tone" },
+    { u"🤽", "person playing water polo" },
+    { u"👩🏿‍❤️‍👩🏻", "couple with heart: woman, woman, dark skin tone, light skin tone" },
+    { u"🚶🏾‍♂‍➡️", "man walking facing right: medium-dark skin tone" },
+    { u"🇸🇨", "flag: Seychelles" },
+    { u"🕵🏽", "detective: medium skin tone" },
+    { u"👨🏿‍🚀", "man astronaut: dark skin tone" },
+    { u"🧑🏾‍❤‍💋‍🧑🏻", "kiss: person, person, medium-dark skin tone, light skin tone" },
+    { u"🧉", "mate" },
+    { u"🍫", "chocolate bar" },
+    { u"🪮", "hair pick" },
+    { u"🧝🏽‍♀", "woman elf: medium skin tone" },
+    { u"🚶🏽‍♂️‍➡", "man walking facing right: medium skin tone" },
+    { u"😮", "face with open mouth" },
+    { u"💁‍♂", "man tipping hand" },
+    { u"👩🏾‍❤‍💋‍👨🏽", "kiss: woman, man, medium-dark skin tone, medium skin tone" },
+    { u"🖍", "crayon" },
+    { u"👨🏿‍💼", "man office worker: dark skin tone" },
+    { u"👩🏼‍🎓", "woman student: medium-light skin tone" },
+    { u"🔔", "bell" },
+    { u"🙋🏻", "person raising hand: light skin tone" },
+    { u"🥑", "avocado" },
+    { u"🤽‍♂", "man playing water polo" },
+    { u"🗺", "world map" },
+    { u"👩🏽‍🍳", "woman cook: medium skin tone" },
+    { u"🥷🏾", "ninja: medium-dark skin tone" },
+    { u"🏃‍♂️‍➡️", "man running facing right" },
+    { u"👨🏿‍❤️‍👨🏽", "couple with heart: man, man, dark skin tone, medium skin tone" },
+    { u"🚞", "mountain railway" },
+    { u"👩🏽‍🏫", "woman teacher: medium skin tone" },
+    { u"🧒🏿", "child: dark skin tone" },
+    { u"🇼🇫", "flag: Wallis & Futuna" },
+    { u"👶🏻", "baby: light skin tone" },
+    { u"🧑🏼", "person: medium-light skin tone" },
+    { u"👨🏻‍❤‍👨🏼", "couple with heart: man, man, light skin tone, medium-light skin tone" },
+    { u"🇧🇶", "flag: Caribbean Netherlands" },
+    { u"👨🏻‍❤️‍💋‍👨🏾", "kiss: man, man, light skin tone, medium-dark skin tone" },
+    { u"🙎🏾‍♀", "woman pouting: medium-dark skin tone" },
+    { u"🚵🏿‍♂", "man mountain biking: dark skin tone" },
+    { u"🌎", "globe showing Americas" },
+    { u"🎅🏿", "Santa Claus: dark skin tone" },
+    { u"🧎🏼‍♂", "man kneeling: medium-light skin tone" },
+    { u"🤶🏿", "Mrs. Claus: dark skin tone" },
+    { u"⛴", "ferry" },
+    { u"🚯", "no littering" },
+    { u"⛈", "cloud with lightning and rain" },
+    { u"🏕", "camping" },
+    { u"🚶🏼‍➡️", "person walking facing right: medium-light skin tone" },
+    { u"🗣️", "speaking head" },
+    { u"🚣🏻‍♀", "woman rowing boat: light skin tone" },
+    { u"⛵", "sailboat" },
+    { u"🫵🏾", "index pointing at the viewer: medium-dark skin tone" },
+    { u"⏮", "last track button" },
+    { u"🧑‍🏭", "factory worker" },
+    { u"☔️", "umbrella with rain drops" },
+    { u"🦸🏻‍♂", "man superhero: light skin tone" },
+    { u"👦", "boy" },
+    { u"🔉", "speaker medium volume" },
+    { u"🏊🏼", "person swimming: medium-light skin tone" },
+    { u"👰🏻", "person with veil: light skin tone" },
+    { u"🙎", "person pouting" },
+    { u"👨‍👧", "family: man, girl" },
+    { u"🇨🇵", "flag: Clipperton Island" },
+    { u"🏩", "love hotel" },
+    { u"🙍🏽‍♀", "woman frowning: medium skin tone" },
+    { u"⛩️", "shinto shrine" },
+    { u"✨️", "sparkles" },
+    { u"🤹🏻", "person juggling: light skin tone" },
+    { u"🤱", "breast-feeding" },
+    { u"💪🏽", "flexed biceps: medium skin tone" },
+    { u"💂🏿‍♀", "woman guard: dark skin tone" },
+    { u"🧑🏾‍🎨", "artist: medium-dark skin tone" },
+    { u"🧔🏾‍♀", "woman: medium-dark skin tone, beard" },
+    { u"🇧🇴", "flag: Bolivia" },
+    { u"😇", "smiling face with halo" },
+    { u"🏃🏽‍♂️", "man running: medium skin tone" },
+    { u"🇸🇮", "flag: Slovenia" },
+    { u"🤵🏿‍♂", "man in tuxedo: dark skin tone" },
+    { u"🏃🏻‍♀", "woman running: light skin tone" },
+    { u"🔭", "telescope" },
+    { u"🤞", "crossed fingers" },
+    { u"📥", "inbox tray" },
+    { u"♒", "Aquarius" },
+    { u"📈", "chart increasing" },
+    { u"🍺", "beer mug" },
+    { u"🇱🇾", "flag: Libya" },
+    { u"🍼", "baby bottle" },
+    { u"🙋🏼‍♀", "woman raising hand: medium-light skin tone" },
+    { u"🛌🏼", "person in bed: medium-light skin tone" },
+    { u"🥊", "boxing glove" },
+    { u"🐔", "chicken" },
+    { u"🕤", "nine-thirty" },
+    { u"🛵", "motor scooter" },
+    { u"🙍🏾‍♀", "woman frowning: medium-dark skin tone" },
+    { u"👨🏾‍❤️‍👨🏻", "couple with heart: man, man, medium-dark skin tone, light skin tone" },
+    { u"👃🏿", "nose: dark skin tone" },
+    { u"🧵", "thread" },
+    { u"☕", "hot beverage" },
+    { u"🕵🏼", "detective: medium-light skin tone" },
+    { u"㊗️", "Japanese “congratulations” button" },
+    { u"👨‍👩‍👦‍👦", "family: man, woman, boy, boy" },
+    { u"👨🏻‍🦲", "man: light skin tone, bald" },
+    { u"🫱🏻‍🫲🏼", "handshake: light skin tone, medium-light skin tone" },
+    { u"🕵🏿‍♂️", "man detective: dark skin tone" },
+    { u"💃🏿", "woman dancing: dark skin tone" },
+    { u"🧛🏾", "vampire: medium-dark skin tone" },
+    { u"⛹️‍♂️", "man bouncing ball" },
+    { u"♂", "male sign" },
+    { u"⚕️", "medical symbol" },
+    { u"👨🏼‍🦼‍➡️", "man in motorized wheelchair facing right: medium-light skin tone" },
+    { u"🏉", "rugby football" },
+    { u"🧑‍🦳", "person: white hair" },
+    { u"🫳", "palm down hand" },
+    { u"🧍🏿‍♀", "woman standing: dark skin tone" },
+    { u"🌐", "globe with meridians" },
+    { u"🦹🏻‍♂", "man supervillain: light skin tone" },
+    { u"👩🏼‍❤️‍💋‍👩🏼", "kiss: woman, woman, medium-light skin tone" },
+    { u"👩🏻‍🎤", "woman singer: light skin tone" },
+    { u"😎", "smiling face with sunglasses" },
+    { u"🧎🏽‍♀️", "woman kneeling: medium skin tone" },
+    { u"🧑🏾‍🎤", "singer: medium-dark skin tone" },
+    { u"🫱🏼‍🫲🏾", "handshake: medium-light skin tone, medium-dark skin tone" },
+    { u"👨🏾‍⚖", "man judge: medium-dark skin tone" },
+    { u"🧐", "face with monocle" },
+    { u"⛹️‍♀", "woman bouncing ball" },
+    { u"👩🏼‍🦳", "woman: medium-light skin tone, white hair" },
+    { u"💂🏼‍♀️", "woman guard: medium-light skin tone" },
+    { u"🅱", "B button (blood type)" },
+    { u"👴🏽", "old man: medium skin tone" },
+    { u"*️⃣", "keycap: *" },
+    { u"🧑🏽‍💼", "office worker: medium skin tone" },
+    { u"😋", "face savoring food" },
+    { u"🇸🇯", "flag: Svalbard & Jan Mayen" },
+    { u"👩🏼‍🦽‍➡️", "woman in manual wheelchair facing right: medium-light skin tone" },
+    { u"🚶🏽‍♂️", "man walking: medium skin tone" },
+    { u"🪱", "worm" },
+    { u"👩🏼‍❤️‍💋‍👩🏻", "kiss: woman, woman, medium-light skin tone, light skin tone" },
+    { u"🚣‍♂", "man rowing boat" },
+    { u"📌", "pushpin" },
+    { u"🇻🇳", "flag: Vietnam" },
+    { u"👨🏽‍🤝‍👨🏾", "men holding hands: medium skin tone, medium-dark skin tone" },
+    { u"💅🏾", "nail polish: medium-dark skin tone" },
+    { u"🍩", "doughnut" },
+    { u"👎🏾", "thumbs down: medium-dark skin tone" },
+    { u"➕", "plus" },
+    { u"🤷🏼‍♂️", "man shrugging: medium-light skin tone" },
+    { u"🫳🏾", "palm down hand: medium-dark skin tone" },
+    { u"👩🏽", "woman: medium skin tone" },
+    { u"🙅🏿‍♀", "woman gesturing NO: dark skin tone" },
+    { u"⛅", "sun behind cloud" },
+    { u"👩🏽‍❤️‍💋‍👩🏾", "kiss: woman, woman, medium skin tone, medium-dark skin tone" },
+    { u"🧑🏼‍❤️‍🧑🏾", "couple with heart: person, person, medium-light skin tone, medium-dark skin tone" },
+    { u"🧏🏼‍♀", "deaf woman: medium-light skin tone" },
+    { u"🏌🏻‍♂", "man golfing: light skin tone" },
+    { u"👩🏼‍🌾", "woman farmer: medium-light skin tone" },
+    { u"🙅‍♀️", "woman gesturing NO" },
+    { u"🙇🏼‍♀️", "woman bowing: medium-light skin tone" },
+    { u"🛍", "shopping bags" },
+    { u"👴🏼", "old man: medium-light skin tone" },
+    { u"🤲🏼", "palms up together: medium-light skin tone" },
+    { u"🧍🏼", "person standing: medium-light skin tone" },
+    { u"👩🏽‍❤‍👩🏿", "couple with heart: woman, woman, medium skin tone, dark skin tone" },
+    { u"🙅🏻‍♂", "man gesturing NO: light skin tone" },
+    { u"🕍", "synagogue" },
+    { u"👨🏾‍🍼", "man feeding baby: medium-dark skin tone" },
+    { u"🧙🏻‍♂", "man mage: light skin tone" },
+    { u"🥀", "wilted flower" },
+    { u"🤯", "exploding head" },
+    { u"🪗", "accordion" },
+    { u"👩‍❤‍👨", "couple with heart: woman, man" },
+    { u"🦹🏻‍♂️", "man supervillain: light skin tone" },
+    { u"🫚", "ginger root" },
+    { u"🚶🏿", "person walking: dark skin tone" },
+    { u"🕙", "ten o’clock" },
+    { u"🇬🇧", "flag: United Kingdom" },
+    { u"🧎🏾‍♂", "man kneeling: medium-dark skin tone" },
+    { u"🏙", "cityscape" },
+    { u"🧑🏾‍🤝‍🧑🏻", "people holding hands: medium-dark skin tone, light skin tone" },
+    { u"👧🏿", "girl: dark skin tone" },
+    { u"👨🏻‍🦯‍➡️", "man with white cane facing right: light skin tone" },
+    { u"🕺🏽", "man dancing: medium skin tone" },
+    { u"💩", "pile of poo" },
+    { u"👰🏾‍♀️", "woman with veil: medium-dark skin tone" },
+    { u"👏🏼", "clapping hands: medium-light skin tone" },
+    { u"🪲", "beetle" },
+    { u"👷🏻‍♂️", "man construction worker: light skin tone" },
+    { u"👨🏻‍🦽‍➡", "man in manual wheelchair facing right: light skin tone" },
+    { u"🤾🏽‍♀", "woman playing handball: medium skin tone" },
+    { u"🇧🇸", "flag: Bahamas" },
+    { u"👩🏽‍⚖", "woman judge: medium skin tone" },
+    { u"🕧", "twelve-thirty" },
+    { u"🧔‍♂", "man: beard" },
+    { u"⏰", "alarm clock" },
+    { u"🇵🇲", "flag: St. Pierre & Miquelon" },
+    { u"👨‍🎓", "man student" },
+    { u"🎙️", "studio microphone" },
+    { u"✳", "eight-spoked asterisk" },
+    { u"⛰️", "mountain" },
+    { u"♏", "Scorpio" },
+    { u"🤾🏾‍♀️", "woman playing handball: medium-dark skin tone" },
+    { u"🤚🏻", "raised back of hand: light skin tone" },
+    { u"👳🏾‍♀", "woman wearing turban: medium-dark skin tone" },
+    { u"👳‍♀", "woman wearing turban" },
+    { u"💂🏾‍♀️", "woman guard: medium-dark skin tone" },
+    { u"👩‍❤️‍👩", "couple with heart: woman, woman" },
+    { u"8⃣", "keycap: 8" },
+    { u"👩‍🎨", "woman artist" },
+    { u"👩🏼‍🦱", "woman: medium-light skin tone, curly hair" },
+    { u"🦮", "guide dog" },
+    { u"👨🏾‍🤝‍👨🏻", "men holding hands: medium-dark skin tone, light skin tone" },
+    { u"🧑🏾‍🤝‍🧑🏼", "people holding hands: medium-dark skin tone, medium-light skin tone" },
+    { u"🙋🏿‍♂", "man raising hand: dark skin tone" },
+    { u"🧑🏾‍🎄", "Mx Claus: medium-dark skin tone" },
+    { u"🥠", "fortune cookie" },
+    { u"🧰", "toolbox" },
+    { u"🇧🇷", "flag: Brazil" },
+    { u"👼🏻", "baby angel: light skin tone" },
+    { u"👨🏽‍🔬", "man scientist: medium skin tone" },
+    { u"👆🏼", "backhand index pointing up: medium-light skin tone" },
+    { u"👷🏾‍♂️", "man construction worker: medium-dark skin tone" },
+    { u"🛃", "customs" },
+    { u"🇲🇲", "flag: Myanmar (Burma)" },
+    { u"🔄", "counterclockwise arrows button" },
+    { u"👴🏿", "old man: dark skin tone" },
+    { u"💟", "heart decoration" },
+    { u"🙋", "person raising hand" },
+    { u"🧖‍♂", "man in steamy room" },
+    { u"🏃🏻‍♀‍➡", "woman running facing right: light skin tone" },
+    { u"🙎🏼", "person pouting: medium-light skin tone" },
+    { u"🈵", "Japanese “no vacancy” button" },
+    { u"🥋", "martial arts uniform" },
+    { u"💆🏽", "person getting massage: medium skin tone" },
+    { u"🧗🏽‍♂️", "man climbing: medium skin tone" },
+    { u"🤽🏾", "person playing water polo: medium-dark skin tone" },
+    { u"👷‍♂️", "man construction worker" },
+    { u"🏃🏾‍➡️", "person running facing right: medium-dark skin tone" },
+    { u"😕", "confused face" },
+    { u"🫱🏼‍🫲🏻", "handshake: medium-light skin tone, light skin tone" },
+    { u"🏋🏿‍♂", "man lifting weights: dark skin tone" },
+    { u"↪", "left arrow curving right" },
+    { u"🚥", "horizontal traffic light" },
+    { u"👨🏽‍🔧", "man mechanic: medium skin tone" },
+    { u"🇹🇴", "flag: Tonga" },
+    { u"🧑🏻‍❤️‍🧑🏼", "couple with heart: person, person, light skin tone, medium-light skin tone" },
+    { u"🫁", "lungs" },
+    { u"☝", "index pointing up" },
+    { u"⚒", "hammer and pick" },
+    { u"🐤", "baby chick" },
+    { u"👲🏾", "person with skullcap: medium-dark skin tone" },
+    { u"🙇🏾‍♀", "woman bowing: medium-dark skin tone" },
+    { u"🧑‍🎓", "student" },
+    { u"👩🏻‍🚀", "woman astronaut: light skin tone" },
+    { u"🧑🏿‍❤️‍🧑🏼", "couple with heart: person, person, dark skin tone, medium-light skin tone" },
+    { u"🧑🏾‍🦲", "person: medium-dark skin tone, bald" },
+    { u"👩🏿‍❤‍💋‍👩🏿", "kiss: woman, woman, dark skin tone" },
+    { u"👩🏾‍❤️‍💋‍👩🏾", "kiss: woman, woman, medium-dark skin tone" },
+    { u"👨🏽‍🦯‍➡", "man with white cane facing right: medium skin tone" },
+    { u"🧚🏿‍♀", "woman fairy: dark skin tone" },
+    { u"😹", "cat with tears of joy" },
+    { u"👩🏼‍❤‍💋‍👩🏻", "kiss: woman, woman, medium-light skin tone, light skin tone" },
+    { u"🖖🏼", "vulcan salute: medium-light skin tone" },
+    { u"↔", "left-right arrow" },
+    { u"👩🏼‍❤️‍👩🏿", "couple with heart: woman, woman, medium-light skin tone, dark skin tone" },
+    { u"👩🏾‍❤️‍👨🏻", "couple with heart: woman, man, medium-dark skin tone, light skin tone" },
+    { u"🤵‍♂️", "man in tuxedo" },
+    { u"♦", "diamond suit" },
+    { u"👨🏻‍🏫", "man teacher: light skin tone" },
+    { u"🎅🏾", "Santa Claus: medium-dark skin tone" },
+    { u"👰🏿‍♀️", "woman with veil: dark skin tone" },
+    { u"👨🏽‍❤️‍💋‍👨🏻", "kiss: man, man, medium skin tone, light skin tone" },
+    { u"🦹🏻‍♀", "woman supervillain: light skin tone" },
+    { u"💁🏼", "person tipping hand: medium-light skin tone" },
+    { u"🦹🏼‍♂", "man supervillain: medium-light skin tone" },
+    { u"👩‍🦰", "woman: red hair" },
+    { u"🥜", "peanuts" },
+    { u"🧖🏿‍♂️", "man in steamy room: dark skin tone" },
+    { u"👬🏻", "men holding hands: light skin tone" },
+    { u"🥨", "pretzel" },
+    { u"👨🏻‍❤️‍👨🏿", "couple with heart: man, man, light skin tone, dark skin tone" },
+    { u"🎐", "wind chime" },
+    { u"👮🏻", "police officer: light skin tone" },
+    { u"🤕", "face with head-bandage" },
+    { u"🧜🏾‍♀️", "mermaid: medium-dark skin tone" },
+    { u"🫏", "donkey" },
+    { u"🤧", "sneezing face" },
+    { u"🤸🏼", "person cartwheeling: medium-light skin tone" },
+    { u"👨🏻‍💻", "man technologist: light skin tone" },
+    { u"🕐", "one o’clock" },
+    { u"🧑🏻‍🤝‍🧑🏾", "people holding hands: light skin tone, medium-dark skin tone" },
+    { u"🧍🏾‍♀", "woman standing: medium-dark skin tone" },
+    { u"🧙🏿‍♂️", "man mage: dark skin tone" },
+    { u"👩🏾‍🦯", "woman with white cane: medium-dark skin tone" },
+    { u"🙇🏼", "person bowing: medium-light skin tone" },
+    { u"👱‍♀", "woman: blond hair" },
+    { u"⌚", "watch" },
+    { u"👨🏾‍🦽", "man in manual wheelchair: medium-dark skin tone" },
+    { u"💆🏽‍♂️", "man getting massage: medium skin tone" },
+    { u"👱🏾‍♀", "woman: medium-dark skin tone, blond hair" },
+    { u"🧘‍♂️", "man in lotus position" },
+    { u"👮🏿‍♂", "man police officer: dark skin tone" },
+    { u"🙎🏻‍♂️", "man pouting: light skin tone" },
+    { u"📪", "closed mailbox with lowered flag" },
+    { u"🗾", "map of Japan" },
+    { u"🏃🏾‍♀‍➡", "woman running facing right: medium-dark skin tone" },
+    { u"⛹🏿‍♀", "woman bouncing ball: dark skin tone" },
+    { u"🧎🏽‍♀️‍➡️", "woman kneeling facing right: medium skin tone" },
+    { u"🧚🏾‍♀", "woman fairy: medium-dark skin tone" },
+    { u"🏃🏿‍♀️‍➡", "woman running facing right: dark skin tone" },
+    { u"👩🏻‍❤‍💋‍👩🏽", "kiss: woman, woman, light skin tone, medium skin tone" },
+    { u"🧑🏿‍🎄", "Mx Claus: dark skin tone" },
+    { u"👨🏽‍🦼", "man in motorized wheelchair: medium skin tone" },
+    { u"🙂", "slightly smiling face" },
+    { u"🧟‍♂️", "man zombie" },
+    { u"🦶🏻", "foot: light skin tone" },
+    { u"🌨", "cloud with snow" },
+    { u"🇷🇴", "flag: Romania" },
+    { u"🏄🏼", "person surfing: medium-light skin tone" },
+    { u"😪", "sleepy face" },
+    { u"🧏🏾‍♂", "deaf man: medium-dark skin tone" },
+    { u"👩🏿‍🦱", "woman: dark skin tone, curly hair" },
+    { u"👩‍🎤", "woman singer" },
+    { u"🙇🏼‍♀", "woman bowing: medium-light skin tone" },
+    { u"🤾🏻‍♂️", "man playing handball: light skin tone" },
+    { u"🥿", "flat shoe" },
+    { u"🙎🏻‍♂", "man pouting: light skin tone" },
+    { u"🫲", "leftwards hand" },
+    { u"🧑🏿‍✈️", "pilot: dark skin tone" },
+    { u"👩🏿‍💻", "woman technologist: dark skin tone" },
+    { u"🧏🏿‍♂", "deaf man: dark skin tone" },
+    { u"🤛🏻", "left-facing fist: light skin tone" },
+    { u"👮🏿‍♂️", "man police officer: dark skin tone" },
+    { u"🥇", "1st place medal" },
+    { u"🙋🏼‍♂", "man raising hand: medium-light skin tone" },
+    { u"🧕", "woman with headscarf" },
+    { u"🧎🏿‍♂", "man kneeling: dark skin tone" },
+    { u"😟", "worried face" },
+    { u"👨🏾‍❤‍💋‍👨🏼", "kiss: man, man, medium-dark skin tone, medium-light skin tone" },
+    { u"👩🏼‍🤝‍👩🏿", "women holding hands: medium-light skin tone, dark skin tone" },
+    { u"🚵🏼", "person mountain biking: medium-light skin tone" },
+    { u"🏇🏿", "horse racing: dark skin tone" },
+    { u"⛪", "church" },
+    { u"🎟️", "admission tickets" },
+    { u"🇸🇸", "flag: South Sudan" },
+    { u"👩🏼‍❤️‍👨🏻", "couple with heart: woman, man, medium-light skin tone, light skin tone" },
+    { u"🎄", "Christmas tree" },
+    { u"🧬", "dna" },
+    { u"🎟", "admission tickets" },
+    { u"🚶🏾‍♂", "man walking: medium-dark skin tone" },
+    { u"👏🏻", "clapping hands: light skin tone" },
+    { u"💺", "seat" },
+    { u"🙍🏿‍♀️", "woman frowning: dark skin tone" },
+    { u"🇳🇬", "flag: Nigeria" },
+    { u"👨‍🍳", "man cook" },
+    { u"🧘🏽‍♀️", "woman in lotus position: medium skin tone" },
+    { u"🎼", "musical score" },
+    { u"🚪", "door" },
+    { u"🫱🏽‍🫲🏾", "handshake: medium skin tone, medium-dark skin tone" },
+    { u"🖼", "framed picture" },
+    { u"🚴🏼‍♀", "woman biking: medium-light skin tone" },
+    { u"🦚", "peacock" },
+    { u"👩‍🦯‍➡️", "woman with white cane facing right" },
+    { u"💆🏻‍♀", "woman getting massage: light skin tone" },
+    { u"🤙🏼", "call me hand: medium-light skin tone" },
+    { u"🧛🏿‍♀", "woman vampire: dark skin tone" },
+    { u"👩🏽‍❤️‍👨🏽", "couple with heart: woman, man, medium skin tone" },
+    { u"🤷🏻‍♂️", "man shrugging: light skin tone" },
+    { u"👰🏿", "person with veil: dark skin tone" },
+    { u"🍜", "steaming bowl" },
+    { u"💇🏽‍♂️", "man getting haircut: medium skin tone" },
+    { u"🧛🏻", "vampire: light skin tone" },
+    { u"👸🏾", "princess: medium-dark skin tone" },
+    { u"🏴󠁧󠁢󠁳󠁣󠁴󠁿", "flag: Scotland" },
+    { u"👠", "high-heeled shoe" },
+    { u"⛲", "fountain" },
+    { u"💣", "bomb" },
+    { u"🎹", "musical keyboard" },
+    { u"🤽🏻‍♀", "woman playing water polo: light skin tone" },
+    { u"⏮️", "last track button" },
+    { u"🥧", "pie" },
+    { u"🫱🏿‍🫲🏽", "handshake: dark skin tone, medium skin tone" },
+    { u"🧞", "genie" },
+    { u"🏻", "light skin tone" },
+    { u"💇🏾‍♀", "woman getting haircut: medium-dark skin tone" },
+    { u"🍱", "bento box" },
+    { u"👮🏾‍♀", "woman police officer: medium-dark skin tone" },
+    { u"🧎🏾‍➡", "person kneeling facing right: medium-dark skin tone" },
+    { u"🚶🏽‍♀‍➡", "woman walking facing right: medium skin tone" },
+    { u"👨🏿‍❤‍💋‍👨🏿", "kiss: man, man, dark skin tone" },
+    { u"🚶‍♀‍➡", "woman walking facing right" },
+    { u"👩🏾‍🦼‍➡", "woman in motorized wheelchair facing right: medium-dark skin tone" },
+    { u"🧜🏾‍♂", "merman: medium-dark skin tone" },
+    { u"🫰🏾", "hand with index finger and thumb crossed: medium-dark skin tone" },
+    { u"🙍🏼‍♀️", "woman frowning: medium-light skin tone" },
+    { u"👩🏻‍✈️", "woman pilot: light skin tone" },
+    { u"☂️", "umbrella" },
+    { u"👩🏽‍❤‍💋‍👩🏿", "kiss: woman, woman, medium skin tone, dark skin tone" },
+    { u"🧑🏿‍🏫", "teacher: dark skin tone" },
+    { u"☃", "snowman" },
+    { u"🇲🇿", "flag: Mozambique" },
+    { u"🦻🏾", "ear with hearing aid: medium-dark skin tone" },
+    { u"💭", "thought balloon" },
+    { u"🧑🏻‍🦽‍➡", "person in manual wheelchair facing right: light skin tone" },
+    { u"🫐", "blueberries" },
+    { u"🧎🏿‍♀‍➡", "woman kneeling facing right: dark skin tone" },
+    { u"🦜", "parrot" },
+    { u"🧙🏼‍♀", "woman mage: medium-light skin tone" },
+    { u"💅🏻", "nail polish: light skin tone" },
+    { u"🫤", "face with diagonal mouth" },
+    { u"🧛🏾‍♂️", "man vampire: medium-dark skin tone" },
+    { u"✝", "latin cross" },
+    { u"🧘🏻‍♂️", "man in lotus position: light skin tone" },
+    { u"🪔", "diya lamp" },
+    { u"🧑🏼‍🤝‍🧑🏽", "people holding hands: medium-light skin tone, medium skin tone" },
+    { u"🫷🏽", "leftwards pushing hand: medium skin tone" },
+    { u"😝", "squinting face with tongue" },
+    { u"🧑🏾‍⚖️", "judge: medium-dark skin tone" },
+    { u"👬🏿", "men holding hands: dark skin tone" },
+    { u"🏌🏻‍♀️", "woman golfing: light skin tone" },
+    { u"🧅", "onion" },
+    { u"👩‍💼", "woman office worker" },
+    { u"🧝🏻‍♀️", "woman elf: light skin tone" },
+    { u"🙋🏼", "person raising hand: medium-light skin tone" },
+    { u"🙆🏿‍♂", "man gesturing OK: dark skin tone" },
+    { u"🏌🏿‍♂", "man golfing: dark skin tone" },
+    { u"👩🏽‍🔬", "woman scientist: medium skin tone" },
+    { u"🛰", "satellite" },
+    { u"🙈", "see-no-evil monkey" },
+    { u"🚶🏿‍♂‍➡️", "man walking facing right: dark skin tone" },
+    { u"👨🏿‍🦱", "man: dark skin tone, curly hair" },
+    { u"🥎", "softball" },
+    { u"🍋‍🟩", "lime" },
+    { u"🤹🏼‍♂️", "man juggling: medium-light skin tone" },
+    { u"✉", "envelope" },
+    { u"🇰🇼", "flag: Kuwait" },
+    { u"👰‍♀", "woman with veil" },
+    { u"🚄", "high-speed train" },
+    { u"🏃🏻‍♂", "man running: light skin tone" },
+    { u"🎛", "control knobs" },
+    { u"👩🏽‍🦼", "woman in motorized wheelchair: medium skin tone" },
+    { u"🏊🏼‍♀️", "woman swimming: medium-light skin tone" },
+    { u"🙅🏾‍♀", "woman gesturing NO: medium-dark skin tone" },
+    { u"👩🏻‍🦯‍➡️", "woman with white cane facing right: light skin tone" },
+    { u"🙎🏿‍♀", "woman pouting: dark skin tone" },
+    { u"🥷🏿", "ninja: dark skin tone" },
+    { u"👩🏻‍🏭", "woman factory worker: light skin tone" },
+    { u"🛴", "kick scooter" },
+    { u"🌡", "thermometer" },
+    { u"👨🏿‍❤‍💋‍👨🏼", "kiss: man, man, dark skin tone, medium-light skin tone" },
+    { u"👩‍🦯‍➡", "woman with white cane facing right" },
+    { u"🚭", "no smoking" },
+    { u"👨🏿‍🌾", "man farmer: dark skin tone" },
+    { u"🇲🇶", "flag: Martinique" },
+    { u"👩🏽‍🤝‍👨🏼", "woman and man holding hands: medium skin tone, medium-light skin tone" },
+    { u"👐🏼", "open hands: medium-light skin tone" },
+    { u"👷🏿", "construction worker: dark skin tone" },
+    { u"👨🏼‍❤‍💋‍👨🏻", "kiss: man, man, medium-light skin tone, light skin tone" },
+    { u"🧑🏻‍❤️‍🧑🏽", "couple with heart: person, person, light skin tone, medium skin tone" },
+    { u"📤", "outbox tray" },
+    { u"🧛🏻‍♀️", "woman vampire: light skin tone" },
+    { u"💆", "person getting massage" },
+    { u"👩🏽‍❤️‍👩🏽", "couple with heart: woman, woman, medium skin tone" },
+    { u"🧑‍🍳", "cook" },
+    { u"🫱🏾‍🫲🏼", "handshake: medium-dark skin tone, medium-light skin tone" },
+    { u"👩🏽‍❤‍💋‍👩🏾", "kiss: woman, woman, medium skin tone, medium-dark skin tone" },
+    { u"👂🏽", "ear: medium skin tone" },
+    { u"👍", "thumbs up" },
+    { u"↖️", "up-left arrow" },
+    { u"👩🏼‍❤️‍💋‍👨🏿", "kiss: woman, man, medium-light skin tone, dark skin tone" },
+    { u"👈🏾", "backhand index pointing left: medium-dark skin tone" },
+    { u"🧑🏿‍🤝‍🧑🏽", "people holding hands: dark skin tone, medium skin tone" },
+    { u"🙋🏻‍♂", "man raising hand: light skin tone" },
+    { u"🏃🏽‍♂‍➡", "man running facing right: medium skin tone" },
+    { u"⚔️", "crossed swords" },
+    { u"👩‍👩‍👧‍👧", "family: woman, woman, girl, girl" },
+    { u"🚣🏾‍♀", "woman rowing boat: medium-dark skin tone" },
+    { u"🏃🏿‍♀️", "woman running: dark skin tone" },
+    { u"👩🏿‍🤝‍👨🏼", "woman and man holding hands: dark skin tone, medium-light skin tone" },
+    { u"🇵🇾", "flag: Paraguay" },
+    { u"❣", "heart exclamation" },
+    { u"🏇🏾", "horse racing: medium-dark skin tone" },
+    { u"🏃🏿‍♂", "man running: dark skin tone" },
+    { u"👩🏽‍❤‍👨🏿", "couple with heart: woman, man, medium skin tone, dark skin tone" },
+    { u"🇳🇫", "flag: Norfolk Island" },
+    { u"👩🏿‍🦯‍➡", "woman with white cane facing right: dark skin tone" },
+    { u"🚰", "potable water" },
+    { u"⌨", "keyboard" },
+    { u"♂️", "male sign" },
+    { u"🏊🏼‍♂", "man swimming: medium-light skin tone" },
+    { u"🆖", "NG button" },
+    { u"👩‍✈️", "woman pilot" },
+    { u"👨🏼‍🏫", "man teacher: medium-light skin tone" },
+    { u"🥔", "potato" },
+    { u"🍐", "pear" },
+    { u"👩🏽‍🍼", "woman feeding baby: medium skin tone" },
+    { u"🙇🏿", "person bowing: dark skin tone" },
+    { u"👩🏼‍🍳", "woman cook: medium-light skin tone" },
+    { u"🙎🏽‍♂️", "man pouting: medium skin tone" },
+    { u"👩‍❤️‍👨", "couple with heart: woman, man" },
+    { u"🛄", "baggage claim" },
+    { u"🏋🏽‍♂️", "man lifting weights: medium skin tone" },
+    { u"⛹🏽‍♂️", "man bouncing ball: medium skin tone" },
+    { u"👩‍🔬", "woman scientist" },
+    { u"🙆‍♂️", "man gesturing OK" },
+    { u"🇷🇺", "flag: Russia" },
+    { u"⚰", "coffin" },
+    { u"👩🏼‍🤝‍👩🏾", "women holding hands: medium-light skin tone, medium-dark skin tone" },
+    { u"☺️", "smiling face" },
+    { u"🧔‍♀", "woman: beard" },
+    { u"🫱🏽", "rightwards hand: medium skin tone" },
+    { u"🧑🏽‍🔬", "scientist: medium skin tone" },
+    { u"👩🏾‍❤‍💋‍👩🏽", "kiss: woman, woman, medium-dark skin tone, medium skin tone" },
+    { u"☝️", "index pointing up" },
+    { u"⛹🏾", "person bouncing ball: medium-dark skin tone" },
+    { u"👩🏻‍❤️‍👩🏽", "couple with heart: woman, woman, light skin tone, medium skin tone" },
+    { u"🤷🏿‍♂️", "man shrugging: dark skin tone" },
+    { u"💙", "blue heart" },
+    { u"🚐", "minibus" },
+    { u"🧗🏾‍♂️", "man climbing: medium-dark skin tone" },
+    { u"👩🏿‍🏭", "woman factory worker: dark skin tone" },
+    { u"🧏‍♂️", "deaf man" },
+    { u"🧑🏿‍🦲", "person: dark skin tone, bald" },
+    { u"👨🏾‍🌾", "man farmer: medium-dark skin tone" },
+    { u"💆‍♂️", "man getting massage" },
+    { u"🎏", "carp streamer" },
+    { u"🦡", "badger" },
+    { u"🧜🏽‍♂️", "merman: medium skin tone" },
+    { u"👨🏼‍⚖", "man judge: medium-light skin tone" },
+    { u"🛁", "bathtub" },
+    { u"🇧🇪", "flag: Belgium" },
+    { u"◼", "black medium square" },
+    { u"❄️", "snowflake" },
+    { u"🛌🏻", "person in bed: light skin tone" },
+    { u"🍗", "poultry leg" },
+    { u"💆🏿‍♂", "man getting massage: dark skin tone" },
+    { u"🧎🏿", "person kneeling: dark skin tone" },
+    { u"🤚", "raised back of hand" },
+    { u"🚴🏽‍♂", "man biking: medium skin tone" },
+    { u"👩🏿‍🤝‍👨🏾", "woman and man holding hands: dark skin tone, medium-dark skin tone" },
+    { u"👨‍❤️‍💋‍👨", "kiss: man, man" },
+    { u"🕵‍♂", "man detective" },
+    { u"🧑🏼‍🎨", "artist: medium-light skin tone" },
+    { u"🔞", "no one under eighteen" },
+    { u"🙇‍♀️", "woman bowing" },
+    { u"🇧🇲", "flag: Bermuda" },
+    { u"👨🏼‍❤️‍💋‍👨🏾", "kiss: man, man, medium-light skin tone, medium-dark skin tone" },
+    { u"🤷🏾‍♂", "man shrugging: medium-dark skin tone" },
+    { u"👳🏾", "person wearing turban: medium-dark skin tone" },
+    { u"🌑", "new moon" },
+    { u"⛷️", "skier" },
+    { u"👩🏼‍⚖", "woman judge: medium-light skin tone" },
+    { u"👳🏽‍♀", "woman wearing turban: medium skin tone" },
+    { u"♠", "spade suit" },
+    { u"👩🏽‍🤝‍👩🏼", "women holding hands: medium skin tone, medium-light skin tone" },
+    { u"⚙️", "gear" },
+    { u"⛹‍♂️", "man bouncing ball" },
+    { u"🧛‍♀", "woman vampire" },
+    { u"👩🏿‍❤️‍👨🏻", "couple with heart: woman, man, dark skin tone, light skin tone" },
+    { u"🤸🏼‍♂", "man cartwheeling: medium-light skin tone" },
+    { u"🏺", "amphora" },
+    { u"🐃", "water buffalo" },
+    { u"🇰🇿", "flag: Kazakhstan" },
+    { u"👳🏼‍♂️", "man wearing turban: medium-light skin tone" },
+    { u"🍖", "meat on bone" },
+    { u"🧑‍🦯", "person with white cane" },
+    { u"🤿", "diving mask" },
+    { u"🛠️", "hammer and wrench" },
+    { u"♈", "Aries" },
+    { u"🤑", "money-mouth face" },
+    { u"®", "registered" },
+    { u"🙅🏾‍♂️", "man gesturing NO: medium-dark skin tone" },
+    { u"💂🏻‍♂", "man guard: light skin tone" },
+    { u"🤹🏻‍♀", "woman juggling: light skin tone" },
+    { u"👩🏽‍🚀", "woman astronaut: medium skin tone" },
+    { u"🧘🏾‍♂️", "man in lotus position: medium-dark skin tone" },
+    { u"🇬🇳", "flag: Guinea" },
+    { u"👨🏽‍❤‍👨🏼", "couple with heart: man, man, medium skin tone, medium-light skin tone" },
+    { u"🧕🏻", "woman with headscarf: light skin tone" },
+    { u"👨🏻‍❤️‍👨🏽", "couple with heart: man, man, light skin tone, medium skin tone" },
+    { u"⏺️", "record button" },
+    { u"👷🏻‍♀", "woman construction worker: light skin tone" },
+    { u"🧑🏻‍🤝‍🧑🏻", "people holding hands: light skin tone" },
+    { u"🇨🇮", "flag: Côte d’Ivoire" },
+    { u"🙎🏾‍♂", "man pouting: medium-dark skin tone" },
+    { u"🧗🏾‍♂", "man climbing: medium-dark skin tone" },
+    { u"💉", "syringe" },
+    { u"🏋🏽‍♀", "woman lifting weights: medium skin tone" },
+    { u"📻", "radio" },
+    { u"🧎‍♂‍➡️", "man kneeling facing right" },
+    { u"👩‍🍼", "woman feeding baby" },
+    { u"⛓️", "chains" },
+    { u"👩🏻‍❤️‍💋‍👨🏽", "kiss: woman, man, light skin tone, medium skin tone" },
+    { u"🫱🏼‍🫲🏽", "handshake: medium-light skin tone, medium skin tone" },
+    { u"🫓", "flatbread" },
+    { u"🏂🏼", "snowboarder: medium-light skin tone" },
+    { u"💇🏿‍♀", "woman getting haircut: dark skin tone" },
+    { u"👉🏿", "backhand index pointing right: dark skin tone" },
+    { u"🧎🏼‍♂‍➡️", "man kneeling facing right: medium-light skin tone" },
+    { u"✌", "victory hand" },
+    { u"🤷🏻", "person shrugging: light skin tone" },
+    { u"⛹🏻", "person bouncing ball: light skin tone" },
+    { u"🙅‍♂️", "man gesturing NO" },
+    { u"💂🏻‍♀️", "woman guard: light skin tone" },
+    { u"🙍🏾", "person frowning: medium-dark skin tone" },
+    { u"👨🏽‍⚕", "man health worker: medium skin tone" },
+    { u"👩🏾‍💻", "woman technologist: medium-dark skin tone" },
+    { u"🇹🇼", "flag: Taiwan" },
+    { u"🧍🏽‍♀️", "woman standing: medium skin tone" },
+    { u"👩🏿‍❤‍💋‍👨🏽", "kiss: woman, man, dark skin tone, medium skin tone" },
+    { u"🙍🏽‍♂️", "man frowning: medium skin tone" },
+    { u"🇱🇧", "flag: Lebanon" },
+    { u"👩🏼‍🤝‍👩🏽", "women holding hands: medium-light skin tone, medium skin tone" },
+    { u"📞", "telephone receiver" },
+    { u"👼🏽", "baby angel: medium skin tone" },
+    { u"🇵🇫", "flag: French Polynesia" },
+    { u"🫴🏻", "palm up hand: light skin tone" },
+    { u"😢", "crying face" },
+    { u"🧏🏼", "deaf person: medium-light skin tone" },
+    { u"👩🏾‍❤️‍💋‍👩🏼", "kiss: woman, woman, medium-dark skin tone, medium-light skin tone" },
+    { u"👨‍🦼‍➡️", "man in motorized wheelchair facing right" },
+    { u"🤽‍♀", "woman playing water polo" },
+    { u"🧏🏿", "deaf person: dark skin tone" },
+    { u"👨🏼‍🦯‍➡️", "man with white cane facing right: medium-light skin tone" },
+    { u"🤩", "star-struck" },
+    { u"👨🏼‍❤‍💋‍👨🏾", "kiss: man, man, medium-light skin tone, medium-dark skin tone" },
+    { u"🤾🏾‍♀", "woman playing handball: medium-dark skin tone" },
+    { u"🤵🏻‍♀", "woman in tuxedo: light skin tone" },
+    { u"😺", "grinning cat" },
+    { u"🫶🏽", "heart hands: medium skin tone" },
+    { u"🙏🏽", "folded hands: medium skin tone" },
+    { u"⚧️", "transgender symbol" },
+    { u"🪠", "plunger" },
+    { u"⛹️‍♂", "man bouncing ball" },
+    { u"🗨", "left speech bubble" },
+    { u"🤵🏽", "person in tuxedo: medium skin tone" },
+    { u"👩🏽‍❤‍💋‍👨🏻", "kiss: woman, man, medium skin tone, light skin tone" },
+    { u"🇬🇬", "flag: Guernsey" },
+    { u"🔣", "input symbols" },
+    { u"🧏🏻", "deaf person: light skin tone" },
+    { u"🧘🏽‍♀", "woman in lotus position: medium skin tone" },
+    { u"👵🏻", "old woman: light skin tone" },
+    { u"🎥", "movie camera" },
+    { u"👨🏿‍❤‍💋‍👨🏽", "kiss: man, man, dark skin tone, medium skin tone" },
+    { u"👳🏽‍♂️", "man wearing turban: medium skin tone" },
+    { u"⛩", "shinto shrine" },
+    { u"💁🏼‍♂", "man tipping hand: medium-light skin tone" },
+    { u"🚘", "oncoming automobile" },
+    { u"🏞️", "national park" },
+    { u"👮🏻‍♀️", "woman police officer: light skin tone" },
+    { u"🚣🏽‍♀️", "woman rowing boat: medium skin tone" },
+    { u"🚴🏼‍♂️", "man biking: medium-light skin tone" },
+    { u"👨‍✈️", "man pilot" },
+    { u"👨🏻‍🦰", "man: light skin tone, red hair" },
+    { u"🏋‍♂", "man lifting weights" },
+    { u"➗", "divide" },
+    { u"🧑🏼‍❤️‍🧑🏿", "couple with heart: person, person, medium-light skin tone, dark skin tone" },
+    { u"🏃🏽‍♂️‍➡️", "man running facing right: medium skin tone" },
+    { u"⛸", "ice skate" },
+    { u"🚣🏿", "person rowing boat: dark skin tone" },
+    { u"🌪️", "tornado" },
+    { u"👩🏻‍🎓", "woman student: light skin tone" },
+    { u"🦳", "white hair" },
+    { u"🇮🇶", "flag: Iraq" },
+    { u"🧎🏾‍♂‍➡️", "man kneeling facing right: medium-dark skin tone" },
+    { u"⛹", "person bouncing ball" },
+    { u"🏌🏿", "person golfing: dark skin tone" },
+    { u"🇧🇳", "flag: Brunei" },
+    { u"🚶🏽", "person walking: medium skin tone" },
+    { u"🤽🏿", "person playing water polo: dark skin tone" },
+    { u"👚", "woman’s clothes" },
+    { u"🤦‍♂", "man facepalming" },
+    { u"👨🏾‍✈", "man pilot: medium-dark skin tone" },
+    { u"🇩🇴", "flag: Dominican Republic" },
+    { u"🏃🏽‍♂️‍➡", "man running facing right: medium skin tone" },
+    { u"🧛🏻‍♀", "woman vampire: light skin tone" },
+    { u"🐮", "cow face" },
+    { u"🧭", "compass" },
+    { u"💦", "sweat droplets" },
+    { u"▪️", "black small square" },
+    { u"👩🏿‍🦼‍➡️", "woman in motorized wheelchair facing right: dark skin tone" },
+    { u"🇮🇪", "flag: Ireland" },
+    { u"1⃣", "keycap: 1" },
+    { u"🏃🏼‍♂‍➡", "man running facing right: medium-light skin tone" },
+    { u"▶", "play button" },
+    { u"🧎🏻‍♀‍➡️", "woman kneeling facing right: light skin tone" },
+    { u"🧍🏾‍♂️", "man standing: medium-dark skin tone" },
+    { u"☝🏿", "index pointing up: dark skin tone" },
+    { u"🧏🏼‍♂", "deaf man: medium-light skin tone" },
+    { u"🅿️", "P button" },
+    { u"🧎🏿‍♂️‍➡", "man kneeling facing right: dark skin tone" },
+    { u"🦤", "dodo" },
+    { u"🧏🏻‍♂", "deaf man: light skin tone" },
+    { u"🧙🏽", "mage: medium skin tone" },
+    { u"👩🏻‍❤‍👩🏾", "couple with heart: woman, woman, light skin tone, medium-dark skin tone" },
+    { u"↙️", "down-left arrow" },
+    { u"🧎‍♀", "woman kneeling" },
+    { u"👴", "old man" },
+    { u"🚀", "rocket" },
+    { u"🚶🏿‍➡️", "person walking facing right: dark skin tone" },
+    { u"🙆🏼‍♂", "man gesturing OK: medium-light skin tone" },
+    { u"👩🏼‍🔧", "woman mechanic: medium-light skin tone" },
+    { u"👬", "men holding hands" },
+    { u"🥂", "clinking glasses" },
+    { u"👩🏽‍❤️‍👩🏿", "couple with heart: woman, woman, medium skin tone, dark skin tone" },
+    { u"🇦🇫", "flag: Afghanistan" },
+    { u"🩵", "light blue heart" },
+    { u"📕", "closed book" },
+    { u"🕔", "five o’clock" },
+    { u"🇨🇲", "flag: Cameroon" },
+    { u"🇲🇼", "flag: Malawi" },
+    { u"🧎🏾‍♀️‍➡", "woman kneeling facing right: medium-dark skin tone" },
+    { u"🏊🏽", "person swimming: medium skin tone" },
+    { u"🏔", "snow-capped mountain" },
+    { u"🦻🏼", "ear with hearing aid: medium-light skin tone" },
+    { u"🍧", "shaved ice" },
+    { u"🍔", "hamburger" },
+    { u"👨🏻‍❤️‍💋‍👨🏿", "kiss: man, man, light skin tone, dark skin tone" },
+    { u"👨🏿‍🏫", "man teacher: dark skin tone" },
+    { u"🦷", "tooth" },
+    { u"👨🏻‍⚖️", "man judge: light skin tone" },
+    { u"🏃🏽‍♀", "woman running: medium skin tone" },
+    { u"🤷🏻‍♂", "man shrugging: light skin tone" },
+    { u"🇮🇨", "flag: Canary Islands" },
+    { u"⛓‍💥", "broken chain" },
+    { u"👨🏼‍✈️", "man pilot: medium-light skin tone" },
+    { u"🏄‍♂", "man surfing" },
+    { u"🧝🏾‍♂️", "man elf: medium-dark skin tone" },
+    { u"🛫", "airplane departure" },
+    { u"🧜🏾‍♂️", "merman: medium-dark skin tone" },
+    { u"👦🏼", "boy: medium-light skin tone" },
+    { u"🚣🏿‍♀", "woman rowing boat: dark skin tone" },
+    { u"🇵🇭", "flag: Philippines" },
+    { u"👩🏼‍❤‍💋‍👩🏿", "kiss: woman, woman, medium-light skin tone, dark skin tone" },
+    { u"🧑‍⚖", "judge" },
+    { u"👩🏾‍❤️‍💋‍👨🏻", "kiss: woman, man, medium-dark skin tone, light skin tone" },
+    { u"👱🏻", "person: light skin tone, blond hair" },
+    { u"🧝‍♀️", "woman elf" },
+    { u"🕷️", "spider" },
+    { u"🚶🏼‍♂", "man walking: medium-light skin tone" },
+    { u"👨🏽‍❤️‍💋‍👨🏽", "kiss: man, man, medium skin tone" },
+    { u"🤵🏼", "person in tuxedo: medium-light skin tone" },
+    { u"💆🏾‍♀", "woman getting massage: medium-dark skin tone" },
+    { u"🪞", "mirror" },
+    { u"🥉", "3rd place medal" },
+    { u"📜", "scroll" },
+    { u"👩🏻‍🦽‍➡", "woman in manual wheelchair facing right: light skin tone" },
+    { u"🚣🏽", "person rowing boat: medium skin tone" },
+    { u"🧑🏻‍❤️‍💋‍🧑🏾", "kiss: person, person, light skin tone, medium-dark skin tone" },
+    { u"🧛🏿‍♂", "man vampire: dark skin tone" },
+    { u"🏌🏼‍♂️", "man golfing: medium-light skin tone" },
+    { u"🌅", "sunrise" },
+    { u"🦹🏻", "supervillain: light skin tone" },
+    { u"🤸🏿", "person cartwheeling: dark skin tone" },
+    { u"🧎🏽‍➡️", "person kneeling facing right: medium skin tone" },
+    { u"🧗🏼‍♀️", "woman climbing: medium-light skin tone" },
+    { u"🚶‍♂‍➡", "man walking facing right" },
+    { u"🤛🏼", "left-facing fist: medium-light skin tone" },
+    { u"😣", "persevering face" },
+    { u"🇫🇲", "flag: Micronesia" },
+    { u"🕵🏾‍♀", "woman detective: medium-dark skin tone" },
+    { u"🫣", "face with peeking eye" },
+    { u"2⃣", "keycap: 2" },
+    { u"🦶", "foot" },
+    { u"🐒", "monkey" },
+    { u"💆🏾‍♂️", "man getting massage: medium-dark skin tone" },
+    { u"🧏🏽‍♂️", "deaf man: medium skin tone" },
+    { u"👨🏽‍❤️‍👨🏾", "couple with heart: man, man, medium skin tone, medium-dark skin tone" },
+    { u"↩", "right arrow curving left" },
+    { u"👨‍👧‍👧", "family: man, girl, girl" },
+    { u"🌍", "globe showing Europe-Africa" },
+    { u"🏳‍⚧️", "transgender flag" },
+    { u"⚰️", "coffin" },
+    { u"🫄🏻", "pregnant person: light skin tone" },
+    { u"🧑🏾‍✈️", "pilot: medium-dark skin tone" },
+    { u"🚣🏽‍♂", "man rowing boat: medium skin tone" },
+    { u"🇬🇱", "flag: Greenland" },
+    { u"➖", "minus" },
+    { u"👨🏿‍🎨", "man artist: dark skin tone" },
+    { u"🇧🇾", "flag: Belarus" },
+    { u"🌆", "cityscape at dusk" },
+    { u"👭🏼", "women holding hands: medium-light skin tone" },
+    { u"🧑🏼‍🔧", "mechanic: medium-light skin tone" },
+    { u"👩‍🦲", "woman: bald" },
+    { u"🤵🏾‍♂️", "man in tuxedo: medium-dark skin tone" },
+    { u"🐊", "crocodile" },
+    { u"🫰🏻", "hand with index finger and thumb crossed: light skin tone" },
+    { u"💆🏿", "person getting massage: dark skin tone" },
+    { u"🏃🏻", "person running: light skin tone" },
+    { u"🚋", "tram car" },
+    { u"🕣", "eight-thirty" },
+    { u"🧑🏿‍💼", "office worker: dark skin tone" },
+    { u"🧚🏻‍♀", "woman fairy: light skin tone" },
+    { u"⛎", "Ophiuchus" },
+    { u"⚒️", "hammer and pick" },
+    { u"👩🏿‍❤‍💋‍👩🏻", "kiss: woman, woman, dark skin tone, light skin tone" },
+    { u"💁🏾‍♂", "man tipping hand: medium-dark skin tone" },
+    { u"🪭", "folding hand fan" },
+    { u"🤱🏼", "breast-feeding: medium-light skin tone" },
+    { u"🇮🇱", "flag: Israel" },
+    { u"🕊️", "dove" },
+    { u"🍯", "honey pot" },
+    { u"🧑🏻‍🤝‍🧑🏿", "people holding hands: light skin tone, dark skin tone" },
+    { u"🧖🏻‍♀", "woman in steamy room: light skin tone" },
+    { u"🕵🏻", "detective: light skin tone" },
+    { u"🧛", "vampire" },
+    { u"👩🏼‍❤️‍👩🏼", "couple with heart: woman, woman, medium-light skin tone" },
+    { u"🧙‍♀️", "woman mage" },
+    { u"🏚", "derelict house" },
+    { u"🦋", "butterfly" },
+    { u"🤼‍♂️", "men wrestling" },
+    { u"💛", "yellow heart" },
+    { u"🐻‍❄", "polar bear" },
+    { u"🐻‍❄️", "polar bear" },
+    { u"🇳🇵", "flag: Nepal" },
+    { u"🇧🇫", "flag: Burkina Faso" },
+    { u"📢", "loudspeaker" },
+    { u"🈷", "Japanese “monthly amount” button" },
+    { u"🕵🏼‍♂", "man detective: medium-light skin tone" },
+    { u"🌔", "waxing gibbous moon" },
+    { u"👨🏼‍🦯", "man with white cane: medium-light skin tone" },
+    { u"🤷🏼‍♀️", "woman shrugging: medium-light skin tone" },
+    { u"🏊🏻‍♂", "man swimming: light skin tone" },
+    { u"🍠", "roasted sweet potato" },
+    { u"👩🏻‍❤️‍👨🏽", "couple with heart: woman, man, light skin tone, medium skin tone" },
+    { u"👩🏼‍🦽‍➡", "woman in manual wheelchair facing right: medium-light skin tone" },
+    { u"👩🏾‍🚀", "woman astronaut: medium-dark skin tone" },
+    { u"🔶", "large orange diamond" },
+    { u"🫸🏾", "rightwards pushing hand: medium-dark skin tone" },
+    { u"🧑🏿‍❤‍💋‍🧑🏾", "kiss: person, person, dark skin tone, medium-dark skin tone" },
+    { u"🫸🏽", "rightwards pushing hand: medium skin tone" },
+    { u"🏃🏾‍♂️‍➡️", "man running facing right: medium-dark skin tone" },
+    { u"😬", "grimacing face" },
+    { u"🧝🏾‍♀️", "woman elf: medium-dark skin tone" },
+    { u"🧎‍♂️", "man kneeling" },
+    { u"🧑🏽‍🦯‍➡", "person with white cane facing right: medium skin tone" },
+    { u"🏗️", "building construction" },
+    { u"🙍🏼‍♀", "woman frowning: medium-light skin tone" },
+    { u"🦉", "owl" },
+    { u"🚶🏿‍♂️‍➡️", "man walking facing right: dark skin tone" },
+    { u"🙇", "person bowing" },
+    { u"🧘🏾‍♀️", "woman in lotus position: medium-dark skin tone" },
+    { u"📺", "television" },
+    { u"🧘‍♀️", "woman in lotus position" },
+    { u"↙", "down-left arrow" },
+    { u"🧙🏾‍♀️", "woman mage: medium-dark skin tone" },
+    { u"🀄", "mahjong red dragon" },
+    { u"🙋🏿", "person raising hand: dark skin tone" },
+    { u"🦸🏻‍♀", "woman superhero: light skin tone" },
+    { u"🏌️", "person golfing" },
+    { u"👎", "thumbs down" },
+    { u"🏄🏻‍♀️", "woman surfing: light skin tone" },
+    { u"🖕🏽", "middle finger: medium skin tone" },
+    { u"🥤", "cup with straw" },
+    { u"🧑🏿‍🤝‍🧑🏿", "people holding hands: dark skin tone" },
+    { u"🚶🏻‍♀️‍➡", "woman walking facing right: light skin tone" },
+    { u"🦫", "beaver" },
+    { u"👨‍🦱", "man: curly hair" },
+    { u"❇", "sparkle" },
+    { u"👰🏽‍♂", "man with veil: medium skin tone" },
+    { u"🧎🏻‍♂️", "man kneeling: light skin tone" },
+    { u"👰🏻‍♂", "man with veil: light skin tone" },
+    { u"🚵🏻‍♀", "woman mountain biking: light skin tone" },
+    { u"⚠️", "warning" },
+    { u"🦹🏾‍♂", "man supervillain: medium-dark skin tone" },
+    { u"👨🏾‍❤‍💋‍👨🏾", "kiss: man, man, medium-dark skin tone" },
+    { u"🤏🏿", "pinching hand: dark skin tone" },
+    { u"🤳🏽", "selfie: medium skin tone" },
+    { u"🚴🏾‍♀", "woman biking: medium-dark skin tone" },
+    { u"🥱", "yawning face" },
+    { u"👩🏿‍🔧", "woman mechanic: dark skin tone" },
+    { u"🇧🇦", "flag: Bosnia & Herzegovina" },
+    { u"⬛", "black large square" },
+    { u"👨🏼‍🦼‍➡", "man in motorized wheelchair facing right: medium-light skin tone" },
+    { u"🫳🏼", "palm down hand: medium-light skin tone" },
+    { u"🏃🏻‍♀️‍➡", "woman running facing right: light skin tone" },
+    { u"🤹🏽", "person juggling: medium skin tone" },
+    { u"🏌️‍♂️", "man golfing" },
+    { u"🕕", "six o’clock" },
+    { u"🧎‍➡️", "person kneeling facing right" },
+    { u"🧑🏿", "person: dark skin tone" },
+    { u"👧🏽", "girl: medium skin tone" },
+    { u"🇪🇦", "flag: Ceuta & Melilla" },
+    { u"🛼", "roller skate" },
+    { u"🚣🏿‍♂", "man rowing boat: dark skin tone" },
+    { u"👋", "waving hand" },
+    { u"👩🏿‍❤️‍👩🏿", "couple with heart: woman, woman, dark skin tone" },
+    { u"🙍🏽‍♀️", "woman frowning: medium skin tone" },
+    { u"🧑🏿‍❤️‍🧑🏽", "couple with heart: person, person, dark skin tone, medium skin tone" },
+    { u"👨🏻‍🤝‍👨🏾", "men holding hands: light skin tone, medium-dark skin tone" },
+    { u"👐🏾", "open hands: medium-dark skin tone" },
+    { u"🤲🏾", "palms up together: medium-dark skin tone" },
+    { u"🏊🏽‍♀️", "woman swimming: medium skin tone" },
+    { u"🚵🏿‍♂️", "man mountain biking: dark skin tone" },
+    { u"👩🏿‍❤️‍👩🏽", "couple with heart: woman, woman, dark skin tone, medium skin tone" },
+    { u"👨🏻‍🤝‍👨🏿", "men holding hands: light skin tone, dark skin tone" },
+    { u"💴", "yen banknote" },
+    { u"🐳", "spouting whale" },
+    { u"😉", "winking face" },
+    { u"🤛", "left-facing fist" },
+    { u"🇳🇿", "flag: New Zealand" },
+    { u"🇸🇻", "flag: El Salvador" },
+    { u"👨🏽‍🎓", "man student: medium skin tone" },
+    { u"👙", "bikini" },
+    { u"👩‍🦳", "woman: white hair" },
+    { u"🤸🏽‍♂️", "man cartwheeling: medium skin tone" },
+    { u"🧑🏻‍🦽", "person in manual wheelchair: light skin tone" },
+    { u"🚛", "articulated lorry" },
+    { u"👷🏽‍♀", "woman construction worker: medium skin tone" },
+    { u"🚵🏽‍♂", "man mountain biking: medium skin tone" },
+    { u"🧜🏻‍♂️", "merman: light skin tone" },
+    { u"😌", "relieved face" },
+    { u"🪄", "magic wand" },
+    { u"👩🏿‍🚒", "woman firefighter: dark skin tone" },
+    { u"🦻🏽", "ear with hearing aid: medium skin tone" },
+    { u"🧔", "person: beard" },
+    { u"⛹🏿‍♂️", "man bouncing ball: dark skin tone" },
+    { u"👩🏿‍❤️‍💋‍👩🏾", "kiss: woman, woman, dark skin tone, medium-dark skin tone" },
+    { u"🚂", "locomotive" },
+    { u"🗨️", "left speech bubble" },
+    { u"⬆️", "up arrow" },
+    { u"☄️", "comet" },
+    { u"🚬", "cigarette" },
+    { u"🏃🏻‍♂‍➡", "man running facing right: light skin tone" },
+    { u"🤚🏽", "raised back of hand: medium skin tone" },
+    { u"🫵🏿", "index pointing at the viewer: dark skin tone" },
+    { u"♥️", "heart suit" },
+    { u"👨🏻‍❤‍👨🏽", "couple with heart: man, man, light skin tone, medium skin tone" },
+    { u"🛡️", "shield" },
+    { u"👦🏻", "boy: light skin tone" },
+    { u"🧙🏼‍♀️", "woman mage: medium-light skin tone" },
+    { u"🥘", "shallow pan of food" },
+    { u"💇🏿‍♂", "man getting haircut: dark skin tone" },
+    { u"🧜🏾", "merperson: medium-dark skin tone" },
+    { u"👩🏻‍🤝‍👩🏾", "women holding hands: light skin tone, medium-dark skin tone" },
+    { u"👨🏾‍🦽‍➡️", "man in manual wheelchair facing right: medium-dark skin tone" },
+    { u"🪶", "feather" },
+    { u"🤦🏼‍♂️", "man facepalming: medium-light skin tone" },
+    { u"🇨🇺", "flag: Cuba" },
+    { u"👨🏽‍❤‍👨🏻", "couple with heart: man, man, medium skin tone, light skin tone" },
+    { u"🇪🇬", "flag: Egypt" },
+    { u"🏃🏾‍♀️", "woman running: medium-dark skin tone" },
+    { u"🤷🏽‍♂", "man shrugging: medium skin tone" },
+    { u"🧚🏽‍♀", "woman fairy: medium skin tone" },
+    { u"🚶🏼‍♂‍➡", "man walking facing right: medium-light skin tone" },
+    { u"🧑🏾‍🏫", "teacher: medium-dark skin tone" },
+    { u"🚵🏾‍♀", "woman mountain biking: medium-dark skin tone" },
+    { u"🪏", "shovel" },
+    { u"🤾🏻‍♀️", "woman playing handball: light skin tone" },
+    { u"❤‍🩹", "mending heart" },
+    { u"👨🏼‍❤️‍💋‍👨🏻", "kiss: man, man, medium-light skin tone, light skin tone" },
+    { u"🧑🏾‍🍼", "person feeding baby: medium-dark skin tone" },
+    { u"🩸", "drop of blood" },
+    { u"🫱🏻‍🫲🏿", "handshake: light skin tone, dark skin tone" },
+    { u"💂🏽‍♀", "woman guard: medium skin tone" },
+    { u"👍🏿", "thumbs up: dark skin tone" },
+    { u"🧈", "butter" },
+    { u"🇲🇷", "flag: Mauritania" },
+    { u"👨‍👩‍👧‍👧", "family: man, woman, girl, girl" },
+    { u"🛀🏽", "person taking bath: medium skin tone" },
+    { u"🧖🏽‍♂", "man in steamy room: medium skin tone" },
+    { u"🧎🏼‍♀‍➡", "woman kneeling facing right: medium-light skin tone" },
+    { u"🫡", "saluting face" },
+    { u"🧑🏽", "person: medium skin tone" },
+    { u"👰🏾‍♂️", "man with veil: medium-dark skin tone" },
+    { u"👨🏽‍🎤", "man singer: medium skin tone" },
+    { u"🫦", "biting lip" },
+    { u"👱🏽‍♀", "woman: medium skin tone, blond hair" },
+    { u"👨‍👨‍👦‍👦", "family: man, man, boy, boy" },
+    { u"👩🏼‍⚖️", "woman judge: medium-light skin tone" },
+    { u"🤚🏼", "raised back of hand: medium-light skin tone" },
+    { u"🚓", "police car" },
+    { u"🎩", "top hat" },
+    { u"🧏‍♂", "deaf man" },
+    { u"🏖️", "beach with umbrella" },
+    { u"☦", "orthodox cross" },
+    { u"🤹‍♂", "man juggling" },
+    { u"🏟️", "stadium" },
+    { u"👊🏾", "oncoming fist: medium-dark skin tone" },
+    { u"🧙🏽‍♀", "woman mage: medium skin tone" },
+    { u"🕵‍♀️", "woman detective" },
+    { u"🚧", "construction" },
+    { u"👉🏾", "backhand index pointing right: medium-dark skin tone" },
+    { u"☁️", "cloud" },
+    { u"🤾🏻‍♀", "woman playing handball: light skin tone" },
+    { u"🏎️", "racing car" },
+    { u"🧑‍🦼", "person in motorized wheelchair" },
+    { u"🚶🏻‍♀️‍➡️", "woman walking facing right: light skin tone" },
+    { u"✋🏻", "raised hand: light skin tone" },
+    { u"🚶🏼‍♀‍➡", "woman walking facing right: medium-light skin tone" },
+    { u"👩🏽‍❤‍💋‍👨🏿", "kiss: woman, man, medium skin tone, dark skin tone" },
+    { u"🧍🏾‍♀️", "woman standing: medium-dark skin tone" },
+    { u"🧑🏾‍⚕️", "health worker: medium-dark skin tone" },
+    { u"📛", "name badge" },
+    { u"🧑🏿‍❤‍💋‍🧑🏻", "kiss: person, person, dark skin tone, light skin tone" },
+    { u"🫨", "shaking face" },
+    { u"👨‍👩‍👧‍👦", "family: man, woman, girl, boy" },
+    { u"👥", "busts in silhouette" },
+    { u"🫔", "tamale" },
+    { u"🧑🏼‍🦽‍➡️", "person in manual wheelchair facing right: medium-light skin tone" },
+    { u"🟢", "green circle" },
+    { u"🧙🏾‍♂️", "man mage: medium-dark skin tone" },
+    { u"🔋", "battery" },
+    { u"🍎", "red apple" },
+    { u"🧚🏽‍♂️", "man fairy: medium skin tone" },
+    { u"🏷️", "label" },
+    { u"🚵🏼‍♀", "woman mountain biking: medium-light skin tone" },
+    { u"📍", "round pushpin" },
+    { u"🏃🏽‍♀‍➡", "woman running facing right: medium skin tone" },
+    { u"🥒", "cucumber" },
+    { u"🇳🇷", "flag: Nauru" },
+    { u"👨🏾‍🎨", "man artist: medium-dark skin tone" },
+    { u"🌾", "sheaf of rice" },
+    { u"👱🏼‍♀", "woman: medium-light skin tone, blond hair" },
+    { u"🧑🏾‍🚀", "astronaut: medium-dark skin tone" },
+    { u"🔸", "small orange diamond" },
+    { u"🦸🏻", "superhero: light skin tone" },
+    { u"🙆🏻", "person gesturing OK: light skin tone" },
+    { u"🤽🏽", "person playing water polo: medium skin tone" },
+    { u"🦨", "skunk" },
+    { u"🧝🏼‍♀", "woman elf: medium-light skin tone" },
+    { u"🧏🏽‍♂", "deaf man: medium skin tone" },
+    { u"🫘", "beans" },
+    { u"🦹🏿‍♂", "man supervillain: dark skin tone" },
+    { u"🤵🏻‍♀️", "woman in tuxedo: light skin tone" },
+    { u"👸🏿", "princess: dark skin tone" },
+    { u"👩🏾‍❤️‍👨🏽", "couple with heart: woman, man, medium-dark skin tone, medium skin tone" },
+    { u"🧑🏿‍❤️‍💋‍🧑🏽", "kiss: person, person, dark skin tone, medium skin tone" },
+    { u"🏚️", "derelict house" },
+    { u"🙍🏻‍♂", "man frowning: light skin tone" },
+    { u"🙇‍♂️", "man bowing" },
+    { u"🏊🏽‍♂", "man swimming: medium skin tone" },
+    { u"👨🏿‍🤝‍👨🏼", "men holding hands: dark skin tone, medium-light skin tone" },
+    { u"👇🏻", "backhand index pointing down: light skin tone" },
+    { u"🖖🏽", "vulcan salute: medium skin tone" },
+    { u"👱🏿‍♂️", "man: dark skin tone, blond hair" },
+    { u"🤝🏽", "handshake: medium skin tone" },
+    { u"🍃", "leaf fluttering in wind" },
+    { u"🗳️", "ballot box with ballot" },
+    { u"🧎🏻", "person kneeling: light skin tone" },
+    { u"🥻", "sari" },
+    { u"👨🏿‍⚕️", "man health worker: dark skin tone" },
+    { u"🚶🏾", "person walking: medium-dark skin tone" },
+    { u"👩🏿‍❤‍💋‍👩🏾", "kiss: woman, woman, dark skin tone, medium-dark skin tone" },
+    { u"🤏🏻", "pinching hand: light skin tone" },
+    { u"🧑🏿‍🔧", "mechanic: dark skin tone" },
+    { u"🎑", "moon viewing ceremony" },
+    { u"👰🏻‍♂️", "man with veil: light skin tone" },
+    { u"👮🏽‍♀", "woman police officer: medium skin tone" },
+    { u"🧑🏻‍✈️", "pilot: light skin tone" },
+    { u"🚶🏿‍♂", "man walking: dark skin tone" },
+    { u"👨", "man" },
+    { u"👨🏽‍❤‍💋‍👨🏿", "kiss: man, man, medium skin tone, dark skin tone" },
+    { u"👱🏼‍♂️", "man: medium-light skin tone, blond hair" },
+    { u"🧑🏿‍✈", "pilot: dark skin tone" },
+    { u"🧚🏼‍♀️", "woman fairy: medium-light skin tone" },
+    { u"👷🏽‍♂", "man construction worker: medium skin tone" },
+    { u"🏃🏿‍♀️‍➡️", "woman running facing right: dark skin tone" },
+    { u"🏀", "basketball" },
+    { u"🎻", "violin" },
+    { u"🤗", "smiling face with open hands" },
+    { u"📏", "straight ruler" },
+    { u"🚵‍♀️", "woman mountain biking" },
+    { u"🇨🇼", "flag: Curaçao" },
+    { u"🥷🏽", "ninja: medium skin tone" },
+    { u"🚶🏼‍♀", "woman walking: medium-light skin tone" },
+    { u"👁‍🗨", "eye in speech bubble" },
+    { u"🧑🏽‍🦳", "person: medium skin tone, white hair" },
+    { u"🧎", "person kneeling" },
+    { u"🫸", "rightwards pushing hand" },
+    { u"🤸🏻‍♀️", "woman cartwheeling: light skin tone" },
+    { u"🦹🏾‍♂️", "man supervillain: medium-dark skin tone" },
+    { u"🧘🏿‍♂️", "man in lotus position: dark skin tone" },
+    { u"👨🏼‍🤝‍👨🏿", "men holding hands: medium-light skin tone, dark skin tone" },
+    { u"👩‍🏫", "woman teacher" },
+    { u"🧍🏻‍♂️", "man standing: light skin tone" },
+    { u"🧚🏼", "fairy: medium-light skin tone" },
+    { u"🧑🏻‍🦼‍➡", "person in motorized wheelchair facing right: light skin tone" },
+    { u"🧍🏿‍♂️", "man standing: dark skin tone" },
+    { u"🧙🏻", "mage: light skin tone" },
+    { u"🙎🏻‍♀", "woman pouting: light skin tone" },
+    { u"🧙🏽‍♂", "man mage: medium skin tone" },
+    { u"👩🏾‍❤️‍💋‍👨🏼", "kiss: woman, man, medium-dark skin tone, medium-light skin tone" },
+    { u"👩🏽‍❤‍💋‍👩🏻", "kiss: woman, woman, medium skin tone, light skin tone" },
+    { u"🤹🏽‍♀", "woman juggling: medium skin tone" },
+    { u"💳", "credit card" },
+    { u"🏄🏼‍♂️", "man surfing: medium-light skin tone" },
+    { u"🧎🏽‍♂️‍➡️", "man kneeling facing right: medium skin tone" },
+    { u"🤾🏼‍♂", "man playing handball: medium-light skin tone" },
+    { u"🧑‍🦲", "person: bald" },
+    { u"👩🏼‍🤝‍👨🏾", "woman and man holding hands: medium-light skin tone, medium-dark skin tone" },
+    { u"🧕🏽", "woman with headscarf: medium skin tone" },
+    { u"🅿", "P button" },
+    { u"🩹", "adhesive bandage" },
+    { u"🦑", "squid" },
+    { u"🚴🏿‍♂️", "man biking: dark skin tone" },
+    { u"🤽🏻‍♀️", "woman playing water polo: light skin tone" },
+    { u"🧛🏼‍♂️", "man vampire: medium-light skin tone" },
+    { u"🧖🏾", "person in steamy room: medium-dark skin tone" },
+    { u"🐙", "octopus" },
+    { u"✌🏻", "victory hand: light skin tone" },
+    { u"🪻", "hyacinth" },
+    { u"💇🏾‍♂", "man getting haircut: medium-dark skin tone" },
+    { u"☢", "radioactive" },
+    { u"👅", "tongue" },
+    { u"🪵", "wood" },
+    { u"🏊🏼‍♀", "woman swimming: medium-light skin tone" },
+    { u"☹️", "frowning face" },
+    { u"🇬🇷", "flag: Greece" },
+    { u"🅰️", "A button (blood type)" },
+    { u"😶‍🌫️", "face in clouds" },
+    { u"👩🏿‍🤝‍👩🏼", "women holding hands: dark skin tone, medium-light skin tone" },
+    { u"🏄🏻‍♀", "woman surfing: light skin tone" },
+    { u"👩‍🦼", "woman in motorized wheelchair" },
+    { u"🧑🏻‍⚖", "judge: light skin tone" },
+    { u"🇫🇯", "flag: Fiji" },
+    { u"🕋", "kaaba" },
+    { u"🥅", "goal net" },
+    { u"🍓", "strawberry" },
+    { u"🎫", "ticket" },
+    { u"🏊🏻", "person swimming: light skin tone" },
+    { u"👩🏻‍🌾", "woman farmer: light skin tone" },
+    { u"👩🏽‍🦼‍➡", "woman in motorized wheelchair facing right: medium skin tone" },
+    { u"😩", "weary face" },
+    { u"🐿", "chipmunk" },
+    { u"🤹🏿‍♂", "man juggling: dark skin tone" },
+    { u"🙋🏽", "person raising hand: medium skin tone" },
+    { u"👳🏻", "person wearing turban: light skin tone" },
+    { u"🪴", "potted plant" },
+    { u"🙋🏿‍♀️", "woman raising hand: dark skin tone" },
+    { u"🙎🏿", "person pouting: dark skin tone" },
+    { u"💏🏾", "kiss: medium-dark skin tone" },
+    { u"🛬", "airplane arrival" },
+    { u"🦗", "cricket" },
+    { u"🧎🏾‍♀‍➡", "woman kneeling facing right: medium-dark skin tone" },
+    { u"⚖", "balance scale" },
+    { u"🧑🏾‍🦼‍➡️", "person in motorized wheelchair facing right: medium-dark skin tone" },
+    { u"🇲🇰", "flag: North Macedonia" },
+    { u"🧑🏿‍❤️‍🧑🏻", "couple with heart: person, person, dark skin tone, light skin tone" },
+    { u"👩🏿‍❤️‍👨🏽", "couple with heart: woman, man, dark skin tone, medium skin tone" },
+    { u"🙅🏽", "person gesturing NO: medium skin tone" },
+    { u"👶", "baby" },
+    { u"🤵‍♀", "woman in tuxedo" },
+    { u"6️⃣", "keycap: 6" },
+    { u"🗻", "mount fuji" },
+    { u"🙂‍↔", "head shaking horizontally" },
+    { u"🤘🏾", "sign of the horns: medium-dark skin tone" },
+    { u"🙎🏿‍♂️", "man pouting: dark skin tone" },
+    { u"🇲🇹", "flag: Malta" },
+    { u"Ⓜ", "circled M" },
+    { u"🛏", "bed" },
+    { u"🆓", "FREE button" },
+    { u"🍽", "fork and knife with plate" },
+    { u"✋🏾", "raised hand: medium-dark skin tone" },
+    { u"🫱🏾‍🫲🏻", "handshake: medium-dark skin tone, light skin tone" },
+    { u"🍦", "soft ice cream" },
+    { u"🧎🏽", "person kneeling: medium skin tone" },
+    { u"👩‍👩‍👦", "family: woman, woman, boy" },
+    { u"📂", "open file folder" },
+    { u"🫰🏿", "hand with index finger and thumb crossed: dark skin tone" },
+    { u"🫵", "index pointing at the viewer" },
+    { u"🇦🇿", "flag: Azerbaijan" },
+    { u"🎪", "circus tent" },
+    { u"👏", "clapping hands" },
+    { u"🧑🏽‍❤️‍🧑🏼", "couple with heart: person, person, medium skin tone, medium-light skin tone" },
+    { u"🤴🏿", "prince: dark skin tone" },
+    { u"🥵", "hot face" },
+    { u"🤷🏼", "person shrugging: medium-light skin tone" },
+    { u"🙎🏾‍♀️", "woman pouting: medium-dark skin tone" },
+    { u"👩🏼‍❤‍💋‍👨🏽", "kiss: woman, man, medium-light skin tone, medium skin tone" },
+    { u"🙉", "hear-no-evil monkey" },
+    { u"🏋🏼‍♂", "man lifting weights: medium-light skin tone" },
+    { u"🏊‍♂", "man swimming" },
+    { u"🕵🏻‍♀️", "woman detective: light skin tone" },
+    { u"🗄", "file cabinet" },
+    { u"🧒🏽", "child: medium skin tone" },
+    { u"🧞‍♂️", "man genie" },
+    { u"🫃🏾", "pregnant man: medium-dark skin tone" },
+    { u"🧑🏻‍🦯‍➡", "person with white cane facing right: light skin tone" },
+    { u"🇸🇬", "flag: Singapore" },
+    { u"👱", "person: blond hair" },
+    { u"🧑🏽‍❤‍💋‍🧑🏻", "kiss: person, person, medium skin tone, light skin tone" },
+    { u"🦞", "lobster" },
+    { u"🏋🏿‍♀", "woman lifting weights: dark skin tone" },
+    { u"🧛🏾‍♀", "woman vampire: medium-dark skin tone" },
+    { u"➿", "double curly loop" },
+    { u"🦵", "leg" },
+    { u"🇻🇦", "flag: Vatican City" },
+    { u"🤸🏿‍♂", "man cartwheeling: dark skin tone" },
+    { u"🛋️", "couch and lamp" },
+    { u"🤰", "pregnant woman" },
+    { u"🧎🏻‍♂", "man kneeling: light skin tone" },
+    { u"🐞", "lady beetle" },
+    { u"👩🏼‍❤‍👨🏾", "couple with heart: woman, man, medium-light skin tone, medium-dark skin tone" },
+    { u"🧖🏽", "person in steamy room: medium skin tone" },
+    { u"↖", "up-left arrow" },
+    { u"🈚", "Japanese “free of charge” button" },
+    { u"📊", "bar chart" },
+    { u"🏃🏽‍♂", "man running: medium skin tone" },
+    { u"🕴🏼", "person in suit levitating: medium-light skin tone" },
+    { u"🧜🏻", "merperson: light skin tone" },
+    { u"👐🏿", "open hands: dark skin tone" },
+    { u"🧑‍🦽‍➡️", "person in manual wheelchair facing right" },
+    { u"🧑🏿‍🦯‍➡", "person with white cane facing right: dark skin tone" },
+    { u"👨🏼‍🦯‍➡", "man with white cane facing right: medium-light skin tone" },
+    { u"🖖🏾", "vulcan salute: medium-dark skin tone" },
+    { u"👮🏿‍♀", "woman police officer: dark skin tone" },
+    { u"🧎🏿‍♀️‍➡", "woman kneeling facing right: dark skin tone" },
+    { u"🤵🏾‍♂", "man in tuxedo: medium-dark skin tone" },
+    { u"🇱🇹", "flag: Lithuania" },
+    { u"👨🏾‍🦼‍➡️", "man in motorized wheelchair facing right: medium-dark skin tone" },
+    { u"👩🏿‍❤‍👩🏻", "couple with heart: woman, woman, dark skin tone, light skin tone" },
+    { u"🧎🏿‍♂‍➡️", "man kneeling facing right: dark skin tone" },
+    { u"💁🏿‍♂", "man tipping hand: dark skin tone" },
+    { u"💃🏼", "woman dancing: medium-light skin tone" },
+    { u"🇮🇲", "flag: Isle of Man" },
+    { u"🧑🏽‍🦰", "person: medium skin tone, red hair" },
+    { u"⏹", "stop button" },
+    { u"↗", "up-right arrow" },
+    { u"🤷🏻‍♀", "woman shrugging: light skin tone" },
+    { u"🇹🇰", "flag: Tokelau" },
+    { u"↪️", "left arrow curving right" },
+    { u"🚶‍♂", "man walking" },
+    { u"🔎", "magnifying glass tilted right" },
+    { u"💂‍♀", "woman guard" },
+    { u"⛹🏾‍♀️", "woman bouncing ball: medium-dark skin tone" },
+    { u"💾", "floppy disk" },
+    { u"📃", "page with curl" },
+    { u"😳", "flushed face" },
+    { u"🚒", "fire engine" },
+    { u"🫲🏿", "leftwards hand: dark skin tone" },
+    { u"🫄🏼", "pregnant person: medium-light skin tone" },
+    { u"🚩", "triangular flag" },
+    { u"🤸🏿‍♂️", "man cartwheeling: dark skin tone" },
+    { u"🤽🏻‍♂", "man playing water polo: light skin tone" },
+    { u"🙆‍♀️", "woman gesturing OK" },
+    { u"🚶🏿‍♀‍➡️", "woman walking facing right: dark skin tone" },
+    { u"🇰🇳", "flag: St. Kitts & Nevis" },
+    { u"👩‍🚒", "woman firefighter" },
+    { u"🧜🏼‍♂", "merman: medium-light skin tone" },
+    { u"☪️", "star and crescent" },
+    { u"🧜🏼", "merperson: medium-light skin tone" },
+    { u"👩🏼‍❤️‍💋‍👩🏽", "kiss: woman, woman, medium-light skin tone, medium skin tone" },
+    { u"👨🏿‍🦳", "man: dark skin tone, white hair" },
+    { u"🏦", "bank" },
+    { u"👩🏽‍🎓", "woman student: medium skin tone" },
+    { u"🏊🏿‍♂", "man swimming: dark skin tone" },
+    { u"🧑🏽‍❤️‍💋‍🧑🏾", "kiss: person, person, medium skin tone, medium-dark skin tone" },
+    { u"🥈", "2nd place medal" },
+    { u"🔻", "red triangle pointed down" },
+    { u"🫵🏽", "index pointing at the viewer: medium skin tone" },
+    { u"🧑🏾‍🎓", "student: medium-dark skin tone" },
+    { u"👸🏼", "princess: medium-light skin tone" },
+    { u"👨‍🌾", "man farmer" },
+    { u"👷🏽‍♂️", "man construction worker: medium skin tone" },
+    { u"🤾‍♀️", "woman playing handball" },
+    { u"🧑🏻‍🍳", "cook: light skin tone" },
+    { u"👩🏾‍💼", "woman office worker: medium-dark skin tone" },
+    { u"🦶🏽", "foot: medium skin tone" },
+    { u"🦹‍♂️", "man supervillain" },
+    { u"👨‍🔬", "man scientist" },
+    { u"👨🏼‍🎓", "man student: medium-light skin tone" },
+    { u"📹", "video camera" },
+    { u"☑️", "check box with check" },
+    { u"🤾", "person playing handball" },
+    { u"🇫🇴", "flag: Faroe Islands" },
+    { u"🪼", "jellyfish" },
+    { u"🍴", "fork and knife" },
+    { u"💇🏽‍♀️", "woman getting haircut: medium skin tone" },
+    { u"🏃🏾", "person running: medium-dark skin tone" },
+    { u"🧑🏿‍🔬", "scientist: dark skin tone" },
+    { u"🌕", "full moon" },
+    { u"✴️", "eight-pointed star" },
+    { u"🧑🏿‍🦱", "person: dark skin tone, curly hair" },
+    { u"📣", "megaphone" },
+    { u"🏌🏽‍♀️", "woman golfing: medium skin tone" },
+    { u"👌", "OK hand" },
+    { u"💂🏻‍♀", "woman guard: light skin tone" },
+    { u"👯‍♀", "women with bunny ears" },
+    { u"🚶‍♀️‍➡", "woman walking facing right" },
+    { u"🇧🇿", "flag: Belize" },
+    { u"🙅🏼‍♀️", "woman gesturing NO: medium-light skin tone" },
+    { u"🏸", "badminton" },
+    { u"👩🏼‍🚀", "woman astronaut: medium-light skin tone" },
+    { u"👨🏽‍🦱", "man: medium skin tone, curly hair" },
+    { u"🧑🏼‍🦼‍➡", "person in motorized wheelchair facing right: medium-light skin tone" },
+    { u"🌽", "ear of corn" },
+    { u"📷", "camera" },
+    { u"👮🏻‍♂", "man police officer: light skin tone" },
+    { u"👨🏼‍🦼", "man in motorized wheelchair: medium-light skin tone" },
+    { u"🇧🇧", "flag: Barbados" },
+    { u"🙇🏽‍♀️", "woman bowing: medium skin tone" },
+    { u"👩🏿‍❤‍👨🏼", "couple with heart: woman, man, dark skin tone, medium-light skin tone" },
+    { u"🙍🏻‍♀️", "woman frowning: light skin tone" },
+    { u"🚷", "no pedestrians" },
+    { u"🏃🏿‍♂️", "man running: dark skin tone" },
+    { u"🥙", "stuffed flatbread" },
+    { u"😼", "cat with wry smile" },
+    { u"♐", "Sagittarius" },
+    { u"🕵️‍♀", "woman detective" },
+    { u"🧝🏿‍♀", "woman elf: dark skin tone" },
+    { u"🦍", "gorilla" },
+    { u"🖲", "trackball" },
+    { u"🏊🏾‍♀", "woman swimming: medium-dark skin tone" },
+    { u"📦", "package" },
+    { u"👰🏻‍♀️", "woman with veil: light skin tone" },
+    { u"9️⃣", "keycap: 9" },
+    { u"🔅", "dim button" },
+    { u"💝", "heart with ribbon" },
+    { u"🧑🏽‍🦽‍➡️", "person in manual wheelchair facing right: medium skin tone" },
+    { u"🔨", "hammer" },
+    { u"👩🏽‍❤️‍👨🏼", "couple with heart: woman, man, medium skin tone, medium-light skin tone" },
+    { u"✊🏼", "raised fist: medium-light skin tone" },
+    { u"💑", "couple with heart" },
+    { u"🧛🏽", "vampire: medium skin tone" },
+    { u"🧜🏼‍♀", "mermaid: medium-light skin tone" },
+    { u"💂🏼‍♂️", "man guard: medium-light skin tone" },
+    { u"🇦🇬", "flag: Antigua & Barbuda" },
+    { u"🇹🇭", "flag: Thailand" },
+    { u"🚶🏻‍♂️‍➡️", "man walking facing right: light skin tone" },
+    { u"✊🏿", "raised fist: dark skin tone" },
+    { u"🧕🏾", "woman with headscarf: medium-dark skin tone" },
+    { u"🛥️", "motor boat" },
+    { u"🧓🏿", "older person: dark skin tone" },
+    { u"😖", "confounded face" },
+    { u"🏡", "house with garden" },
+    { u"🇲🇪", "flag: Montenegro" },
+    { u"🏜", "desert" },
+    { u"🇵🇸", "flag: Palestinian Territories" },
+    { u"👩🏽‍❤️‍💋‍👨🏿", "kiss: woman, man, medium skin tone, dark skin tone" },
+    { u"🤐", "zipper-mouth face" },
+    { u"🤷🏾", "person shrugging: medium-dark skin tone" },
+    { u"🤸‍♂", "man cartwheeling" },
+    { u"🚣🏿‍♂️", "man rowing boat: dark skin tone" },
+    { u"🎙", "studio microphone" },
+    { u"◼️", "black medium square" },
+    { u"🫰🏼", "hand with index finger and thumb crossed: medium-light skin tone" },
+    { u"5⃣", "keycap: 5" },
+    { u"👮🏼‍♂️", "man police officer: medium-light skin tone" },
+    { u"♨️", "hot springs" },
+    { u"🌋", "volcano" },
+    { u"🚶‍♀️‍➡️", "woman walking facing right" },
+    { u"🙋🏼‍♂️", "man raising hand: medium-light skin tone" },
+    { u"👩🏾‍❤️‍💋‍👩🏽", "kiss: woman, woman, medium-dark skin tone, medium skin tone" },
+    { u"*⃣", "keycap: *" },
+    { u"🧟‍♀", "woman zombie" },
+    { u"🦸‍♂️", "man superhero" },
+    { u"☯️", "yin yang" },
+    { u"👩🏻‍❤‍👩🏽", "couple with heart: woman, woman, light skin tone, medium skin tone" },
+    { u"⚠", "warning" },
+    { u"🧙🏼‍♂", "man mage: medium-light skin tone" },
+    { u"🦸", "superhero" },
+    { u"🫢", "face with open eyes and hand over mouth" },
+    { u"🧝🏿‍♂", "man elf: dark skin tone" },
+    { u"💃🏽", "woman dancing: medium skin tone" },
+    { u"🚶‍♂️", "man walking" },
+    { u"🧑🏻‍❤‍💋‍🧑🏾", "kiss: person, person, light skin tone, medium-dark skin tone" },
+    { u"👞", "man’s shoe" },
+    { u"👩🏿‍🎓", "woman student: dark skin tone" },
+    { u"🦓", "zebra" },
+    { u"🤾🏽‍♀️", "woman playing handball: medium skin tone" },
+    { u"🍥", "fish cake with swirl" },
+    { u"🤟🏿", "love-you gesture: dark skin tone" },
+    { u"👩🏾‍🎨", "woman artist: medium-dark skin tone" },
+    { u"👨🏾‍❤️‍👨🏼", "couple with heart: man, man, medium-dark skin tone, medium-light skin tone" },
+    { u"🙆🏾‍♂", "man gesturing OK: medium-dark skin tone" },
+    { u"🤥", "lying face" },
+    { u"🇦🇽", "flag: Åland Islands" },
+    { u"👍🏻", "thumbs up: light skin tone" },
+    { u"👩🏻‍🏫", "woman teacher: light skin tone" },
+    { u"🖖🏻", "vulcan salute: light skin tone" },
+    { u"👂", "ear" },
+    { u"🈳", "Japanese “vacancy” button" },
+    { u"🚶🏿‍➡", "person walking facing right: dark skin tone" },
+    { u"🇺🇸", "flag: United States" },
+    { u"👌🏼", "OK hand: medium-light skin tone" },
+    { u"🦺", "safety vest" },
+    { u"🏝️", "desert island" },
+    { u"🚵🏽", "person mountain biking: medium skin tone" },
+    { u"👬🏼", "men holding hands: medium-light skin tone" },
+    { u"👈", "backhand index pointing left" },
+    { u"🤽🏿‍♂️", "man playing water polo: dark skin tone" },
+    { u"🇳🇪", "flag: Niger" },
+    { u"🇹🇩", "flag: Chad" },
+    { u"👲🏿", "person with skullcap: dark skin tone" },
+    { u"📨", "incoming envelope" },
+    { u"✔", "check mark" },
+    { u"💨", "dashing away" },
+    { u"👩🏻‍❤️‍💋‍👩🏻", "kiss: woman, woman, light skin tone" },
+    { u"🎁", "wrapped gift" },
+    { u"🧎🏼‍♂️‍➡️", "man kneeling facing right: medium-light skin tone" },
+    { u"🧘🏼", "person in lotus position: medium-light skin tone" },
+    { u"🧑🏾‍🦼", "person in motorized wheelchair: medium-dark skin tone" },
+    { u"🫱🏼", "rightwards hand: medium-light skin tone" },
+    { u"✋", "raised hand" },
+    { u"🍳", "cooking" },
+    { u"👩🏽‍⚕️", "woman health worker: medium skin tone" },
+    { u"👳🏻‍♂️", "man wearing turban: light skin tone" },
+    { u"🖤", "black heart" },
+    { u"🕡", "six-thirty" },
+    { u"👩🏻‍❤️‍💋‍👩🏿", "kiss: woman, woman, light skin tone, dark skin tone" },
+    { u"👩🏻‍❤‍👩🏿", "couple with heart: woman, woman, light skin tone, dark skin tone" },
+    { u"🤣", "rolling on the floor laughing" },
+    { u"⛹🏼‍♀️", "woman bouncing ball: medium-light skin tone" },
+    { u"🧞‍♂", "man genie" },
+    { u"🤹🏿", "person juggling: dark skin tone" },
+    { u"🙋‍♀️", "woman raising hand" },
+    { u"🇨🇬", "flag: Congo - Brazzaville" },
+    { u"🏇", "horse racing" },
+    { u"👨‍👨‍👧‍👧", "family: man, man, girl, girl" },
+    { u"🧑🏽‍🦼‍➡️", "person in motorized wheelchair facing right: medium skin tone" },
+    { u"🔧", "wrench" },
+    { u"🧷", "safety pin" },
+    { u"🚶🏽‍♀️‍➡", "woman walking facing right: medium skin tone" },
+    { u"💲", "heavy dollar sign" },
+    { u"🧍🏿‍♀️", "woman standing: dark skin tone" },
+    { u"©️", "copyright" },
+    { u"🤦🏻‍♂️", "man facepalming: light skin tone" },
+    { u"😗", "kissing face" },
+    { u"🚣🏾‍♂", "man rowing boat: medium-dark skin tone" },
+    { u"🏳️‍⚧", "transgender flag" },
+    { u"🔠", "input latin uppercase" },
+    { u"🇺🇾", "flag: Uruguay" },
+    { u"🤷🏿‍♀️", "woman shrugging: dark skin tone" },
+    { u"🚶🏼‍♂‍➡️", "man walking facing right: medium-light skin tone" },
+    { u"🙆🏾‍♀️", "woman gesturing OK: medium-dark skin tone" },
+    { u"👨🏿‍🤝‍👨🏾", "men holding hands: dark skin tone, medium-dark skin tone" },
+    { u"🙍‍♀️", "woman frowning" },
+    { u"6⃣", "keycap: 6" },
+    { u"🚶", "person walking" },
+    { u"👨🏽‍✈", "man pilot: medium skin tone" },
+    { u"🧑🏿‍⚖", "judge: dark skin tone" },
+    { u"👩🏾‍🦯‍➡️", "woman with white cane facing right: medium-dark skin tone" },
+    { u"🧚🏿‍♂", "man fairy: dark skin tone" },
+    { u"🧑🏽‍🦯", "person with white cane: medium skin tone" },
+    { u"🫱", "rightwards hand" },
+    { u"🤵🏾", "person in tuxedo: medium-dark skin tone" },
+    { u"🦸🏽‍♂️", "man superhero: medium skin tone" },
+    { u"✔️", "check mark" },
+    { u"👨‍👨‍👦", "family: man, man, boy" },
+    { u"🎗️", "reminder ribbon" },
+    { u"🫑", "bell pepper" },
+    { u"🇸🇽", "flag: Sint Maarten" },
+    { u"🤸🏾‍♂", "man cartwheeling: medium-dark skin tone" },
+    { u"🍛", "curry rice" },
+    { u"👰🏼‍♂", "man with veil: medium-light skin tone" },
+    { u"🤙🏾", "call me hand: medium-dark skin tone" },
+    { u"👳🏿‍♀️", "woman wearing turban: dark skin tone" },
+    { u"🏄‍♀️", "woman surfing" },
+    { u"🚶🏼‍♀‍➡️", "woman walking facing right: medium-light skin tone" },
+    { u"🫒", "olive" },
+    { u"🏊‍♀", "woman swimming" },
+    { u"👰🏾‍♂", "man with veil: medium-dark skin tone" },
+    { u"🔂", "repeat single button" },
+    { u"🏋🏻", "person lifting weights: light skin tone" },
+    { u"👘", "kimono" },
+    { u"🏊🏿‍♀️", "woman swimming: dark skin tone" },
+    { u"🪐", "ringed planet" },
+    { u"🧑‍🍼", "person feeding baby" },
+    { u"🏿", "dark skin tone" },
+    { u"🕺🏻", "man dancing: light skin tone" },
+    { u"🫱🏾‍🫲🏽", "handshake: medium-dark skin tone, medium skin tone" },
+    { u"👩🏾‍❤‍👨🏻", "couple with heart: woman, man, medium-dark skin tone, light skin tone" },
+    { u"🦸🏿‍♂️", "man superhero: dark skin tone" },
+    { u"‼️", "double exclamation mark" },
+    { u"🤦🏽", "person facepalming: medium skin tone" },
+    { u"👩🏾‍❤‍💋‍👩🏻", "kiss: woman, woman, medium-dark skin tone, light skin tone" },
+    { u"👁️‍🗨", "eye in speech bubble" },
+    { u"🧑‍🧑‍🧒", "family: adult, adult, child" },
+    { u"🫱🏻‍🫲🏾", "handshake: light skin tone, medium-dark skin tone" },
+    { u"🍅", "tomato" },
+    { u"✉️", "envelope" },
+    { u"🔚", "END arrow" },
+    { u"🇱🇨", "flag: St. Lucia" },
+    { u"🌱", "seedling" },
+    { u"🧑‍🔬", "scientist" },
+    { u"👩🏾‍🦰", "woman: medium-dark skin tone, red hair" },
+    { u"✊🏽", "raised fist: medium skin tone" },
+    { u"👨🏻‍🔧", "man mechanic: light skin tone" },
+    { u"🚴🏾‍♂", "man biking: medium-dark skin tone" },
+    { u"🧍🏽‍♀", "woman standing: medium skin tone" },
+    { u"🧠", "brain" },
+    { u"🙌🏿", "raising hands: dark skin tone" },
+    { u"🧔🏼", "person: medium-light skin tone, beard" },
+    { u"👩‍❤‍👩", "couple with heart: woman, woman" },
+    { u"🐌", "snail" },
+    { u"🧑🏻‍🚒", "firefighter: light skin tone" },
+    { u"🧘🏻‍♂", "man in lotus position: light skin tone" },
+    { u"🕓", "four o’clock" },
+    { u"🧑🏼‍❤️‍💋‍🧑🏿", "kiss: person, person, medium-light skin tone, dark skin tone" },
+    { u"🤸🏻‍♂️", "man cartwheeling: light skin tone" },
+    { u"👶🏾", "baby: medium-dark skin tone" },
+    { u"👩‍🦯", "woman with white cane" },
+    { u"🕳", "hole" },
+    { u"🚕", "taxi" },
+    { u"🚗", "automobile" },
+    { u"🇨🇫", "flag: Central African Republic" },
+    { u"👨‍⚖️", "man judge" },
+    { u"🧽", "sponge" },
+    { u"🤽🏼", "person playing water polo: medium-light skin tone" },
+    { u"🙆🏼‍♀️", "woman gesturing OK: medium-light skin tone" },
+    { u"🧎🏼‍♀️‍➡", "woman kneeling facing right: medium-light skin tone" },
+    { u"👨🏽‍❤‍💋‍👨🏾", "kiss: man, man, medium skin tone, medium-dark skin tone" },
+    { u"❣️", "heart exclamation" },
+    { u"🧑‍⚕️", "health worker" },
+    { u"🙆🏾", "person gesturing OK: medium-dark skin tone" },
+    { u"💤", "ZZZ" },
+    { u"👵🏼", "old woman: medium-light skin tone" },
+    { u"🆕", "NEW button" },
+    { u"🦻🏻", "ear with hearing aid: light skin tone" },
+    { u"👩🏼‍🏫", "woman teacher: medium-light skin tone" },
+    { u"👨‍🦯‍➡", "man with white cane facing right" },
+    { u"👩🏼‍❤‍👩🏾", "couple with heart: woman, woman, medium-light skin tone, medium-dark skin tone" },
+    { u"🏃🏾‍➡", "person running facing right: medium-dark skin tone" },
+    { u"🆚", "VS button" },
+    { u"🇧🇭", "flag: Bahrain" },
+    { u"👨🏽‍🎨", "man artist: medium skin tone" },
+    { u"🫩", "face with bags under eyes" },
+    { u"🚴‍♀", "woman biking" },
+    { u"🇪🇭", "flag: Western Sahara" },
+    { u"🚶🏽‍➡️", "person walking facing right: medium skin tone" },
+    { u"🚖", "oncoming taxi" },
+    { u"🧑🏽‍❤‍💋‍🧑🏼", "kiss: person, person, medium skin tone, medium-light skin tone" },
+    { u"🌶️", "hot pepper" },
+    { u"🛟", "ring buoy" },
+    { u"📬", "open mailbox with raised flag" },
+    { u"🙍‍♂️", "man frowning" },
+    { u"🦸🏼‍♀️", "woman superhero: medium-light skin tone" },
+    { u"📅", "calendar" },
+    { u"🖐🏽", "hand with fingers splayed: medium skin tone" },
+    { u"🙆🏾‍♀", "woman gesturing OK: medium-dark skin tone" },
+    { u"💆🏽‍♀", "woman getting massage: medium skin tone" },
+    { u"🇵🇹", "flag: Portugal" },
+    { u"🤹‍♀", "woman juggling" },
+    { u"🗳", "ballot box with ballot" },
+    { u"🍍", "pineapple" },
+    { u"🧖🏽‍♀", "woman in steamy room: medium skin tone" },
+    { u"🚶🏽‍♀", "woman walking: medium skin tone" },
+    { u"👨🏿‍🦼", "man in motorized wheelchair: dark skin tone" },
+    { u"💆🏻‍♂", "man getting massage: light skin tone" },
+    { u"🧍🏼‍♀", "woman standing: medium-light skin tone" },
+    { u"🫷🏻", "leftwards pushing hand: light skin tone" },
+    { u"🧑🏽‍🎨", "artist: medium skin tone" },
+    { u"🏊🏿", "person swimming: dark skin tone" },
+    { u"🧑🏾‍❤️‍🧑🏼", "couple with heart: person, person, medium-dark skin tone, medium-light skin tone" },
+    { u"👩🏼‍🎤", "woman singer: medium-light skin tone" },
+    { u"👈🏼", "backhand index pointing left: medium-light skin tone" },
+    { u"🇲🇬", "flag: Madagascar" },
+    { u"👩", "woman" },
+    { u"🧝🏻‍♀", "woman elf: light skin tone" },
+    { u"💑🏾", "couple with heart: medium-dark skin tone" },
+    { u"👷🏿‍♀️", "woman construction worker: dark skin tone" },
+    { u"👩🏿‍❤‍💋‍👨🏻", "kiss: woman, man, dark skin tone, light skin tone" },
+    { u"👩🏻‍❤️‍💋‍👩🏼", "kiss: woman, woman, light skin tone, medium-light skin tone" },
+    { u"🎌", "crossed flags" },
+    { u"🇲🇻", "flag: Maldives" },
+    { u"◽", "white medium-small square" },
+    { u"🏃🏾‍♀️‍➡️", "woman running facing right: medium-dark skin tone" },
+    { u"👩‍❤‍💋‍👩", "kiss: woman, woman" },
+    { u"🧑🏾‍❤‍🧑🏿", "couple with heart: person, person, medium-dark skin tone, dark skin tone" },
+    { u"🤸🏾‍♀️", "woman cartwheeling: medium-dark skin tone" },
+    { u"🤶🏾", "Mrs. Claus: medium-dark skin tone" },
+    { u"🤙🏿", "call me hand: dark skin tone" },
+    { u"🤚🏾", "raised back of hand: medium-dark skin tone" },
+    { u"🖕🏼", "middle finger: medium-light skin tone" },
+    { u"👩🏾‍❤️‍👩🏻", "couple with heart: woman, woman, medium-dark skin tone, light skin tone" },
+    { u"🤹🏼‍♀️", "woman juggling: medium-light skin tone" },
+    { u"👨🏾‍❤️‍💋‍👨🏾", "kiss: man, man, medium-dark skin tone" },
+    { u"👨🏼‍❤‍💋‍👨🏼", "kiss: man, man, medium-light skin tone" },
+    { u"🎵", "musical note" },
+    { u"👩‍🚀", "woman astronaut" },
+    { u"💪🏻", "flexed biceps: light skin tone" },
+    { u"🈹", "Japanese “discount” button" },
+    { u"🧑‍⚕", "health worker" },
+    { u"🏁", "chequered flag" },
+    { u"🪢", "knot" },
+    { u"🪒", "razor" },
+    { u"✈️", "airplane" },
+    { u"🧍🏼‍♂", "man standing: medium-light skin tone" },
+    { u"😦", "frowning face with open mouth" },
+    { u"👩🏽‍🚒", "woman firefighter: medium skin tone" },
+    { u"🌬", "wind face" },
+    { u"7️⃣", "keycap: 7" },
+    { u"🏌️‍♂", "man golfing" },
+    { u"💄", "lipstick" },
+    { u"🤵🏼‍♀️", "woman in tuxedo: medium-light skin tone" },
+    { u"🇸🇴", "flag: Somalia" },
+    { u"🤲🏻", "palms up together: light skin tone" },
+    { u"🚡", "aerial tramway" },
+    { u"🧖🏼‍♀️", "woman in steamy room: medium-light skin tone" },
+    { u"⚖️", "balance scale" },
+    { u"🧑🏼‍🎓", "student: medium-light skin tone" },
+    { u"🧛🏿‍♀️", "woman vampire: dark skin tone" },
+    { u"👿", "angry face with horns" },
+    { u"🚳", "no bicycles" },
+    { u"🛌🏽", "person in bed: medium skin tone" },
+    { u"👩🏻‍❤️‍💋‍👩🏾", "kiss: woman, woman, light skin tone, medium-dark skin tone" },
+    { u"🧛‍♂️", "man vampire" },
+    { u"⏩", "fast-forward button" },
+    { u"🧗🏿‍♀", "woman climbing: dark skin tone" },
+    { u"🩱", "one-piece swimsuit" },
+    { u"👨🏼‍🦽", "man in manual wheelchair: medium-light skin tone" },
+    { u"🧗🏻‍♂", "man climbing: light skin tone" },
+    { u"🛜", "wireless" },
+    { u"🦖", "T-Rex" },
+    { u"💪🏼", "flexed biceps: medium-light skin tone" },
+    { u"🧑🏻‍❤‍💋‍🧑🏽", "kiss: person, person, light skin tone, medium skin tone" },
+    { u"🔛", "ON! arrow" },
+    { u"🧙🏻‍♂️", "man mage: light skin tone" },
+    { u"🏃🏻‍♂️‍➡", "man running facing right: light skin tone" },
+    { u"🕴️", "person in suit levitating" },
+    { u"🧎‍♀️‍➡", "woman kneeling facing right" },
+    { u"🙏🏿", "folded hands: dark skin tone" },
+    { u"👨🏽‍❤️‍👨🏿", "couple with heart: man, man, medium skin tone, dark skin tone" },
+    { u"🧆", "falafel" },
+    { u"🏃🏿‍♂️‍➡", "man running facing right: dark skin tone" },
+    { u"🏔️", "snow-capped mountain" },
+    { u"🇸🇰", "flag: Slovakia" },
+    { u"🚣‍♀️", "woman rowing boat" },
+    { u"👨🏻‍🦯‍➡", "man with white cane facing right: light skin tone" },
+    { u"👩🏿‍⚖️", "woman judge: dark skin tone" },
+    { u"🚶🏽‍♂", "man walking: medium skin tone" },
+    { u"🧑🏽‍❤️‍🧑🏻", "couple with heart: person, person, medium skin tone, light skin tone" },
+    { u"🤾🏼‍♀", "woman playing handball: medium-light skin tone" },
+    { u"🦸🏿‍♂", "man superhero: dark skin tone" },
+    { u"🦌", "deer" },
+    { u"👨🏾", "man: medium-dark skin tone" },
+    { u"👨🏼‍⚕️", "man health worker: medium-light skin tone" },
+    { u"↕", "up-down arrow" },
+    { u"🛳️", "passenger ship" },
+    { u"🇵🇼", "flag: Palau" },
+    { u"🚵🏻‍♂", "man mountain biking: light skin tone" },
+    { u"👷🏽", "construction worker: medium skin tone" },
+    { u"🧍‍♀", "woman standing" },
+    { u"🦢", "swan" },
+    { u"🤾🏼‍♂️", "man playing handball: medium-light skin tone" },
+    { u"🃏", "joker" },
+    { u"👩‍⚕️", "woman health worker" },
+    { u"🙎🏻‍♀️", "woman pouting: light skin tone" },
+    { u"🇺🇳", "flag: United Nations" },
+    { u"👫🏾", "woman and man holding hands: medium-dark skin tone" },
+    { u"🤾🏿‍♀️", "woman playing handball: dark skin tone" },
+    { u"👨🏽‍🤝‍👨🏼", "men holding hands: medium skin tone, medium-light skin tone" },
+    { u"👨🏼‍🔧", "man mechanic: medium-light skin tone" },
+    { u"🫥", "dotted line face" },
+    { u"🏄🏽‍♂️", "man surfing: medium skin tone" },
+    { u"👨🏽‍❤️‍👨🏼", "couple with heart: man, man, medium skin tone, medium-light skin tone" },
+    { u"📟", "pager" },
+    { u"🏌🏿‍♂️", "man golfing: dark skin tone" },
+    { u"🙁", "slightly frowning face" },
+    { u"🏃🏼‍♀️‍➡", "woman running facing right: medium-light skin tone" },
+    { u"🏊🏼‍♂️", "man swimming: medium-light skin tone" },
+    { u"🤬", "face with symbols on mouth" },
+    { u"🏃🏿‍♀‍➡️", "woman running facing right: dark skin tone" },
+    { u"🧗🏿‍♂", "man climbing: dark skin tone" },
+    { u"🦶🏼", "foot: medium-light skin tone" },
+    { u"👉🏽", "backhand index pointing right: medium skin tone" },
+    { u"🫱🏽‍🫲🏼", "handshake: medium skin tone, medium-light skin tone" },
+    { u"☝🏾", "index pointing up: medium-dark skin tone" },
+    { u"👇", "backhand index pointing down" },
+    { u"🧑🏽‍❤‍🧑🏿", "couple with heart: person, person, medium skin tone, dark skin tone" },
+    { u"👩🏾‍❤‍👩🏾", "couple with heart: woman, woman, medium-dark skin tone" },
+    { u"🧑🏾‍🦯‍➡", "person with white cane facing right: medium-dark skin tone" },
+    { u"🤷‍♀️", "woman shrugging" },
+    { u"🧎🏿‍♀️", "woman kneeling: dark skin tone" },
+    { u"👩🏾‍⚕️", "woman health worker: medium-dark skin tone" },
+    { u"🌯", "burrito" },
+    { u"👩🏽‍💻", "woman technologist: medium skin tone" },
+    { u"👨🏿‍💻", "man technologist: dark skin tone" },
+    { u"💁🏿‍♀", "woman tipping hand: dark skin tone" },
+    { u"🚴🏿", "person biking: dark skin tone" },
+    { u"🦹🏼", "supervillain: medium-light skin tone" },
+    { u"👨🏻‍🎓", "man student: light skin tone" },
+    { u"🙋‍♂️", "man raising hand" },
+    { u"🙎‍♂", "man pouting" },
+    { u"🐴", "horse face" },
+    { u"🧗‍♂️", "man climbing" },
+    { u"🤒", "face with thermometer" },
+    { u"🦣", "mammoth" },
+    { u"🙎‍♀️", "woman pouting" },
+    { u"🇲🇸", "flag: Montserrat" },
+    { u"👧", "girl" },
+    { u"👻", "ghost" },
+    { u"🎿", "skis" },
+    { u"🧑🏾‍💻", "technologist: medium-dark skin tone" },
+    { u"💂🏼‍♂", "man guard: medium-light skin tone" },
+    { u"🤽🏿‍♂", "man playing water polo: dark skin tone" },
+    { u"🙏🏾", "folded hands: medium-dark skin tone" },
+    { u"👩🏾‍🦲", "woman: medium-dark skin tone, bald" },
+    { u"🧜‍♂", "merman" },
+    { u"🧖🏾‍♂️", "man in steamy room: medium-dark skin tone" },
+    { u"🧑🏻‍❤️‍💋‍🧑🏼", "kiss: person, person, light skin tone, medium-light skin tone" },
+    { u"🧑🏻‍🤝‍🧑🏼", "people holding hands: light skin tone, medium-light skin tone" },
+    { u"🧍", "person standing" },
+    { u"🙍🏿‍♀", "woman frowning: dark skin tone" },
+    { u"🩻", "x-ray" },
+    { u"🚶🏼‍♀️", "woman walking: medium-light skin tone" },
+    { u"🛌🏿", "person in bed: dark skin tone" },
+    { u"🤰🏿", "pregnant woman: dark skin tone" },
+    { u"👫🏽", "woman and man holding hands: medium skin tone" },
+    { u"◀️", "reverse button" },
+    { u"🤨", "face with raised eyebrow" },
+    { u"🙎🏽‍♂", "man pouting: medium skin tone" },
+    { u"🕵🏾‍♂", "man detective: medium-dark skin tone" },
+    { u"👩🏽‍🦽‍➡️", "woman in manual wheelchair facing right: medium skin tone" },
+    { u"👁‍🗨️", "eye in speech bubble" },
+    { u"🛀🏿", "person taking bath: dark skin tone" },
+    { u"🤞🏻", "crossed fingers: light skin tone" },
+    { u"◻️", "white medium square" },
+    { u"👨🏼‍⚕", "man health worker: medium-light skin tone" },
+    { u"🧏🏻‍♀️", "deaf woman: light skin tone" },
+    { u"🏌️‍♀️", "woman golfing" },
+    { u"👩🏿‍✈", "woman pilot: dark skin tone" },
+    { u"🤷🏾‍♀️", "woman shrugging: medium-dark skin tone" },
+    { u"🧑‍🦽", "person in manual wheelchair" },
+    { u"🤽🏼‍♂️", "man playing water polo: medium-light skin tone" },
+    { u"🦹🏾‍♀", "woman supervillain: medium-dark skin tone" },
+    { u"💂🏾‍♀", "woman guard: medium-dark skin tone" },
+    { u"🌭", "hot dog" },
+    { u"👰‍♀️", "woman with veil" },
+    { u"🥫", "canned food" },
+    { u"🧗🏽‍♀️", "woman climbing: medium skin tone" },
+    { u"💆🏻", "person getting massage: light skin tone" },
+    { u"🧑🏽‍🦼‍➡", "person in motorized wheelchair facing right: medium skin tone" },
+    { u"👩🏾‍🏫", "woman teacher: medium-dark skin tone" },
+    { u"🦵🏽", "leg: medium skin tone" },
+    { u"🤦🏼‍♂", "man facepalming: medium-light skin tone" },
+    { u"⚜️", "fleur-de-lis" },
+    { u"🚣‍♀", "woman rowing boat" },
+    { u"♦️", "diamond suit" },
+    { u"🏋️‍♀", "woman lifting weights" },
+    { u"👩🏽‍❤‍💋‍👩🏽", "kiss: woman, woman, medium skin tone" },
+    { u"🤦‍♂️", "man facepalming" },
+    { u"💂‍♂️", "man guard" },
+    { u"🫴🏿", "palm up hand: dark skin tone" },
+    { u"👨🏽‍⚖", "man judge: medium skin tone" },
+    { u"🧔🏼‍♀️", "woman: medium-light skin tone, beard" },
+    { u"💸", "money with wings" },
+    { u"👨🏾‍💻", "man technologist: medium-dark skin tone" },
+    { u"🪇", "maracas" },
+    { u"🧑🏽‍🔧", "mechanic: medium skin tone" },
+    { u"🕵🏽‍♀️", "woman detective: medium skin tone" },
+    { u"🇮🇷", "flag: Iran" },
+    { u"🤝🏿", "handshake: dark skin tone" },
+    { u"👨🏼‍🚒", "man firefighter: medium-light skin tone" },
+    { u"▫", "white small square" },
+    { u"🧖🏻‍♂", "man in steamy room: light skin tone" },
+    { u"🎈", "balloon" },
+    { u"🧙", "mage" },
+    { u"🧑🏽‍🤝‍🧑🏾", "people holding hands: medium skin tone, medium-dark skin tone" },
+    { u"🐪", "camel" },
+    { u"🏃‍♀️‍➡", "woman running facing right" },
+    { u"🚶🏾‍➡️", "person walking facing right: medium-dark skin tone" },
+    { u"🚶🏿‍♀️", "woman walking: dark skin tone" },
+    { u"📒", "ledger" },
+    { u"👨‍❤️‍👨", "couple with heart: man, man" },
+    { u"🧖🏽‍♀️", "woman in steamy room: medium skin tone" },
+    { u"🧎🏼‍♂‍➡", "man kneeling facing right: medium-light skin tone" },
+    { u"👌🏾", "OK hand: medium-dark skin tone" },
+    { u"👩🏿‍🦼", "woman in motorized wheelchair: dark skin tone" },
+    { u"🌫️", "fog" },
+    { u"🇲🇭", "flag: Marshall Islands" },
+    { u"🍹", "tropical drink" },
+    { u"🙇🏼‍♂", "man bowing: medium-light skin tone" },
+    { u"🧎🏽‍♂", "man kneeling: medium skin tone" },
+    { u"🏊🏻‍♀", "woman swimming: light skin tone" },
+    { u"🪈", "flute" },
+    { u"🖌", "paintbrush" },
+    { u"👨🏻‍🔬", "man scientist: light skin tone" },
+    { u"🎬", "clapper board" },
+    { u"😙", "kissing face with smiling eyes" },
+    { u"🖐🏻", "hand with fingers splayed: light skin tone" },
+    { u"🦹🏻‍♀️", "woman supervillain: light skin tone" },
+    { u"🤸‍♀", "woman cartwheeling" },
+    { u"👨🏽‍🦼‍➡", "man in motorized wheelchair facing right: medium skin tone" },
+    { u"💆‍♀️", "woman getting massage" },
+    { u"👨🏼‍❤‍👨🏻", "couple with heart: man, man, medium-light skin tone, light skin tone" },
+    { u"⏲", "timer clock" },
+    { u"🧑‍🧒‍🧒", "family: adult, child, child" },
+    { u"👩🏻‍❤️‍👩🏻", "couple with heart: woman, woman, light skin tone" },
+    { u"🧔🏽‍♂️", "man: medium skin tone, beard" },
+    { u"🏃🏻‍♀️‍➡️", "woman running facing right: light skin tone" },
+    { u"🇭🇰", "flag: Hong Kong SAR China" },
+    { u"🙅", "person gesturing NO" },
+    { u"👩🏽‍🦽‍➡", "woman in manual wheelchair facing right: medium skin tone" },
+    { u"🏯", "Japanese castle" },
+    { u"🏢", "office building" },
+    { u"🚫", "prohibited" },
+    { u"👨🏼‍🦽‍➡", "man in manual wheelchair facing right: medium-light skin tone" },
+    { u"🚈", "light rail" },
+    { u"🇩🇯", "flag: Djibouti" },
+    { u"👁️", "eye" },
+    { u"🧑🏻‍❤‍💋‍🧑🏼", "kiss: person, person, light skin tone, medium-light skin tone" },
+    { u"🧎🏽‍♂️", "man kneeling: medium skin tone" },
+    { u"🗝️", "old key" },
+    { u"👩‍⚖", "woman judge" },
+    { u"🧑🏼‍❤‍🧑🏽", "couple with heart: person, person, medium-light skin tone, medium skin tone" },
+    { u"🧛🏿", "vampire: dark skin tone" },
+    { u"🏄‍♂️", "man surfing" },
+    { u"🦩", "flamingo" },
+    { u"🛩️", "small airplane" },
+    { u"💽", "computer disk" },
+    { u"🙆🏿‍♀️", "woman gesturing OK: dark skin tone" },
+    { u"💷", "pound banknote" },
+    { u"👕", "t-shirt" },
+    { u"🇵🇳", "flag: Pitcairn Islands" },
+    { u"🙇🏻‍♂️", "man bowing: light skin tone" },
+    { u"⚗️", "alembic" },
+    { u"🇬🇦", "flag: Gabon" },
+    { u"🦹🏿‍♀️", "woman supervillain: dark skin tone" },
+    { u"👩🏾‍❤‍👨🏿", "couple with heart: woman, man, medium-dark skin tone, dark skin tone" },
+    { u"🧑🏻‍❤‍💋‍🧑🏿", "kiss: person, person, light skin tone, dark skin tone" },
+    { u"⬅", "left arrow" },
+    { u"🚴🏽‍♀️", "woman biking: medium skin tone" },
+    { u"🚜", "tractor" },
+    { u"🥚", "egg" },
+    { u"🚉", "station" },
+    { u"🧔🏻", "person: light skin tone, beard" },
+    { u"🏍", "motorcycle" },
+    { u"🇨🇱", "flag: Chile" },
+    { u"👴🏻", "old man: light skin tone" },
+    { u"🤾🏾‍♂", "man playing handball: medium-dark skin tone" },
+    { u"🙇🏻‍♀️", "woman bowing: light skin tone" },
+    { u"🥷🏼", "ninja: medium-light skin tone" },
+    { u"👈🏿", "backhand index pointing left: dark skin tone" },
+    { u"🚁", "helicopter" },
+    { u"🚴🏿‍♀", "woman biking: dark skin tone" },
+    { u"👨🏾‍🚀", "man astronaut: medium-dark skin tone" },
+    { u"👮🏼‍♂", "man police officer: medium-light skin tone" },
+    { u"🧑🏽‍🦼", "person in motorized wheelchair: medium skin tone" },
+    { u"🧍🏽‍♂️", "man standing: medium skin tone" },
+    { u"🇫🇰", "flag: Falkland Islands" },
+    { u"🚶🏾‍➡", "person walking facing right: medium-dark skin tone" },
+    { u"👩🏾‍⚖", "woman judge: medium-dark skin tone" },
+    { u"🥍", "lacrosse" },
+    { u"🧀", "cheese wedge" },
+    { u"🧑🏽‍❤️‍🧑🏿", "couple with heart: person, person, medium skin tone, dark skin tone" },
+    { u"🙋🏽‍♂", "man raising hand: medium skin tone" },
+    { u"🧚🏿‍♀️", "woman fairy: dark skin tone" },
+    { u"👩🏼‍🍼", "woman feeding baby: medium-light skin tone" },
+    { u"🐱", "cat face" },
+    { u"🤱🏿", "breast-feeding: dark skin tone" },
+    { u"🧎🏽‍♀‍➡️", "woman kneeling facing right: medium skin tone" },
+    { u"🧚🏻‍♀️", "woman fairy: light skin tone" },
+    { u"👳🏿‍♀", "woman wearing turban: dark skin tone" },
+    { u"💀", "skull" },
+    { u"🧖🏾‍♀️", "woman in steamy room: medium-dark skin tone" },
+    { u"💏", "kiss" },
+    { u"👨🏻‍🤝‍👨🏽", "men holding hands: light skin tone, medium skin tone" },
+    { u"🤵🏿", "person in tuxedo: dark skin tone" },
+    { u"💗", "growing heart" },
+    { u"🪣", "bucket" },
+    { u"⛹🏾‍♀", "woman bouncing ball: medium-dark skin tone" },
+    { u"👏🏽", "clapping hands: medium skin tone" },
+    { u"😂", "face with tears of joy" },
+    { u"🐖", "pig" },
+    { u"❗", "red exclamation mark" },
+    { u"💑🏽", "couple with heart: medium skin tone" },
+    { u"🤹🏾‍♀️", "woman juggling: medium-dark skin tone" },
+    { u"🏃‍♂‍➡️", "man running facing right" },
+    { u"🧑‍💻", "technologist" },
+    { u"👐🏻", "open hands: light skin tone" },
+    { u"🍚", "cooked rice" },
+    { u"👨‍👨‍👧‍👦", "family: man, man, girl, boy" },
+    { u"🗞", "rolled-up newspaper" },
+    { u"🔳", "white square button" },
+    { u"💅", "nail polish" },
+    { u"⛑️", "rescue worker’s helmet" },
+    { u"💂🏼", "guard: medium-light skin tone" },
+    { u"👩🏽‍⚕", "woman health worker: medium skin tone" },
+    { u"👨🏿‍🦯", "man with white cane: dark skin tone" },
+    { u"🧑🏿‍🍼", "person feeding baby: dark skin tone" },
+    { u"🦸🏾‍♂️", "man superhero: medium-dark skin tone" },
+    { u"☠️", "skull and crossbones" },
+    { u"🧔🏿‍♂", "man: dark skin tone, beard" },
+    { u"👩🏼‍❤️‍💋‍👨🏼", "kiss: woman, man, medium-light skin tone" },
+    { u"🐬", "dolphin" },
+    { u"↘", "down-right arrow" },
+    { u"🚶🏻‍➡️", "person walking facing right: light skin tone" },
+    { u"👩🏾‍❤️‍👩🏾", "couple with heart: woman, woman, medium-dark skin tone" },
+    { u"🪯", "khanda" },
+    { u"👎🏼", "thumbs down: medium-light skin tone" },
+    { u"🧝🏻‍♂️", "man elf: light skin tone" },
+    { u"🤲", "palms up together" },
+    { u"⛹🏾‍♂", "man bouncing ball: medium-dark skin tone" },
+    { u"👨🏼‍🤝‍👨🏾", "men holding hands: medium-light skin tone, medium-dark skin tone" },
+    { u"📖", "open book" },
+    { u"💇🏻‍♂️", "man getting haircut: light skin tone" },
+    { u"🧑🏻‍❤️‍💋‍🧑🏽", "kiss: person, person, light skin tone, medium skin tone" },
+    { u"👩🏽‍🦼‍➡️", "woman in motorized wheelchair facing right: medium skin tone" },
+    { u"🇲🇳", "flag: Mongolia" },
+    { u"👨🏽‍❤️‍💋‍👨🏾", "kiss: man, man, medium skin tone, medium-dark skin tone" },
+    { u"🧝🏽", "elf: medium skin tone" },
+    { u"🛂", "passport control" },
+    { u"🙍🏽", "person frowning: medium skin tone" },
+    { u"🦹🏼‍♀️", "woman supervillain: medium-light skin tone" },
+    { u"🚴🏻‍♀", "woman biking: light skin tone" },
+    { u"👨‍👧‍👦", "family: man, girl, boy" },
+    { u"🫃", "pregnant man" },
+    { u"🕵🏿‍♀", "woman detective: dark skin tone" },
+    { u"👨🏾‍⚕", "man health worker: medium-dark skin tone" },
+    { u"🏃🏼‍♂️‍➡️", "man running facing right: medium-light skin tone" },
+    { u"🐶", "dog face" },
+    { u"⤵️", "right arrow curving down" },
+    { u"🐩", "poodle" },
+    { u"🧜🏿", "merperson: dark skin tone" },
+    { u"🏋🏼‍♂️", "man lifting weights: medium-light skin tone" },
+    { u"⏱️", "stopwatch" },
+    { u"🇫🇷", "flag: France" },
+    { u"🫷🏿", "leftwards pushing hand: dark skin tone" },
+    { u"🇷🇪", "flag: Réunion" },
+    { u"👩🏻‍💼", "woman office worker: light skin tone" },
+    { u"👩🏻‍❤‍👨🏼", "couple with heart: woman, man, light skin tone, medium-light skin tone" },
+    { u"🧜", "merperson" },
+    { u"🈲", "Japanese “prohibited” button" },
+    { u"👳🏾‍♀️", "woman wearing turban: medium-dark skin tone" },
+    { u"💆🏼‍♂️", "man getting massage: medium-light skin tone" },
+    { u"👨🏿‍🦰", "man: dark skin tone, red hair" },
+    { u"🔝", "TOP arrow" },
+    { u"🩴", "thong sandal" },
+    { u"👩🏿‍⚕️", "woman health worker: dark skin tone" },
+    { u"👱🏿", "person: dark skin tone, blond hair" },
+    { u"🐄", "cow" },
+    { u"🇵🇬", "flag: Papua New Guinea" },
+    { u"🆗", "OK button" },
+    { u"🚵🏻‍♂️", "man mountain biking: light skin tone" },
+    { u"📝", "memo" },
+    { u"❇️", "sparkle" },
+    { u"🤹🏿‍♂️", "man juggling: dark skin tone" },
+    { u"👩🏽‍✈️", "woman pilot: medium skin tone" },
+    { u"📀", "dvd" },
+    { u"🧑🏾‍✈", "pilot: medium-dark skin tone" },
+    { u"🧖🏽‍♂️", "man in steamy room: medium skin tone" },
+    { u"🧛🏾‍♀️", "woman vampire: medium-dark skin tone" },
+    { u"🤜🏿", "right-facing fist: dark skin tone" },
+    { u"🚶🏿‍♂‍➡", "man walking facing right: dark skin tone" },
+    { u"🍈", "melon" },
+    { u"💇🏼", "person getting haircut: medium-light skin tone" },
+    { u"⛱", "umbrella on ground" },
+    { u"🤴🏽", "prince: medium skin tone" },
+    { u"👴🏾", "old man: medium-dark skin tone" },
+    { u"🧑🏻‍🦽‍➡️", "person in manual wheelchair facing right: light skin tone" },
+    { u"🏷", "label" },
+    { u"🏋🏼‍♀", "woman lifting weights: medium-light skin tone" },
+    { u"🐾", "paw prints" },
+    { u"🤏🏽", "pinching hand: medium skin tone" },
+    { u"🧔‍♀️", "woman: beard" },
+    { u"🆎", "AB button (blood type)" },
+    { u"👨🏻‍🎤", "man singer: light skin tone" },
+    { u"👩🏽‍🤝‍👨🏾", "woman and man holding hands: medium skin tone, medium-dark skin tone" },
+    { u"🚶🏽‍♂️‍➡️", "man walking facing right: medium skin tone" },
+    { u"🏭", "factory" },
+    { u"🧑🏻‍🚀", "astronaut: light skin tone" },
+    { u"🙆🏽‍♀️", "woman gesturing OK: medium skin tone" },
+    { u"🧘🏿‍♀️", "woman in lotus position: dark skin tone" },
+    { u"👩🏿‍❤️‍👨🏼", "couple with heart: woman, man, dark skin tone, medium-light skin tone" },
+    { u"🤸🏽‍♀️", "woman cartwheeling: medium skin tone" },
+    { u"🍪", "cookie" },
+    { u"🎚️", "level slider" },
+    { u"🚶🏽‍➡", "person walking facing right: medium skin tone" },
+    { u"✖", "multiply" },
+    { u"👰🏽‍♀️", "woman with veil: medium skin tone" },
+    { u"♀", "female sign" },
+    { u"🏃‍♂‍➡", "man running facing right" },
+    { u"👳🏼‍♀️", "woman wearing turban: medium-light skin tone" },
+    { u"💂🏿", "guard: dark skin tone" },
+    { u"🧑🏽‍🍼", "person feeding baby: medium skin tone" },
+    { u"🧑🏾‍🦽‍➡️", "person in manual wheelchair facing right: medium-dark skin tone" },
+    { u"🫲🏾", "leftwards hand: medium-dark skin tone" },
+    { u"👰🏿‍♀", "woman with veil: dark skin tone" },
+    { u"🚆", "train" },
+    { u"💇🏼‍♂️", "man getting haircut: medium-light skin tone" },
+    { u"👩🏼‍❤‍💋‍👨🏻", "kiss: woman, man, medium-light skin tone, light skin tone" },
+    { u"🧎🏾‍♀️‍➡️", "woman kneeling facing right: medium-dark skin tone" },
+    { u"👨🏾‍🦯‍➡️", "man with white cane facing right: medium-dark skin tone" },
+    { u"🟦", "blue square" },
+    { u"☮️", "peace symbol" },
+    { u"💍", "ring" },
+    { u"🧑🏼‍🔬", "scientist: medium-light skin tone" },
+    { u"🏄🏻‍♂️", "man surfing: light skin tone" },
+    { u"🦧", "orangutan" },
+    { u"😵", "face with crossed-out eyes" },
+    { u"👨🏼‍🦲", "man: medium-light skin tone, bald" },
+    { u"🙇🏽‍♀", "woman bowing: medium skin tone" },
+    { u"🧗🏼‍♂️", "man climbing: medium-light skin tone" },
+    { u"🫅🏽", "person with crown: medium skin tone" },
+    { u"👩🏿‍❤‍💋‍👩🏼", "kiss: woman, woman, dark skin tone, medium-light skin tone" },
+    { u"🧜🏻‍♀️", "mermaid: light skin tone" },
+    { u"♌", "Leo" },
+    { u"💏🏽", "kiss: medium skin tone" },
+    { u"🤟🏽", "love-you gesture: medium skin tone" },
+    { u"🙇‍♀", "woman bowing" },
+    { u"👸🏻", "princess: light skin tone" },
+    { u"👩🏼‍🚒", "woman firefighter: medium-light skin tone" },
+    { u"🅰", "A button (blood type)" },
+    { u"✅", "check mark button" },
+    { u"🧏", "deaf person" },
+    { u"🪕", "banjo" },
+    { u"🍊", "tangerine" },
+    { u"💃🏾", "woman dancing: medium-dark skin tone" },
+    { u"👩🏻‍❤️‍👩🏾", "couple with heart: woman, woman, light skin tone, medium-dark skin tone" },
+    { u"🧎🏽‍➡", "person kneeling facing right: medium skin tone" },
+    { u"🆘", "SOS button" },
+    { u"🖱️", "computer mouse" },
+    { u"👩‍👩‍👦‍👦", "family: woman, woman, boy, boy" },
+    { u"🙀", "weary cat" },
+    { u"🚶‍♀️", "woman walking" },
+    { u"🤜", "right-facing fist" },
+    { u"🍿", "popcorn" },
+    { u"🤰🏼", "pregnant woman: medium-light skin tone" },
+    { u"🐦‍⬛", "black bird" },
+    { u"🟤", "brown circle" },
+    { u"🖐🏼", "hand with fingers splayed: medium-light skin tone" },
+    { u"👨🏽‍🦳", "man: medium skin tone, white hair" },
+    { u"🏖", "beach with umbrella" },
+    { u"🤺", "person fencing" },
+    { u"⛑", "rescue worker’s helmet" },
+    { u"👩🏼‍🏭", "woman factory worker: medium-light skin tone" },
+    { u"⚫", "black circle" },
+    { u"🦇", "bat" },
+    { u"👾", "alien monster" },
+    { u"⏏", "eject button" },
+    { u"🎴", "flower playing cards" },
+    { u"👬🏽", "men holding hands: medium skin tone" },
+    { u"🙋🏾‍♂", "man raising hand: medium-dark skin tone" },
+    { u"💂🏾‍♂", "man guard: medium-dark skin tone" },
+    { u"🇪🇪", "flag: Estonia" },
+    { u"👨🏾‍🍳", "man cook: medium-dark skin tone" },
+    { u"🕵‍♀", "woman detective" },
+    { u"👩🏾‍❤️‍👨🏿", "couple with heart: woman, man, medium-dark skin tone, dark skin tone" },
+    { u"🙎‍♀", "woman pouting" },
+    { u"👩‍🦽‍➡️", "woman in manual wheelchair facing right" },
+    { u"👱🏿‍♀️", "woman: dark skin tone, blond hair" },
+    { u"🐭", "mouse face" },
+    { u"🧑🏿‍🚒", "firefighter: dark skin tone" },
+    { u"👖", "jeans" },
+    { u"🌠", "shooting star" },
+    { u"👩🏿‍❤️‍💋‍👨🏾", "kiss: woman, man, dark skin tone, medium-dark skin tone" },
+    { u"👨‍🎤", "man singer" },
+    { u"👨🏽‍❤‍👨🏽", "couple with heart: man, man, medium skin tone" },
+    { u"😽", "kissing cat" },
+    { u"🧗‍♀", "woman climbing" },
+    { u"🤦🏾‍♀️", "woman facepalming: medium-dark skin tone" },
+    { u"🧗🏿‍♀️", "woman climbing: dark skin tone" },
+    { u"🗺️", "world map" },
+    { u"🏙️", "cityscape" },
+    { u"⤵", "right arrow curving down" },
+    { u"👎🏽", "thumbs down: medium skin tone" },
+    { u"👮‍♂️", "man police officer" },
+    { u"👨🏻‍💼", "man office worker: light skin tone" },
+    { u"📁", "file folder" },
+    { u"💇", "person getting haircut" },
+    { u"🤽🏾‍♂", "man playing water polo: medium-dark skin tone" },
+    { u"👳🏽", "person wearing turban: medium skin tone" },
+    { u"🧑🏼‍🦰", "person: medium-light skin tone, red hair" },
+    { u"🏃‍♂️‍➡", "man running facing right" },
+    { u"⛔", "no entry" },
+    { u"🤵🏽‍♂️", "man in tuxedo: medium skin tone" },
+    { u"👨🏾‍❤‍💋‍👨🏻", "kiss: man, man, medium-dark skin tone, light skin tone" },
+    { u"🚴🏼", "person biking: medium-light skin tone" },
+    { u"👨🏼‍🔬", "man scientist: medium-light skin tone" },
+    { u"⚗", "alembic" },
+    { u"📲", "mobile phone with arrow" },
+    { u"🇦🇶", "flag: Antarctica" },
+    { u"🚴🏾‍♂️", "man biking: medium-dark skin tone" },
+    { u"🧑🏿‍🤝‍🧑🏻", "people holding hands: dark skin tone, light skin tone" },
+    { u"👷🏽‍♀️", "woman construction worker: medium skin tone" },
+    { u"🚶🏾‍♂️‍➡", "man walking facing right: medium-dark skin tone" },
+    { u"🏕️", "camping" },
+    { u"👱🏻‍♀️", "woman: light skin tone, blond hair" },
+    { u"🧛🏻‍♂️", "man vampire: light skin tone" },
+    { u"🧚🏿", "fairy: dark skin tone" },
+    { u"👨‍⚖", "man judge" },
+    { u"🙌🏻", "raising hands: light skin tone" },
+    { u"🐀", "rat" },
+    { u"🏫", "school" },
+    { u"🧶", "yarn" },
+    { u"🤹🏽‍♀️", "woman juggling: medium skin tone" },
+    { u"🧣", "scarf" },
+    { u"🎸", "guitar" },
+    { u"👩🏼‍❤‍👨🏿", "couple with heart: woman, man, medium-light skin tone, dark skin tone" },
+    { u"🧑🏼‍⚕", "health worker: medium-light skin tone" },
+    { u"👨🏾‍✈️", "man pilot: medium-dark skin tone" },
+    { u"👨🏻‍❤️‍👨🏾", "couple with heart: man, man, light skin tone, medium-dark skin tone" },
+    { u"🧏🏿‍♀️", "deaf woman: dark skin tone" },
+    { u"🏃🏿‍♂️‍➡️", "man running facing right: dark skin tone" },
+    { u"😸", "grinning cat with smiling eyes" },
+    { u"🇩🇲", "flag: Dominica" },
+    { u"🐼", "panda" },
+    { u"👩🏻‍🦽", "woman in manual wheelchair: light skin tone" },
+    { u"™️", "trade mark" },
+    { u"👩‍👦‍👦", "family: woman, boy, boy" },
+    { u"👨🏾‍❤️‍💋‍👨🏽", "kiss: man, man, medium-dark skin tone, medium skin tone" },
+    { u"🫅🏼", "person with crown: medium-light skin tone" },
+    { u"🧝🏼", "elf: medium-light skin tone" },
+    { u"👂🏾", "ear: medium-dark skin tone" },
+    { u"🤸🏽", "person cartwheeling: medium skin tone" },
+    { u"🧒🏾", "child: medium-dark skin tone" },
+    { u"🍤", "fried shrimp" },
+    { u"🧑🏿‍🚀", "astronaut: dark skin tone" },
+    { u"👩🏾‍🔬", "woman scientist: medium-dark skin tone" },
+    { u"🤝🏼", "handshake: medium-light skin tone" },
+    { u"🫰🏽", "hand with index finger and thumb crossed: medium skin tone" },
+    { u"🧜🏼‍♂️", "merman: medium-light skin tone" },
+    { u"🧔🏾‍♀️", "woman: medium-dark skin tone, beard" },
+    { u"🇭🇹", "flag: Haiti" },
+    { u"📰", "newspaper" },
+    { u"🧕🏿", "woman with headscarf: dark skin tone" },
+    { u"📙", "orange book" },
+    { u"🔰", "Japanese symbol for beginner" },
+    { u"🚠", "mountain cableway" },
+    { u"⚙", "gear" },
+    { u"🙅🏻‍♀", "woman gesturing NO: light skin tone" },
+    { u"🧖🏼", "person in steamy room: medium-light skin tone" },
+    { u"🤵🏽‍♂", "man in tuxedo: medium skin tone" },
+    { u"🧔🏿‍♀", "woman: dark skin tone, beard" },
+    { u"🏊🏾‍♂️", "man swimming: medium-dark skin tone" },
+    { u"🧗🏾‍♀", "woman climbing: medium-dark skin tone" },
+    { u"🗡", "dagger" },
+    { u"🦹🏼‍♀", "woman supervillain: medium-light skin tone" },
+    { u"🚵🏽‍♀", "woman mountain biking: medium skin tone" },
+    { u"⛴️", "ferry" },
+    { u"🧑🏼‍🍳", "cook: medium-light skin tone" },
+    { u"🏊🏾‍♂", "man swimming: medium-dark skin tone" },
+    { u"🆒", "COOL button" },
+    { u"👨🏿‍❤‍👨🏼", "couple with heart: man, man, dark skin tone, medium-light skin tone" },
+    { u"👰🏾‍♀", "woman with veil: medium-dark skin tone" },
+    { u"🧑🏿‍⚕", "health worker: dark skin tone" },
+    { u"🧎🏼‍➡️", "person kneeling facing right: medium-light skin tone" },
+    { u"😤", "face with steam from nose" },
+    { u"🤦‍♀️", "woman facepalming" },
+    { u"👰🏼", "person with veil: medium-light skin tone" },
+    { u"🏌🏾‍♀", "woman golfing: medium-dark skin tone" },
+    { u"🧑🏾‍🍳", "cook: medium-dark skin tone" },
+    { u"🧑🏼‍⚖️", "judge: medium-light skin tone" },
+    { u"🙇🏽‍♂", "man bowing: medium skin tone" },
+    { u"🕎", "menorah" },
+    { u"🇪🇸", "flag: Spain" },
+    { u"🦵🏿", "leg: dark skin tone" },
+    { u"〰", "wavy dash" },
+    { u"◀", "reverse button" },
+    { u"🧼", "soap" },
+    { u"👩🏻‍❤‍👨🏿", "couple with heart: woman, man, light skin tone, dark skin tone" },
+    { u"👇🏾", "backhand index pointing down: medium-dark skin tone" },
+    { u"🧙🏼‍♂️", "man mage: medium-light skin tone" },
+    { u"🦬", "bison" },
+    { u"🌥️", "sun behind large cloud" },
+    { u"🏃🏿‍♂‍➡", "man running facing right: dark skin tone" },
+    { u"🤏🏼", "pinching hand: medium-light skin tone" },
+    { u"🇨🇰", "flag: Cook Islands" },
+    { u"❔", "white question mark" },
+    { u"🏋🏾‍♂️", "man lifting weights: medium-dark skin tone" },
+    { u"📱", "mobile phone" },
+    { u"🤽🏽‍♀️", "woman playing water polo: medium skin tone" },
+    { u"👩🏻‍🚒", "woman firefighter: light skin tone" },
+    { u"👩🏼‍❤‍💋‍👩🏼", "kiss: woman, woman, medium-light skin tone" },
+    { u"🧎🏿‍♂️‍➡️", "man kneeling facing right: dark skin tone" },
+    { u"🧑🏻‍🍼", "person feeding baby: light skin tone" },
+    { u"🏄🏽‍♀️", "woman surfing: medium skin tone" },
+    { u"🏃🏾‍♂️", "man running: medium-dark skin tone" },
+    { u"👨🏽‍❤‍💋‍👨🏼", "kiss: man, man, medium skin tone, medium-light skin tone" },
+    { u"👩‍👧‍👦", "family: woman, girl, boy" },
+    { u"🙅🏽‍♀️", "woman gesturing NO: medium skin tone" },
+    { u"🇹🇲", "flag: Turkmenistan" },
+    { u"🇷🇸", "flag: Serbia" },
+    { u"🐓", "rooster" },
+    { u"👩🏿‍🦲", "woman: dark skin tone, bald" },
+    { u"⏹️", "stop button" },
+    { u"👮🏻‍♂️", "man police officer: light skin tone" },
+    { u"👩🏼‍🤝‍👨🏿", "woman and man holding hands: medium-light skin tone, dark skin tone" },
+    { u"🐻", "bear" },
+    { u"👮🏽", "police officer: medium skin tone" },
+    { u"🧑‍🎄", "Mx Claus" },
+    { u"🫲🏽", "leftwards hand: medium skin tone" },
+    { u"⛏", "pick" },
+    { u"🧑🏻‍🎨", "artist: light skin tone" },
+    { u"🙅🏻‍♀️", "woman gesturing NO: light skin tone" },
+    { u"👁", "eye" },
+    { u"🙅🏼‍♂️", "man gesturing NO: medium-light skin tone" },
+    { u"💇‍♂️", "man getting haircut" },
+    { u"🧔🏻‍♂️", "man: light skin tone, beard" },
+    { u"👨🏾‍❤️‍💋‍👨🏻", "kiss: man, man, medium-dark skin tone, light skin tone" },
+    { u"🧙🏼", "mage: medium-light skin tone" },
+    { u"👷🏼‍♂", "man construction worker: medium-light skin tone" },
+    { u"🧑🏾‍🦽‍➡", "person in manual wheelchair facing right: medium-dark skin tone" },
+    { u"💌", "love letter" },
+    { u"👩🏾‍🤝‍👨🏻", "woman and man holding hands: medium-dark skin tone, light skin tone" },
+    { u"🏊🏿‍♂️", "man swimming: dark skin tone" },
+    { u"🙎🏼‍♀️", "woman pouting: medium-light skin tone" },
+    { u"🤷", "person shrugging" },
+    { u"🦆", "duck" },
+    { u"🧔🏼‍♀", "woman: medium-light skin tone, beard" },
+    { u"🧑🏽‍🤝‍🧑🏻", "people holding hands: medium skin tone, light skin tone" },
+    { u"🎎", "Japanese dolls" },
+    { u"🖊", "pen" },
+    { u"🪅", "piñata" },
+    { u"🇬🇪", "flag: Georgia" },
+    { u"👱🏻‍♀", "woman: light skin tone, blond hair" },
+    { u"🚶🏾‍♀️‍➡️", "woman walking facing right: medium-dark skin tone" },
+    { u"🚟", "suspension railway" },
+    { u"👔", "necktie" },
+    { u"👨🏾‍🦲", "man: medium-dark skin tone, bald" },
+    { u"🙇🏽", "person bowing: medium skin tone" },
+    { u"🚴‍♀️", "woman biking" },
+    { u"🧻", "roll of paper" },
+    { u"🦃", "turkey" },
+    { u"👦🏽", "boy: medium skin tone" },
+    { u"🚏", "bus stop" },
+    { u"🏄‍♀", "woman surfing" },
+    { u"🧚🏾", "fairy: medium-dark skin tone" },
+    { u"🐣", "hatching chick" },
+    { u"👨🏽‍❤‍💋‍👨🏻", "kiss: man, man, medium skin tone, light skin tone" },
+    { u"👩🏼‍🤝‍👨🏽", "woman and man holding hands: medium-light skin tone, medium skin tone" },
+    { u"🙇🏾‍♂️", "man bowing: medium-dark skin tone" },
+    { u"🤜🏻", "right-facing fist: light skin tone" },
+    { u"🤾🏽‍♂", "man playing handball: medium skin tone" },
+    { u"🧎🏼‍♀️", "woman kneeling: medium-light skin tone" },
+    { u"👩🏻‍❤‍👩🏻", "couple with heart: woman, woman, light skin tone" },
+    { u"👨‍❤‍💋‍👨", "kiss: man, man" },
+    { u"👨🏻‍🤝‍👨🏼", "men holding hands: light skin tone, medium-light skin tone" },
+    { u"🪙", "coin" },
+    { u"🌊", "water wave" },
+    { u"👨🏾‍🦯‍➡", "man with white cane facing right: medium-dark skin tone" },
+    { u"🙍‍♂", "man frowning" },
+    { u"🧗🏻‍♀", "woman climbing: light skin tone" },
+    { u"🚶🏻‍♀", "woman walking: light skin tone" },
+    { u"♾", "infinity" },
+    { u"🎮", "video game" },
+    { u"🧍‍♂️", "man standing" },
+    { u"↗️", "up-right arrow" },
+    { u"🏃🏻‍♂️‍➡️", "man running facing right: light skin tone" },
+    { u"👩🏿‍❤️‍💋‍👨🏽", "kiss: woman, man, dark skin tone, medium skin tone" },
+    { u"🧏‍♀", "deaf woman" },
+    { u"💮", "white flower" },
+    { u"💼", "briefcase" },
+    { u"👵", "old woman" },
+    { u"🚵🏽‍♂️", "man mountain biking: medium skin tone" },
+    { u"🇦🇮", "flag: Anguilla" },
+    { u"🏓", "ping pong" },
+    { u"✍🏾", "writing hand: medium-dark skin tone" },
+    { u"🤾🏿", "person playing handball: dark skin tone" },
+    { u"👨🏼‍🍼", "man feeding baby: medium-light skin tone" },
+    { u"🧑🏽‍❤‍💋‍🧑🏿", "kiss: person, person, medium skin tone, dark skin tone" },
+    { u"🐅", "tiger" },
+    { u"🧑🏻‍🏭", "factory worker: light skin tone" },
+    { u"🛠", "hammer and wrench" },
+    { u"👩🏾‍❤‍👨🏾", "couple with heart: woman, man, medium-dark skin tone" },
+    { u"🖍️", "crayon" },
+    { u"🔗", "link" },
+    { u"👇🏿", "backhand index pointing down: dark skin tone" },
+    { u"🧙🏻‍♀", "woman mage: light skin tone" },
+    { u"🏜️", "desert" },
+    { u"🧛🏼‍♀️", "woman vampire: medium-light skin tone" },
+    { u"👓", "glasses" },
+    { u"🧒🏼", "child: medium-light skin tone" },
+    { u"🟫", "brown square" },
+    { u"🧑🏽‍🎄", "Mx Claus: medium skin tone" },
+    { u"👩🏿‍🦯‍➡️", "woman with white cane facing right: dark skin tone" },
+    { u"🇷🇼", "flag: Rwanda" },
+    { u"🧑🏾‍🔬", "scientist: medium-dark skin tone" },
+    { u"🥌", "curling stone" },
+    { u"👩‍🎓", "woman student" },
+    { u"🏃‍♀️", "woman running" },
+    { u"🧑🏿‍🦯", "person with white cane: dark skin tone" },
+    { u"🇰🇲", "flag: Comoros" },
+    { u"🏠", "house" },
+    { u"👛", "purse" },
+    { u"👱🏾", "person: medium-dark skin tone, blond hair" },
+    { u"👰🏼‍♂️", "man with veil: medium-light skin tone" },
+    { u"👩🏼‍❤‍👩🏽", "couple with heart: woman, woman, medium-light skin tone, medium skin tone" },
+    { u"🧑🏻‍🌾", "farmer: light skin tone" },
+    { u"🧾", "receipt" },
+    { u"🏄🏽‍♂", "man surfing: medium skin tone" },
+    { u"🚶‍➡️", "person walking facing right" },
+    { u"🤦🏿‍♂️", "man facepalming: dark skin tone" },
+    { u"0⃣", "keycap: 0" },
+    { u"👩🏿‍❤‍👨🏿", "couple with heart: woman, man, dark skin tone" },
+    { u"🧸", "teddy bear" },
+    { u"🧔🏻‍♂", "man: light skin tone, beard" },
+    { u"🔫", "water pistol" },
+    { u"🍙", "rice ball" },
+    { u"🏏", "cricket game" },
+    { u"🈴", "Japanese “passing grade” button" },
+    { u"🩰", "ballet shoes" },
+    { u"🔺", "red triangle pointed up" },
+    { u"▶️", "play button" },
+    { u"🇺🇦", "flag: Ukraine" },
+    { u"🅾️", "O button (blood type)" },
+    { u"💆🏼‍♀️", "woman getting massage: medium-light skin tone" },
+    { u"☎", "telephone" },
+    { u"🚶🏾‍♀‍➡️", "woman walking facing right: medium-dark skin tone" },
+    { u"🧔‍♂️", "man: beard" },
+    { u"🧜‍♂️", "merman" },
+    { u"🚤", "speedboat" },
+    { u"👩🏽‍🦲", "woman: medium skin tone, bald" },
+    { u"🎺", "trumpet" },
+    { u"👫🏿", "woman and man holding hands: dark skin tone" },
+    { u"🌻", "sunflower" },
+    { u"🚶🏻‍♂️‍➡", "man walking facing right: light skin tone" },
+    { u"🇬🇼", "flag: Guinea-Bissau" },
+    { u"🤾🏿‍♂", "man playing handball: dark skin tone" },
+    { u"👲🏽", "person with skullcap: medium skin tone" },
+    { u"😑", "expressionless face" },
+    { u"👩‍❤‍💋‍👨", "kiss: woman, man" },
+    { u"🦸🏿‍♀", "woman superhero: dark skin tone" },
+    { u"🏄🏿", "person surfing: dark skin tone" },
+    { u"🧎‍♀‍➡️", "woman kneeling facing right" },
+    { u"🙏🏻", "folded hands: light skin tone" },
+    { u"📆", "tear-off calendar" },
+    { u"🐈‍⬛", "black cat" },
+    { u"👫🏼", "woman and man holding hands: medium-light skin tone" },
+    { u"🏋🏾‍♂", "man lifting weights: medium-dark skin tone" },
+    { u"™", "trade mark" },
+    { u"👩🏼‍❤️‍👨🏽", "couple with heart: woman, man, medium-light skin tone, medium skin tone" },
+    { u"👩‍🏭", "woman factory worker" },
+    { u"🧎🏻‍♀", "woman kneeling: light skin tone" },
+    { u"⏳", "hourglass not done" },
+    { u"🛸", "flying saucer" },
+    { u"🇹🇿", "flag: Tanzania" },
+    { u"👶🏼", "baby: medium-light skin tone" },
+    { u"🏃🏾‍♀", "woman running: medium-dark skin tone" },
+    { u"🍞", "bread" },
+    { u"👩🏽‍🦽", "woman in manual wheelchair: medium skin tone" },
+    { u"💆🏻‍♂️", "man getting massage: light skin tone" },
+    { u"🈂", "Japanese “service charge” button" },
+    { u"⛹🏻‍♂", "man bouncing ball: light skin tone" },
+    { u"🟥", "red square" },
+    { u"🏃🏼‍♀‍➡️", "woman running facing right: medium-light skin tone" },
+    { u"🖖🏿", "vulcan salute: dark skin tone" },
+    { u"💘", "heart with arrow" },
+    { u"🤛🏿", "left-facing fist: dark skin tone" },
+    { u"❤️‍🔥", "heart on fire" },
+    { u"🇲🇱", "flag: Mali" },
+    { u"🧑🏾‍❤️‍💋‍🧑🏼", "kiss: person, person, medium-dark skin tone, medium-light skin tone" },
+    { u"💃", "woman dancing" },
+    { u"🧓", "older person" },
+    { u"🧑‍🏫", "teacher" },
+    { u"↘️", "down-right arrow" },
+    { u"❤️", "red heart" },
+    { u"👨🏾‍❤️‍💋‍👨🏼", "kiss: man, man, medium-dark skin tone, medium-light skin tone" },
+    { u"✌🏾", "victory hand: medium-dark skin tone" },
+    { u"🧖", "person in steamy room" },
+    { u"🧗🏼‍♀", "woman climbing: medium-light skin tone" },
+    { u"🎓", "graduation cap" },
+    { u"🧘🏾", "person in lotus position: medium-dark skin tone" },
+    { u"🧓🏼", "older person: medium-light skin tone" },
+    { u"🏄🏾‍♀️", "woman surfing: medium-dark skin tone" },
+    { u"👨🏼‍❤️‍💋‍👨🏼", "kiss: man, man, medium-light skin tone" },
+    { u"🏄🏾", "person surfing: medium-dark skin tone" },
+    { u"🧝🏽‍♂", "man elf: medium skin tone" },
+    { u"🧑🏻‍❤️‍🧑🏿", "couple with heart: person, person, light skin tone, dark skin tone" },
+    { u"👩‍👧‍👧", "family: woman, girl, girl" },
+    { u"🥺", "pleading face" },
+    { u"🇸🇪", "flag: Sweden" },
+    { u"🧘🏻‍♀️", "woman in lotus position: light skin tone" },
+    { u"🧑🏻‍⚕️", "health worker: light skin tone" },
+    { u"🫅🏿", "person with crown: dark skin tone" },
+    { u"😥", "sad but relieved face" },
+    { u"🏄🏾‍♀", "woman surfing: medium-dark skin tone" },
+    { u"🖇️", "linked paperclips" },
+    { u"🏋🏻‍♀", "woman lifting weights: light skin tone" },
+    { u"⛹🏻‍♀️", "woman bouncing ball: light skin tone" },
+    { u"🧑🏿‍🤝‍🧑🏼", "people holding hands: dark skin tone, medium-light skin tone" },
+    { u"🙅🏾‍♀️", "woman gesturing NO: medium-dark skin tone" },
+    { u"🙆🏽‍♂️", "man gesturing OK: medium skin tone" },
+    { u"🪷", "lotus" },
+    { u"🌮", "taco" },
+    { u"🚶🏼‍♀️‍➡", "woman walking facing right: medium-light skin tone" },
+    { u"🎖️", "military medal" },
+    { u"🧑🏽‍🦽", "person in manual wheelchair: medium skin tone" },
+    { u"🏋🏿‍♀️", "woman lifting weights: dark skin tone" },
+    { u"🫅🏾", "person with crown: medium-dark skin tone" },
+    { u"👩🏿‍🦰", "woman: dark skin tone, red hair" },
+    { u"💫", "dizzy" },
+    { u"🧑🏽‍🤝‍🧑🏽", "people holding hands: medium skin tone" },
+    { u"🇲🇾", "flag: Malaysia" },
+    { u"👩🏽‍❤‍👨🏾", "couple with heart: woman, man, medium skin tone, medium-dark skin tone" },
+    { u"👨🏿‍🔬", "man scientist: dark skin tone" },
+    { u"👏🏿", "clapping hands: dark skin tone" },
+    { u"🤜🏾", "right-facing fist: medium-dark skin tone" },
+    { u"🌈", "rainbow" },
+    { u"🚢", "ship" },
+    { u"🇰🇮", "flag: Kiribati" },
+    { u"🌧", "cloud with rain" },
+    { u"🏇🏽", "horse racing: medium skin tone" },
+    { u"🛗", "elevator" },
+    { u"🧏🏾", "deaf person: medium-dark skin tone" },
+    { u"👮🏼‍♀", "woman police officer: medium-light skin tone" },
+    { u"🤽🏻‍♂️", "man playing water polo: light skin tone" },
+    { u"🧛🏼‍♀", "woman vampire: medium-light skin tone" },
+    { u"👩🏾‍🤝‍👩🏿", "women holding hands: medium-dark skin tone, dark skin tone" },
+    { u"👩🏿‍❤️‍👩🏼", "couple with heart: woman, woman, dark skin tone, medium-light skin tone" },
+    { u"👩‍🌾", "woman farmer" },
+    { u"🙅🏽‍♂", "man gesturing NO: medium skin tone" },
+    { u"🎍", "pine decoration" },
+    { u"🇸🇿", "flag: Eswatini" },
+    { u"🌇", "sunset" },
+    { u"🐧", "penguin" },
+    { u"🍂", "fallen leaf" },
+    { u"🎞", "film frames" },
+    { u"🦙", "llama" },
+    { u"🥡", "takeout box" },
+    { u"🔁", "repeat button" },
+    { u"🧑🏿‍⚖️", "judge: dark skin tone" },
+    { u"🩷", "pink heart" },
+    { u"👨🏼‍❤️‍💋‍👨🏿", "kiss: man, man, medium-light skin tone, dark skin tone" },
+    { u"🧖🏼‍♀", "woman in steamy room: medium-light skin tone" },
+    { u"⛈️", "cloud with lightning and rain" },
+    { u"🤦🏿", "person facepalming: dark skin tone" },
+    { u"🧑🏾", "person: medium-dark skin tone" },
+    { u"🧑🏽‍🏭", "factory worker: medium skin tone" },
+    { u"🏈", "american football" },
+    { u"💇🏿‍♀️", "woman getting haircut: dark skin tone" },
+    { u"👩🏿‍⚖", "woman judge: dark skin tone" },
+    { u"🇩🇰", "flag: Denmark" },
+    { u"👱‍♀️", "woman: blond hair" },
+    { u"🇩🇬", "flag: Diego Garcia" },
+    { u"👨🏾‍🦰", "man: medium-dark skin tone, red hair" },
+    { u"🇸🇭", "flag: St. Helena" },
+    { u"🏃🏾‍♂‍➡", "man running facing right: medium-dark skin tone" },
+    { u"🚣‍♂️", "man rowing boat" },
+    { u"🧘🏻‍♀", "woman in lotus position: light skin tone" },
+    { u"🧖‍♀️", "woman in steamy room" },
+    { u"😲", "astonished face" },
+    { u"🧄", "garlic" },
+    { u"🦸🏽", "superhero: medium skin tone" },
+    { u"😁", "beaming face with smiling eyes" },
+    { u"🖕🏾", "middle finger: medium-dark skin tone" },
+    { u"👩🏼‍❤️‍👩🏻", "couple with heart: woman, woman, medium-light skin tone, light skin tone" },
+    { u"👨‍🦯‍➡️", "man with white cane facing right" },
+    { u"🧑🏾‍❤‍💋‍🧑🏿", "kiss: person, person, medium-dark skin tone, dark skin tone" },
+    { u"🏑", "field hockey" },
+    { u"🍀", "four leaf clover" },
+    { u"🇵🇦", "flag: Panama" },
+    { u"👨🏻‍⚕️", "man health worker: light skin tone" },
+    { u"👩🏿‍❤️‍👨🏾", "couple with heart: woman, man, dark skin tone, medium-dark skin tone" },
+    { u"🏋🏾‍♀", "woman lifting weights: medium-dark skin tone" },
+    { u"🙇🏽‍♂️", "man bowing: medium skin tone" },
+    { u"🙆", "person gesturing OK" },
+    { u"🦸🏼‍♀", "woman superhero: medium-light skin tone" },
+    { u"💁", "person tipping hand" },
+    { u"💹", "chart increasing with yen" },
+    { u"🐕‍🦺", "service dog" },
+    { u"👩🏻‍🎨", "woman artist: light skin tone" },
+    { u"🧑‍🦼‍➡", "person in motorized wheelchair facing right" },
+    { u"🐑", "ewe" },
+    { u"🧟‍♂", "man zombie" },
+    { u"🏐", "volleyball" },
+    { u"👨🏻‍❤‍👨🏿", "couple with heart: man, man, light skin tone, dark skin tone" },
+    { u"🧑🏻‍🦼", "person in motorized wheelchair: light skin tone" },
+    { u"👩🏾‍✈️", "woman pilot: medium-dark skin tone" },
+    { u"👨🏾‍⚕️", "man health worker: medium-dark skin tone" },
+    { u"🧘🏿", "person in lotus position: dark skin tone" },
+    { u"👩🏼‍💼", "woman office worker: medium-light skin tone" },
+    { u"🧎🏿‍♂‍➡", "man kneeling facing right: dark skin tone" },
+    { u"🚶🏼‍♂️‍➡️", "man walking facing right: medium-light skin tone" },
+    { u"🧚‍♂", "man fairy" },
+    { u"🙍🏼‍♂", "man frowning: medium-light skin tone" },
+    { u"🧎🏻‍♀‍➡", "woman kneeling facing right: light skin tone" },
+    { u"🐆", "leopard" },
+    { u"🤦🏼‍♀", "woman facepalming: medium-light skin tone" },
+    { u"❕", "white exclamation mark" },
+    { u"✋🏽", "raised hand: medium skin tone" },
+    { u"🙎‍♂️", "man pouting" },
+    { u"🧎🏿‍➡️", "person kneeling facing right: dark skin tone" },
+    { u"🙍🏾‍♂", "man frowning: medium-dark skin tone" },
+    { u"⛹🏽‍♂", "man bouncing ball: medium skin tone" },
+    { u"🚴🏽‍♂️", "man biking: medium skin tone" },
+    { u"🙆🏻‍♂️", "man gesturing OK: light skin tone" },
+    { u"🧏🏽‍♀️", "deaf woman: medium skin tone" },
+    { u"🏋🏿‍♂️", "man lifting weights: dark skin tone" },
+    { u"👫🏻", "woman and man holding hands: light skin tone" },
+    { u"🧑🏽‍❤️‍💋‍🧑🏻", "kiss: person, person, medium skin tone, light skin tone" },
+    { u"🤽🏽‍♂️", "man playing water polo: medium skin tone" },
+    { u"🙆🏽‍♀", "woman gesturing OK: medium skin tone" },
+    { u"✒️", "black nib" },
+    { u"🧚🏽", "fairy: medium skin tone" },
+    { u"🌿", "herb" },
+    { u"🧑🏿‍🦯‍➡️", "person with white cane facing right: dark skin tone" },
+    { u"🧑🏼‍❤‍💋‍🧑🏿", "kiss: person, person, medium-light skin tone, dark skin tone" },
+    { u"🕶", "sunglasses" },
+    { u"🏃🏿‍♀‍➡", "woman running facing right: dark skin tone" },
+    { u"🌀", "cyclone" },
+    { u"🤘🏻", "sign of the horns: light skin tone" },
+    { u"♻️", "recycling symbol" },
+    { u"👨🏾‍🤝‍👨🏿", "men holding hands: medium-dark skin tone, dark skin tone" },
+    { u"🙅🏿", "person gesturing NO: dark skin tone" },
+    { u"⛹🏿", "person bouncing ball: dark skin tone" },
+    { u"👂🏿", "ear: dark skin tone" },
+    { u"🚃", "railway car" },
+    { u"💠", "diamond with a dot" },
+    { u"👨‍💼", "man office worker" },
+    { u"📉", "chart decreasing" },
+    { u"🏞", "national park" },
+    { u"🈸", "Japanese “application” button" },
+    { u"👮🏿‍♀️", "woman police officer: dark skin tone" },
+    { u"🐫", "two-hump camel" },
+    { u"👩🏾‍🦼", "woman in motorized wheelchair: medium-dark skin tone" },
+    { u"👨🏿‍🦼‍➡️", "man in motorized wheelchair facing right: dark skin tone" },
+    { u"🕶️", "sunglasses" },
+    { u"🖋️", "fountain pen" },
+    { u"🤾🏾‍♂️", "man playing handball: medium-dark skin tone" },
+    { u"🧑🏾‍❤‍🧑🏽", "couple with heart: person, person, medium-dark skin tone, medium skin tone" },
+    { u"👨🏽‍⚖️", "man judge: medium skin tone" },
+    { u"🇲🇩", "flag: Moldova" },
+    { u"🧑🏼‍🤝‍🧑🏿", "people holding hands: medium-light skin tone, dark skin tone" },
+    { u"💬", "speech balloon" },
+    { u"🧑‍🦽‍➡", "person in manual wheelchair facing right" },
+    { u"👩🏾‍❤️‍👩🏽", "couple with heart: woman, woman, medium-dark skin tone, medium skin tone" },
+    { u"🎠", "carousel horse" },
+    { u"🍻", "clinking beer mugs" },
+    { u"👩🏼‍💻", "woman technologist: medium-light skin tone" },
+    { u"🏋🏼", "person lifting weights: medium-light skin tone" },
+    { u"🛌🏾", "person in bed: medium-dark skin tone" },
+    { u"🤸🏼‍♀️", "woman cartwheeling: medium-light skin tone" },
+    { u"🕥", "ten-thirty" },
+    { u"🛏️", "bed" },
+    { u"👩🏽‍❤‍💋‍👩🏼", "kiss: woman, woman, medium skin tone, medium-light skin tone" },
+    { u"ℹ", "information" },
+    { u"👩‍👦", "family: woman, boy" },
+    { u"👊🏿", "oncoming fist: dark skin tone" },
+    { u"🧑🏿‍🎓", "student: dark skin tone" },
+    { u"💁🏻‍♂️", "man tipping hand: light skin tone" },
+    { u"👸", "princess" },
+    { u"👨‍👦", "family: man, boy" },
+    { u"🙋🏾", "person raising hand: medium-dark skin tone" },
+    { u"🙎🏿‍♀️", "woman pouting: dark skin tone" },
+    { u"🙅🏻‍♂️", "man gesturing NO: light skin tone" },
+    { u"🧑🏼‍🦲", "person: medium-light skin tone, bald" },
+    { u"💞", "revolving hearts" },
+    { u"🧙🏾", "mage: medium-dark skin tone" },
+    { u"🧑‍🦯‍➡️", "person with white cane facing right" },
+    { u"✨", "sparkles" },
+    { u"👨🏽‍❤️‍👨🏻", "couple with heart: man, man, medium skin tone, light skin tone" },
+    { u"🧑🏽‍❤️‍🧑🏾", "couple with heart: person, person, medium skin tone, medium-dark skin tone" },
+    { u"💇🏽‍♀", "woman getting haircut: medium skin tone" },
+    { u"🧑🏻‍❤‍🧑🏿", "couple with heart: person, person, light skin tone, dark skin tone" },
+    { u"🚱", "non-potable water" },
+    { u"👨🏽‍❤‍👨🏾", "couple with heart: man, man, medium skin tone, medium-dark skin tone" },
+    { u"🧝🏾‍♀", "woman elf: medium-dark skin tone" },
+    { u"🫙", "jar" },
+    { u"👨🏿‍🚒", "man firefighter: dark skin tone" },
+    { u"🌦️", "sun behind rain cloud" },
+    { u"⛹🏿‍♂", "man bouncing ball: dark skin tone" },
+    { u"🦹🏾‍♀️", "woman supervillain: medium-dark skin tone" },
+    { u"🧺", "basket" },
+    { u"🥳", "partying face" },
+    { u"👩🏿‍❤️‍💋‍👨🏻", "kiss: woman, man, dark skin tone, light skin tone" },
+    { u"💥", "collision" },
+    { u"🧡", "orange heart" },
+    { u"👨🏽‍🦯‍➡️", "man with white cane facing right: medium skin tone" },
+    { u"👨🏽‍⚕️", "man health worker: medium skin tone" },
+    { u"🌳", "deciduous tree" },
+    { u"👩🏿‍🤝‍👨🏻", "woman and man holding hands: dark skin tone, light skin tone" },
+    { u"🤸🏼‍♂️", "man cartwheeling: medium-light skin tone" },
+    { u"🌒", "waxing crescent moon" },
+    { u"♣️", "club suit" },
+    { u"💆🏾", "person getting massage: medium-dark skin tone" },
+    { u"🫗", "pouring liquid" },
+    { u"💁🏻‍♂", "man tipping hand: light skin tone" },
+    { u"✊🏾", "raised fist: medium-dark skin tone" },
+    { u"🫱🏾", "rightwards hand: medium-dark skin tone" },
+    { u"🧓🏾", "older person: medium-dark skin tone" },
+    { u"🧖🏿‍♀️", "woman in steamy room: dark skin tone" },
+    { u"👩🏽‍❤‍👨🏽", "couple with heart: woman, man, medium skin tone" },
+    { u"👩🏿‍🦽‍➡", "woman in manual wheelchair facing right: dark skin tone" },
+    { u"🧑🏼‍❤‍💋‍🧑🏻", "kiss: person, person, medium-light skin tone, light skin tone" },
+    { u"🩳", "shorts" },
+    { u"🚶🏻‍♀️", "woman walking: light skin tone" },
+    { u"🙋‍♂", "man raising hand" },
+    { u"🧜🏽‍♂", "merman: medium skin tone" },
+    { u"👈🏽", "backhand index pointing left: medium skin tone" },
+    { u"🧎‍♀️", "woman kneeling" },
+    { u"🙋🏼‍♀️", "woman raising hand: medium-light skin tone" },
+    { u"🇧🇯", "flag: Benin" },
+    { u"🧔🏿‍♀️", "woman: dark skin tone, beard" },
+    { u"🏊🏾", "person swimming: medium-dark skin tone" },
+    { u"🙌🏾", "raising hands: medium-dark skin tone" },
+    { u"👨🏼‍❤️‍👨🏿", "couple with heart: man, man, medium-light skin tone, dark skin tone" },
+    { u"👩🏻‍💻", "woman technologist: light skin tone" },
+    { u"🙇🏾‍♂", "man bowing: medium-dark skin tone" },
+    { u"🇦🇱", "flag: Albania" },
+    { u"🧎🏾‍➡️", "person kneeling facing right: medium-dark skin tone" },
+    { u"💂🏻‍♂️", "man guard: light skin tone" },
+    { u"👷‍♂", "man construction worker" },
+    { u"🟧", "orange square" },
+    { u"🫶🏾", "heart hands: medium-dark skin tone" },
+    { u"👆🏿", "backhand index pointing up: dark skin tone" },
+    { u"🛕", "hindu temple" },
+    { u"👨🏼‍❤‍💋‍👨🏿", "kiss: man, man, medium-light skin tone, dark skin tone" },
+    { u"👍🏽", "thumbs up: medium skin tone" },
+    { u"🕺🏿", "man dancing: dark skin tone" },
+    { u"‼", "double exclamation mark" },
+    { u"👩‍🦼‍➡️", "woman in motorized wheelchair facing right" },
+    { u"🤞🏿", "crossed fingers: dark skin tone" },
+    { u"🧚🏻", "fairy: light skin tone" },
+    { u"👳🏾‍♂️", "man wearing turban: medium-dark skin tone" },
+    { u"🙆🏿‍♀", "woman gesturing OK: dark skin tone" },
+    { u"🚶🏼‍♂️", "man walking: medium-light skin tone" },
+    { u"🦹🏾", "supervillain: medium-dark skin tone" },
+    { u"🚚", "delivery truck" },
+    { u"🌓", "first quarter moon" },
+    { u"🦸🏻‍♀️", "woman superhero: light skin tone" },
+    { u"🧎‍♂️‍➡️", "man kneeling facing right" },
+    { u"😶‍🌫", "face in clouds" },
+    { u"🔙", "BACK arrow" },
+    { u"🕹", "joystick" },
+    { u"🔩", "nut and bolt" },
+    { u"👩🏼‍❤‍💋‍👩🏽", "kiss: woman, woman, medium-light skin tone, medium skin tone" },
+    { u"🕵🏿‍♂", "man detective: dark skin tone" },
+    { u"👨🏻‍⚕", "man health worker: light skin tone" },
+    { u"🧑🏼‍🦼‍➡️", "person in motorized wheelchair facing right: medium-light skin tone" },
+    { u"🧗🏽‍♂", "man climbing: medium skin tone" },
+    { u"🚶🏿‍♀‍➡", "woman walking facing right: dark skin tone" },
+    { u"🔤", "input latin letters" },
+    { u"☹", "frowning face" },
+    { u"🫄🏽", "pregnant person: medium skin tone" },
+    { u"🧚🏽‍♀️", "woman fairy: medium skin tone" },
+    { u"🤰🏻", "pregnant woman: light skin tone" },
+    { u"🧑🏻‍🏫", "teacher: light skin tone" },
+    { u"👩‍❤️‍💋‍👩", "kiss: woman, woman" },
+    { u"🤸‍♂️", "man cartwheeling" },
+    { u"🤷‍♂", "man shrugging" },
+    { u"😯", "hushed face" },
+    { u"🤱🏽", "breast-feeding: medium skin tone" },
+    { u"👩🏽‍❤‍💋‍👨🏾", "kiss: woman, man, medium skin tone, medium-dark skin tone" },
+    { u"🏄", "person surfing" },
+    { u"🕵🏼‍♂️", "man detective: medium-light skin tone" },
+    { u"🧑🏼‍💼", "office worker: medium-light skin tone" },
+    { u"🦄", "unicorn" },
+    { u"🪧", "placard" },
+    { u"🏄🏾‍♂", "man surfing: medium-dark skin tone" },
+    { u"😛", "face with tongue" },
+    { u"🙍🏻‍♀", "woman frowning: light skin tone" },
+    { u"👩🏼‍❤‍👨🏻", "couple with heart: woman, man, medium-light skin tone, light skin tone" },
+    { u"🧯", "fire extinguisher" },
+    { u"🗡️", "dagger" },
+    { u"🧙🏿‍♀", "woman mage: dark skin tone" },
+    { u"👩🏿‍🦽", "woman in manual wheelchair: dark skin tone" },
+    { u"🖥️", "desktop computer" },
+    { u"3️⃣", "keycap: 3" },
+    { u"👨🏼‍❤‍👨🏾", "couple with heart: man, man, medium-light skin tone, medium-dark skin tone" },
+    { u"🎶", "musical notes" },
+    { u"👩🏻‍❤️‍💋‍👨🏼", "kiss: woman, man, light skin tone, medium-light skin tone" },
+    { u"🤦🏿‍♀️", "woman facepalming: dark skin tone" },
+    { u"🧎🏻‍♂️‍➡", "man kneeling facing right: light skin tone" },
+    { u"🏂🏿", "snowboarder: dark skin tone" },
+    { u"🫧", "bubbles" },
+    { u"👩🏽‍❤️‍💋‍👩🏻", "kiss: woman, woman, medium skin tone, light skin tone" },
+    { u"🧢", "billed cap" },
+    { u"✍🏿", "writing hand: dark skin tone" },
+    { u"🧃", "beverage box" },
+    { u"💂🏿‍♀️", "woman guard: dark skin tone" },
+    { u"🥷🏻", "ninja: light skin tone" },
+    { u"♥", "heart suit" },
+    { u"🧝🏿‍♂️", "man elf: dark skin tone" },
+    { u"🚴🏾", "person biking: medium-dark skin tone" },
+    { u"👩‍🦼‍➡", "woman in motorized wheelchair facing right" },
+    { u"🇦🇨", "flag: Ascension Island" },
+    { u"🙎🏼‍♂", "man pouting: medium-light skin tone" },
+    { u"⛹️‍♀️", "woman bouncing ball" },
+    { u"☠", "skull and crossbones" },
+    { u"🧑🏻‍💼", "office worker: light skin tone" },
+    { u"🫲🏻", "leftwards hand: light skin tone" },
+    { u"🧎‍♀‍➡", "woman kneeling facing right" },
+    { u"👩🏿‍🍳", "woman cook: dark skin tone" },
+    { u"😾", "pouting cat" },
+    { u"🦸🏼‍♂️", "man superhero: medium-light skin tone" },
+    { u"⛱️", "umbrella on ground" },
+    { u"👷🏼‍♀️", "woman construction worker: medium-light skin tone" },
+    { u"👩🏻‍🍳", "woman cook: light skin tone" },
+    { u"🧎🏽‍♂‍➡", "man kneeling facing right: medium skin tone" },
+    { u"👩🏾‍❤‍👩🏻", "couple with heart: woman, woman, medium-dark skin tone, light skin tone" },
+    { u"🏋️‍♂", "man lifting weights" },
+    { u"🤦🏽‍♂️", "man facepalming: medium skin tone" },
+    { u"👨🏿‍🦯‍➡️", "man with white cane facing right: dark skin tone" },
+    { u"🪺", "nest with eggs" },
+    { u"👳", "person wearing turban" },
+    { u"🤵🏿‍♂️", "man in tuxedo: dark skin tone" },
+    { u"👩🏼‍❤️‍👨🏼", "couple with heart: woman, man, medium-light skin tone" },
+    { u"🚣🏻‍♂️", "man rowing boat: light skin tone" },
+    { u"🧒🏻", "child: light skin tone" },
+    { u"💇🏿", "person getting haircut: dark skin tone" },
+    { u"🐥", "front-facing baby chick" },
+    { u"🌂", "closed umbrella" },
+    { u"🫱🏿‍🫲🏼", "handshake: dark skin tone, medium-light skin tone" },
+    { u"👩🏽‍🎨", "woman artist: medium skin tone" },
+    { u"🧑🏿‍🦽", "person in manual wheelchair: dark skin tone" },
+    { u"👱🏻‍♂", "man: light skin tone, blond hair" },
+    { u"🐎", "horse" },
+    { u"👨🏼‍❤‍👨🏼", "couple with heart: man, man, medium-light skin tone" },
+    { u"👨🏽‍🤝‍👨🏿", "men holding hands: medium skin tone, dark skin tone" },
+    { u"7⃣", "keycap: 7" },
+    { u"🧗🏼‍♂", "man climbing: medium-light skin tone" },
+    { u"🏄🏿‍♂️", "man surfing: dark skin tone" },
+    { u"🧑🏻‍🦯", "person with white cane: light skin tone" },
+    { u"🧑🏽‍🦽‍➡", "person in manual wheelchair facing right: medium skin tone" },
+    { u"👩🏽‍❤️‍👨🏻", "couple with heart: woman, man, medium skin tone, light skin tone" },
+    { u"💁🏽‍♂", "man tipping hand: medium skin tone" },
+    { u"👎🏿", "thumbs down: dark skin tone" },
+    { u"🇳🇱", "flag: Netherlands" },
+    { u"🙆🏼‍♂️", "man gesturing OK: medium-light skin tone" },
+    { u"🤦🏼‍♀️", "woman facepalming: medium-light skin tone" },
+    { u"🦊", "fox" },
+    { u"👨🏻‍🦱", "man: light skin tone, curly hair" },
+    { u"💆🏼‍♂", "man getting massage: medium-light skin tone" },
+    { u"🏌🏾‍♂", "man golfing: medium-dark skin tone" },
+    { u"📭", "open mailbox with lowered flag" },
+    { u"🚴🏻‍♀️", "woman biking: light skin tone" },
+    { u"🏋🏾‍♀️", "woman lifting weights: medium-dark skin tone" },
+    { u"💇🏻", "person getting haircut: light skin tone" },
+    { u"⚾", "baseball" },
+    { u"👨🏼‍❤‍💋‍👨🏽", "kiss: man, man, medium-light skin tone, medium skin tone" },
+    { u"⛹🏻‍♂️", "man bouncing ball: light skin tone" },
+    { u"🇹🇳", "flag: Tunisia" },
+    { u"🧑🏼‍💻", "technologist: medium-light skin tone" },
+    { u"🧙🏻‍♀️", "woman mage: light skin tone" },
+    { u"🔬", "microscope" },
+    { u"🙇🏿‍♀", "woman bowing: dark skin tone" },
+    { u"🏇🏻", "horse racing: light skin tone" },
+    { u"👨🏾‍🤝‍👨🏼", "men holding hands: medium-dark skin tone, medium-light skin tone" },
+    { u"👍🏼", "thumbs up: medium-light skin tone" },
+    { u"🛐", "place of worship" },
+    { u"🫅🏻", "person with crown: light skin tone" },
+    { u"🫷🏼", "leftwards pushing hand: medium-light skin tone" },
+    { u"🧇", "waffle" },
+    { u"👊🏼", "oncoming fist: medium-light skin tone" },
+    { u"🤾🏿‍♀", "woman playing handball: dark skin tone" },
+    { u"👷🏻‍♀️", "woman construction worker: light skin tone" },
+    { u"🚵🏾‍♀️", "woman mountain biking: medium-dark skin tone" },
+    { u"🚶🏼‍♀️‍➡️", "woman walking facing right: medium-light skin tone" },
+    { u"👩🏿‍✈️", "woman pilot: dark skin tone" },
+    { u"🏃🏽‍➡️", "person running facing right: medium skin tone" },
+    { u"🕜", "one-thirty" },
+    { u"🧑‍🎤", "singer" },
+    { u"💐", "bouquet" },
+    { u"👩🏻‍🔬", "woman scientist: light skin tone" },
+    { u"👨🏾‍❤️‍💋‍👨🏿", "kiss: man, man, medium-dark skin tone, dark skin tone" },
+    { u"🕺🏾", "man dancing: medium-dark skin tone" },
+    { u"👨🏾‍❤‍👨🏼", "couple with heart: man, man, medium-dark skin tone, medium-light skin tone" },
+    { u"🦅", "eagle" },
+    { u"🧑🏻‍🎄", "Mx Claus: light skin tone" },
+    { u"👨🏾‍🎓", "man student: medium-dark skin tone" },
+    { u"💁🏾‍♂️", "man tipping hand: medium-dark skin tone" },
+    { u"👇🏽", "backhand index pointing down: medium skin tone" },
+    { u"🏄🏼‍♀️", "woman surfing: medium-light skin tone" },
+    { u"🤓", "nerd face" },
+    { u"👩🏻‍🦲", "woman: light skin tone, bald" },
+    { u"🎞️", "film frames" },
+    { u"♓", "Pisces" },
+    { u"⬇️", "down arrow" },
+    { u"ℹ️", "information" },
+    { u"🏃🏾‍♀️‍➡", "woman running facing right: medium-dark skin tone" },
+    { u"🕺", "man dancing" },
+    { u"🤦🏾‍♂", "man facepalming: medium-dark skin tone" },
+    { u"🧑🏾‍🦱", "person: medium-dark skin tone, curly hair" },
+    { u"🏅", "sports medal" },
+    { u"🎇", "sparkler" },
+    { u"👩🏾‍❤️‍👨🏾", "couple with heart: woman, man, medium-dark skin tone" },
+    { u"🚵🏿‍♀️", "woman mountain biking: dark skin tone" },
+    { u"🧑‍🧑‍🧒‍🧒", "family: adult, adult, child, child" },
+    { u"👨🏾‍🦳", "man: medium-dark skin tone, white hair" },
+    { u"🧙🏾‍♀", "woman mage: medium-dark skin tone" },
+    { u"🫖", "teapot" },
+    { u"👩🏾‍🍼", "woman feeding baby: medium-dark skin tone" },
+    { u"🧑🏻‍🦲", "person: light skin tone, bald" },
+    { u"🆔", "ID button" },
+    { u"🎤", "microphone" },
+    { u"👩🏽‍❤️‍👩🏾", "couple with heart: woman, woman, medium skin tone, medium-dark skin tone" },
+    { u"💂🏾", "guard: medium-dark skin tone" },
+    { u"💆🏽‍♀️", "woman getting massage: medium skin tone" },
+    { u"👨🏿‍🎤", "man singer: dark skin tone" },
+    { u"💢", "anger symbol" },
+    { u"🤏🏾", "pinching hand: medium-dark skin tone" },
+    { u"⛹‍♀", "woman bouncing ball" },
+    { u"🤦🏿‍♀", "woman facepalming: dark skin tone" },
+    { u"🧍🏼‍♂️", "man standing: medium-light skin tone" },
+    { u"🙇‍♂", "man bowing" },
+    { u"🧎🏻‍♀️‍➡", "woman kneeling facing right: light skin tone" },
+    { u"🗑", "wastebasket" },
+    { u"🏌🏻‍♀", "woman golfing: light skin tone" },
+    { u"✍🏽", "writing hand: medium skin tone" },
+    { u"🙂‍↔️", "head shaking horizontally" },
+    { u"🐷", "pig face" },
+    { u"😅", "grinning face with sweat" },
+    { u"🧕🏼", "woman with headscarf: medium-light skin tone" },
+    { u"🏃🏽‍♀‍➡️", "woman running facing right: medium skin tone" },
+    { u"💂", "guard" },
+    { u"😏", "smirking face" },
+    { u"🤾🏼‍♀️", "woman playing handball: medium-light skin tone" },
+    { u"🤟🏻", "love-you gesture: light skin tone" },
+    { u"👨🏽‍❤️‍💋‍👨🏼", "kiss: man, man, medium skin tone, medium-light skin tone" },
+    { u"🧔🏽‍♂", "man: medium skin tone, beard" },
+    { u"🕹️", "joystick" },
+    { u"🧑🏽‍🦱", "person: medium skin tone, curly hair" },
+    { u"🕟", "four-thirty" },
+    { u"⁉", "exclamation question mark" },
+    { u"😀", "grinning face" },
+    { u"🧎🏾‍♀️", "woman kneeling: medium-dark skin tone" },
+    { u"🇨🇴", "flag: Colombia" },
+    { u"🧑🏿‍🏭", "factory worker: dark skin tone" },
+    { u"🧪", "test tube" },
+    { u"💇‍♀️", "woman getting haircut" },
+    { u"🧘🏼‍♂️", "man in lotus position: medium-light skin tone" },
+    { u"🎧", "headphone" },
+    { u"🧑‍🦰", "person: red hair" },
+    { u"🧘🏽", "person in lotus position: medium skin tone" },
+    { u"👨🏻‍🦼", "man in motorized wheelchair: light skin tone" },
+    { u"👱‍♂", "man: blond hair" },
+    { u"👶🏿", "baby: dark skin tone" },
+    { u"👳‍♂️", "man wearing turban" },
+    { u"🐍", "snake" },
+    { u"🇹🇯", "flag: Tajikistan" },
+    { u"🎆", "fireworks" },
+    { u"🧑🏼‍❤‍💋‍🧑🏾", "kiss: person, person, medium-light skin tone, medium-dark skin tone" },
+    { u"👦🏾", "boy: medium-dark skin tone" },
+    { u"🇰🇵", "flag: North Korea" },
+    { u"🙇🏻‍♂", "man bowing: light skin tone" },
+    { u"💏🏿", "kiss: dark skin tone" },
+    { u"👨🏿‍🦯‍➡", "man with white cane facing right: dark skin tone" },
+    { u"㊗", "Japanese “congratulations” button" },
+    { u"🏳️‍⚧️", "transgender flag" },
+    { u"🏄🏿‍♂", "man surfing: dark skin tone" },
+    { u"🌤", "sun behind small cloud" },
+    { u"🤷🏽", "person shrugging: medium skin tone" },
+    { u"👨🏼‍🤝‍👨🏻", "men holding hands: medium-light skin tone, light skin tone" },
+    { u"🏴󠁧󠁢󠁷󠁬󠁳󠁿", "flag: Wales" },
+    { u"🌛", "first quarter moon face" },
+    { u"🤦🏽‍♀️", "woman facepalming: medium skin tone" },
+    { u"👩‍💻", "woman technologist" },
+    { u"🎋", "tanabata tree" },
+    { u"👰‍♂", "man with veil" },
+    { u"👭🏿", "women holding hands: dark skin tone" },
+    { u"🫴", "palm up hand" },
+    { u"⛓", "chains" },
+    { u"🇬🇵", "flag: Guadeloupe" },
+    { u"🐉", "dragon" },
+    { u"🧗🏻", "person climbing: light skin tone" },
+    { u"🧑‍✈", "pilot" },
+    { u"👮🏽‍♀️", "woman police officer: medium skin tone" },
+    { u"🧮", "abacus" },
+    { u"👩🏽‍❤️‍👨🏾", "couple with heart: woman, man, medium skin tone, medium-dark skin tone" },
+    { u"👩🏼‍❤‍💋‍👨🏼", "kiss: woman, man, medium-light skin tone" },
+    { u"🧑🏽‍✈️", "pilot: medium skin tone" },
+    { u"🌃", "night with stars" },
+    { u"🧑🏼‍❤‍🧑🏿", "couple with heart: person, person, medium-light skin tone, dark skin tone" },
+    { u"🏳️", "white flag" },
+    { u"🏋🏽", "person lifting weights: medium skin tone" },
+    { u"🧱", "brick" },
+    { u"🧏‍♀️", "deaf woman" },
+    { u"🧘‍♀", "woman in lotus position" },
+    { u"👨🏻‍❤‍💋‍👨🏽", "kiss: man, man, light skin tone, medium skin tone" },
+    { u"🤾🏼", "person playing handball: medium-light skin tone" },
+    { u"🙇🏿‍♂️", "man bowing: dark skin tone" },
+    { u"👽", "alien" },
+    { u"👨🏿‍🤝‍👨🏽", "men holding hands: dark skin tone, medium skin tone" },
+    { u"🧚", "fairy" },
+    { u"👩🏻‍🦯", "woman with white cane: light skin tone" },
+    { u"🦸‍♀", "woman superhero" },
+    { u"🤷🏿", "person shrugging: dark skin tone" },
+    { u"🇱🇸", "flag: Lesotho" },
+    { u"🧗", "person climbing" },
+    { u"🤹🏻‍♂️", "man juggling: light skin tone" },
+    { u"💰", "money bag" },
+    { u"⛹🏼‍♂", "man bouncing ball: medium-light skin tone" },
+    { u"💆🏼", "person getting massage: medium-light skin tone" },
+    { u"🧑🏽‍🎓", "student: medium skin tone" },
+    { u"🚻", "restroom" },
+    { u"🍬", "candy" },
+    { u"🦸‍♀️", "woman superhero" },
+    { u"🌄", "sunrise over mountains" },
+    { u"🤏", "pinching hand" },
+    { u"🦈", "shark" },
+    { u"👩‍🔧", "woman mechanic" },
+    { u"↩️", "right arrow curving left" },
+    { u"🇦🇼", "flag: Aruba" },
+    { u"🎉", "party popper" },
+    { u"🕵🏿", "detective: dark skin tone" },
+    { u"🔷", "large blue diamond" },
+    { u"🖐🏾", "hand with fingers splayed: medium-dark skin tone" },
+    { u"☸", "wheel of dharma" },
+    { u"🧏🏼‍♀️", "deaf woman: medium-light skin tone" },
+    { u"👩🏽‍❤️‍💋‍👨🏽", "kiss: woman, man, medium skin tone" },
+    { u"👮🏽‍♂️", "man police officer: medium skin tone" },
+    { u"🤹‍♀️", "woman juggling" },
+    { u"👬🏾", "men holding hands: medium-dark skin tone" },
+    { u"🪑", "chair" },
+    { u"🇬🇲", "flag: Gambia" },
+    { u"🧛🏿‍♂️", "man vampire: dark skin tone" },
+    { u"🦹🏽‍♀", "woman supervillain: medium skin tone" },
+    { u"🚶🏻‍♀‍➡️", "woman walking facing right: light skin tone" },
+    { u"🧖🏻", "person in steamy room: light skin tone" },
+    { u"🇻🇮", "flag: U.S. Virgin Islands" },
+    { u"🧑‍🚒", "firefighter" },
+    { u"⭐", "star" },
+    { u"🧑‍🧒", "family: adult, child" },
+    { u"👩🏾‍🎤", "woman singer: medium-dark skin tone" },
+    { u"🤛🏾", "left-facing fist: medium-dark skin tone" },
+    { u"👩🏻‍🤝‍👨🏾", "woman and man holding hands: light skin tone, medium-dark skin tone" },
+    { u"💅🏼", "nail polish: medium-light skin tone" },
+    { u"👩🏽‍✈", "woman pilot: medium skin tone" },
+    { u"🖨️", "printer" },
+    { u"🇿🇲", "flag: Zambia" },
+    { u"🧍🏿", "person standing: dark skin tone" },
+    { u"🎡", "ferris wheel" },
+    { u"🤰🏾", "pregnant woman: medium-dark skin tone" },
+    { u"#⃣", "keycap: #" },
+    { u"🚵‍♂", "man mountain biking" },
+    { u"👨‍🦰", "man: red hair" },
+    { u"🧖‍♀", "woman in steamy room" },
+    { u"👩🏻‍🤝‍👨🏼", "woman and man holding hands: light skin tone, medium-light skin tone" },
+    { u"🌺", "hibiscus" },
+    { u"🤵🏼‍♂", "man in tuxedo: medium-light skin tone" },
+    { u"🕵️", "detective" },
+    { u"👨🏻‍🎨", "man artist: light skin tone" },
+    { u"😵‍💫", "face with spiral eyes" },
+    { u"🌗", "last quarter moon" },
+    { u"🏇🏼", "horse racing: medium-light skin tone" },
+    { u"🧑🏻‍🤝‍🧑🏽", "people holding hands: light skin tone, medium skin tone" },
+    { u"🧏🏻‍♂️", "deaf man: light skin tone" },
+    { u"📇", "card index" },
+    { u"👃🏾", "nose: medium-dark skin tone" },
+    { u"🧑🏼‍🦽‍➡", "person in manual wheelchair facing right: medium-light skin tone" },
+    { u"🛅", "left luggage" },
+    { u"👨🏿‍🍼", "man feeding baby: dark skin tone" },
+    { u"👨🏼‍🦰", "man: medium-light skin tone, red hair" },
+    { u"🥷", "ninja" },
+    { u"🇸🇾", "flag: Syria" },
+    { u"👉", "backhand index pointing right" },
+    { u"🧧", "red envelope" },
+    { u"👮‍♂", "man police officer" },
+    { u"👩🏽‍❤‍💋‍👨🏼", "kiss: woman, man, medium skin tone, medium-light skin tone" },
+    { u"👧🏼", "girl: medium-light skin tone" },
+    { u"👨🏻‍🦼‍➡", "man in motorized wheelchair facing right: light skin tone" },
+    { u"👩🏾‍🌾", "woman farmer: medium-dark skin tone" },
+    { u"🤘🏿", "sign of the horns: dark skin tone" },
+    { u"🏄🏿‍♀️", "woman surfing: dark skin tone" },
+    { u"👨🏽‍🦲", "man: medium skin tone, bald" },
+    { u"🤞🏼", "crossed fingers: medium-light skin tone" },
+    { u"😡", "enraged face" },
+    { u"🍝", "spaghetti" },
+    { u"🏳", "white flag" },
+    { u"💂🏿‍♂️", "man guard: dark skin tone" },
+    { u"🙇🏾‍♀️", "woman bowing: medium-dark skin tone" },
+    { u"👩🏼‍⚕", "woman health worker: medium-light skin tone" },
+    { u"🪉", "harp" },
+    { u"👃🏻", "nose: light skin tone" },
+    { u"👳🏼", "person wearing turban: medium-light skin tone" },
+    { u"🧑🏾‍❤️‍🧑🏽", "couple with heart: person, person, medium-dark skin tone, medium skin tone" },
+    { u"🤶🏽", "Mrs. Claus: medium skin tone" },
+    { u"👩🏾‍⚕", "woman health worker: medium-dark skin tone" },
+    { u"👎🏻", "thumbs down: light skin tone" },
+    { u"🍭", "lollipop" },
+    { u"🔖", "bookmark" },
+    { u"🎛️", "control knobs" },
+    { u"⚧", "transgender symbol" },
+    { u"👨‍🦳", "man: white hair" },
+    { u"👮🏾‍♀️", "woman police officer: medium-dark skin tone" },
+    { u"🤴", "prince" },
+    { u"👩🏽‍❤‍💋‍👨🏽", "kiss: woman, man, medium skin tone" },
+    { u"🧗🏼", "person climbing: medium-light skin tone" },
+    { u"👩🏼‍❤️‍💋‍👩🏾", "kiss: woman, woman, medium-light skin tone, medium-dark skin tone" },
+    { u"😍", "smiling face with heart-eyes" },
+    { u"🧑🏼‍🦯", "person with white cane: medium-light skin tone" },
+    { u"🧚🏾‍♂️", "man fairy: medium-dark skin tone" },
+    { u"🧘🏿‍♀", "woman in lotus position: dark skin tone" },
+    { u"📴", "mobile phone off" },
+    { u"👳🏾‍♂", "man wearing turban: medium-dark skin tone" },
+    { u"🧑‍🌾", "farmer" },
+    { u"👩🏿‍🍼", "woman feeding baby: dark skin tone" },
+    { u"🙅‍♀", "woman gesturing NO" },
+    { u"🧎🏻‍♂️‍➡️", "man kneeling facing right: light skin tone" },
+    { u"🦸🏽‍♂", "man superhero: medium skin tone" },
+    { u"🏃🏼‍➡", "person running facing right: medium-light skin tone" },
+    { u"👨‍🦽‍➡️", "man in manual wheelchair facing right" },
+    { u"🤜🏽", "right-facing fist: medium skin tone" },
+    { u"👩🏿‍❤‍👨🏾", "couple with heart: woman, man, dark skin tone, medium-dark skin tone" },
+    { u"⏸", "pause button" },
+    { u"👋🏾", "waving hand: medium-dark skin tone" },
+    { u"🕢", "seven-thirty" },
+    { u"🤸‍♀️", "woman cartwheeling" },
+    { u"🇰🇬", "flag: Kyrgyzstan" },
+    { u"👨🏽‍❤‍👨🏿", "couple with heart: man, man, medium skin tone, dark skin tone" },
+    { u"🧊", "ice" },
+    { u"👪", "family" },
+    { u"👩🏾‍🦯‍➡", "woman with white cane facing right: medium-dark skin tone" },
+    { u"🧑‍✈️", "pilot" },
+    { u"👨🏾‍⚖️", "man judge: medium-dark skin tone" },
+    { u"🙅🏼", "person gesturing NO: medium-light skin tone" },
+    { u"🇱🇷", "flag: Liberia" },
+    { u"🤾🏻", "person playing handball: light skin tone" },
+    { u"🤶🏻", "Mrs. Claus: light skin tone" },
+    { u"🧎🏼‍➡", "person kneeling facing right: medium-light skin tone" },
+    { u"🤵", "person in tuxedo" },
+    { u"👩🏾‍❤‍👩🏽", "couple with heart: woman, woman, medium-dark skin tone, medium skin tone" },
+    { u"🫃🏽", "pregnant man: medium skin tone" },
+    { u"☀️", "sun" },
+    { u"🛺", "auto rickshaw" },
+    { u"🛀🏻", "person taking bath: light skin tone" },
+    { u"🇲🇦", "flag: Morocco" },
+    { u"🧎🏿‍♀", "woman kneeling: dark skin tone" },
+    { u"🇧🇮", "flag: Burundi" },
+    { u"🥛", "glass of milk" },
+    { u"👨🏼‍🍳", "man cook: medium-light skin tone" },
+    { u"🇻🇺", "flag: Vanuatu" },
+    { u"🤹🏻‍♂", "man juggling: light skin tone" },
+    { u"🫄", "pregnant person" },
+    { u"🧍🏻‍♀", "woman standing: light skin tone" },
+    { u"💡", "light bulb" },
+    { u"😭", "loudly crying face" },
+    { u"🧘🏽‍♂", "man in lotus position: medium skin tone" },
+    { u"💪", "flexed biceps" },
+    { u"👨🏽‍🦽", "man in manual wheelchair: medium skin tone" },
+    { u"⛹🏼‍♂️", "man bouncing ball: medium-light skin tone" },
+    { u"🧑🏼‍🏫", "teacher: medium-light skin tone" },
+    { u"🤽🏿‍♀", "woman playing water polo: dark skin tone" },
+    { u"🎚", "level slider" },
+    { u"🧥", "coat" },
+    { u"👨🏿‍🦽‍➡️", "man in manual wheelchair facing right: dark skin tone" },
+    { u"🧎‍♀️‍➡️", "woman kneeling facing right" },
+    { u"🧑🏽‍💻", "technologist: medium skin tone" },
+    { u"🤴🏻", "prince: light skin tone" },
+    { u"👨🏼‍🎨", "man artist: medium-light skin tone" },
+    { u"🧑🏾‍🤝‍🧑🏾", "people holding hands: medium-dark skin tone" },
+    { u"🎰", "slot machine" },
+    { u"♉", "Taurus" },
+    { u"🧑🏽‍🚀", "astronaut: medium skin tone" },
+    { u"🏌🏾‍♀️", "woman golfing: medium-dark skin tone" },
+    { u"🏥", "hospital" },
+    { u"🌁", "foggy" },
+    { u"🦹🏽‍♂️", "man supervillain: medium skin tone" },
+    { u"👳🏿‍♂️", "man wearing turban: dark skin tone" },
+    { u"🧑🏼‍❤‍🧑🏻", "couple with heart: person, person, medium-light skin tone, light skin tone" },
+    { u"💔", "broken heart" },
+    { u"🇪🇷", "flag: Eritrea" },
+    { u"🦸🏾‍♀️", "woman superhero: medium-dark skin tone" },
+    { u"🧑🏽‍🦯‍➡️", "person with white cane facing right: medium skin tone" },
+    { u"⏪", "fast reverse button" },
+    { u"👷🏼‍♀", "woman construction worker: medium-light skin tone" },
+    { u"⛳", "flag in hole" },
+    { u"👩🏾‍🍳", "woman cook: medium-dark skin tone" },
+    { u"🗒️", "spiral notepad" },
+    { u"👱🏽‍♂️", "man: medium skin tone, blond hair" },
+    { u"🧘🏼‍♀", "woman in lotus position: medium-light skin tone" },
+    { u"🇶🇦", "flag: Qatar" },
+    { u"✝️", "latin cross" },
+    { u"🫸🏻", "rightwards pushing hand: light skin tone" },
+    { u"👩🏾‍❤‍👨🏽", "couple with heart: woman, man, medium-dark skin tone, medium skin tone" },
+    { u"🚍", "oncoming bus" },
+    { u"🧑🏼‍❤️‍🧑🏽", "couple with heart: person, person, medium-light skin tone, medium skin tone" },
+    { u"👩🏿", "woman: dark skin tone" },
+    { u"🪜", "ladder" },
+    { u"🇨🇻", "flag: Cape Verde" },
+    { u"👉🏼", "backhand index pointing right: medium-light skin tone" },
+    { u"🚶🏻‍♂‍➡", "man walking facing right: light skin tone" },
+    { u"👰🏼‍♀️", "woman with veil: medium-light skin tone" },
+    { u"🦹🏽‍♀️", "woman supervillain: medium skin tone" },
+    { u"👱🏽‍♂", "man: medium skin tone, blond hair" },
+    { u"💁🏿‍♀️", "woman tipping hand: dark skin tone" },
+    { u"🕵🏻‍♀", "woman detective: light skin tone" },
+    { u"🛎", "bellhop bell" },
+    { u"🈂️", "Japanese “service charge” button" },
+    { u"👨🏻‍❤️‍💋‍👨🏼", "kiss: man, man, light skin tone, medium-light skin tone" },
+    { u"🏃‍♀️‍➡️", "woman running facing right" },
+    { u"🧎🏾‍♂‍➡", "man kneeling facing right: medium-dark skin tone" },
+    { u"🏌🏾", "person golfing: medium-dark skin tone" },
+    { u"🦾", "mechanical arm" },
+    { u"☎️", "telephone" },
+    { u"🗂️", "card index dividers" },
+    { u"🧗🏻‍♂️", "man climbing: light skin tone" },
+    { u"🤸🏻‍♀", "woman cartwheeling: light skin tone" },
+    { u"👩🏾‍🤝‍👨🏽", "woman and man holding hands: medium-dark skin tone, medium skin tone" },
+    { u"🤹🏾", "person juggling: medium-dark skin tone" },
+    { u"🫛", "pea pod" },
+    { u"🚇", "metro" },
+    { u"🙆🏿‍♂️", "man gesturing OK: dark skin tone" },
+    { u"🏋🏻‍♂️", "man lifting weights: light skin tone" },
+    { u"🇦🇲", "flag: Armenia" },
+    { u"📄", "page facing up" },
+    { u"🧎🏼‍♂️‍➡", "man kneeling facing right: medium-light skin tone" },
+    { u"🐋", "whale" },
+    { u"🧑🏻‍🎤", "singer: light skin tone" },
+    { u"🙎🏾‍♂️", "man pouting: medium-dark skin tone" },
+    { u"🤸🏻", "person cartwheeling: light skin tone" },
+    { u"👨🏼‍💻", "man technologist: medium-light skin tone" },
+    { u"❤‍🔥", "heart on fire" },
+    { u"🧟‍♀️", "woman zombie" },
+    { u"👨🏽‍🦽‍➡", "man in manual wheelchair facing right: medium skin tone" },
+    { u"🤽🏽‍♂", "man playing water polo: medium skin tone" },
+    { u"🏃‍♀‍➡", "woman running facing right" },
+    { u"🚶‍♀", "woman walking" },
+    { u"📯", "postal horn" },
+    { u"👩🏼‍❤️‍💋‍👨🏾", "kiss: woman, man, medium-light skin tone, medium-dark skin tone" },
+    { u"🇦🇪", "flag: United Arab Emirates" },
+    { u"🚴🏿‍♀️", "woman biking: dark skin tone" },
+    { u"🚸", "children crossing" },
+    { u"🇳🇴", "flag: Norway" },
+    { u"👨🏼‍✈", "man pilot: medium-light skin tone" },
+    { u"🏌🏽", "person golfing: medium skin tone" },
+    { u"🏃🏿‍➡️", "person running facing right: dark skin tone" },
+    { u"🤌🏾", "pinched fingers: medium-dark skin tone" },
+    { u"⛷", "skier" },
+    { u"🕦", "eleven-thirty" },
+    { u"🦶🏾", "foot: medium-dark skin tone" },
+    { u"🫶🏿", "heart hands: dark skin tone" },
+    { u"👩🏼‍🦯‍➡️", "woman with white cane facing right: medium-light skin tone" },
+    { u"👱🏻‍♂️", "man: light skin tone, blond hair" },
+    { u"🦵🏾", "leg: medium-dark skin tone" },
+    { u"🧑🏽‍❤️‍💋‍🧑🏼", "kiss: person, person, medium skin tone, medium-light skin tone" },
+    { u"🧑🏾‍❤️‍🧑🏻", "couple with heart: person, person, medium-dark skin tone, light skin tone" },
+    { u"👨🏽", "man: medium skin tone" },
+    { u"👨🏽‍💻", "man technologist: medium skin tone" },
+    { u"🌩", "cloud with lightning" },
+    { u"🐹", "hamster" },
+    { u"🧎🏻‍♂‍➡", "man kneeling facing right: light skin tone" },
+    { u"🤡", "clown face" },
+    { u"🧑‍🤝‍🧑", "people holding hands" },
+    { u"🇲🇽", "flag: Mexico" },
+    { u"🔓", "unlocked" },
+    { u"🟩", "green square" },
+    { u"🦽", "manual wheelchair" },
+    { u"👨🏽‍🦰", "man: medium skin tone, red hair" },
+    { u"🧑🏿‍❤‍🧑🏽", "couple with heart: person, person, dark skin tone, medium skin tone" },
+    { u"🤹", "person juggling" },
+    { u"😶", "face without mouth" },
+    { u"🤘🏽", "sign of the horns: medium skin tone" },
+    { u"🧑🏿‍🦼‍➡️", "person in motorized wheelchair facing right: dark skin tone" },
+    { u"👨🏿‍❤‍👨🏻", "couple with heart: man, man, dark skin tone, light skin tone" },
+    { u"🇮🇴", "flag: British Indian Ocean Territory" },
+    { u"🏄🏻", "person surfing: light skin tone" },
+    { u"🫱🏿‍🫲🏻", "handshake: dark skin tone, light skin tone" },
+    { u"🪰", "fly" },
+    { u"💇🏽", "person getting haircut: medium skin tone" },
+    { u"🎾", "tennis" },
+    { u"🐗", "boar" },
+    { u"👩🏿‍❤️‍💋‍👩🏼", "kiss: woman, woman, dark skin tone, medium-light skin tone" },
+    { u"🚅", "bullet train" },
+    { u"👮‍♀", "woman police officer" },
+    { u"🤝🏾", "handshake: medium-dark skin tone" },
+    { u"💿", "optical disk" },
+    { u"🏗", "building construction" },
+    { u"👩🏿‍❤‍👨🏻", "couple with heart: woman, man, dark skin tone, light skin tone" },
+    { u"👩‍⚕", "woman health worker" },
+    { u"🧎‍➡", "person kneeling facing right" },
+    { u"🤭", "face with hand over mouth" },
+    { u"🧎🏾‍♀‍➡️", "woman kneeling facing right: medium-dark skin tone" },
+    { u"👨🏻‍🦳", "man: light skin tone, white hair" },
+    { u"🇬🇸", "flag: South Georgia & South Sandwich Islands" },
+    { u"🧜🏻‍♀", "mermaid: light skin tone" },
+    { u"🔮", "crystal ball" },
+    { u"👩🏿‍❤‍👩🏽", "couple with heart: woman, woman, dark skin tone, medium skin tone" },
+    { u"↔️", "left-right arrow" },
+    { u"😐", "neutral face" },
+    { u"👱🏼‍♂", "man: medium-light skin tone, blond hair" },
+    { u"👩🏿‍❤‍💋‍👨🏼", "kiss: woman, man, dark skin tone, medium-light skin tone" },
+    { u"🍲", "pot of food" },
+    { u"🫵🏻", "index pointing at the viewer: light skin tone" },
+    { u"👩🏼‍✈️", "woman pilot: medium-light skin tone" },
+    { u"🤹🏼‍♂", "man juggling: medium-light skin tone" },
+    { u"🚵🏽‍♀️", "woman mountain biking: medium skin tone" },
+    { u"🙋🏻‍♀", "woman raising hand: light skin tone" },
+    { u"💇🏻‍♀", "woman getting haircut: light skin tone" },
+    { u"🥁", "drum" },
+    { u"🤮", "face vomiting" },
+    { u"🪖", "military helmet" },
+    { u"🧑🏼‍⚕️", "health worker: medium-light skin tone" },
+    { u"🙋🏽‍♀", "woman raising hand: medium skin tone" },
+    { u"🫃🏿", "pregnant man: dark skin tone" },
+    { u"🍮", "custard" },
+    { u"🚑", "ambulance" },
+    { u"🧑🏼‍🌾", "farmer: medium-light skin tone" },
+    { u"👩🏻‍❤️‍💋‍👨🏿", "kiss: woman, man, light skin tone, dark skin tone" },
+    { u"🗓", "spiral calendar" },
+    { u"🇸🇦", "flag: Saudi Arabia" },
+    { u"🥟", "dumpling" },
+    { u"🧝🏾‍♂", "man elf: medium-dark skin tone" },
+    { u"🧑🏻‍🦼‍➡️", "person in motorized wheelchair facing right: light skin tone" },
+    { u"👨🏿‍🍳", "man cook: dark skin tone" },
+    { u"🧤", "gloves" },
+    { u"👨🏾‍🔧", "man mechanic: medium-dark skin tone" },
+    { u"🇸🇱", "flag: Sierra Leone" },
+    { u"🏝", "desert island" },
+    { u"🚶🏽‍♀️‍➡️", "woman walking facing right: medium skin tone" },
+    { u"⬅️", "left arrow" },
+    { u"👮‍♀️", "woman police officer" },
+    { u"🏌🏿‍♀️", "woman golfing: dark skin tone" },
+    { u"👨‍🏭", "man factory worker" },
+    { u"🟪", "purple square" },
+    { u"📎", "paperclip" },
+    { u"🧑🏼‍🤝‍🧑🏻", "people holding hands: medium-light skin tone, light skin tone" },
+    { u"🦔", "hedgehog" },
+    { u"🧑🏻‍❤‍🧑🏼", "couple with heart: person, person, light skin tone, medium-light skin tone" },
+    { u"💆🏾‍♀️", "woman getting massage: medium-dark skin tone" },
+    { u"👩🏻‍❤‍💋‍👨🏼", "kiss: woman, man, light skin tone, medium-light skin tone" },
+    { u"👩🏽‍🌾", "woman farmer: medium skin tone" },
+    { u"🗯️", "right anger bubble" },
+    { u"🐡", "blowfish" },
+    { u"🙇🏾", "person bowing: medium-dark skin tone" },
+    { u"🧎🏾‍♂️‍➡️", "man kneeling facing right: medium-dark skin tone" },
+    { u"🦸‍♂", "man superhero" },
+    { u"🧎🏽‍♂️‍➡", "man kneeling facing right: medium skin tone" },
+    { u"🧍🏽‍♂", "man standing: medium skin tone" },
+    { u"📸", "camera with flash" },
+    { u"👩🏼‍🦰", "woman: medium-light skin tone, red hair" },
+    { u"🇯🇵", "flag: Japan" },
+    { u"🍶", "sake" },
+    { u"🧝🏼‍♂️", "man elf: medium-light skin tone" },
+    { u"👩🏽‍💼", "woman office worker: medium skin tone" },
+    { u"🙏", "folded hands" },
+    { u"📡", "satellite antenna" },
+    { u"👱🏼", "person: medium-light skin tone, blond hair" },
+    { u"🫶", "heart hands" },
+    { u"🗜", "clamp" },
+    { u"👯", "people with bunny ears" },
+    { u"👨🏼‍🏭", "man factory worker: medium-light skin tone" },
+    { u"🏄🏽‍♀", "woman surfing: medium skin tone" },
+    { u"🪹", "empty nest" },
+    { u"🤛🏽", "left-facing fist: medium skin tone" },
+    { u"💆🏾‍♂", "man getting massage: medium-dark skin tone" },
+    { u"🧑🏿‍❤‍💋‍🧑🏼", "kiss: person, person, dark skin tone, medium-light skin tone" },
+    { u"🚣🏼‍♀", "woman rowing boat: medium-light skin tone" },
+    { u"🧔🏻‍♀", "woman: light skin tone, beard" },
+    { u"🛝", "playground slide" },
+    { u"🏄🏾‍♂️", "man surfing: medium-dark skin tone" },
+    { u"🙎🏽", "person pouting: medium skin tone" },
+    { u"🙂‍↕", "head shaking vertically" },
+    { u"🍋", "lemon" },
+    { u"🇹🇦", "flag: Tristan da Cunha" },
+    { u"🇹🇨", "flag: Turks & Caicos Islands" },
+    { u"🤦🏻‍♀️", "woman facepalming: light skin tone" },
+    { u"🏌", "person golfing" },
+    { u"🌵", "cactus" },
+    { u"🧜‍♀️", "mermaid" },
+    { u"🙅🏾‍♂", "man gesturing NO: medium-dark skin tone" },
+    { u"🛀🏾", "person taking bath: medium-dark skin tone" },
+    { u"👨🏽‍🦯", "man with white cane: medium skin tone" },
+    { u"💎", "gem stone" },
+    { u"🦴", "bone" },
+    { u"👩🏽‍🔧", "woman mechanic: medium skin tone" },
+    { u"🇨🇳", "flag: China" },
+    { u"👨🏼‍❤️‍👨🏻", "couple with heart: man, man, medium-light skin tone, light skin tone" },
+    { u"👩🏽‍❤️‍👩🏼", "couple with heart: woman, woman, medium skin tone, medium-light skin tone" },
+    { u"🏊🏿‍♀", "woman swimming: dark skin tone" },
+    { u"🚶‍♂‍➡️", "man walking facing right" },
+    { u"➡", "right arrow" },
+    { u"🧑🏾‍🌾", "farmer: medium-dark skin tone" },
+    { u"🚶🏽‍♂‍➡️", "man walking facing right: medium skin tone" },
+    { u"🧑🏿‍🦼‍➡", "person in motorized wheelchair facing right: dark skin tone" },
+    { u"👮🏾", "police officer: medium-dark skin tone" },
+    { u"👂🏻", "ear: light skin tone" },
+    { u"🥪", "sandwich" },
+    { u"🧔🏽", "person: medium skin tone, beard" },
+    { u"〽️", "part alternation mark" },
+    { u"🎣", "fishing pole" },
+    { u"♠️", "spade suit" },
+    { u"🏂", "snowboarder" },
+    { u"🇼🇸", "flag: Samoa" },
+    { u"🧑🏼‍🏭", "factory worker: medium-light skin tone" },
+    { u"🎅🏼", "Santa Claus: medium-light skin tone" },
+    { u"🇿🇦", "flag: South Africa" },
+    { u"👩🏻‍❤‍💋‍👨🏽", "kiss: woman, man, light skin tone, medium skin tone" },
+    { u"🦟", "mosquito" },
+    { u"👨🏿‍❤️‍💋‍👨🏻", "kiss: man, man, dark skin tone, light skin tone" },
+    { u"🍡", "dango" },
+    { u"🦻🏿", "ear with hearing aid: dark skin tone" },
+    { u"✊🏻", "raised fist: light skin tone" },
+    { u"🤵🏻‍♂️", "man in tuxedo: light skin tone" },
+    { u"👋🏼", "waving hand: medium-light skin tone" },
+    { u"🤟", "love-you gesture" },
+    { u"🦹🏿", "supervillain: dark skin tone" },
+    { u"👲🏻", "person with skullcap: light skin tone" },
+    { u"👐", "open hands" },
+    { u"🇹🇱", "flag: Timor-Leste" },
+    { u"🙇🏿‍♂", "man bowing: dark skin tone" },
+    { u"🔍", "magnifying glass tilted left" },
+    { u"🎅", "Santa Claus" },
+    { u"🕗", "eight o’clock" },
+    { u"🤔", "thinking face" },
+    { u"🏃🏽‍♀️‍➡", "woman running facing right: medium skin tone" },
+    { u"🥼", "lab coat" },
+    { u"👌🏽", "OK hand: medium skin tone" },
+    { u"💪🏾", "flexed biceps: medium-dark skin tone" },
+    { u"☝🏽", "index pointing up: medium skin tone" },
+    { u"🏵", "rosette" },
+    { u"🪂", "parachute" },
+    { u"🇦🇺", "flag: Australia" },
+    { u"🧙🏿‍♂", "man mage: dark skin tone" },
+    { u"💃🏻", "woman dancing: light skin tone" },
+    { u"🤶🏼", "Mrs. Claus: medium-light skin tone" },
+    { u"🛩", "small airplane" },
+    { u"🤼‍♂", "men wrestling" },
+    { u"🤽‍♀️", "woman playing water polo" },
+    { u"💁🏾‍♀", "woman tipping hand: medium-dark skin tone" },
+    { u"🇮🇹", "flag: Italy" },
+    { u"✍🏻", "writing hand: light skin tone" },
+    { u"🍽️", "fork and knife with plate" },
+    { u"👨🏻‍🏭", "man factory worker: light skin tone" },
+    { u"🍒", "cherries" },
+    { u"🗿", "moai" },
+    { u"🙍🏿‍♂️", "man frowning: dark skin tone" },
+    { u"🧖🏿‍♂", "man in steamy room: dark skin tone" },
+    { u"👨🏾‍🚒", "man firefighter: medium-dark skin tone" },
+    { u"🧑🏾‍❤️‍💋‍🧑🏽", "kiss: person, person, medium-dark skin tone, medium skin tone" },
+    { u"👸🏽", "princess: medium skin tone" },
+    { u"🙎🏾", "person pouting: medium-dark skin tone" },
+    { u"👨🏿‍❤‍👨🏿", "couple with heart: man, man, dark skin tone" },
+    { u"🦸🏾‍♀", "woman superhero: medium-dark skin tone" },
+    { u"☃️", "snowman" },
+    { u"💇🏾‍♀️", "woman getting haircut: medium-dark skin tone" },
+    { u"👩🏼‍❤‍💋‍👩🏾", "kiss: woman, woman, medium-light skin tone, medium-dark skin tone" },
+    { u"🤽🏾‍♂️", "man playing water polo: medium-dark skin tone" },
+    { u"🧑🏿‍❤️‍🧑🏾", "couple with heart: person, person, dark skin tone, medium-dark skin tone" },
+    { u"🌶", "hot pepper" },
+    { u"🏋‍♂️", "man lifting weights" },
+    { u"🤙🏻", "call me hand: light skin tone" },
+    { u"🧛🏽‍♀", "woman vampire: medium skin tone" },
+    { u"💂🏼‍♀", "woman guard: medium-light skin tone" },
+    { u"🙅🏽‍♀", "woman gesturing NO: medium skin tone" },
+    { u"🤞🏽", "crossed fingers: medium skin tone" },
+    { u"🧑🏽‍🤝‍🧑🏿", "people holding hands: medium skin tone, dark skin tone" },
+    { u"🏃🏼‍♀️‍➡️", "woman running facing right: medium-light skin tone" },
+    { u"♍", "Virgo" },
+    { u"🚵‍♀", "woman mountain biking" },
+    { u"👩🏼‍🦯", "woman with white cane: medium-light skin tone" },
+    { u"🥴", "woozy face" },
+    { u"⌨️", "keyboard" },
+    { u"♨", "hot springs" },
+    { u"🥄", "spoon" },
+    { u"🤫", "shushing face" },
+    { u"🧔🏾‍♂️", "man: medium-dark skin tone, beard" },
+    { u"🏄🏼‍♀", "woman surfing: medium-light skin tone" },
+    { u"🏃🏿‍♂‍➡️", "man running facing right: dark skin tone" },
+    { u"🥐", "croissant" },
+    { u"⏸️", "pause button" },
+    { u"👩🏿‍❤️‍👩🏾", "couple with heart: woman, woman, dark skin tone, medium-dark skin tone" },
+    { u"🧛🏻‍♂", "man vampire: light skin tone" },
+    { u"🫎", "moose" },
+    { u"🌜", "last quarter moon face" },
+    { u"🚎", "trolleybus" },
+    { u"🇱🇺", "flag: Luxembourg" },
+    { u"🧑🏽‍🍳", "cook: medium skin tone" },
+    { u"🧑🏼‍❤‍🧑🏾", "couple with heart: person, person, medium-light skin tone, medium-dark skin tone" },
+    { u"🏮", "red paper lantern" },
+    { u"🚶🏿‍♀", "woman walking: dark skin tone" },
+    { u"🏋🏻‍♀️", "woman lifting weights: light skin tone" },
+    { u"👩🏾‍🔧", "woman mechanic: medium-dark skin tone" },
+    { u"🌘", "waning crescent moon" },
+    { u"👨🏿‍🤝‍👨🏻", "men holding hands: dark skin tone, light skin tone" },
+    { u"🕵🏻‍♂️", "man detective: light skin tone" },
+    { u"🧖🏼‍♂", "man in steamy room: medium-light skin tone" },
+    { u"🐠", "tropical fish" },
+    { u"🏌‍♀️", "woman golfing" },
+    { u"👩🏿‍🤝‍👩🏽", "women holding hands: dark skin tone, medium skin tone" },
+    { u"🧑🏾‍❤‍🧑🏼", "couple with heart: person, person, medium-dark skin tone, medium-light skin tone" },
+    { u"🍸", "cocktail glass" },
+    { u"🇹🇫", "flag: French Southern Territories" },
+    { u"🇸🇷", "flag: Suriname" },
+    { u"👨🏻‍❤‍👨🏾", "couple with heart: man, man, light skin tone, medium-dark skin tone" },
+    { u"👨🏿‍❤️‍💋‍👨🏿", "kiss: man, man, dark skin tone" },
+    { u"😰", "anxious face with sweat" },
+    { u"👩🏻‍✈", "woman pilot: light skin tone" },
+    { u"🚣🏼‍♂️", "man rowing boat: medium-light skin tone" },
+    { u"👨🏼‍🚀", "man astronaut: medium-light skin tone" },
+    { u"🪦", "headstone" },
+    { u"👩🏽‍🤝‍👩🏿", "women holding hands: medium skin tone, dark skin tone" },
+    { u"👩🏻‍🦯‍➡", "woman with white cane facing right: light skin tone" },
+    { u"⛹🏼‍♀", "woman bouncing ball: medium-light skin tone" },
+    { u"👩‍👧", "family: woman, girl" },
+    { u"🥏", "flying disc" },
+    { u"🧑🏾‍🦰", "person: medium-dark skin tone, red hair" },
+    { u"🚣🏿‍♀️", "woman rowing boat: dark skin tone" },
+    { u"👨🏾‍❤‍👨🏾", "couple with heart: man, man, medium-dark skin tone" },
+    { u"♻", "recycling symbol" },
+    { u"⛹🏿‍♀️", "woman bouncing ball: dark skin tone" },
+    { u"👷🏾‍♀️", "woman construction worker: medium-dark skin tone" },
+    { u"🧑🏻‍🦰", "person: light skin tone, red hair" },
+    { u"🦶🏿", "foot: dark skin tone" },
+    { u"🧑🏾‍❤️‍💋‍🧑🏿", "kiss: person, person, medium-dark skin tone, dark skin tone" },
+    { u"🚶🏾‍♀️", "woman walking: medium-dark skin tone" },
+    { u"🚶🏾‍♂️‍➡️", "man walking facing right: medium-dark skin tone" },
+    { u"🏨", "hotel" },
+    { u"🚣🏾‍♂️", "man rowing boat: medium-dark skin tone" },
+    { u"🦸🏼‍♂", "man superhero: medium-light skin tone" },
+    { u"🧑🏾‍❤‍💋‍🧑🏼", "kiss: person, person, medium-dark skin tone, medium-light skin tone" },
+    { u"👇🏼", "backhand index pointing down: medium-light skin tone" },
+    { u"👩🏾‍🎓", "woman student: medium-dark skin tone" },
+    { u"👩🏾‍❤‍💋‍👨🏾", "kiss: woman, man, medium-dark skin tone" },
+    { u"📵", "no mobile phones" },
+    { u"👨🏼‍⚖️", "man judge: medium-light skin tone" },
+    { u"🏰", "castle" },
+    { u"👆", "backhand index pointing up" },
+    { u"👩🏾‍🦱", "woman: medium-dark skin tone, curly hair" },
+    { u"🇯🇲", "flag: Jamaica" },
+    { u"🤾‍♂", "man playing handball" },
+    { u"🧑🏼‍🦽", "person in manual wheelchair: medium-light skin tone" },
+    { u"㊙️", "Japanese “secret” button" },
+    { u"🏌🏾‍♂️", "man golfing: medium-dark skin tone" },
+    { u"🦹🏽‍♂", "man supervillain: medium skin tone" },
+    { u"🦹‍♀️", "woman supervillain" },
+    { u"🏄🏼‍♂", "man surfing: medium-light skin tone" },
+    { u"👩🏼‍❤️‍👩🏾", "couple with heart: woman, woman, medium-light skin tone, medium-dark skin tone" },
+    { u"🌸", "cherry blossom" },
+    { u"🧍🏻‍♀️", "woman standing: light skin tone" },
+    { u"👳🏼‍♂", "man wearing turban: medium-light skin tone" },
+    { u"🙋🏿‍♀", "woman raising hand: dark skin tone" },
+    { u"👩🏻‍❤‍👨🏽", "couple with heart: woman, man, light skin tone, medium skin tone" },
+    { u"🕸️", "spider web" },
+    { u"🧙🏽‍♀️", "woman mage: medium skin tone" },
+    { u"🫀", "anatomical heart" },
+    { u"⛹🏽‍♀", "woman bouncing ball: medium skin tone" },
+    { u"😜", "winking face with tongue" },
+    { u"🧑🏼‍🦼", "person in motorized wheelchair: medium-light skin tone" },
+    { u"👳🏽‍♂", "man wearing turban: medium skin tone" },
+    { u"👩🏽‍❤️‍👩🏻", "couple with heart: woman, woman, medium skin tone, light skin tone" },
+    { u"🧦", "socks" },
+    { u"🐝", "honeybee" },
+    { u"🗂", "card index dividers" },
+    { u"🤢", "nauseated face" },
+    { u"👨🏼‍❤️‍👨🏾", "couple with heart: man, man, medium-light skin tone, medium-dark skin tone" },
+    { u"😮‍💨", "face exhaling" },
+    { u"👨🏿‍❤️‍💋‍👨🏾", "kiss: man, man, dark skin tone, medium-dark skin tone" },
+    { u"💆‍♂", "man getting massage" },
+    { u"🧝🏻‍♂", "man elf: light skin tone" },
+    { u"♾️", "infinity" },
+    { u"👆🏻", "backhand index pointing up: light skin tone" },
+    { u"🍣", "sushi" },
+    { u"🍉", "watermelon" },
+    { u"🤽🏼‍♀️", "woman playing water polo: medium-light skin tone" },
+    { u"🤷🏼‍♀", "woman shrugging: medium-light skin tone" },
+    { u"🏋🏼‍♀️", "woman lifting weights: medium-light skin tone" },
+    { u"👨🏻‍🚀", "man astronaut: light skin tone" },
+    { u"👨‍🚒", "man firefighter" },
+    { u"👩🏿‍❤️‍💋‍👨🏿", "kiss: woman, man, dark skin tone" },
+    { u"🍵", "teacup without handle" },
+    { u"👨🏼‍❤️‍💋‍👨🏽", "kiss: man, man, medium-light skin tone, medium skin tone" },
+    { u"👲🏼", "person with skullcap: medium-light skin tone" },
+    { u"🏬", "department store" },
+    { u"🈺", "Japanese “open for business” button" },
+    { u"🈯", "Japanese “reserved” button" },
+    { u"🤦🏾‍♀", "woman facepalming: medium-dark skin tone" },
+    { u"☮", "peace symbol" },
+    { u"👩🏻‍🦽‍➡️", "woman in manual wheelchair facing right: light skin tone" },
+    { u"🧑🏻", "person: light skin tone" },
+    { u"☂", "umbrella" },
+    { u"🫱🏿", "rightwards hand: dark skin tone" },
+    { u"🫴🏽", "palm up hand: medium skin tone" },
+    { u"🪡", "sewing needle" },
+    { u"👩🏻‍🤝‍👩🏿", "women holding hands: light skin tone, dark skin tone" },
+    { u"👲", "person with skullcap" },
+    { u"🏄🏻‍♂", "man surfing: light skin tone" },
+    { u"🏊🏻‍♀️", "woman swimming: light skin tone" },
+    { u"🇧🇹", "flag: Bhutan" },
+    { u"💶", "euro banknote" },
+    { u"🖋", "fountain pen" },
+    { u"🧏🏽", "deaf person: medium skin tone" },
+    { u"🚣🏽‍♂️", "man rowing boat: medium skin tone" },
+    { u"👨🏾‍🦱", "man: medium-dark skin tone, curly hair" },
+    { u"🧑🏼‍❤️‍💋‍🧑🏽", "kiss: person, person, medium-light skin tone, medium skin tone" },
+    { u"🙆‍♀", "woman gesturing OK" },
+    { u"🏃🏾‍♂", "man running: medium-dark skin tone" },
+    { u"🦸🏽‍♀️", "woman superhero: medium skin tone" },
+    { u"🧛🏽‍♂️", "man vampire: medium skin tone" },
+    { u"📔", "notebook with decorative cover" },
+    { u"👊🏽", "oncoming fist: medium skin tone" },
+    { u"🛒", "shopping cart" },
+    { u"🧎🏾‍♀", "woman kneeling: medium-dark skin tone" },
+    { u"🚣🏾‍♀️", "woman rowing boat: medium-dark skin tone" },
+    { u"🧖🏿", "person in steamy room: dark skin tone" },
+    { u"🕵🏼‍♀️", "woman detective: medium-light skin tone" },
+    { u"🍌", "banana" },
+    { u"🧑🏽‍❤‍🧑🏾", "couple with heart: person, person, medium skin tone, medium-dark skin tone" },
+    { u"🫳🏿", "palm down hand: dark skin tone" },
+    { u"💇🏼‍♂", "man getting haircut: medium-light skin tone" },
+    { u"🚶🏻‍♂", "man walking: light skin tone" },
+    { u"🏃‍➡", "person running facing right" },
+    { u"🧑🏽‍✈", "pilot: medium skin tone" },
+    { u"👨‍✈", "man pilot" },
+    { u"🏊🏾‍♀️", "woman swimming: medium-dark skin tone" },
+    { u"🏃‍♀‍➡️", "woman running facing right" },
+    { u"🧑🏻‍❤‍🧑🏽", "couple with heart: person, person, light skin tone, medium skin tone" },
+    { u"💁🏽", "person tipping hand: medium skin tone" },
+    { u"🤙🏽", "call me hand: medium skin tone" },
+    { u"🐨", "koala" },
+    { u"🌰", "chestnut" },
+    { u"👷🏾", "construction worker: medium-dark skin tone" },
+    { u"🧙🏾‍♂", "man mage: medium-dark skin tone" },
+    { u"🧎🏻‍➡️", "person kneeling facing right: light skin tone" },
+    { u"☣️", "biohazard" },
+    { u"🚴🏼‍♀️", "woman biking: medium-light skin tone" },
+    { u"♎", "Libra" },
+    { u"⛓️‍💥", "broken chain" },
+    { u"🧎🏼‍♀️‍➡️", "woman kneeling facing right: medium-light skin tone" },
+    { u"🧝🏽‍♂️", "man elf: medium skin tone" },
+    { u"🖲️", "trackball" },
+    { u"🧝🏽‍♀️", "woman elf: medium skin tone" },
+    { u"🔥", "fire" },
+    { u"🙌🏼", "raising hands: medium-light skin tone" },
+    { u"👮🏻‍♀", "woman police officer: light skin tone" },
+    { u"🧘🏽‍♂️", "man in lotus position: medium skin tone" },
+    { u"📑", "bookmark tabs" },
+    { u"🧙🏽‍♂️", "man mage: medium skin tone" },
+    { u"🫕", "fondue" },
+    { u"👮🏾‍♂", "man police officer: medium-dark skin tone" },
+    { u"✌️", "victory hand" },
+    { u"🕵️‍♂", "man detective" },
+    { u"🤳🏼", "selfie: medium-light skin tone" },
+    { u"🧎🏿‍♀‍➡️", "woman kneeling facing right: dark skin tone" },
+    { u"🛣", "motorway" },
+    { u"🧎🏿‍➡", "person kneeling facing right: dark skin tone" },
+    { u"👩🏻‍❤️‍👩🏼", "couple with heart: woman, woman, light skin tone, medium-light skin tone" },
+    { u"👩🏼‍🦯‍➡", "woman with white cane facing right: medium-light skin tone" },
+    { u"🏃🏼‍♀‍➡", "woman running facing right: medium-light skin tone" },
+    { u"👈🏻", "backhand index pointing left: light skin tone" },
+    { u"👩🏻‍🦼", "woman in motorized wheelchair: light skin tone" },
+    { u"❌", "cross mark" },
+    { u"👹", "ogre" },
+    { u"🍨", "ice cream" },
+    { u"🚴🏽‍♀", "woman biking: medium skin tone" },
+    { u"🏃‍♂", "man running" },
+    { u"👨🏿‍❤‍👨🏾", "couple with heart: man, man, dark skin tone, medium-dark skin tone" },
+    { u"💑🏻", "couple with heart: light skin tone" },
+    { u"🚶‍♂️‍➡️", "man walking facing right" },
+    { u"👩🏽‍🤝‍👨🏻", "woman and man holding hands: medium skin tone, light skin tone" },
+    { u"🙍🏼", "person frowning: medium-light skin tone" },
+    { u"🚴🏻", "person biking: light skin tone" },
+    { u"💓", "beating heart" },
+    { u"🛀", "person taking bath" },
+    { u"🧑🏼‍🚒", "firefighter: medium-light skin tone" },
+    { u"🤵🏼‍♂️", "man in tuxedo: medium-light skin tone" },
+    { u"🏃🏼‍♂️", "man running: medium-light skin tone" },
+    { u"👨🏽‍🚀", "man astronaut: medium skin tone" },
+    { u"👷🏾‍♀", "woman construction worker: medium-dark skin tone" },
+    { u"👢", "woman’s boot" },
+    { u"💇🏽‍♂", "man getting haircut: medium skin tone" },
+    { u"♟️", "chess pawn" },
+    { u"🈶", "Japanese “not free of charge” button" },
+    { u"👩🏿‍❤️‍💋‍👩🏿", "kiss: woman, woman, dark skin tone" },
+    { u"🙅🏿‍♂️", "man gesturing NO: dark skin tone" },
+    { u"🔃", "clockwise vertical arrows" },
+    { u"🙍🏿‍♂", "man frowning: dark skin tone" },
+    { u"🧑🏼‍❤️‍💋‍🧑🏾", "kiss: person, person, medium-light skin tone, medium-dark skin tone" },
+    { u"🏤", "post office" },
+    { u"💊", "pill" },
+    { u"👨🏾‍🤝‍👨🏽", "men holding hands: medium-dark skin tone, medium skin tone" },
+    { u"㊙", "Japanese “secret” button" },
+    { u"🪨", "rock" },
+    { u"☘", "shamrock" },
+    { u"💵", "dollar banknote" },
+    { u"👨‍🦽", "man in manual wheelchair" },
+    { u"👩🏼‍❤‍👨🏽", "couple with heart: woman, man, medium-light skin tone, medium skin tone" },
+    { u"🌷", "tulip" },
+    { u"👩🏻‍🤝‍👨🏿", "woman and man holding hands: light skin tone, dark skin tone" },
+    { u"🕵🏿‍♀️", "woman detective: dark skin tone" },
+    { u"🧗‍♂", "man climbing" },
+    { u"😫", "tired face" },
+    { u"💂🏽‍♂️", "man guard: medium skin tone" },
+    { u"8️⃣", "keycap: 8" },
+    { u"🙆🏻‍♂", "man gesturing OK: light skin tone" },
+    { u"🏳‍🌈", "rainbow flag" },
+    { u"👨‍🎨", "man artist" },
+    { u"🙎🏻", "person pouting: light skin tone" },
+    { u"🐈", "cat" },
+    { u"🧍🏻‍♂", "man standing: light skin tone" },
+    { u"👨🏿‍❤️‍👨🏿", "couple with heart: man, man, dark skin tone" },
+    { u"👩🏻‍❤‍💋‍👨🏾", "kiss: woman, man, light skin tone, medium-dark skin tone" },
+    { u"🤷‍♀", "woman shrugging" },
+    { u"👩🏼‍❤️‍👩🏽", "couple with heart: woman, woman, medium-light skin tone, medium skin tone" },
+    { u"👩🏽‍🎤", "woman singer: medium skin tone" },
+    { u"🕴🏽", "person in suit levitating: medium skin tone" },
+    { u"👨🏻‍❤️‍💋‍👨🏻", "kiss: man, man, light skin tone" },
+    { u"🕠", "five-thirty" },
+    { u"🚶🏾‍♂‍➡", "man walking facing right: medium-dark skin tone" },
+    { u"🪘", "long drum" },
+    { u"🕘", "nine o’clock" },
+    { u"🕴🏻", "person in suit levitating: light skin tone" },
+    { u"🏌‍♀", "woman golfing" },
+    { u"👨🏾‍❤‍💋‍👨🏽", "kiss: man, man, medium-dark skin tone, medium skin tone" },
+    { u"👩🏾‍🤝‍👨🏿", "woman and man holding hands: medium-dark skin tone, dark skin tone" },
+    { u"🕸", "spider web" },
+    { u"☦️", "orthodox cross" },
+    { u"🏋🏻‍♂", "man lifting weights: light skin tone" },
+    { u"🕵️‍♂️", "man detective" },
+    { u"🧑🏿‍❤‍🧑🏾", "couple with heart: person, person, dark skin tone, medium-dark skin tone" },
+    { u"🤵🏿‍♀", "woman in tuxedo: dark skin tone" },
+    { u"🚼", "baby symbol" },
+    { u"🧑🏼‍🦱", "person: medium-light skin tone, curly hair" },
+    { u"👩🏻‍❤️‍💋‍👨🏾", "kiss: woman, man, light skin tone, medium-dark skin tone" },
+    { u"🙌", "raising hands" },
+    { u"🖖", "vulcan salute" },
+    { u"🏂🏽", "snowboarder: medium skin tone" },
+    { u"🕵🏻‍♂", "man detective: light skin tone" },
+    { u"🧑‍🚀", "astronaut" },
+    { u"🧜🏿‍♀️", "mermaid: dark skin tone" },
+    { u"🍷", "wine glass" },
+    { u"👩🏻‍❤‍💋‍👨🏻", "kiss: woman, man, light skin tone" },
+    { u"🛥", "motor boat" },
+    { u"🧔🏽‍♀️", "woman: medium skin tone, beard" },
+    { u"🪚", "carpentry saw" },
+    { u"🙍🏿", "person frowning: dark skin tone" },
+    { u"🧘‍♂", "man in lotus position" },
+    { u"🧑🏿‍🎤", "singer: dark skin tone" },
+    { u"👩🏾‍⚖️", "woman judge: medium-dark skin tone" },
+    { u"🙎🏼‍♀", "woman pouting: medium-light skin tone" },
+    { u"💆🏿‍♀", "woman getting massage: dark skin tone" },
+    { u"👩🏿‍🦼‍➡", "woman in motorized wheelchair facing right: dark skin tone" },
+    { u"💒", "wedding" },
+    { u"👩🏿‍🏫", "woman teacher: dark skin tone" },
+    { u"🧘🏾‍♀", "woman in lotus position: medium-dark skin tone" },
+    { u"💯", "hundred points" },
+    { u"👩🏽‍❤️‍💋‍👨🏻", "kiss: woman, man, medium skin tone, light skin tone" },
+    { u"👨🏾‍🦽‍➡", "man in manual wheelchair facing right: medium-dark skin tone" },
+    { u"🪬", "hamsa" },
+    { u"🏋️‍♀️", "woman lifting weights" },
+    { u"🏌🏼", "person golfing: medium-light skin tone" },
+    { u"👩🏻‍❤‍💋‍👩🏾", "kiss: woman, woman, light skin tone, medium-dark skin tone" },
+    { u"🤽🏾‍♀", "woman playing water polo: medium-dark skin tone" },
+    { u"🤵🏻‍♂", "man in tuxedo: light skin tone" },
+    { u"😞", "disappointed face" },
+    { u"🤹🏽‍♂", "man juggling: medium skin tone" },
+    { u"🪸", "coral" },
+    { u"👩‍✈", "woman pilot" },
+    { u"🫱🏼‍🫲🏿", "handshake: medium-light skin tone, dark skin tone" },
+    { u"🤾🏾", "person playing handball: medium-dark skin tone" },
+    { u"🎂", "birthday cake" },
+    { u"🇮🇳", "flag: India" },
+    { u"🚴🏼‍♂", "man biking: medium-light skin tone" },
+    { u"🧜🏼‍♀️", "mermaid: medium-light skin tone" },
+    { u"🧛🏽‍♀️", "woman vampire: medium skin tone" },
+    { u"✡️", "star of David" },
+    { u"🧎🏼", "person kneeling: medium-light skin tone" },
+    { u"😧", "anguished face" },
+    { u"🌏", "globe showing Asia-Australia" },
+    { u"🙅🏿‍♀️", "woman gesturing NO: dark skin tone" },
+    { u"🤷🏻‍♀️", "woman shrugging: light skin tone" },
+    { u"🧑🏿‍❤️‍💋‍🧑🏼", "kiss: person, person, dark skin tone, medium-light skin tone" },
+    { u"🕳️", "hole" },
+    { u"🧖🏾‍♂", "man in steamy room: medium-dark skin tone" },
+    { u"👱🏼‍♀️", "woman: medium-light skin tone, blond hair" },
+    { u"🧏🏾‍♂️", "deaf man: medium-dark skin tone" },
+    { u"☑", "check box with check" },
+    { u"😔", "pensive face" },
+    { u"👩🏼‍❤‍👩🏼", "couple with heart: woman, woman, medium-light skin tone" },
+    { u"🤳🏾", "selfie: medium-dark skin tone" },
+    { u"🧚🏼‍♂️", "man fairy: medium-light skin tone" },
+    { u"🕷", "spider" },
+    { u"🆑", "CL button" },
+    { u"🔴", "red circle" },
+    { u"🪫", "low battery" },
+    { u"◾", "black medium-small square" },
+    { u"👨🏽‍🦽‍➡️", "man in manual wheelchair facing right: medium skin tone" },
+    { u"🧑🏼‍🎄", "Mx Claus: medium-light skin tone" },
+    { u"👼🏾", "baby angel: medium-dark skin tone" },
+    { u"💖", "sparkling heart" },
+    { u"👩🏻‍❤️‍👨🏻", "couple with heart: woman, man, light skin tone" },
+    { u"☝🏻", "index pointing up: light skin tone" },
+    { u"🎳", "bowling" },
+    { u"👑", "crown" },
+    { u"✡", "star of David" },
+    { u"😴", "sleeping face" },
+    { u"🚝", "monorail" },
+    { u"🕞", "three-thirty" },
+    { u"🌙", "crescent moon" },
+    { u"⚓", "anchor" },
+    { u"👨‍🦼‍➡", "man in motorized wheelchair facing right" },
+    { u"👩🏽‍🦳", "woman: medium skin tone, white hair" },
+    { u"🛖", "hut" },
+    { u"🤲🏽", "palms up together: medium skin tone" },
+    { u"🧔🏽‍♀", "woman: medium skin tone, beard" },
+    { u"🙋🏻‍♂️", "man raising hand: light skin tone" },
+    { u"👩🏼‍🤝‍👨🏻", "woman and man holding hands: medium-light skin tone, light skin tone" },
+    { u"👨🏽‍❤️‍💋‍👨🏿", "kiss: man, man, medium skin tone, dark skin tone" },
+    { u"🇳🇦", "flag: Namibia" },
+    { u"👨‍👩‍👦", "family: man, woman, boy" },
+    { u"🇨🇨", "flag: Cocos (Keeling) Islands" },
+    { u"🕵🏾", "detective: medium-dark skin tone" },
+    { u"👌🏻", "OK hand: light skin tone" },
+    { u"🧎‍♂️‍➡", "man kneeling facing right" },
+    { u"👨🏾‍❤‍👨🏽", "couple with heart: man, man, medium-dark skin tone, medium skin tone" },
+    { u"🧑🏾‍🚒", "firefighter: medium-dark skin tone" },
+    { u"🤦🏼", "person facepalming: medium-light skin tone" },
+    { u"🏛️", "classical building" },
+    { u"🧍‍♂", "man standing" },
+    { u"🎦", "cinema" },
+    { u"🚶🏼", "person walking: medium-light skin tone" },
+    { u"👩🏻‍⚖️", "woman judge: light skin tone" },
+    { u"🦥", "sloth" },
+    { u"🦹🏽", "supervillain: medium skin tone" },
+    { u"▫️", "white small square" },
+    { u"👍🏾", "thumbs up: medium-dark skin tone" },
+    { u"🧘🏻", "person in lotus position: light skin tone" },
+    { u"🇬🇫", "flag: French Guiana" },
+    { u"🇵🇷", "flag: Puerto Rico" },
+    { u"🧗🏾‍♀️", "woman climbing: medium-dark skin tone" },
+    { u"3⃣", "keycap: 3" },
+    { u"📽️", "film projector" },
+    { u"🧑🏾‍❤‍💋‍🧑🏽", "kiss: person, person, medium-dark skin tone, medium skin tone" },
+    { u"🛣️", "motorway" },
+    { u"👷‍♀", "woman construction worker" },
+    { u"📘", "blue book" },
+    { u"🇨🇭", "flag: Switzerland" },
+    { u"🇲🇫", "flag: St. Martin" },
+    { u"🇸🇹", "flag: São Tomé & Príncipe" },
+    { u"🧳", "luggage" },
+    { u"👼🏼", "baby angel: medium-light skin tone" },
+    { u"🥮", "moon cake" },
+    { u"🧑🏿‍🍳", "cook: dark skin tone" },
+    { u"🧑🏿‍🎨", "artist: dark skin tone" },
+    { u"🧝‍♂️", "man elf" },
+    { u"🚙", "sport utility vehicle" },
+    { u"📠", "fax machine" },
+    { u"🦕", "sauropod" },
+    { u"👨🏿‍🏭", "man factory worker: dark skin tone" },
+    { u"👨🏽‍🍼", "man feeding baby: medium skin tone" },
+    { u"🗄️", "file cabinet" },
+    { u"🏟", "stadium" },
+    { u"🥲", "smiling face with tear" },
+    { u"🤹🏾‍♂️", "man juggling: medium-dark skin tone" },
+    { u"👨🏿‍🦼‍➡", "man in motorized wheelchair facing right: dark skin tone" },
+    { u"🛰️", "satellite" },
+    { u"🧓🏽", "older person: medium skin tone" },
+    { u"🚵🏿", "person mountain biking: dark skin tone" },
+    { u"🐂", "ox" },
+    { u"👨🏾‍❤️‍👨🏾", "couple with heart: man, man, medium-dark skin tone" },
+    { u"🕴🏿", "person in suit levitating: dark skin tone" },
+    { u"👩🏻‍❤️‍👨🏼", "couple with heart: woman, man, light skin tone, medium-light skin tone" },
+    { u"🛎️", "bellhop bell" },
+    { u"🐵", "monkey face" },
+    { u"😃", "grinning face with big eyes" },
+    { u"🏃🏻‍➡️", "person running facing right: light skin tone" },
+    { u"🧑🏻‍🦱", "person: light skin tone, curly hair" },
+    { u"🌨️", "cloud with snow" },
+    { u"🏋🏾", "person lifting weights: medium-dark skin tone" },
+    { u"🙋‍♀", "woman raising hand" },
+    { u"👩🏽‍❤️‍💋‍👨🏾", "kiss: woman, man, medium skin tone, medium-dark skin tone" },
+    { u"🏊", "person swimming" },
+    { u"🌦", "sun behind rain cloud" },
+    { u"🧗🏿‍♂️", "man climbing: dark skin tone" },
+    { u"🪟", "window" },
+    { u"💕", "two hearts" },
+    { u"✌🏽", "victory hand: medium skin tone" },
+    { u"😆", "grinning squinting face" },
+    { u"🕝", "two-thirty" },
+    { u"🍄", "mushroom" },
+    { u"🇹🇬", "flag: Togo" },
+    { u"#️⃣", "keycap: #" },
+    { u"🤾🏽", "person playing handball: medium skin tone" },
+};
+
+// Code points occurring in emoji, in pages of 256 code points.
+static constexpr uint EMOJI_CODE_POINT_PAGE_COUNT = 3585;
+
+static constexpr uint8_t EMOJI_CODE_POINT_PAGE_INDEX[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 3, 0, 4, 5, 6, 7, 8, 0, 9, 0, 10, 0, 0, 0, 0, 11, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 15, 16, 17, 18, 19, 20, 21, 0, 22, 23, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    24,
+};
+
+static constexpr uint32_t EMOJI_CODE_POINT_BITS[][8] = {
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+    { 0x00000000, 0x03ff0408, 0x00000000, 0x00000000, 0x00000000, 0x00004200, 0x00000000, 0x00000000 },
+    { 0x00002000, 0x10000000, 0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008 },
+    { 0x00000000, 0x02000004, 0x00000000, 0x00000000, 0x03f00000, 0x00000600, 0x00000000, 0x00000000 },
+    { 0x0c000000, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x070ffe00 },
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000 },
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00400c00, 0x00000001, 0x78000000 },
+    { 0x2132401f, 0x0700c44d, 0x800fff05, 0xc8000169, 0x1afc0000, 0x60030c83, 0x001ac130, 0x27bf0600 },
+    { 0x2054bf24, 0x00180102, 0x00b85090, 0x00000018, 0x00e00000, 0x80010002, 0x00000000, 0x00000000 },
+    { 0x00000000, 0x00300000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+    { 0x180000e0, 0x00000000, 0x00210000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+    { 0x00000000, 0x20010000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02800000, 0x00000000, 0x00000000, 0x00000000 },
+    { 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+    { 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000 },
+    { 0x00000000, 0x00000000, 0x00000000, 0xc0030000, 0x07fe4000, 0x00000000, 0x00000000, 0xffffffc0 },
+    { 0x04000006, 0x07fc8000, 0x00030000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+    { 0xffffffff, 0xfffffff3, 0xffffffff, 0xffffffff, 0xcecfffff, 0xffffffff, 0xffffffff, 0xffb9ffff },
+    { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xbfffffff },
+    { 0xffffffff, 0x3fffffff, 0xffff7e00, 0x07f980ff, 0x00613c80, 0x10060130, 0x700e001c, 0xfc08810a },
+    { 0xffffffff, 0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffffffff, 0xf0e7f83f, 0x1ff91a3f },
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010fff },
+    { 0xfffff000, 0xf7ffffff, 0xffffffbf, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+    { 0x00000000, 0x00000000, 0x00000000, 0x1fff0000, 0xffff83ff, 0xffffffff, 0x9fffc07f, 0x01ff03ff },
+    { 0x00000000, 0x00000000, 0x00000000, 0x809850ac, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+};
+
+}
@@ -2,6 +2,7 @@
 // License: GPLv3
 #include "external_view.h"
 #include "content_filter.h"
+#include "link_card_store.h"
 #include "profile.h"
 
 namespace Skywalker
@@ -37,6 +38,11 @@ QString ExternalView::getThumbUrl() const
     return mExternal ? mExternal->mThumb.value_or("") : "";
 }
 
+QString ExternalView::getThumbSource() const
+{
+    return LinkCardStore::instance().getLinkThumbSource(getUri(), getThumbUrl());
+}
+
 QDateTime ExternalView::getCreatedAt() const
 {
     return mExternal ? mExternal->mCreatedAt.value_or(QDateTime{}) : QDateTime{};
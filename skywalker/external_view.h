@@ -16,6 +16,7 @@ class ExternalView
     Q_PROPERTY(QString title READ getTitle FINAL)
     Q_PROPERTY(QString description READ getDescription FINAL)
     Q_PROPERTY(QString thumbUrl READ getThumbUrl FINAL)
+    Q_PROPERTY(QString thumbSource READ getThumbSource FINAL)
     Q_PROPERTY(QDateTime createdAt READ getCreatedAt FINAL)
     Q_PROPERTY(QDateTime updateAt READ getUpdatedAt FINAL)
     Q_PROPERTY(int readingTime READ getReadingTime FINAL)
@@ -35,6 +36,10 @@ public:
     QString getTitle() const;
     QString getDescription() const;
     QString getThumbUrl() const;
+
+    // The stored thumbnail of the link card if available, otherwise the thumb URL.
+    QString getThumbSource() const;
+
     QDateTime getCreatedAt() const;
     QDateTime getUpdatedAt() const;
     int getReadingTime() const; // minutes
@@ -41,7 +41,7 @@ void FacetUtils::extractMentionsAndLinks(const QString& text, const QString& pre
         cursor = text.size();
 
     const QString fullText = text.sliced(0, cursor) + preeditText + text.sliced(cursor);
-    const auto facets = ATProto::RichTextMaster::parseFacets(fullText);
+    const auto facets = mFacetParser.parse(fullText);
 
     int preeditCursor = cursor + preeditText.length();
     bool editMentionFound = false;
@@ -2,6 +2,7 @@
 // License: GPLv3
 #pragma once
 #include "facet_highlighter.h"
+#include "incremental_facet_parser.h"
 #include "text_differ.h"
 #include "presence.h"
 #include "enums.h"
@@ -160,6 +161,7 @@ private:
     int mCursorInEmbeddedLink = -1;
 
     FacetHighlighter mFacetHighlighter;
+    IncrementalFacetParser mFacetParser;
 };
 
 }
@@ -0,0 +1,622 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#include "feed_spill_store.h"
+#include "file_utils.h"
+#include <QDir>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QSaveFile>
+
+namespace Skywalker {
+
+using namespace std::chrono_literals;
+
+// Spilled posts get stale (like counts, etc.). Older pages are fetched again.
+static constexpr auto MAX_PAGE_AGE = 36h;
+
+// When the data file grows beyond the max size, the oldest pages are removed
+// till the file is at most half the max size.
+static constexpr qint64 MAX_DATA_FILE_SIZE = 32 * 1024 * 1024;
+
+FeedSpillStore::FeedSpillStore(const QString& name, QObject* parent) :
+    QObject(parent),
+    mName(name)
+{
+    mWorkerPool.setMaxThreadCount(1);
+}
+
+FeedSpillStore::~FeedSpillStore()
+{
+    close();
+}
+
+void FeedSpillStore::open(const QString& userDid)
+{
+    const QString path = FileUtils::getCachePath(userDid);
+
+    if (path.isEmpty())
+        return;
+
+    if (isOpen())
+    {
+        if (path == mPath)
+            return;
+
+        close();
+    }
+
+    mPath = path;
+    const QString fileName = QDir(mPath).filePath(mName + ".dat");
+    qDebug() << "Open spill store:" << fileName;
+
+    // Left over from an interrupted compaction
+    QFile::remove(getCompactFileName());
+    mDataFile.setFileName(fileName);
+
+    if (!mDataFile.open(QIODevice::ReadWrite))
+    {
+        qWarning() << "Cannot open file:" << fileName << mDataFile.errorString();
+        return;
+    }
+
+    if (!loadIndex())
+    {
+        clear();
+        return;
+    }
+
+    mDataSize = mDataFile.size();
+    removeExpiredEntries();
+}
+
+void FeedSpillStore::close()
+{
+    if (!isOpen())
+        return;
+
+    qDebug() << "Close spill store:" << mDataFile.fileName() << "pages:" << mIndex.size();
+
+    // Pending writes include the index. A compaction saves its own index, pages
+    // spilled during compaction are dropped.
+    mWorkerPool.waitForDone();
+    ++mGeneration;
+    mCompacting = false;
+    mIndexDirty = false;
+    QFile::remove(getCompactFileName());
+    unmapData();
+    mDataFile.close();
+    mDataSize = 0;
+    mIndex.clear();
+    mUnwrittenPages.clear();
+    mPath.clear();
+}
+
+void FeedSpillStore::clear()
+{
+    qDebug() << "Clear spill store:" << mName;
+    mIndex.clear();
+    mUnwrittenPages.clear();
+    ++mGeneration;
+    mCompacting = false;
+    mIndexDirty = false;
+    mDataSize = 0;
+
+    if (!isOpen())
+        return;
+
+    // A running compaction may replace the data file.
+    mWorkerPool.waitForDone();
+    QFile::remove(getCompactFileName());
+    unmapData();
+    mDataFile.close();
+
+    if (!mDataFile.open(QIODevice::ReadWrite | QIODevice::Truncate))
+    {
+        qWarning() << "Cannot open file:" << mDataFile.fileName() << mDataFile.errorString();
+        mPath.clear();
+        return;
+    }
+
+    saveIndex();
+}
+
+void FeedSpillStore::spillPage(const QString& cursor, const QString& nextCursor, const FeedViewPostList& feed)
+{
+    if (!isOpen() || cursor.isEmpty() || feed.empty())
+        return;
+
+    QJsonArray jsonFeed;
+
+    for (const auto& feedViewPost : feed)
+        jsonFeed.append(feedViewPost->toJson());
+
+    QJsonObject json;
+    json.insert("feed", jsonFeed);
+
+    if (!nextCursor.isEmpty())
+        json.insert("cursor", nextCursor);
+
+    const QByteArray data = QJsonDocument(json).toJson(QJsonDocument::Compact);
+
+    if (mDataSize + data.size() > MAX_DATA_FILE_SIZE)
+        compact();
+
+    mIndex[cursor] = Entry{ UNPLACED_OFFSET, data.size(), QDateTime::currentDateTimeUtc() };
+    mUnwrittenPages[cursor] = data;
+
+    // During compaction the page is written when the compacted file is in place.
+    if (!mCompacting)
+        writePage(cursor);
+
+    qDebug() << "Spilled page:" << cursor << "posts:" << feed.size() << "bytes:" << data.size() << "pages:" << mIndex.size();
+    saveIndex();
+}
+
+ATProto::AppBskyFeed::OutputFeed::SharedPtr FeedSpillStore::loadPage(const QString& cursor)
+{
+    auto it = mIndex.find(cursor);
+
+    if (it == mIndex.end())
+        return nullptr;
+
+    const Entry& entry = it->second;
+
+    if (QDateTime::currentDateTimeUtc() - entry.mSpilledAt > MAX_PAGE_AGE)
+    {
+        qDebug() << "Spilled page expired:" << cursor;
+        removePage(cursor);
+        return nullptr;
+    }
+
+    QByteArray rawData;
+    auto itUnwritten = mUnwrittenPages.find(cursor);
+
+    if (itUnwritten != mUnwrittenPages.end())
+    {
+        rawData = itUnwritten->second;
+    }
+    else
+    {
+        const uchar* data = mapData(entry.mOffset + entry.mSize);
+
+        if (!data)
+            return nullptr;
+
+        // The JSON parser copies the data, so no need to copy it out of the map.
+        rawData = QByteArray::fromRawData(reinterpret_cast<const char*>(data + entry.mOffset), entry.mSize);
+    }
+
+    QJsonParseError error;
+    const QJsonDocument json = QJsonDocument::fromJson(rawData, &error);
+
+    if (json.isNull())
+    {
+        qWarning() << "Invalid spilled page:" << cursor << error.errorString();
+        removePage(cursor);
+        return nullptr;
+    }
+
+    try {
+        auto feed = ATProto::AppBskyFeed::OutputFeed::fromJson(json.object());
+        qDebug() << "Loaded spilled page:" << cursor << "posts:" << feed->mFeed.size();
+        return feed;
+    } catch (ATProto::InvalidJsonException& e) {
+        qWarning() << "Invalid spilled page:" << cursor << e.msg();
+        removePage(cursor);
+        return nullptr;
+    }
+}
+
+QString FeedSpillStore::getIndexFileName() const
+{
+    return QDir(mPath).filePath(mName + "_index.json");
+}
+
+QString FeedSpillStore::getCompactFileName() const
+{
+    return QDir(mPath).filePath(mName + ".compact");
+}
+
+bool FeedSpillStore::loadIndex()
+{
+    mIndex.clear();
+    QFile file(getIndexFileName());
+
+    if (!file.exists())
+        return false;
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qWarning() << "Cannot open file:" << file.fileName();
+        return false;
+    }
+
+    const QJsonDocument json = QJsonDocument::fromJson(file.readAll());
+    const QJsonArray pages = json.object().value("pages").toArray();
+    const qint64 dataSize = mDataFile.size();
+
+    for (const auto& page : pages)
+    {
+        const QJsonObject pageJson = page.toObject();
+        const QString cursor = pageJson.value("cursor").toString();
+        const Entry entry{
+            pageJson.value("offset").toInteger(),
+            pageJson.value("size").toInteger(),
+            QDateTime::fromSecsSinceEpoch(pageJson.value("spilledAt").toInteger()) };
+
+        if (cursor.isEmpty() || entry.mOffset < 0 || entry.mSize <= 0 || entry.mOffset + entry.mSize > dataSize)
+        {
+            qWarning() << "Invalid spill index:" << file.fileName();
+            mIndex.clear();
+            return false;
+        }
+
+        mIndex[cursor] = entry;
+    }
+
+    qDebug() << "Loaded spill index:" << file.fileName() << "pages:" << mIndex.size();
+    return true;
+}
+
+// The index is written after the pages queued before. During compaction the
+// offsets are about to change, so the index is saved after compaction.
+void FeedSpillStore::saveIndex()
+{
+    if (mPath.isEmpty())
+        return;
+
+    if (mCompacting)
+    {
+        mIndexDirty = true;
+        return;
+    }
+
+    EntryList entries;
+    entries.reserve(mIndex.size());
+
+    for (const auto& [cursor, entry] : mIndex)
+    {
+        if (entry.mOffset != UNPLACED_OFFSET)
+            entries.push_back({cursor, entry});
+    }
+
+    mIndexDirty = false;
+    mWorkerPool.start([indexFileName=getIndexFileName(), indexData=toIndexJson(entries)]{
+        writeIndex(indexFileName, indexData);
+    });
+}
+
+void FeedSpillStore::removePage(const QString& cursor)
+{
+    mIndex.erase(cursor);
+    mUnwrittenPages.erase(cursor);
+    saveIndex();
+}
+
+void FeedSpillStore::removeExpiredEntries()
+{
+    const auto now = QDateTime::currentDateTimeUtc();
+    const auto oldSize = mIndex.size();
+
+    std::erase_if(mIndex, [now](const auto& item){
+        return now - item.second.mSpilledAt > MAX_PAGE_AGE; });
+
+    if (mIndex.empty())
+    {
+        clear();
+        return;
+    }
+
+    if (mIndex.size() != oldSize)
+    {
+        qDebug() << "Removed expired spilled pages:" << oldSize - mIndex.size();
+        compact();
+    }
+}
+
+void FeedSpillStore::writePage(const QString& cursor)
+{
+    Entry& entry = mIndex[cursor];
+    entry.mOffset = mDataSize;
+    mDataSize += entry.mSize;
+
+    mWorkerPool.start([this, generation=mGeneration, cursor, offset=entry.mOffset,
+                       data=mUnwrittenPages[cursor], dataFileName=mDataFile.fileName()]{
+        const bool success = appendData(dataFileName, offset, data);
+
+        QMetaObject::invokeMethod(this, [this, generation, cursor, offset, success]{
+                pageWritten(generation, cursor, offset, success); },
+            Qt::QueuedConnection);
+    });
+}
+
+void FeedSpillStore::pageWritten(int generation, const QString& cursor, qint64 offset, bool success)
+{
+    if (generation != mGeneration)
+        return;
+
+    if (!success)
+    {
+        clear();
+        return;
+    }
+
+    // The page may have been spilled again meanwhile.
+    auto it = mIndex.find(cursor);
+
+    if (it != mIndex.end() && it->second.mOffset == offset)
+        mUnwrittenPages.erase(cursor);
+}
+
+// Rewrites the data file with the newest pages only. The pages are copied to a
+// new file on the background thread, which then replaces the data file. Pages
+// spilled in the meantime are written after that.
+void FeedSpillStore::compact()
+{
+    if (mCompacting)
+        return;
+
+    EntryList entries(mIndex.begin(), mIndex.end());
+    std::sort(entries.begin(), entries.end(),
+              [](const auto& lhs, const auto& rhs){ return lhs.second.mSpilledAt > rhs.second.mSpilledAt; });
+
+    qint64 keepSize = 0;
+    size_t keepCount = 0;
+
+    for (; keepCount < entries.size(); ++keepCount)
+    {
+        if (keepSize + entries[keepCount].second.mSize > MAX_DATA_FILE_SIZE / 2)
+            break;
+
+        keepSize += entries[keepCount].second.mSize;
+    }
+
+    entries.resize(keepCount);
+    qDebug() << "Compact spill store:" << mName << "pages:" << mIndex.size() << "keep:" << keepCount;
+
+    // Keep the file order of the pages
+    std::sort(entries.begin(), entries.end(),
+              [](const auto& lhs, const auto& rhs){ return lhs.second.mOffset < rhs.second.mOffset; });
+
+    mCompacting = true;
+
+    mWorkerPool.start([this, generation=mGeneration, entries, dataFileName=mDataFile.fileName(),
+                       compactFileName=getCompactFileName(), indexFileName=getIndexFileName()]{
+        EntryList compactEntries = entries;
+        bool success = writeCompactData(dataFileName, compactFileName, compactEntries);
+
+        if (success)
+        {
+            QFile::remove(dataFileName);
+            success = QFile::rename(compactFileName, dataFileName);
+
+            if (!success)
+                qWarning() << "Failed to replace:" << dataFileName;
+        }
+
+        if (success)
+            writeIndex(indexFileName, toIndexJson(compactEntries));
+        else
+            QFile::remove(compactFileName);
+
+        QMetaObject::invokeMethod(this, [this, generation, entries, compactEntries, success]{
+                finishCompaction(generation, entries, compactEntries, success); },
+            Qt::QueuedConnection);
+    });
+}
+
+void FeedSpillStore::finishCompaction(int generation, const EntryList& oldEntries, const EntryList& newEntries, bool success)
+{
+    if (generation != mGeneration)
+    {
+        qDebug() << "Spill store changed during compaction:" << mName;
+        return;
+    }
+
+    mCompacting = false;
+
+    if (!success)
+    {
+        clear();
+        return;
+    }
+
+    // The data file has been replaced.
+    unmapData();
+    mDataFile.close();
+
+    if (!mDataFile.open(QIODevice::ReadWrite))
+    {
+        qWarning() << "Cannot open file:" << mDataFile.fileName() << mDataFile.errorString();
+        clear();
+        return;
+    }
+
+    std::unordered_map<QString, Entry> index;
+    Q_ASSERT(oldEntries.size() == newEntries.size());
+
+    for (size_t i = 0; i < oldEntries.size(); ++i)
+    {
+        // Skip pages that got removed, or spilled again, during compaction.
+        const auto& [cursor, oldEntry] = oldEntries[i];
+        auto it = mIndex.find(cursor);
+
+        if (it != mIndex.end() && it->second.mOffset == oldEntry.mOffset)
+            index[cursor] = newEntries[i].second;
+    }
+
+    std::vector<QString> unplacedCursors;
+
+    for (const auto& [cursor, entry] : mIndex)
+    {
+        if (entry.mOffset == UNPLACED_OFFSET)
+        {
+            index[cursor] = entry;
+            unplacedCursors.push_back(cursor);
+        }
+    }
+
+    mIndex = std::move(index);
+    mDataSize = mDataFile.size();
+    std::erase_if(mUnwrittenPages, [this](const auto& item){ return !mIndex.contains(item.first); });
+
+    for (const auto& cursor : unplacedCursors)
+        writePage(cursor);
+
+    if (!unplacedCursors.empty() || mIndexDirty)
+        saveIndex();
+
+    qDebug() << "Compacted spill store:" << mName << "pages:" << mIndex.size() << "bytes:" << mDataSize;
+    emit compacted();
+}
+
+bool FeedSpillStore::appendData(const QString& dataFileName, qint64 offset, const QByteArray& data)
+{
+    QFile file(dataFileName);
+
+    if (!file.open(QIODevice::Append))
+    {
+        qWarning() << "Cannot open file:" << dataFileName << file.errorString();
+        return false;
+    }
+
+    if (file.size() != offset)
+    {
+        qWarning() << "Unexpected spill file size:" << file.size() << "offset:" << offset;
+        return false;
+    }
+
+    if (file.write(data) != data.size() || !file.flush())
+    {
+        qWarning() << "Failed to spill page:" << dataFileName << file.errorString();
+        return false;
+    }
+
+    return true;
+}
+
+bool FeedSpillStore::writeIndex(const QString& indexFileName, const QByteArray& indexData)
+{
+    QSaveFile file(indexFileName);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        qWarning() << "Cannot open file:" << indexFileName << file.errorString();
+        return false;
+    }
+
+    file.write(indexData);
+
+    if (!file.commit())
+    {
+        qWarning() << "Failed to save spill index:" << indexFileName << file.errorString();
+        return false;
+    }
+
+    return true;
+}
+
+// Pages in the data file are only appended to. Pages queued for writing before
+// the compaction have been written already.
+bool FeedSpillStore::writeCompactData(const QString& dataFileName, const QString& compactFileName,
+                                      EntryList& entries)
+{
+    QFile dataFile(dataFileName);
+
+    if (!dataFile.open(QIODevice::ReadOnly))
+    {
+        qWarning() << "Cannot open file:" << dataFileName << dataFile.errorString();
+        return false;
+    }
+
+    const qint64 dataSize = dataFile.size();
+    const uchar* data = dataSize > 0 ? dataFile.map(0, dataSize) : nullptr;
+
+    if (!data && !entries.empty())
+    {
+        qWarning() << "Cannot map file:" << dataFileName << dataFile.errorString();
+        return false;
+    }
+
+    QFile compactFile(compactFileName);
+
+    if (!compactFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning() << "Cannot open file:" << compactFileName << compactFile.errorString();
+        return false;
+    }
+
+    qint64 offset = 0;
+
+    for (auto& [_, entry] : entries)
+    {
+        if (entry.mOffset + entry.mSize > dataSize ||
+            compactFile.write(reinterpret_cast<const char*>(data + entry.mOffset), entry.mSize) != entry.mSize)
+        {
+            qWarning() << "Failed to compact:" << compactFileName << compactFile.errorString();
+            return false;
+        }
+
+        entry.mOffset = offset;
+        offset += entry.mSize;
+    }
+
+    return compactFile.flush();
+}
+
+QByteArray FeedSpillStore::toIndexJson(const EntryList& entries)
+{
+    QJsonArray pages;
+
+    for (const auto& [cursor, entry] : entries)
+    {
+        QJsonObject pageJson;
+        pageJson.insert("cursor", cursor);
+        pageJson.insert("offset", entry.mOffset);
+        pageJson.insert("size", entry.mSize);
+        pageJson.insert("spilledAt", entry.mSpilledAt.toSecsSinceEpoch());
+        pages.append(pageJson);
+    }
+
+    QJsonObject json;
+    json.insert("pages", pages);
+    return QJsonDocument(json).toJson(QJsonDocument::Compact);
+}
+
+const uchar* FeedSpillStore::mapData(qint64 endOffset)
+{
+    if (mMap && endOffset <= mMapSize)
+        return mMap;
+
+    unmapData();
+    const qint64 size = mDataFile.size();
+
+    if (endOffset > size || size == 0)
+    {
+        qWarning() << "Spilled data beyond end of file:" << endOffset << "size:" << size;
+        return nullptr;
+    }
+
+    mMap = mDataFile.map(0, size);
+
+    if (!mMap)
+    {
+        qWarning() << "Cannot map file:" << mDataFile.fileName() << mDataFile.errorString();
+        return nullptr;
+    }
+
+    mMapSize = size;
+    return mMap;
+}
+
+void FeedSpillStore::unmapData()
+{
+    if (!mMap)
+        return;
+
+    mDataFile.unmap(mMap);
+    mMap = nullptr;
+    mMapSize = 0;
+}
+
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <atproto/lib/lexicon/app_bsky_feed.h>
+#include <QDateTime>
+#include <QFile>
+#include <QObject>
+#include <QThreadPool>
+#include <unordered_map>
+
+namespace Skywalker {
+
+// Keeps pages of feed posts that have been removed from a feed model in a file,
+// such that they can be added back without fetching them from the network.
+// A page is found by the cursor that was used to fetch it. The data file is
+// appended to and read through a memory map. The page index is saved next to
+// it, such that spilled pages survive a restart.
+//
+// All writes are done in order on a background thread. Pages are kept in memory
+// till they are written. Meanwhile pages can still be spilled and loaded.
+class FeedSpillStore : public QObject
+{
+    Q_OBJECT
+
+public:
+    using FeedViewPostList = std::vector<ATProto::AppBskyFeed::FeedViewPost::SharedPtr>;
+
+    explicit FeedSpillStore(const QString& name, QObject* parent = nullptr);
+    ~FeedSpillStore();
+
+    void open(const QString& userDid);
+    void close();
+    bool isOpen() const { return mDataFile.isOpen(); }
+
+    // Removes all pages
+    void clear();
+
+    void spillPage(const QString& cursor, const QString& nextCursor, const FeedViewPostList& feed);
+
+    // Returns nullptr if there is no page for the cursor
+    ATProto::AppBskyFeed::OutputFeed::SharedPtr loadPage(const QString& cursor);
+
+    bool hasPage(const QString& cursor) const { return mIndex.contains(cursor); }
+    size_t size() const { return mIndex.size(); }
+    bool isCompacting() const { return mCompacting; }
+
+signals:
+    void compacted();
+
+private:
+    // A page spilled during compaction gets its offset when the compaction is done.
+    static constexpr qint64 UNPLACED_OFFSET = -1;
+
+    struct Entry
+    {
+        qint64 mOffset = UNPLACED_OFFSET;
+        qint64 mSize = 0;
+        QDateTime mSpilledAt;
+    };
+
+    using EntryList = std::vector<std::pair<QString, Entry>>;
+
+    QString getIndexFileName() const;
+    QString getCompactFileName() const;
+    bool loadIndex();
+    void saveIndex();
+    void removePage(const QString& cursor);
+    void removeExpiredEntries();
+    void writePage(const QString& cursor);
+    void pageWritten(int generation, const QString& cursor, qint64 offset, bool success);
+    void compact();
+    void finishCompaction(int generation, const EntryList& oldEntries, const EntryList& newEntries, bool success);
+    const uchar* mapData(qint64 endOffset);
+    void unmapData();
+
+    // These run on the background thread
+    static bool appendData(const QString& dataFileName, qint64 offset, const QByteArray& data);
+    static bool writeIndex(const QString& indexFileName, const QByteArray& indexData);
+    static bool writeCompactData(const QString& dataFileName, const QString& compactFileName,
+                                 EntryList& entries);
+    static QByteArray toIndexJson(const EntryList& entries);
+
+    QString mName;
+    QString mPath;
+    QFile mDataFile; // read through a memory map, pages are written by the worker
+    uchar* mMap = nullptr;
+    qint64 mMapSize = 0;
+    qint64 mDataSize = 0; // including pages queued for writing
+    std::unordered_map<QString, Entry> mIndex; // cursor -> page
+    std::unordered_map<QString, QByteArray> mUnwrittenPages; // cursor -> page data
+    bool mCompacting = false;
+    bool mIndexDirty = false; // index changed during compaction
+    int mGeneration = 0; // incremented when the data file gets cleared or closed
+    QThreadPool mWorkerPool;
+};
+
+}
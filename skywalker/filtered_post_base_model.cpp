@@ -68,8 +68,7 @@ void FilteredPostBaseModel::setEndOfFeed(bool endOfFeed)
         if (!post.isPlaceHolder())
         {
             post.setEndOfFeed(true);
-            const auto index = createIndex(i, 0);
-            emit dataChanged(index, index, { int(Role::EndOfFeed) });
+            changePhysicalRowData(i, { int(Role::EndOfFeed) });
             break;
         }
     }
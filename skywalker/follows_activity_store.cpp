@@ -1,25 +1,52 @@
 // Copyright (C) 2025 Michel de Boer
 // License: GPLv3
 #include "follows_activity_store.h"
+#include <algorithm>
 
 namespace Skywalker {
 
 using namespace std::chrono_literals;
 
 static constexpr auto UPDATE_INTERVAL = 31s;
+static constexpr auto WHEEL_TICK = 30s;
+static constexpr qint64 WHEEL_TICK_MS = std::chrono::milliseconds(WHEEL_TICK).count();
 
-FollowsActivityStore::FollowsActivityStore(Following& following, QObject* parent) :
+// The wheel covers the active interval, so a status never wraps around.
+static const int WHEEL_SIZE = ActivityStatus::ACTIVE_INTERVAL / WHEEL_TICK + 2;
+
+static qint64 toTick(QDateTime timestamp)
+{
+    return timestamp.toMSecsSinceEpoch() / WHEEL_TICK_MS;
+}
+
+static qint64 toTickCeil(QDateTime timestamp)
+{
+    return (timestamp.toMSecsSinceEpoch() + WHEEL_TICK_MS - 1) / WHEEL_TICK_MS;
+}
+
+FollowsActivityStore::FollowsActivityStore(Following& following, PollScheduler& pollScheduler, QObject* parent) :
     QObject(parent),
-    mFollowing(following)
+    mFollowing(following),
+    mPollScheduler(pollScheduler),
+    mWheel(WHEEL_SIZE),
+    mLastExpiryTick(toTick(QDateTime::currentDateTimeUtc()))
 {
     mUnfollowConnection = connect(&mFollowing, &Following::stoppedFollowing, this, [this](const QString& did){ handleUnfollow(did); });
-    connect(&mUpdateTimer, &QTimer::timeout, this, [this]{ updateActivities(); });
-    mUpdateTimer.start(UPDATE_INTERVAL);
+
+    // Local job, no backoff as activity should expire in time.
+    mUpdateJob = mPollScheduler.addJob("follows-activity", UPDATE_INTERVAL, UPDATE_INTERVAL,
+        [this](const PollScheduler::DoneCb& done){
+            const auto activeCount = mStatusExpiryTick.size();
+            updateActivities();
+            done(mStatusExpiryTick.size() != activeCount ? PollScheduler::Result::CHANGED : PollScheduler::Result::UNCHANGED);
+        });
+    mPollScheduler.startJob(mUpdateJob);
 }
 
 FollowsActivityStore::~FollowsActivityStore()
 {
     disconnect(mUnfollowConnection);
+    mPollScheduler.removeJob(mUpdateJob);
 }
 
 void FollowsActivityStore::clear()
@@ -28,7 +55,10 @@ void FollowsActivityStore::clear()
         status->deleteLater();
 
     mDidStatus.clear();
-    mActiveStatusSet.clear();
+    mStatusExpiryTick.clear();
+
+    for (auto& bucket : mWheel)
+        bucket.clear();
 }
 
 ActivityStatus* FollowsActivityStore::getActivityStatus(const BasicProfile& author)
@@ -53,40 +83,108 @@ void FollowsActivityStore::reportActivity(const BasicProfile& author, QDateTime
         return;
 
     auto* status = getActivityStatus(author);
-    mActiveStatusSet.erase(status);
+    const auto oldLastActive = status->getLastActive();
     status->setLastActive(timestamp);
 
+    if (status->getLastActive() == oldLastActive && mStatusExpiryTick.contains(status))
+        return;
+
+    removeFromWheel(status);
+
     if (status->isActive())
-        mActiveStatusSet.insert(status);
+        addToWheel(status);
 }
 
 std::vector<QString> FollowsActivityStore::getActiveFollowsDids() const
 {
     std::vector<QString> dids;
-    dids.reserve(mActiveStatusSet.size());
+    dids.reserve(mStatusExpiryTick.size());
 
-    for (auto it = mActiveStatusSet.rbegin(); it != mActiveStatusSet.rend(); ++it)
-        dids.push_back((*it)->getDid());
+    forEachActiveFollow([&dids](const ActivityStatus& status){
+        dids.push_back(status.getDid());
+        return true;
+    });
 
     return dids;
 }
 
+void FollowsActivityStore::forEachActiveFollow(const ActivityVisitor& visitor) const
+{
+    std::vector<ActivityStatus*> bucketStatuses;
+
+    // Newest activity expires last.
+    for (qint64 tick = mLastExpiryTick + WHEEL_SIZE; tick > mLastExpiryTick; --tick)
+    {
+        const auto& bucket = mWheel[tick % WHEEL_SIZE];
+
+        if (bucket.empty())
+            continue;
+
+        bucketStatuses.assign(bucket.begin(), bucket.end());
+        std::sort(bucketStatuses.begin(), bucketStatuses.end(),
+                  [](ActivityStatus* lhs, ActivityStatus* rhs){ return *rhs < *lhs; });
+
+        for (const auto* status : bucketStatuses)
+        {
+            if (!visitor(*status))
+                return;
+        }
+    }
+}
+
 void FollowsActivityStore::updateActivities()
 {
     const auto now = QDateTime::currentDateTimeUtc();
+    const qint64 nowTick = toTick(now);
+
+    if (nowTick <= mLastExpiryTick)
+        return;
+
+    // After a long pause all buckets are due, each needs to be checked once only.
+    const qint64 firstTick = std::max(mLastExpiryTick + 1, nowTick - WHEEL_SIZE + 1);
+    mLastExpiryTick = nowTick;
 
-    for (auto it = mActiveStatusSet.begin(); it != mActiveStatusSet.end(); )
+    for (qint64 tick = firstTick; tick <= nowTick; ++tick)
+        expireBucket(tick, now);
+}
+
+void FollowsActivityStore::expireBucket(qint64 tick, QDateTime now)
+{
+    std::unordered_set<ActivityStatus*> bucket;
+    bucket.swap(mWheel[tick % WHEEL_SIZE]);
+
+    for (auto* status : bucket)
     {
-        auto* status = *it;
+        mStatusExpiryTick.erase(status);
         status->updateActive(now);
 
-        if (!status->isActive())
-            it = mActiveStatusSet.erase(it);
-        else
-            break; // the remainder is newer and hence will stay active
+        // Activity time in the future (clock skew) gets checked again later.
+        if (status->isActive())
+            addToWheel(status);
     }
 }
 
+void FollowsActivityStore::addToWheel(ActivityStatus* status)
+{
+    const auto expiry = status->getLastActive().addMSecs(std::chrono::milliseconds(ActivityStatus::ACTIVE_INTERVAL).count());
+    qint64 tick = toTickCeil(expiry);
+    tick = std::clamp(tick, mLastExpiryTick + 1, mLastExpiryTick + WHEEL_SIZE);
+
+    mWheel[tick % WHEEL_SIZE].insert(status);
+    mStatusExpiryTick[status] = tick;
+}
+
+void FollowsActivityStore::removeFromWheel(ActivityStatus* status)
+{
+    auto it = mStatusExpiryTick.find(status);
+
+    if (it == mStatusExpiryTick.end())
+        return;
+
+    mWheel[it->second % WHEEL_SIZE].erase(status);
+    mStatusExpiryTick.erase(it);
+}
+
 void FollowsActivityStore::handleUnfollow(const QString& did)
 {
     auto it = mDidStatus.find(did);
@@ -96,7 +194,7 @@ void FollowsActivityStore::handleUnfollow(const QString& did)
 
     qDebug() << "Delete activity status:" << did;
     ActivityStatus* status = it->second;
-    mActiveStatusSet.erase(status);
+    removeFromWheel(status);
     status->deleteLater();
     mDidStatus.erase(it);
 }
@@ -104,13 +202,13 @@ void FollowsActivityStore::handleUnfollow(const QString& did)
 void FollowsActivityStore::pause()
 {
     qDebug() << "Pause";
-    mUpdateTimer.stop();
+    mPollScheduler.stopJob(mUpdateJob);
 }
 
 void FollowsActivityStore::resume()
 {
     qDebug() << "Resume";
-    mUpdateTimer.start(UPDATE_INTERVAL);
+    mPollScheduler.startJob(mUpdateJob);
 }
 
 }
@@ -3,9 +3,10 @@
 #pragma once
 #include "activity_status.h"
 #include "following.h"
+#include "poll_scheduler.h"
 #include "profile.h"
-#include <QTimer>
 #include <QObject>
+#include <unordered_set>
 
 namespace Skywalker {
 
@@ -14,7 +15,7 @@ class FollowsActivityStore : public QObject
     Q_OBJECT
 
 public:
-    explicit FollowsActivityStore(Following& following, QObject* parent = nullptr);
+    explicit FollowsActivityStore(Following& following, PollScheduler& pollScheduler, QObject* parent = nullptr);
     ~FollowsActivityStore();
 
     void clear();
@@ -24,21 +25,33 @@ public:
     // From newest to oldest activity
     std::vector<QString> getActiveFollowsDids() const;
 
+    // Visit the active follows from newest to oldest activity till the visitor
+    // returns false.
+    using ActivityVisitor = std::function<bool(const ActivityStatus&)>;
+    void forEachActiveFollow(const ActivityVisitor& visitor) const;
+
     void pause();
     void resume();
 
 private:
     void updateActivities();
+    void expireBucket(qint64 tick, QDateTime now);
+    void addToWheel(ActivityStatus* status);
+    void removeFromWheel(ActivityStatus* status);
     void handleUnfollow(const QString& did);
 
     Following& mFollowing;
+    PollScheduler& mPollScheduler;
     ActivityStatus mNotActiveStatus{"", this};
     std::unordered_map<QString, ActivityStatus*> mDidStatus;
 
-    // From oldest to newest activity
-    std::set<ActivityStatus*, ActiviyStatusPtrCmp> mActiveStatusSet;
+    // Timing wheel of active statuses. Each bucket holds the statuses that
+    // expire in the same tick. Only the buckets that are due get checked.
+    std::vector<std::unordered_set<ActivityStatus*>> mWheel;
+    std::unordered_map<ActivityStatus*, qint64> mStatusExpiryTick;
+    qint64 mLastExpiryTick = 0; // all buckets up to this tick are expired
 
-    QTimer mUpdateTimer;
+    PollScheduler::JobId mUpdateJob = 0;
     QMetaObject::Connection mUnfollowConnection;
 };
 
@@ -0,0 +1,117 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#include "gif_meta_data.h"
+#include <QDebug>
+#include <QFile>
+
+namespace Skywalker {
+
+static constexpr uchar EXTENSION_INTRODUCER = 0x21;
+static constexpr uchar GRAPHIC_CONTROL_LABEL = 0xF9;
+static constexpr uchar IMAGE_SEPARATOR = 0x2C;
+static constexpr uchar TRAILER = 0x3B;
+
+static int colorTableSize(uchar packedFields)
+{
+    return (packedFields & 0x80) ? 3 * (1 << ((packedFields & 0x07) + 1)) : 0;
+}
+
+static int readUInt16(QByteArrayView data, qsizetype pos)
+{
+    return uchar(data[pos]) | (uchar(data[pos + 1]) << 8);
+}
+
+// Returns the position after the sub-blocks starting at pos, or -1 if the
+// data ends before the block terminator.
+static qsizetype skipSubBlocks(QByteArrayView data, qsizetype pos)
+{
+    while (pos < data.size())
+    {
+        const uchar blockSize = data[pos];
+        pos += 1 + blockSize;
+
+        if (blockSize == 0)
+            return pos;
+    }
+
+    return -1;
+}
+
+bool GifMetaData::read(const QString& fileName)
+{
+    QFile file(fileName);
+
+    if (!file.open(QFile::ReadOnly))
+    {
+        qWarning() << "Cannot open:" << fileName;
+        return false;
+    }
+
+    const uchar* mapped = file.map(0, file.size());
+
+    if (mapped)
+        return parse(QByteArrayView(mapped, file.size()));
+
+    return parse(file.readAll());
+}
+
+bool GifMetaData::parse(QByteArrayView data)
+{
+    mFrameDelaysMs.clear();
+
+    if (data.size() < 13 || (!data.startsWith("GIF87a") && !data.startsWith("GIF89a")))
+    {
+        qWarning() << "Not a GIF";
+        return false;
+    }
+
+    // Logical screen descriptor
+    qsizetype pos = 13 + colorTableSize(data[10]);
+    int delayMs = 0;
+
+    while (pos >= 0 && pos < data.size())
+    {
+        const uchar blockType = data[pos];
+
+        if (blockType == TRAILER)
+            break;
+
+        if (blockType == EXTENSION_INTRODUCER)
+        {
+            if (pos + 1 >= data.size())
+                break;
+
+            const uchar label = data[pos + 1];
+
+            if (label == GRAPHIC_CONTROL_LABEL && pos + 6 < data.size())
+                delayMs = readUInt16(data, pos + 4) * 10;
+
+            pos = skipSubBlocks(data, pos + 2);
+        }
+        else if (blockType == IMAGE_SEPARATOR)
+        {
+            // Image descriptor, local color table, LZW minimum code size
+            if (pos + 10 >= data.size())
+                break;
+
+            pos += 10 + colorTableSize(data[pos + 9]) + 1;
+            pos = skipSubBlocks(data, pos);
+
+            if (pos < 0)
+                break;
+
+            mFrameDelaysMs.push_back(delayMs);
+            delayMs = 0;
+        }
+        else
+        {
+            qWarning() << "Unknown GIF block:" << blockType << "at:" << pos;
+            break;
+        }
+    }
+
+    qDebug() << "GIF frames:" << mFrameDelaysMs.size();
+    return !mFrameDelaysMs.empty();
+}
+
+}
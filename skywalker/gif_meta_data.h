@@ -0,0 +1,28 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <QByteArrayView>
+#include <QString>
+#include <vector>
+
+namespace Skywalker {
+
+// Reads the frame delays of a GIF from its block structure without decoding
+// any image data.
+class GifMetaData
+{
+public:
+    bool read(const QString& fileName);
+
+    // Returns false if the data is not a GIF or has no frames. A truncated
+    // GIF gives the frames found before the end of the data.
+    bool parse(QByteArrayView data);
+
+    int getFrameCount() const { return (int)mFrameDelaysMs.size(); }
+    const std::vector<int>& getFrameDelaysMs() const { return mFrameDelaysMs; }
+
+private:
+    std::vector<int> mFrameDelaysMs;
+};
+
+}
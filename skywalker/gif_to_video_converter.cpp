@@ -2,6 +2,7 @@
 // License: GPLv3
 #include "gif_to_video_converter.h"
 #include "file_utils.h"
+#include "gif_meta_data.h"
 #include "temp_file_holder.h"
 
 namespace Skywalker {
@@ -9,6 +10,10 @@ namespace Skywalker {
 constexpr int VIDEO_BIT_RATE_SD = 4'000'000;
 constexpr int VIDEO_BIT_RATE_HD = 8'000'000;
 
+// Maximum number of decoded frames waiting for the encoder. This bounds
+// the memory used when decoding is faster than encoding.
+constexpr size_t MAX_QUEUED_FRAMES = 8;
+
 void GifToVideoConverter::convert(const QString& gifFileName)
 {
     qDebug() << "Convert:" << gifFileName;
@@ -42,7 +47,18 @@ void GifToVideoConverter::convert(const QString& gifFileName)
     }
 
     qDebug() << "Frame count:" << mGif->frameCount();
-    const int fps = calcFps();
+    mFrameCount = mGif->frameCount();
+
+    GifMetaData metaData;
+
+    if (!metaData.read(gifFileName))
+    {
+        qWarning() << "Cannot read GIF meta data:" << gifFileName;
+        emit conversionFailed("Cannot read GIF");
+        return;
+    }
+
+    const int fps = calcFps(metaData.getFrameDelaysMs());
 
     if (fps < 0)
     {
@@ -141,55 +157,154 @@ void GifToVideoConverter::finished()
 bool GifToVideoConverter::pushFrames()
 {
     qDebug() << "Push frames to video encoder";
+    mFrameQueue.clear();
+    mDecodingDone = false;
+    mDecodingFailed = false;
+    mStopDecoding = false;
+
+    QThread* decoder = QThread::create([this]{ decodeFrames(); });
+
+    if (!decoder)
+    {
+        qWarning() << "Failed to start decoder thread";
+        return false;
+    }
+
+    decoder->start();
+    bool success = encodeFrames();
+    stopDecoding();
+    decoder->wait();
+    delete decoder;
+
+    if (mDecodingFailed)
+        success = false;
+
+    qDebug() << "Frames pushed:" << success;
+    return success;
+}
+
+void GifToVideoConverter::decodeFrames()
+{
     mGif->jumpToFrame(0);
-    const int frameCount = mGif->frameCount();
     int frameIndex = 0;
+    Frame pending;
+    int droppedFrames = 0;
 
     do {
-        qDebug() << "Push frame:" << frameIndex << "/" << frameCount << "next frame delay:" << mGif->nextFrameDelay();
-        QImage frame = mGif->currentImage();
+        if (mCanceled)
+            break;
+
+        QImage image = mGif->currentImage();
         const int frameDelayUs = mGif->nextFrameDelay() * 1000;
 
-        if (frame.isNull())
+        if (image.isNull())
         {
             qWarning() << "Failed to read frame:" << frameIndex;
-            return false;
+            QMutexLocker locker(&mQueueMutex);
+            mDecodingFailed = true;
+            break;
         }
 
-        frame.convertTo(QImage::Format_RGBA8888); // must match format in QVideoEncoder.java
+        image.convertTo(QImage::Format_RGBA8888); // must match format in QVideoEncoder.java
+
+        // A frame equal to the previous one extends the duration of the previous one.
+        if (!pending.mImage.isNull() && image == pending.mImage)
+        {
+            pending.mDurationUs += frameDelayUs;
+            ++droppedFrames;
+            continue;
+        }
+
+        if (!pending.mImage.isNull() && !enqueueFrame(std::move(pending)))
+            break;
+
+        pending = { image, frameDelayUs, frameIndex };
+    } while (mGif->jumpToNextFrame() && ++frameIndex <= mFrameCount);
+    // Frames start counting at zero still there is a frame at index frameCount.
+    // Seems frame 0 is not counted in the count??
+
+    if (!pending.mImage.isNull() && !mCanceled && !mDecodingFailed)
+        enqueueFrame(std::move(pending));
+
+    qDebug() << "All frames decoded, dropped duplicates:" << droppedFrames;
+    QMutexLocker locker(&mQueueMutex);
+    mDecodingDone = true;
+    mQueueNotEmpty.wakeAll();
+}
+
+bool GifToVideoConverter::encodeFrames()
+{
+    while (auto frame = dequeueFrame())
+    {
+        qDebug() << "Push frame:" << frame->mIndex << "/" << mFrameCount << "duration:" << frame->mDurationUs;
 
-        if (!mVideoEncoder->push(frame, frameDelayUs))
+        if (!mVideoEncoder->push(frame->mImage, frame->mDurationUs))
         {
-            qWarning() << "Failed to push frame to video enoder:" << frameIndex;
+            qWarning() << "Failed to push frame to video enoder:" << frame->mIndex;
             return false;
         }
 
-        emit conversionProgress(frameIndex / double(frameCount));
+        emit conversionProgress(frame->mIndex / double(mFrameCount));
 
         if (mCanceled)
         {
             qDebug() << "Canceled";
             return false;
         }
-    } while (mGif->jumpToNextFrame() && ++frameIndex <= frameCount);
-    // Frames start counting at zero still there is a frame at index frameCount.
-    // Seems frame 0 is not counted in the count??
+    }
+
+    return !mCanceled;
+}
+
+bool GifToVideoConverter::enqueueFrame(Frame frame)
+{
+    QMutexLocker locker(&mQueueMutex);
+
+    while (mFrameQueue.size() >= MAX_QUEUED_FRAMES && !mStopDecoding && !mCanceled)
+        mQueueNotFull.wait(&mQueueMutex);
 
-    qDebug() << "All frames pushed";
+    if (mStopDecoding || mCanceled)
+        return false;
+
+    mFrameQueue.push_back(std::move(frame));
+    mQueueNotEmpty.wakeAll();
     return true;
 }
 
-int GifToVideoConverter::calcFps()
+std::optional<GifToVideoConverter::Frame> GifToVideoConverter::dequeueFrame()
 {
-    mGif->jumpToFrame(0);
+    QMutexLocker locker(&mQueueMutex);
+
+    while (mFrameQueue.empty() && !mDecodingDone)
+        mQueueNotEmpty.wait(&mQueueMutex);
+
+    if (mFrameQueue.empty())
+        return {};
+
+    Frame frame = std::move(mFrameQueue.front());
+    mFrameQueue.pop_front();
+    mQueueNotFull.wakeAll();
+    return frame;
+}
+
+void GifToVideoConverter::stopDecoding()
+{
+    QMutexLocker locker(&mQueueMutex);
+    mStopDecoding = true;
+    mFrameQueue.clear();
+    mQueueNotFull.wakeAll();
+}
+
+int GifToVideoConverter::calcFps(const std::vector<int>& frameDelaysMs)
+{
+    // NOTE: fps is a hint to the video encoder. The average is taken over
+    // the frame delays from the GIF meta data.
     int totalMs = 0;
     int sampleCount = 0;
 
-    // NOTE: fps is a hint to the video encoder. We sample 25 frames to get
-    // an estimate of the average fps.
-    while (mGif->jumpToNextFrame() && mGif->currentFrameNumber() <= 25)
+    for (const int delayMs : frameDelaysMs)
     {
-        totalMs += mGif->nextFrameDelay();
+        totalMs += delayMs;
         ++sampleCount;
     }
 
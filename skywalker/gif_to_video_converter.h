@@ -4,13 +4,19 @@
 #include "video_encoder.h"
 #include <QAtomicInt>
 #include <QMovie>
+#include <QMutex>
 #include <QObject>
 #include <QTemporaryFile>
 #include <QThread>
+#include <QWaitCondition>
 #include <QtQmlIntegration>
+#include <deque>
+#include <optional>
 
 namespace Skywalker {
 
+// The GIF frames are decoded on one thread and encoded on another, with a
+// bounded queue of frames in between.
 class GifToVideoConverter : public QObject
 {
     Q_OBJECT
@@ -26,10 +32,22 @@ signals:
     void conversionProgress(double progress); // 0.0 => 1.0
 
 private:
+    struct Frame
+    {
+        QImage mImage;
+        int mDurationUs = 0;
+        int mIndex = 0;
+    };
+
     void startThread();
     void finished();
     bool pushFrames();
-    int calcFps();
+    void decodeFrames();
+    bool encodeFrames();
+    bool enqueueFrame(Frame frame);
+    std::optional<Frame> dequeueFrame();
+    void stopDecoding();
+    int calcFps(const std::vector<int>& frameDelaysMs);
 
     std::unique_ptr<VideoEncoder> mVideoEncoder;
     std::unique_ptr<QMovie> mGif;
@@ -37,6 +55,16 @@ private:
     QThread* mThread = nullptr;
     bool mConversionDone = false;
     QAtomicInteger<bool> mCanceled = false;
+    int mFrameCount = 0;
+
+    // Frames decoded and waiting to be encoded
+    QMutex mQueueMutex;
+    QWaitCondition mQueueNotEmpty;
+    QWaitCondition mQueueNotFull;
+    std::deque<Frame> mFrameQueue;
+    bool mDecodingDone = false;
+    bool mDecodingFailed = false;
+    bool mStopDecoding = false;
 };
 
 }
@@ -5,10 +5,12 @@
 #include "definitions.h"
 #include "graph_listener.h"
 #include "list_cache.h"
+#include "network_utils.h"
 #include "photo_picker.h"
 #include "skywalker.h"
 #include "verification_utils.h"
 #include <atproto/lib/at_uri.h>
+#include <QTimer>
 
 namespace Skywalker {
 
@@ -16,6 +18,13 @@ using namespace std::chrono_literals;
 
 static constexpr auto EXPIRY_CHECK_INTERVAL = 59s;
 
+// Users are added to a list with one applyWrites call per batch. A batch that
+// failed on a transient error is retried. As applyWrites is not idempotent, the
+// list members are fetched first to skip users that got added anyway.
+static constexpr int MAX_BATCH_LIST_USERS = 100;
+static constexpr int MAX_BATCH_RETRIES = 2;
+static constexpr auto BATCH_RETRY_DELAY = 2s;
+
 GraphUtils::GraphUtils(QObject* parent) :
     WrappedSkywalker(parent),
     Presence()
@@ -30,21 +39,50 @@ GraphUtils::GraphUtils(QObject* parent) :
                     mGraphMaster = nullptr;
                 });
     });
+}
 
-    connect(&mExpiryCheckTimer, &QTimer::timeout, this, [this]{ checkExpiry(); });
+GraphUtils::~GraphUtils()
+{
+    if (mPollScheduler)
+        mPollScheduler->removeJob(mExpiryCheckJob);
 }
 
 void GraphUtils::startExpiryCheckTimer()
 {
     qDebug() << "Start expiry check timer";
-    mExpiryCheckTimer.start(EXPIRY_CHECK_INTERVAL);
+
+    if (!mSkywalker)
+    {
+        qWarning() << "Skywalker not set";
+        return;
+    }
+
+    if (!mPollScheduler)
+    {
+        // Local job, no backoff as blocks and mutes should expire in time.
+        mPollScheduler = mSkywalker->getPollScheduler();
+        mExpiryCheckJob = mPollScheduler->addJob("expiry-check", EXPIRY_CHECK_INTERVAL, EXPIRY_CHECK_INTERVAL,
+            [this](const PollScheduler::DoneCb& done){
+                checkExpiry();
+                done(PollScheduler::Result::UNCHANGED);
+            });
+    }
+
+    mPollScheduler->startJob(mExpiryCheckJob);
     checkExpiry();
 }
 
 void GraphUtils::stopExpiryCheckTimer()
 {
     qDebug() << "Stop expiry check timer";
-    mExpiryCheckTimer.stop();
+
+    if (mPollScheduler)
+        mPollScheduler->stopJob(mExpiryCheckJob);
+}
+
+bool GraphUtils::isExpiryCheckActive() const
+{
+    return mPollScheduler && mPollScheduler->isJobActive(mExpiryCheckJob);
 }
 
 ATProto::GraphMaster* GraphUtils::graphMaster()
@@ -512,59 +550,64 @@ void GraphUtils::createListFromStarterPack(const StarterPackView& starterPack)
         });
 }
 
-void GraphUtils::continueCreateListFromStarterPack(const StarterPackView& starterPack, const QString &listUri, const QString& listCid, int maxPages, const std::optional<QString> cursor)
+void GraphUtils::continueCreateListFromStarterPack(const StarterPackView& starterPack, const QString &listUri, const QString& listCid,
+                                                   QStringList dids, int maxPages, const std::optional<QString> cursor)
 {
-    qDebug() << "Copy users from starter pack to list:" << starterPack.getName();
+    qDebug() << "Get users from starter pack:" << starterPack.getName() << "users:" << dids.size();
 
     if (maxPages <= 0)
     {
         qWarning() << "Max pages reached";
-        emit createdListFromStarterPackOk(starterPack, listUri, listCid);
+        addStarterPackUsersToList(starterPack, listUri, listCid, dids);
+        return;
     }
 
     bskyClient()->getList(starterPack.getList().getUri(), 100, cursor,
-        [this, presence=getPresence(), starterPack, listUri, listCid, maxPages](auto output){
+        [this, presence=getPresence(), starterPack, listUri, listCid, dids, maxPages](auto output){
             if (!presence)
                 return;
 
-            QStringList dids;
+            QStringList allDids = dids;
 
             for (const auto& item : output->mItems)
-                dids.push_back(item->mSubject->mDid);
+                allDids.push_back(item->mSubject->mDid);
 
-            if (dids.isEmpty())
+            if (!output->mCursor || output->mItems.empty())
             {
-                qDebug() << "Empty starter pack:" << starterPack.getName();
-                emit createdListFromStarterPackOk(starterPack, listUri, listCid);
+                addStarterPackUsersToList(starterPack, listUri, listCid, allDids);
                 return;
             }
 
-            qDebug() << "Users:" << dids.size();
+            continueCreateListFromStarterPack(starterPack, listUri, listCid, allDids, maxPages - 1, output->mCursor);
+        },
+        [this, presence=getPresence(), listUri](const QString& error, const QString& msg){
+            if (!presence)
+                return;
 
-            graphMaster()->batchAddUsersToList(listUri, dids,
-                [this, presence=getPresence(), starterPack, listUri, listCid, maxPages, nextCursor=output->mCursor]{
-                    if (!presence)
-                        return;
+            qDebug() << "Adding users from starter pack failed:" << error << " - " << msg;
+            deleteList(listUri);
+            emit createdListFromStarterPackFailed(msg);
+        });
+}
 
-                    qDebug() << "Users added to starter pack:" << starterPack.getName();
+void GraphUtils::addStarterPackUsersToList(const StarterPackView& starterPack, const QString &listUri, const QString& listCid, const QStringList& dids)
+{
+    if (dids.isEmpty())
+    {
+        qDebug() << "Empty starter pack:" << starterPack.getName();
+        emit createdListFromStarterPackOk(starterPack, listUri, listCid);
+        return;
+    }
 
-                    if (!nextCursor)
-                    {
-                        qDebug() << "All users added:" << starterPack.getName();
-                        emit createdListFromStarterPackOk(starterPack, listUri, listCid);
-                        return;
-                    }
+    qDebug() << "Copy users from starter pack to list:" << starterPack.getName() << "users:" << dids.size();
 
-                    continueCreateListFromStarterPack(starterPack, listUri, listCid, maxPages - 1, nextCursor);
-                },
-                [this, presence=getPresence(), listUri](const QString& error, const QString& msg){
-                    if (!presence)
-                        return;
+    batchAddUsersToList(listUri, dids,
+        [this, presence=getPresence(), starterPack, listUri, listCid]{
+            if (!presence)
+                return;
 
-                    qDebug() << "Adding users from starter pack failed:" << error << " - " << msg;
-                    deleteList(listUri);
-                    emit createdListFromStarterPackFailed(msg);
-                });
+            qDebug() << "All users added:" << starterPack.getName();
+            emit createdListFromStarterPackOk(starterPack, listUri, listCid);
         },
         [this, presence=getPresence(), listUri](const QString& error, const QString& msg){
             if (!presence)
@@ -573,6 +616,149 @@ void GraphUtils::continueCreateListFromStarterPack(const StarterPackView& starte
             qDebug() << "Adding users from starter pack failed:" << error << " - " << msg;
             deleteList(listUri);
             emit createdListFromStarterPackFailed(msg);
+        },
+        [this, presence=getPresence()](int done, int total){
+            if (!presence)
+                return;
+
+            emit createdListFromStarterPackProgress(tr("Added %1 of %2 users").arg(done).arg(total));
+        });
+}
+
+QStringList GraphUtils::getListUsersBatch(const QStringList& dids, int offset, const QSet<QString>& memberDids)
+{
+    QStringList batch;
+
+    for (const auto& did : dids.mid(offset, MAX_BATCH_LIST_USERS))
+    {
+        if (!memberDids.contains(did))
+            batch.push_back(did);
+    }
+
+    return batch;
+}
+
+bool GraphUtils::canRetryListUsersBatch(const QString& error, int attempt)
+{
+    return attempt < MAX_BATCH_RETRIES && NetworkUtils::isTransientXrpcError(error);
+}
+
+void GraphUtils::batchAddUsersToList(const QString& listUri, const QStringList& dids,
+                                     const std::function<void()>& successCb, const ErrorCb& errorCb,
+                                     const BatchProgressCb& progressCb, int offset, int attempt,
+                                     const QSet<QString>& memberDids)
+{
+    if (offset >= dids.size())
+    {
+        successCb();
+        return;
+    }
+
+    if (!graphMaster())
+    {
+        errorCb("Error", tr("Not connected"));
+        return;
+    }
+
+    const int done = std::min(offset + MAX_BATCH_LIST_USERS, (int)dids.size());
+    const QStringList batch = getListUsersBatch(dids, offset, memberDids);
+    qDebug() << "Add users to list:" << listUri << "offset:" << offset << "batch:" << batch.size() << "attempt:" << attempt;
+
+    if (batch.empty())
+    {
+        qDebug() << "All users in batch are member already";
+        progressCb(done, (int)dids.size());
+        batchAddUsersToList(listUri, dids, successCb, errorCb, progressCb, done);
+        return;
+    }
+
+    graphMaster()->batchAddUsersToList(listUri, batch,
+        [this, presence=getPresence(), listUri, dids, successCb, errorCb, progressCb, done]{
+            if (!presence)
+                return;
+
+            progressCb(done, (int)dids.size());
+            batchAddUsersToList(listUri, dids, successCb, errorCb, progressCb, done);
+        },
+        [this, presence=getPresence(), listUri, dids, successCb, errorCb, progressCb, offset, attempt](const QString& error, const QString& msg){
+            if (!presence)
+                return;
+
+            qDebug() << "Add users to list failed:" << listUri << "offset:" << offset << error << " - " << msg;
+
+            if (!canRetryListUsersBatch(error, attempt))
+            {
+                errorCb(error, msg);
+                return;
+            }
+
+            retryBatchAddUsersToList(listUri, dids, successCb, errorCb, progressCb, offset, attempt + 1);
+        });
+}
+
+void GraphUtils::retryBatchAddUsersToList(const QString& listUri, const QStringList& dids,
+                                          const std::function<void()>& successCb, const ErrorCb& errorCb,
+                                          const BatchProgressCb& progressCb, int offset, int attempt)
+{
+    QTimer::singleShot(BATCH_RETRY_DELAY * attempt, this,
+        [this, presence=getPresence(), listUri, dids, successCb, errorCb, progressCb, offset, attempt]{
+            if (!presence)
+                return;
+
+            // The failed batch may have been added, e.g. when the response timed out.
+            getListMemberDids(listUri,
+                [this, presence, listUri, dids, successCb, errorCb, progressCb, offset, attempt](QSet<QString> memberDids){
+                    if (presence)
+                        batchAddUsersToList(listUri, dids, successCb, errorCb, progressCb, offset, attempt, memberDids);
+                },
+                [this, presence, listUri, dids, successCb, errorCb, progressCb, offset, attempt](const QString& error, const QString& msg){
+                    if (!presence)
+                        return;
+
+                    qDebug() << "Get list members failed:" << listUri << error << " - " << msg;
+
+                    if (!canRetryListUsersBatch(error, attempt))
+                    {
+                        errorCb(error, msg);
+                        return;
+                    }
+
+                    retryBatchAddUsersToList(listUri, dids, successCb, errorCb, progressCb, offset, attempt + 1);
+                });
+        });
+}
+
+void GraphUtils::getListMemberDids(const QString& listUri, const std::function<void(QSet<QString>)>& successCb,
+                                   const ErrorCb& errorCb, QSet<QString> memberDids,
+                                   int maxPages, const std::optional<QString>& cursor)
+{
+    if (!bskyClient())
+    {
+        errorCb("Error", tr("Not connected"));
+        return;
+    }
+
+    bskyClient()->getList(listUri, 100, cursor,
+        [this, presence=getPresence(), listUri, successCb, errorCb, memberDids, maxPages](auto output){
+            if (!presence)
+                return;
+
+            QSet<QString> allDids = memberDids;
+
+            for (const auto& item : output->mItems)
+                allDids.insert(item->mSubject->mDid);
+
+            if (!output->mCursor || output->mItems.empty() || maxPages <= 1)
+            {
+                successCb(allDids);
+                return;
+            }
+
+            getListMemberDids(listUri, successCb, errorCb, allDids, maxPages - 1, output->mCursor);
+        },
+        [presence=getPresence(), errorCb](const QString& error, const QString& msg){
+            if (presence)
+                errorCb(error, msg);
         });
 }
 
@@ -1281,7 +1467,7 @@ void GraphUtils::expireBlocks()
 {
     qDebug() << "Check blocks expiry";
 
-    if (!mExpiryCheckTimer.isActive())
+    if (!isExpiryCheckActive())
     {
         qDebug() << "Expiry check is not active";
         return;
@@ -1318,7 +1504,7 @@ void GraphUtils::expireMutes()
 {
     qDebug() << "Check mutes expiry";
 
-    if (!mExpiryCheckTimer.isActive())
+    if (!isExpiryCheckActive())
     {
         qDebug() << "Expiry check is not active";
         return;
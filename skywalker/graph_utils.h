@@ -6,9 +6,11 @@
 #include "presence.h"
 #include "starter_pack.h"
 #include "named_link.h"
+#include "poll_scheduler.h"
 #include "wrapped_skywalker.h"
 #include <atproto/lib/graph_master.h>
-#include <QTimer>
+#include <QPointer>
+#include <QSet>
 
 namespace Skywalker {
 
@@ -22,8 +24,10 @@ class GraphUtils : public WrappedSkywalker, public Presence
 public:
     using ListSuccessCb = std::function<void(const QString& uri, const QString& cid)>;
     using ErrorCb = std::function<void(const QString& error, const QString& message)>;
+    using BatchProgressCb = std::function<void(int done, int total)>;
 
     explicit GraphUtils(QObject* parent = nullptr);
+    ~GraphUtils();
 
     Q_INVOKABLE void follow(const BasicProfile& profile);
     Q_INVOKABLE void unfollow(const QString& did, const QString& followingUri);
@@ -80,6 +84,12 @@ public:
     // Check if a list is a list internally used by Skywalker
     static bool isInternalList(const ATProto::AppBskyGraph::ListView& listView);
 
+    // The users to add in the batch at offset. Users that are already a member are skipped.
+    static QStringList getListUsersBatch(const QStringList& dids, int offset, const QSet<QString>& memberDids = {});
+
+    // A failed batch is retried on transient errors only.
+    static bool canRetryListUsersBatch(const QString& error, int attempt);
+
     void startExpiryCheckTimer();
     void stopExpiryCheckTimer();
 
@@ -108,6 +118,7 @@ signals:
     void updateListFailed(QString error);
     void deleteListOk();
     void deleteListFailed(QString error);
+    void createdListFromStarterPackProgress(QString msg);
     void createdListFromStarterPackOk(StarterPackView starterPack, QString listUri, QString listCid);
     void createdListFromStarterPackFailed(QString error);
     void getListOk(QString userDid, ListView list, bool viewPosts);
@@ -145,13 +156,27 @@ private:
     void continueUpdateList(const QString& listUri, const QString& name,
                             const QString& description, const NamedLink::List& embeddedLinks,
                             ATProto::Blob::SharedPtr blob, bool updateAvatar);
-    void continueCreateListFromStarterPack(const StarterPackView& starterPack, const QString &listUri, const QString& listCid, int maxPages = 3, const std::optional<QString> cursor = {});
+    void continueCreateListFromStarterPack(const StarterPackView& starterPack, const QString &listUri, const QString& listCid,
+                                           QStringList dids = {}, int maxPages = 3, const std::optional<QString> cursor = {});
+    void addStarterPackUsersToList(const StarterPackView& starterPack, const QString &listUri, const QString& listCid, const QStringList& dids);
+    void batchAddUsersToList(const QString& listUri, const QStringList& dids,
+                             const std::function<void()>& successCb, const ErrorCb& errorCb,
+                             const BatchProgressCb& progressCb, int offset = 0, int attempt = 0,
+                             const QSet<QString>& memberDids = {});
+    void retryBatchAddUsersToList(const QString& listUri, const QStringList& dids,
+                                  const std::function<void()>& successCb, const ErrorCb& errorCb,
+                                  const BatchProgressCb& progressCb, int offset, int attempt);
+    void getListMemberDids(const QString& listUri, const std::function<void(QSet<QString>)>& successCb,
+                           const ErrorCb& errorCb, QSet<QString> memberDids = {},
+                           int maxPages = 50, const std::optional<QString>& cursor = {});
     void expireBlocks();
     void expireMutes();
     void checkExpiry();
+    bool isExpiryCheckActive() const;
 
     std::unique_ptr<ATProto::GraphMaster> mGraphMaster;
-    QTimer mExpiryCheckTimer;
+    QPointer<PollScheduler> mPollScheduler; // owned by Skywalker, which may be deleted first
+    PollScheduler::JobId mExpiryCheckJob = 0;
     bool mBlockBusy = false;
     bool mMuteBusy = false;
 };
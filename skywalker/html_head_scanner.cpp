@@ -0,0 +1,367 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#include "html_head_scanner.h"
+#include <QDebug>
+
+namespace Skywalker {
+
+// An unfinished tag that grows beyond this size is not a real tag, e.g. a
+// stray '<' or an unbalanced quote.
+static constexpr qsizetype MAX_TAG_SIZE = 16 * 1024;
+
+static constexpr int RANK_OG = 3;
+static constexpr int RANK_TWITTER = 2;
+static constexpr int RANK_PLAIN = 1;
+
+static bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+static bool startsWithNoCase(QByteArrayView data, QByteArrayView prefix)
+{
+    return data.size() >= prefix.size() && data.first(prefix.size()).compare(prefix, Qt::CaseInsensitive) == 0;
+}
+
+// Returns the position of the '>' that ends the tag starting at 'from', or -1
+// if the tag is not complete. A '>' inside a quoted attribute value does not
+// end the tag.
+static qsizetype findTagEnd(const QByteArray& data, qsizetype from)
+{
+    char quote = 0;
+    char prev = 0;
+
+    for (qsizetype i = from; i < data.size(); ++i)
+    {
+        const char c = data[i];
+
+        if (quote)
+        {
+            if (c == quote)
+                quote = 0;
+        }
+        else if (c == '>')
+        {
+            return i;
+        }
+        else if ((c == '"' || c == '\'') && prev == '=')
+        {
+            quote = c;
+        }
+
+        if (!isSpace(c))
+            prev = c;
+    }
+
+    return -1;
+}
+
+// Finds a closing tag like "</script" without regard to case.
+static qsizetype findClosingTag(const QByteArray& data, QByteArrayView closingTag, qsizetype from)
+{
+    for (qsizetype i = data.indexOf("</", from); i >= 0; i = data.indexOf("</", i + 2))
+    {
+        if (startsWithNoCase(QByteArrayView(data).sliced(i), closingTag))
+            return i;
+    }
+
+    return -1;
+}
+
+static QByteArrayView getTagName(QByteArrayView tag, qsizetype& end)
+{
+    end = 0;
+
+    while (end < tag.size() && !isSpace(tag[end]) && tag[end] != '/')
+        ++end;
+
+    return tag.first(end);
+}
+
+// Calls attributeCb(name, value) for each attribute.
+template<typename AttributeCb>
+static void forEachAttribute(QByteArrayView attributes, AttributeCb attributeCb)
+{
+    qsizetype i = 0;
+    const qsizetype size = attributes.size();
+
+    while (i < size)
+    {
+        while (i < size && (isSpace(attributes[i]) || attributes[i] == '/'))
+            ++i;
+
+        const qsizetype nameStart = i;
+
+        while (i < size && !isSpace(attributes[i]) && attributes[i] != '=' && attributes[i] != '/')
+            ++i;
+
+        const QByteArrayView name = attributes.sliced(nameStart, i - nameStart);
+
+        while (i < size && isSpace(attributes[i]))
+            ++i;
+
+        QByteArrayView value;
+
+        if (i < size && attributes[i] == '=')
+        {
+            ++i;
+
+            while (i < size && isSpace(attributes[i]))
+                ++i;
+
+            if (i < size && (attributes[i] == '"' || attributes[i] == '\''))
+            {
+                const char quote = attributes[i++];
+                const qsizetype valueStart = i;
+
+                while (i < size && attributes[i] != quote)
+                    ++i;
+
+                value = attributes.sliced(valueStart, i - valueStart);
+                ++i;
+            }
+            else
+            {
+                const qsizetype valueStart = i;
+
+                while (i < size && !isSpace(attributes[i]))
+                    ++i;
+
+                value = attributes.sliced(valueStart, i - valueStart);
+            }
+        }
+
+        if (!name.isEmpty())
+            attributeCb(name, value);
+    }
+}
+
+void HtmlHeadScanner::addData(const QByteArray& data)
+{
+    if (mHeadComplete)
+        return;
+
+    mBytesScanned += data.size();
+    mBuffer.append(data);
+    scan();
+}
+
+void HtmlHeadScanner::clear()
+{
+    *this = HtmlHeadScanner{};
+}
+
+QString HtmlHeadScanner::getHtmlTitle() const
+{
+    return QString::fromUtf8(mHtmlTitle).trimmed();
+}
+
+void HtmlHeadScanner::scan()
+{
+    qsizetype pos = 0;
+
+    while (!mHeadComplete && pos < mBuffer.size())
+    {
+        if (!mRawTextEnd.isEmpty())
+        {
+            const qsizetype end = findClosingTag(mBuffer, mRawTextEnd, pos);
+
+            if (end < 0)
+            {
+                // Keep the tail as it may hold the start of the closing tag.
+                pos = std::max(pos, mBuffer.size() - mRawTextEnd.size() + 1);
+                break;
+            }
+
+            mRawTextEnd.clear();
+            pos = end;
+        }
+
+        const qsizetype start = mBuffer.indexOf('<', pos);
+
+        if (start < 0)
+        {
+            if (mInTitle)
+                mHtmlTitle.append(QByteArrayView(mBuffer).sliced(pos));
+
+            pos = mBuffer.size();
+            break;
+        }
+
+        if (mInTitle)
+            mHtmlTitle.append(QByteArrayView(mBuffer).sliced(pos, start - pos));
+
+        const QByteArrayView rest = QByteArrayView(mBuffer).sliced(start);
+
+        // Wait for more data to tell if this is a comment.
+        if (rest.size() < 4 && QByteArrayView("<!--").startsWith(rest))
+        {
+            pos = start;
+            break;
+        }
+
+        if (rest.startsWith("<!--"))
+        {
+            const qsizetype end = mBuffer.indexOf("-->", start + 4);
+
+            if (end < 0)
+            {
+                pos = start;
+                break;
+            }
+
+            pos = end + 3;
+            continue;
+        }
+
+        const qsizetype end = findTagEnd(mBuffer, start + 1);
+
+        if (end < 0)
+        {
+            if (mBuffer.size() - start > MAX_TAG_SIZE)
+            {
+                qDebug() << "Tag too long, skip:" << mBuffer.mid(start, 32);
+                pos = start + 1;
+                continue;
+            }
+
+            pos = start;
+            break;
+        }
+
+        handleTag(QByteArrayView(mBuffer).sliced(start + 1, end - start - 1));
+        pos = end + 1;
+    }
+
+    if (mHeadComplete)
+        mBuffer.clear();
+    else
+        mBuffer.remove(0, pos);
+}
+
+void HtmlHeadScanner::handleTag(QByteArrayView tag)
+{
+    if (tag.isEmpty())
+        return;
+
+    if (tag[0] == '/')
+    {
+        qsizetype nameEnd;
+        const QByteArrayView name = getTagName(tag.sliced(1), nameEnd);
+
+        if (name.compare("head", Qt::CaseInsensitive) == 0)
+        {
+            mHeadComplete = true;
+        }
+        else if (name.compare("title", Qt::CaseInsensitive) == 0 && mInTitle)
+        {
+            mInTitle = false;
+            mHtmlTitleComplete = true;
+        }
+
+        return;
+    }
+
+    qsizetype nameEnd;
+    const QByteArrayView name = getTagName(tag, nameEnd);
+    const QByteArrayView attributes = tag.sliced(nameEnd);
+
+    if (name.compare("meta", Qt::CaseInsensitive) == 0)
+    {
+        handleMetaTag(attributes);
+    }
+    else if (name.compare("link", Qt::CaseInsensitive) == 0)
+    {
+        handleLinkTag(attributes);
+    }
+    else if (name.compare("title", Qt::CaseInsensitive) == 0)
+    {
+        if (!mHtmlTitleComplete)
+            mInTitle = true;
+    }
+    else if (name.compare("script", Qt::CaseInsensitive) == 0 || name.compare("style", Qt::CaseInsensitive) == 0)
+    {
+        if (!tag.endsWith('/'))
+            mRawTextEnd = "</" + name.toByteArray();
+    }
+    else if (name.compare("body", Qt::CaseInsensitive) == 0)
+    {
+        mHeadComplete = true;
+    }
+}
+
+void HtmlHeadScanner::handleMetaTag(QByteArrayView attributes)
+{
+    QByteArray property;
+    QByteArrayView content;
+    bool hasContent = false;
+
+    forEachAttribute(attributes, [&](QByteArrayView name, QByteArrayView value){
+        if (name.compare("content", Qt::CaseInsensitive) == 0)
+        {
+            content = value;
+            hasContent = true;
+        }
+        else if (property.isEmpty() &&
+                 (name.compare("property", Qt::CaseInsensitive) == 0 || name.compare("name", Qt::CaseInsensitive) == 0))
+        {
+            property = value.toByteArray().toLower();
+        }
+    });
+
+    if (property.isEmpty() || !hasContent || content.isEmpty())
+        return;
+
+    int rank = RANK_PLAIN;
+    QByteArrayView key(property);
+
+    if (key.startsWith("og:"))
+    {
+        rank = RANK_OG;
+        key = key.sliced(3);
+    }
+    else if (key.startsWith("twitter:"))
+    {
+        rank = RANK_TWITTER;
+        key = key.sliced(8);
+    }
+
+    if (key == "title")
+        setMetaValue(mTitle, QString::fromUtf8(content), rank);
+    else if (key == "description")
+        setMetaValue(mDescription, QString::fromUtf8(content), rank);
+    else if (key == "image")
+        setMetaValue(mImage, QString::fromUtf8(content), rank);
+}
+
+void HtmlHeadScanner::handleLinkTag(QByteArrayView attributes)
+{
+    QByteArrayView rel;
+    QByteArrayView href;
+
+    forEachAttribute(attributes, [&](QByteArrayView name, QByteArrayView value){
+        if (name.compare("rel", Qt::CaseInsensitive) == 0)
+            rel = value;
+        else if (name.compare("href", Qt::CaseInsensitive) == 0)
+            href = value;
+    });
+
+    if (href.isEmpty())
+        return;
+
+    if (rel == "site.standard.document" && mStandardSiteDocument.isEmpty())
+        mStandardSiteDocument = QString::fromUtf8(href);
+    else if (rel == "site.standard.publication" && mStandardSitePublication.isEmpty())
+        mStandardSitePublication = QString::fromUtf8(href);
+}
+
+void HtmlHeadScanner::setMetaValue(MetaValue& meta, const QString& value, int rank)
+{
+    if (rank <= meta.mRank)
+        return;
+
+    meta.mValue = value;
+    meta.mRank = rank;
+}
+
+}
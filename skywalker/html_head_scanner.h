@@ -0,0 +1,67 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <QByteArray>
+#include <QString>
+
+namespace Skywalker {
+
+// Collects the link card meta data from the head of an HTML document in a
+// single pass. The document can be added in chunks as it is downloaded.
+// Once the head is complete, the rest of the document is not needed.
+//
+// Values are returned as they appear in the document, HTML entities are not
+// decoded.
+class HtmlHeadScanner
+{
+public:
+    void addData(const QByteArray& data);
+    void clear();
+
+    // True when </head> or <body> has been seen.
+    bool isHeadComplete() const { return mHeadComplete; }
+    qint64 getBytesScanned() const { return mBytesScanned; }
+
+    // From og:, twitter: or plain meta tags, in that order of preference.
+    const QString& getTitle() const { return mTitle.mValue; }
+    const QString& getDescription() const { return mDescription.mValue; }
+    const QString& getImage() const { return mImage.mValue; }
+
+    // From the <title> element
+    QString getHtmlTitle() const;
+
+    const QString& getStandardSiteDocument() const { return mStandardSiteDocument; }
+    const QString& getStandardSitePublication() const { return mStandardSitePublication; }
+
+private:
+    struct MetaValue
+    {
+        QString mValue;
+        int mRank = 0; // 0 = not set
+    };
+
+    void scan();
+    void handleTag(QByteArrayView tag);
+    void handleMetaTag(QByteArrayView attributes);
+    void handleLinkTag(QByteArrayView attributes);
+    static void setMetaValue(MetaValue& meta, const QString& value, int rank);
+
+    QByteArray mBuffer;
+    qint64 mBytesScanned = 0;
+    bool mHeadComplete = false;
+
+    // Closing tag of a script or style element. Its content is skipped.
+    QByteArray mRawTextEnd;
+
+    bool mInTitle = false;
+    bool mHtmlTitleComplete = false;
+    QByteArray mHtmlTitle;
+
+    MetaValue mTitle;
+    MetaValue mDescription;
+    MetaValue mImage;
+    QString mStandardSiteDocument;
+    QString mStandardSitePublication;
+};
+
+}
@@ -0,0 +1,152 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#include "image_blob_preparer.h"
+#include "file_utils.h"
+#include "photo_picker.h"
+
+namespace Skywalker {
+
+// Each image being prepared holds a fully decoded photo in memory. Limit the
+// number of images prepared at the same time.
+static constexpr int MAX_THREADS = 2;
+
+QThreadPool* ImageBlobPreparer::threadPool()
+{
+    static QThreadPool* pool = []{
+        auto* p = new QThreadPool;
+        p->setMaxThreadCount(MAX_THREADS);
+        p->setThreadPriority(QThread::LowPriority);
+        return p;
+    }();
+
+    return pool;
+}
+
+ImageBlobPreparer::ImageBlobPreparer(QObject* parent) :
+    QObject(parent)
+{
+}
+
+ImageBlobPreparer::~ImageBlobPreparer()
+{
+    cancel();
+}
+
+void ImageBlobPreparer::prepare(const QStringList& imgNames, int maxBytes)
+{
+    qDebug() << "Prepare images:" << imgNames.size() << "maxBytes:" << maxBytes;
+    cancel();
+
+    mBlobs.clear();
+    mBlobs.resize(imgNames.size());
+    mBlobCbs.clear();
+    mCanceled = std::make_shared<std::atomic_bool>(false);
+
+    // The permission check is done here as it may need the GUI thread on Android.
+    const bool readPermission = FileUtils::checkReadMediaPermission();
+
+    for (int i = 0; i < imgNames.size(); ++i)
+    {
+        const QString& imgName = imgNames[i];
+
+        if (imgName.startsWith("file://") && !readPermission)
+        {
+            qWarning() << "No permission to read:" << imgName;
+            handleDone(i, {});
+            continue;
+        }
+
+        auto* runnable = new ImageBlobProcessor(imgName, i, maxBytes, mCanceled);
+        connect(runnable, &ImageBlobProcessor::done, this,
+                [this, canceled=mCanceled](int index, QByteArray data, QString mimeType, QSize size){
+                    if (!*canceled)
+                        handleDone(index, { data, mimeType, size });
+                });
+        threadPool()->start(runnable);
+    }
+}
+
+void ImageBlobPreparer::cancel()
+{
+    if (mCanceled)
+    {
+        *mCanceled = true;
+        mCanceled = nullptr;
+    }
+}
+
+void ImageBlobPreparer::getBlob(int index, const BlobCb& blobCb)
+{
+    Q_ASSERT(index >= 0 && index < (int)mBlobs.size());
+
+    if (index < 0 || index >= (int)mBlobs.size())
+    {
+        blobCb({});
+        return;
+    }
+
+    if (mBlobs[index])
+    {
+        // Release the memory of the blob once it has been handed out.
+        const Blob blob = std::move(*mBlobs[index]);
+        mBlobs[index] = Blob{};
+        blobCb(blob);
+        return;
+    }
+
+    mBlobCbs[index] = blobCb;
+}
+
+void ImageBlobPreparer::handleDone(int index, Blob blob)
+{
+    qDebug() << "Image prepared:" << index << "bytes:" << blob.mData.size();
+    auto it = mBlobCbs.find(index);
+
+    if (it == mBlobCbs.end())
+    {
+        mBlobs[index] = std::move(blob);
+        return;
+    }
+
+    const BlobCb blobCb = std::move(it->second);
+    mBlobCbs.erase(it);
+    mBlobs[index] = Blob{};
+    blobCb(blob);
+}
+
+ImageBlobProcessor::ImageBlobProcessor(const QString& imgName, int index, int maxBytes,
+                                       std::shared_ptr<std::atomic_bool> canceled) :
+    mImgName(imgName),
+    mIndex(index),
+    mMaxBytes(maxBytes),
+    mCanceled(std::move(canceled))
+{
+}
+
+void ImageBlobProcessor::run()
+{
+    if (*mCanceled)
+    {
+        qDebug() << "Image preparation canceled:" << mImgName;
+        return;
+    }
+
+    const QImage img = PhotoPicker::loadImage(mImgName, false);
+
+    if (*mCanceled)
+    {
+        qDebug() << "Image preparation canceled:" << mImgName;
+        return;
+    }
+
+    QByteArray data;
+    QString mimeType;
+    QSize size;
+
+    if (!img.isNull())
+        std::tie(mimeType, size) = PhotoPicker::createBlob(data, mMaxBytes, img, { "png", "webp" }, mImgName);
+
+    emit done(mIndex, data, mimeType, size);
+}
+
+}
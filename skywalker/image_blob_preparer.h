@@ -0,0 +1,76 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <QImage>
+#include <QObject>
+#include <QRunnable>
+#include <QThreadPool>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+namespace Skywalker {
+
+// Prepares image blobs for uploading on worker threads. Loading, scaling and
+// encoding large photos takes too long to do on the GUI thread.
+// All images are prepared up front, such that the next image is encoded
+// while the previous one is uploading.
+class ImageBlobPreparer : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Blob
+    {
+        QByteArray mData;
+        QString mMimeType;
+        QSize mSize;
+    };
+
+    using BlobCb = std::function<void(const Blob&)>;
+
+    explicit ImageBlobPreparer(QObject* parent = nullptr);
+
+    // Cancels the preparation of images not prepared yet.
+    ~ImageBlobPreparer();
+
+    // imgNames are "file://..." or "image://..."
+    void prepare(const QStringList& imgNames, int maxBytes);
+    void cancel();
+
+    // Calls blobCb as soon as the image at index is prepared. The blob is
+    // empty if the image could not be loaded.
+    void getBlob(int index, const BlobCb& blobCb);
+
+private:
+    void handleDone(int index, Blob blob);
+
+    // Not set while the image is being prepared.
+    std::vector<std::optional<Blob>> mBlobs;
+    std::unordered_map<int, BlobCb> mBlobCbs; // index -> callback
+    std::shared_ptr<std::atomic_bool> mCanceled;
+
+    static QThreadPool* threadPool();
+};
+
+class ImageBlobProcessor : public QObject, public QRunnable
+{
+    Q_OBJECT
+
+public:
+    ImageBlobProcessor(const QString& imgName, int index, int maxBytes, std::shared_ptr<std::atomic_bool> canceled);
+    void run() override;
+
+signals:
+    void done(int index, QByteArray data, QString mimeType, QSize size);
+
+private:
+    QString mImgName;
+    int mIndex;
+    int mMaxBytes;
+    std::shared_ptr<std::atomic_bool> mCanceled;
+};
+
+}
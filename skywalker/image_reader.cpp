@@ -1,6 +1,7 @@
 // Copyright (C) 2023 Michel de Boer
 // License: GPLv3
 #include "image_reader.h"
+#include "file_utils.h"
 #include "photo_picker.h"
 #include <QImageReader>
 
@@ -27,12 +28,22 @@ bool ImageReader::getImage(const QString& urlString, const ImageCb& imageCb, con
 
     if (urlString.startsWith("file://") || urlString.startsWith("image://"))
     {
-        auto img = PhotoPicker::loadImage(urlString);
-
-        if (!img.isNull())
-            imageCb(img);
-        else
+        // The permission check may need the GUI thread.
+        if (urlString.startsWith("file://") && !FileUtils::checkReadMediaPermission())
+        {
+            qWarning() << "No permission to read:" << urlString;
             errorCb("Failed to load image");
+            return true;
+        }
+
+        mImageWorker.run<QImage>(
+            [urlString]{ return PhotoPicker::loadImage(urlString, false); },
+            [imageCb, errorCb](QImage img){
+                if (!img.isNull())
+                    imageCb(img);
+                else
+                    errorCb("Failed to load image");
+            });
 
         return true;
     }
@@ -1,6 +1,7 @@
 // Copyright (C) 2023 Michel de Boer
 // License: GPLv3
 #pragma once
+#include "image_worker.h"
 #include <QImage>
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
@@ -18,6 +19,7 @@ public:
     explicit ImageReader(QNetworkAccessManager* network, QObject* parent = nullptr);
 
     // Gets file:// image:// http:// https:// images
+    // Local images are loaded on a worker thread.
     bool getImage(const QString& urlString, const ImageCb& imageCb, const ErrorCb& errorCb);
 
     bool getImageFromWeb(const QString& urlString, const ImageAndFormatCb& imageCb, const ErrorCb& errorCb);
@@ -26,6 +28,7 @@ private:
     void replyFinished(QNetworkReply* reply, const ImageAndFormatCb& imageCb, const ErrorCb& errorCb);
 
     QNetworkAccessManager* mNetwork;
+    ImageWorker mImageWorker;
 };
 
 }
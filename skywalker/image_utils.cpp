@@ -78,8 +78,11 @@ QSize ImageUtils::getImageSize(const QString& filePath)
 
 ATProto::AppBskyEmbed::AspectRatio::SharedPtr ImageUtils::getImageAspectRatio(const QString& filePath, QSize defaultSize)
 {
-    auto size = getImageSize(filePath);
+    return makeAspectRatio(getImageSize(filePath), defaultSize);
+}
 
+ATProto::AppBskyEmbed::AspectRatio::SharedPtr ImageUtils::makeAspectRatio(QSize size, QSize defaultSize)
+{
     if (!size.isValid())
         size = defaultSize;
 
@@ -300,7 +303,13 @@ Q_INVOKABLE QString ImageUtils::transformImage(const QString& imgSource, bool ho
         return imgSource;
     }
 
-    QImage img = PhotoPicker::loadImage(imgSource);
+    auto* imgProvider = SharedImageProvider::getProvider(SharedImageProvider::SHARED_IMAGE);
+
+    // Take the image out of the provider, such that it can be mirrored in
+    // place without copying.
+    QImage img = imgSource.startsWith("image://") ?
+                     imgProvider->takeImage(imgSource) :
+                     PhotoPicker::loadImage(imgSource);
 
     if (img.isNull())
     {
@@ -311,18 +320,18 @@ Q_INVOKABLE QString ImageUtils::transformImage(const QString& imgSource, bool ho
     if (horMirror)
     {
 #if QT_VERSION < QT_VERSION_CHECK(6, 9, 0)
-        img = img.mirrored(true, false);
+        img.mirror(true, false);
 #else
-        img = img.flipped(Qt::Horizontal);
+        img.flip(Qt::Horizontal);
 #endif
     }
 
     if (vertMirror)
     {
 #if QT_VERSION < QT_VERSION_CHECK(6, 9, 0)
-        img = img.mirrored(false, true);
+        img.mirror(false, true);
 #else
-        img = img.flipped(Qt::Vertical);
+        img.flip(Qt::Vertical);
 #endif
     }
 
@@ -332,12 +341,7 @@ Q_INVOKABLE QString ImageUtils::transformImage(const QString& imgSource, bool ho
     if (!cutRect.isEmpty())
         img = img.copy(cutRect);
 
-    auto* imgProvider = SharedImageProvider::getProvider(SharedImageProvider::SHARED_IMAGE);
-
-    if (imgSource.startsWith("image://"))
-        imgProvider->removeImage(imgSource);
-
-    const QString newSource = imgProvider->addImage(img);
+    const QString newSource = imgProvider->addImage(std::move(img));
     qDebug() << "New image source:" << newSource;
     return newSource;
 }
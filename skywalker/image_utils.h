@@ -20,6 +20,7 @@ public:
     static QImage scaledToSize(const QImage& img, int size);
     static QSize getImageSize(const QString& filePath);
     static ATProto::AppBskyEmbed::AspectRatio::SharedPtr getImageAspectRatio(const QString& filePath, QSize defaultSize = {1, 1});
+    static ATProto::AppBskyEmbed::AspectRatio::SharedPtr makeAspectRatio(QSize size, QSize defaultSize = {1, 1});
 
     explicit ImageUtils(QObject* parent = nullptr);
 
@@ -0,0 +1,70 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#include "image_worker.h"
+#include <QDebug>
+
+namespace Skywalker {
+
+// Each task may hold a fully decoded photo in memory. A single thread also
+// keeps the order of the work.
+static constexpr int MAX_THREADS = 1;
+
+QThreadPool* ImageWorker::threadPool()
+{
+    static QThreadPool* pool = []{
+        auto* p = new QThreadPool;
+        p->setMaxThreadCount(MAX_THREADS);
+        p->setThreadPriority(QThread::LowPriority);
+        return p;
+    }();
+
+    return pool;
+}
+
+ImageWorker::ImageWorker(QObject* parent) :
+    QObject(parent),
+    mCanceled(std::make_shared<std::atomic_bool>(false))
+{
+}
+
+ImageWorker::~ImageWorker()
+{
+    cancel();
+}
+
+void ImageWorker::cancel()
+{
+    *mCanceled = true;
+    mCanceled = std::make_shared<std::atomic_bool>(false);
+}
+
+void ImageWorker::start(std::function<void()> task, std::function<void()> doneCb)
+{
+    auto* runnable = new ImageWorkerTask(std::move(task), mCanceled);
+    connect(runnable, &ImageWorkerTask::done, this,
+            [canceled=mCanceled, doneCb]{
+                if (!*canceled)
+                    doneCb();
+            });
+    threadPool()->start(runnable);
+}
+
+ImageWorkerTask::ImageWorkerTask(std::function<void()> task, std::shared_ptr<std::atomic_bool> canceled) :
+    mTask(std::move(task)),
+    mCanceled(std::move(canceled))
+{
+}
+
+void ImageWorkerTask::run()
+{
+    if (*mCanceled)
+    {
+        qDebug() << "Image work canceled";
+        return;
+    }
+
+    mTask();
+    emit done();
+}
+
+}
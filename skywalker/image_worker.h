@@ -0,0 +1,68 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <QObject>
+#include <QRunnable>
+#include <QThreadPool>
+#include <atomic>
+#include <functional>
+#include <memory>
+
+namespace Skywalker {
+
+// Runs image work, like loading, cropping and rendering, on a worker thread,
+// such that large photos do not block the GUI thread. Results are delivered
+// on the thread of the worker object.
+//
+// The work must not use the worker object or objects that live on the GUI
+// thread, except through the result callback.
+class ImageWorker : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ImageWorker(QObject* parent = nullptr);
+
+    // Cancels all work.
+    ~ImageWorker();
+
+    template<typename Result>
+    void run(std::function<Result()> task, std::function<void(Result)> resultCb);
+
+    // Work that did not start yet is skipped. Results of work in progress
+    // are dropped.
+    void cancel();
+
+    static QThreadPool* threadPool();
+
+private:
+    void start(std::function<void()> task, std::function<void()> doneCb);
+
+    std::shared_ptr<std::atomic_bool> mCanceled;
+};
+
+class ImageWorkerTask : public QObject, public QRunnable
+{
+    Q_OBJECT
+
+public:
+    ImageWorkerTask(std::function<void()> task, std::shared_ptr<std::atomic_bool> canceled);
+    void run() override;
+
+signals:
+    void done();
+
+private:
+    std::function<void()> mTask;
+    std::shared_ptr<std::atomic_bool> mCanceled;
+};
+
+template<typename Result>
+void ImageWorker::run(std::function<Result()> task, std::function<void(Result)> resultCb)
+{
+    auto result = std::make_shared<Result>();
+    start([task, result]{ *result = task(); },
+          [resultCb, result]{ resultCb(std::move(*result)); });
+}
+
+}
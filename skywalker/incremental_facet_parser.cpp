@@ -0,0 +1,119 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#include "incremental_facet_parser.h"
+
+namespace Skywalker {
+
+const std::vector<IncrementalFacetParser::ParsedMatch>& IncrementalFacetParser::parse(const QString& text)
+{
+    if (!mParsed)
+    {
+        fullParse(text);
+        return mFacets;
+    }
+
+    const auto diff = TextDiffer::diff(mText, text);
+
+    if (diff.mType == TextDiffType::NONE)
+        return mFacets;
+
+    if (!incrementalParse(text, diff))
+        fullParse(text);
+
+    return mFacets;
+}
+
+void IncrementalFacetParser::reset()
+{
+    mText.clear();
+    mFacets.clear();
+    mParsed = false;
+}
+
+void IncrementalFacetParser::fullParse(const QString& text)
+{
+    mFacets = ATProto::RichTextMaster::parseFacets(text);
+    mText = text;
+    mParsed = true;
+}
+
+bool IncrementalFacetParser::incrementalParse(const QString& text, const TextDiffer::Result& diff)
+{
+    int editStart = 0;
+    int newEditEnd = 0; // exclusive
+
+    switch (diff.mType)
+    {
+    case TextDiffType::NONE:
+        return true;
+    case TextDiffType::INSERTED:
+        editStart = diff.mNewStartIndex;
+        newEditEnd = diff.mNewEndIndex + 1;
+        break;
+    case TextDiffType::DELETED:
+        editStart = diff.mOldStartIndex;
+        newEditEnd = diff.mOldStartIndex;
+        break;
+    case TextDiffType::REPLACED:
+        editStart = diff.mNewStartIndex;
+        newEditEnd = diff.mNewEndIndex + 1;
+        break;
+    }
+
+    const int delta = text.size() - mText.size();
+
+    // Facets do not contain white space. Re-tokenize from the white space before
+    // the edit till the white space after the edit.
+    int windowStart = editStart;
+
+    while (windowStart > 0 && !text[windowStart - 1].isSpace())
+        --windowStart;
+
+    int windowEnd = newEditEnd;
+
+    while (windowEnd < text.size() && !text[windowEnd].isSpace())
+        ++windowEnd;
+
+    const int oldWindowEnd = windowEnd - delta;
+    std::vector<ParsedMatch> facets;
+    std::vector<ParsedMatch> tailFacets;
+
+    for (const auto& facet : mFacets)
+    {
+        if (facet.mEndIndex <= windowStart)
+        {
+            facets.push_back(facet);
+        }
+        else if (facet.mStartIndex >= oldWindowEnd)
+        {
+            auto shifted = facet;
+            shifted.mStartIndex += delta;
+            shifted.mEndIndex += delta;
+            tailFacets.push_back(std::move(shifted));
+        }
+        else if (facet.mStartIndex < windowStart || facet.mEndIndex > oldWindowEnd)
+        {
+            qDebug() << "Facet crosses parse window:" << facet.mMatch << facet.mStartIndex << facet.mEndIndex << "window:" << windowStart << oldWindowEnd;
+            return false;
+        }
+    }
+
+    if (windowEnd > windowStart)
+    {
+        const auto windowFacets = ATProto::RichTextMaster::parseFacets(text.sliced(windowStart, windowEnd - windowStart));
+
+        for (auto facet : windowFacets)
+        {
+            facet.mStartIndex += windowStart;
+            facet.mEndIndex += windowStart;
+            facets.push_back(std::move(facet));
+        }
+    }
+
+    facets.insert(facets.end(), std::make_move_iterator(tailFacets.begin()), std::make_move_iterator(tailFacets.end()));
+    mFacets = std::move(facets);
+    mText = text;
+    return true;
+}
+
+}
@@ -0,0 +1,31 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include "text_differ.h"
+#include <atproto/lib/rich_text_master.h>
+
+namespace Skywalker {
+
+// Parses facets from a text that is edited in small steps. Only the words
+// touched by an edit are parsed again. Facets outside the edit are kept, with
+// their indexes shifted by the length change of the edit.
+class IncrementalFacetParser
+{
+public:
+    using ParsedMatch = ATProto::RichTextMaster::ParsedMatch;
+
+    const std::vector<ParsedMatch>& parse(const QString& text);
+    void reset();
+
+    const std::vector<ParsedMatch>& getFacets() const { return mFacets; }
+
+private:
+    void fullParse(const QString& text);
+    bool incrementalParse(const QString& text, const TextDiffer::Result& diff);
+
+    QString mText;
+    std::vector<ParsedMatch> mFacets;
+    bool mParsed = false;
+};
+
+}
@@ -2,6 +2,7 @@
 // License: GPLv3
 #pragma once
 #include "external_source.h"
+#include "link_card_store.h"
 #include "profile.h"
 #include "strong_ref.h"
 #include <QObject>
@@ -16,6 +17,7 @@ class LinkCard : public QObject
     Q_PROPERTY(QString title READ getTitle WRITE setTitle NOTIFY titleChanged FINAL);
     Q_PROPERTY(QString description READ getDescription WRITE setDescription NOTIFY descriptionChanged FINAL);
     Q_PROPERTY(QString thumb READ getThumb WRITE setThumb NOTIFY thumbChanged FINAL);
+    Q_PROPERTY(QString thumbSource READ getThumbSource NOTIFY thumbChanged FINAL);
     Q_PROPERTY(QDateTime createdAt READ getCreatedAt WRITE setCreatedAt NOTIFY createdAtChanged FINAL)
     Q_PROPERTY(QDateTime updatedAt READ getUpdatedAt WRITE setUpdatedAt NOTIFY updatedAtChanged FINAL)
     Q_PROPERTY(int readingTime READ getReadingTime WRITE setReadingTime NOTIFY readingTimeChanged FINAL)
@@ -31,6 +33,10 @@ public:
     const QString& getTitle() const { return mTitle; }
     const QString& getDescription() const { return mDescription; }
     const QString& getThumb() const { return mThumb; }
+
+    // The stored thumbnail if available, otherwise the thumb URL.
+    QString getThumbSource() const { return LinkCardStore::instance().getThumbSource(mThumb); }
+
     QDateTime getCreatedAt() const { return mCreatedAt; }
     QDateTime getUpdatedAt() const { return mUpdatedAt; }
     int getReadingTime() const { return mReadingTime; }
@@ -3,11 +3,12 @@
 #include "link_card_reader.h"
 #include "chat.h"
 #include "definitions.h"
+#include "link_card_store.h"
 #include "skywalker.h"
 #include "unicode_fonts.h"
-#include <QRegularExpression>
 #include <QNetworkCookie>
 #include <QNetworkCookieJar>
+#include <QPointer>
 #include <QUrlQuery>
 
 namespace Skywalker {
@@ -152,6 +153,15 @@ void LinkCardReader::getLinkCard(const QString& link, bool retry, bool cookieSav
         }
     }
 
+    const auto* storedCard = LinkCardStore::instance().getCard(url);
+
+    if (storedCard && LinkCardStore::instance().isFresh(*storedCard))
+    {
+        qDebug() << "Got card from store:" << url;
+        useStoredCard(url, *storedCard);
+        return;
+    }
+
     if (!retry)
     {
         qDebug() << "Reset cookie jar";
@@ -160,6 +170,16 @@ void LinkCardReader::getLinkCard(const QString& link, bool retry, bool cookieSav
 
     QNetworkRequest request(url);
 
+    // A stale stored card is used if the web site says the page did not change.
+    if (storedCard)
+    {
+        if (!storedCard->mETag.isEmpty())
+            request.setRawHeader("If-None-Match", storedCard->mETag.toUtf8());
+
+        if (!storedCard->mLastModified.isEmpty())
+            request.setRawHeader("If-Modified-Since", storedCard->mLastModified.toUtf8());
+    }
+
     // Without cookieSaveControl YouTube Shorts does not load
     // With cookieSaveControl www.noordhollandsdagblad.nl fails
     request.setAttribute(QNetworkRequest::CookieSaveControlAttribute, cookieSaveControl);
@@ -180,81 +200,44 @@ void LinkCardReader::getLinkCard(const QString& link, bool retry, bool cookieSav
     mRetry = retry;
     mCookieSaveControl = cookieSaveControl;
 
-    connect(reply, &QNetworkReply::finished, this, [this, reply]{ extractLinkCard(reply); });
+    auto scanner = std::make_shared<HtmlHeadScanner>();
+
+    connect(reply, &QNetworkReply::readyRead, this, [this, reply, scanner]{ scanHead(reply, *scanner); });
+    connect(reply, &QNetworkReply::finished, this, [this, reply, scanner]{
+        scanner->addData(reply->readAll());
+        extractLinkCard(reply, *scanner);
+    });
     connect(reply, &QNetworkReply::errorOccurred, this, [this, reply](auto errCode){ requestFailed(reply, errCode); });
     connect(reply, &QNetworkReply::sslErrors, this, [this, reply]{ requestSslFailed(reply); });
-    connect(reply, &QNetworkReply::redirected, this, [this, reply](const QUrl& url){ redirect(reply, url); });
+    connect(reply, &QNetworkReply::redirected, this, [this, reply, scanner](const QUrl& url){
+        scanner->clear();
+        redirect(reply, url);
+    });
 }
 
-static QString matchRegexes(const std::vector<QRegularExpression>& regexes, const QByteArray& data, const QString& group)
+// The link card data is in the head of the HTML document. As soon as the head
+// has been received, the download of the rest of the document is aborted.
+void LinkCardReader::scanHead(QNetworkReply* reply, HtmlHeadScanner& scanner)
 {
-    for (const auto& re : regexes)
-    {
-        auto match = re.match(data);
+    scanner.addData(reply->readAll());
 
-        if (match.hasMatch())
-            return match.captured(group);
-    }
+    if (!scanner.isHeadComplete())
+        return;
+
+    // Error responses are handled when the reply finishes.
+    const int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
 
-    return {};
+    if (statusCode < 200 || statusCode >= 300)
+        return;
+
+    qDebug() << "Head complete:" << reply->request().url() << "bytes:" << scanner.getBytesScanned();
+    disconnect(reply, nullptr, this, nullptr);
+    extractLinkCard(reply, scanner);
+    reply->abort();
 }
 
-void LinkCardReader::extractLinkCard(QNetworkReply* reply)
+void LinkCardReader::extractLinkCard(QNetworkReply* reply, const HtmlHeadScanner& scanner)
 {
-    static const QString ogTitleStr1(R"(<meta [^>]*(property|name) *=[\"']?(og:|twitter:)?title[\"']? [^>]*content=%1(?<title>[^%1]+?)%1[^>]*>)");
-    static const QString ogTitleStr2(R"(<meta [^>]*content=%1(?<title>[^%1]+?)%1 [^>]*(property|name)=[\"']?(og:|twitter:)?title[\"']?[^>]*>)");
-
-    static const std::vector<QRegularExpression> ogTitleREs = {
-        QRegularExpression(ogTitleStr1.arg('"')),
-        QRegularExpression(ogTitleStr1.arg('\'')),
-        QRegularExpression(ogTitleStr2.arg('"')),
-        QRegularExpression(ogTitleStr2.arg('\''))
-    };
-
-    static const QString htmlTitleStr(R"(<title>(?<title>[^<]+)</title>)");
-
-    static const std::vector<QRegularExpression> htmlTitleREs = {
-        QRegularExpression(htmlTitleStr)
-    };
-
-    static const QString ogDescriptionStr1(R"(<meta [^>]*(property|name) *=[\"']?(og:|twitter:)?description[\"']? [^>]*content=%1(?<description>[^%1]+?)%1[^>]*>)");
-    static const QString ogDescriptionStr2(R"(<meta [^>]*content=%1(?<description>[^%1]+?)%1 [^>]*(property|name)=[\"']?(og:|twitter:)?description[\"']?[^>]*>)");
-
-    static const std::vector<QRegularExpression> ogDescriptionREs = {
-        QRegularExpression(ogDescriptionStr1.arg('"')),
-        QRegularExpression(ogDescriptionStr1.arg('\'')),
-        QRegularExpression(ogDescriptionStr2.arg('"')),
-        QRegularExpression(ogDescriptionStr2.arg('\''))
-    };
-
-    static const QString ogImageStr1(R"(<meta [^>]*(property|name) *=[\"']?(og:|twitter:)?image(?!:)[\"']? [^>]*content=%1(?<image>[^%1]+?)%1[^>]*>)");
-    static const QString ogImageStr2(R"(<meta [^>]*content=%1(?<image>[^%1]+?)%1 [^>]*(property|name)=[\"']?(og:|twitter:)?image(?!:)[\"']?[^>]*>)");
-    static const QString ogImageStr3(R"(<meta [^>]*(property|name) *=[\"']?(og:|twitter:)?image(?!:)[\"']? [^>]*content=(?<image>[^ \"]+?)[^>]*>)");
-    static const QString ogImageStr4(R"(<meta [^>]*content=(?<image>[^ \"]+?) [^<]*(property|name)=[\"']?(og:|twitter:)?image(?!:)[\"']?[^>]*>)");
-
-    static const std::vector<QRegularExpression> ogImageREs = {
-        QRegularExpression(ogImageStr1.arg('"')),
-        QRegularExpression(ogImageStr1.arg('\'')),
-        QRegularExpression(ogImageStr2.arg('"')),
-        QRegularExpression(ogImageStr2.arg('\'')),
-        QRegularExpression(ogImageStr3),
-        QRegularExpression(ogImageStr4)
-    };
-
-    static const QString linkStandardSiteDocument(R"(<link [^>]*rel *= *[\"']site\.standard\.document[\"'] [^>]*href *= *%1(?<link>[^%1]+?)%1[^>]*>)");
-
-    static const std::vector<QRegularExpression> linkStandardSiteDocumentREs = {
-        QRegularExpression(linkStandardSiteDocument.arg('"')),
-        QRegularExpression(linkStandardSiteDocument.arg('\''))
-    };
-
-    static const QString linkStandardSitePublication(R"(<link [^>]*rel *= *[\"']site\.standard\.publication[\"'] [^>]*href *= *%1(?<link>[^%1]+?)%1[^>]*>)");
-
-    static const std::vector<QRegularExpression> linkStandardSitePublicationREs = {
-        QRegularExpression(linkStandardSitePublication.arg('"')),
-        QRegularExpression(linkStandardSitePublication.arg('\''))
-    };
-
     mInProgress = nullptr;
 
     if (reply->error() != QNetworkReply::NoError)
@@ -263,23 +246,41 @@ void LinkCardReader::extractLinkCard(QNetworkReply* reply)
         return;
     }
 
-    auto card = std::make_unique<LinkCard>(this);
-    const auto data = reply->readAll();
+    const auto& url = reply->request().url();
+    const int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+
+    if (statusCode == 304)
+    {
+        const auto* storedCard = LinkCardStore::instance().getCard(url);
+
+        if (storedCard)
+        {
+            LinkCardStore::instance().revalidated(url);
+            useStoredCard(url, *storedCard);
+        }
+        else
+        {
+            qWarning() << "Not modified, but no stored card:" << url;
+            emit linkCardFailed();
+        }
 
-    const QString title = matchRegexes(ogTitleREs, data, "title");
+        return;
+    }
+
+    auto card = std::make_unique<LinkCard>(this);
+    const QString& title = scanner.getTitle();
 
     if (!title.isEmpty())
         card->setTitle(toPlainText(title));
 
-    const QString description = matchRegexes(ogDescriptionREs, data, "description");
+    const QString& description = scanner.getDescription();
 
     if (!description.isEmpty())
         card->setDescription(toPlainText(description));
 
-    qDebug() << QString(data.sliced(0, std::min(data.size(), (qsizetype)1024)));
-    QString imgUrlString = matchRegexes(ogImageREs, data, "image");
+    qDebug() << "Scanned bytes:" << scanner.getBytesScanned() << "head complete:" << scanner.isHeadComplete();
+    QString imgUrlString = scanner.getImage();
     qDebug() << "img url:" << imgUrlString;
-    const auto& url = reply->request().url();
 
     // HACK: for some reason Twitch does not give the linkcard for a channel on the first call
     // NOTE: that a delay (500ms) is needed. Immediate retry does not work.
@@ -365,7 +366,7 @@ void LinkCardReader::extractLinkCard(QNetworkReply* reply)
             getLinkCard(url.toString(), false, true);
             return;
         }
-        else if (auto htmlTitle = matchRegexes(htmlTitleREs, data, "title"); !htmlTitle.isEmpty())
+        else if (auto htmlTitle = scanner.getHtmlTitle(); !htmlTitle.isEmpty())
         {
             card->setTitle(htmlTitle);
             qDebug() << "Got title from HTML document:" << htmlTitle;
@@ -380,7 +381,7 @@ void LinkCardReader::extractLinkCard(QNetworkReply* reply)
     }
 
     std::vector<QString> associatedUris;
-    const QString documentUri = matchRegexes(linkStandardSiteDocumentREs, data, "link");
+    const QString& documentUri = scanner.getStandardSiteDocument();
 
     if (!documentUri.isEmpty())
     {
@@ -388,7 +389,7 @@ void LinkCardReader::extractLinkCard(QNetworkReply* reply)
         associatedUris.push_back(documentUri);
     }
 
-    const QString publicationUri = matchRegexes(linkStandardSitePublicationREs, data, "link");
+    const QString& publicationUri = scanner.getStandardSitePublication();
 
     if (!publicationUri.isEmpty())
     {
@@ -397,10 +398,67 @@ void LinkCardReader::extractLinkCard(QNetworkReply* reply)
     }
 
     card->setLink(url.toString());
+
+    LinkCardStore::Card storedCard;
+    storedCard.mLink = card->getLink();
+    storedCard.mTitle = card->getTitle();
+    storedCard.mDescription = card->getDescription();
+    storedCard.mThumb = card->getThumb();
+    storedCard.mAssociatedUris = associatedUris;
+    storedCard.mETag = QString::fromUtf8(reply->rawHeader("ETag"));
+    storedCard.mLastModified = QString::fromUtf8(reply->rawHeader("Last-Modified"));
+    LinkCardStore::instance().putCard(url, storedCard);
+    storeThumb(card.get());
+
     mCardCache.insert(url, card.get());
     getEmbedExternalView(card.release(), associatedUris);
 }
 
+void LinkCardReader::useStoredCard(const QUrl& url, const LinkCardStore::Card& storedCard)
+{
+    auto* card = new LinkCard(this);
+    card->setLink(storedCard.mLink);
+    card->setTitle(storedCard.mTitle);
+    card->setDescription(storedCard.mDescription);
+    card->setThumb(storedCard.mThumb);
+    storeThumb(card);
+    mCardCache.insert(url, card);
+
+    // The other card fields come from the embed external view.
+    getEmbedExternalView(card, storedCard.mAssociatedUris);
+}
+
+void LinkCardReader::storeThumb(LinkCard* card)
+{
+    const QString thumbUrl = card->getThumb();
+
+    if (!thumbUrl.startsWith("http") || LinkCardStore::instance().hasThumb(thumbUrl))
+        return;
+
+    imageReader()->getImage(thumbUrl,
+        [presence=getPresence(), card=QPointer<LinkCard>(card), thumbUrl](QImage image){
+            if (!presence)
+                return;
+
+            LinkCardStore::instance().putThumb(thumbUrl, image);
+
+            // Show the stored thumbnail
+            if (card && card->getThumb() == thumbUrl)
+                emit card->thumbChanged();
+        },
+        [thumbUrl](const QString& error){
+            qDebug() << "Cannot store thumb:" << thumbUrl << error;
+        });
+}
+
+ImageReader* LinkCardReader::imageReader()
+{
+    if (!mImageReader)
+        mImageReader = std::make_unique<ImageReader>(mNetwork, this);
+
+    return mImageReader.get();
+}
+
 QString LinkCardReader::toPlainText(const QString& text)
 {
     // Texts in linkcard text often contain double encoded ampersands, e.g.
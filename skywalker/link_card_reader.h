@@ -3,6 +3,9 @@
 #pragma once
 #include "link_card.h"
 #include "gif_utils.h"
+#include "html_head_scanner.h"
+#include "image_reader.h"
+#include "link_card_store.h"
 #include "presence.h"
 #include "tenor_gif.h"
 #include "wrapped_skywalker.h"
@@ -34,7 +37,11 @@ signals:
 
 private:
     QString toPlainText(const QString& text);
-    void extractLinkCard(QNetworkReply* reply);
+    void scanHead(QNetworkReply* reply, HtmlHeadScanner& scanner);
+    void extractLinkCard(QNetworkReply* reply, const HtmlHeadScanner& scanner);
+    void useStoredCard(const QUrl& url, const LinkCardStore::Card& storedCard);
+    void storeThumb(LinkCard* card);
+    ImageReader* imageReader();
     void getEmbedExternalView(LinkCard* card, const std::vector<QString> associatedUris);
     void requestFailed(QNetworkReply* reply, int errCode);
     void requestSslFailed(QNetworkReply* reply);
@@ -42,6 +49,7 @@ private:
     void getJoinRequestLinkCard(const QUrl& url);
 
     QNetworkAccessManager* mNetwork;
+    std::unique_ptr<ImageReader> mImageReader;
     QCache<QUrl, LinkCard> mCardCache;
     QNetworkReply* mInProgress = nullptr;
     bool mEmbedExternalViewInProgress = false;
@@ -0,0 +1,354 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#include "link_card_store.h"
+#include "file_utils.h"
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <unordered_set>
+
+namespace Skywalker {
+
+using namespace std::chrono_literals;
+
+// A fresh card is used without asking the web site.
+static constexpr auto FRESH_TTL = 24h;
+
+// A card that could not be revalidated for this long is removed.
+static constexpr auto MAX_CARD_AGE = 30 * 24h;
+
+// When there are more cards, the least recently fetched are removed.
+static constexpr size_t MAX_CARDS = 500;
+
+// Delay for writing index changes to disk.
+static constexpr auto SAVE_DELAY = 5s;
+
+static constexpr char const* THUMB_EXTENSION = ".jpg";
+
+std::unique_ptr<LinkCardStore> LinkCardStore::sInstance;
+
+LinkCardStore& LinkCardStore::instance()
+{
+    if (!sInstance)
+        sInstance = std::make_unique<LinkCardStore>();
+
+    return *sInstance;
+}
+
+LinkCardStore::LinkCardStore()
+{
+    mSaveTimer.setSingleShot(true);
+    mSaveTimer.setInterval(SAVE_DELAY);
+    QObject::connect(&mSaveTimer, &QTimer::timeout, &mSaveTimer, [this]{ saveIndex(); });
+}
+
+LinkCardStore::~LinkCardStore()
+{
+    flush();
+}
+
+void LinkCardStore::flush()
+{
+    if (!mSaveTimer.isActive())
+        return;
+
+    mSaveTimer.stop();
+    saveIndex();
+}
+
+bool LinkCardStore::open()
+{
+    if (mOpened)
+        return !mPath.isEmpty();
+
+    mOpened = true;
+    mPath = FileUtils::getCachePath("link_cards");
+
+    if (mPath.isEmpty())
+    {
+        qWarning() << "No path for link card store";
+        return false;
+    }
+
+    loadIndex();
+    removeOldCards();
+    removeUnusedThumbs();
+    return true;
+}
+
+const LinkCardStore::Card* LinkCardStore::getCard(const QUrl& url)
+{
+    if (!open())
+        return nullptr;
+
+    auto it = mCards.find(url.toString());
+    return it != mCards.end() ? &it->second : nullptr;
+}
+
+bool LinkCardStore::isFresh(const Card& card) const
+{
+    return QDateTime::currentDateTimeUtc() - card.mFetchedAt < FRESH_TTL;
+}
+
+void LinkCardStore::putCard(const QUrl& url, const Card& card)
+{
+    if (!open())
+        return;
+
+    auto& storedCard = mCards[url.toString()];
+    storedCard = card;
+    storedCard.mFetchedAt = QDateTime::currentDateTimeUtc();
+    qDebug() << "Put link card:" << url << "etag:" << card.mETag << "last-modified:" << card.mLastModified;
+
+    if (mCards.size() > MAX_CARDS)
+        removeOldCards();
+
+    scheduleSaveIndex();
+}
+
+void LinkCardStore::revalidated(const QUrl& url)
+{
+    auto it = mCards.find(url.toString());
+
+    if (it == mCards.end())
+        return;
+
+    qDebug() << "Link card revalidated:" << url;
+    it->second.mFetchedAt = QDateTime::currentDateTimeUtc();
+    scheduleSaveIndex();
+}
+
+QImage LinkCardStore::getThumb(const QString& thumbUrl)
+{
+    if (!thumbUrl.startsWith("http") || !open())
+        return {};
+
+    const QString fileName = getThumbFileName(thumbUrl);
+
+    if (!QFile::exists(fileName))
+        return {};
+
+    QImage thumb(fileName);
+
+    if (thumb.isNull())
+    {
+        qWarning() << "Cannot load thumb:" << fileName;
+        QFile::remove(fileName);
+        return {};
+    }
+
+    qDebug() << "Got thumb from store:" << thumbUrl;
+    return thumb;
+}
+
+void LinkCardStore::putThumb(const QString& thumbUrl, const QImage& thumb)
+{
+    // Local images are not stored.
+    if (!thumbUrl.startsWith("http") || thumb.isNull() || !open())
+        return;
+
+    const QString fileName = getThumbFileName(thumbUrl);
+
+    if (!thumb.save(fileName, "jpg", 90))
+        qWarning() << "Cannot save thumb:" << fileName;
+}
+
+bool LinkCardStore::hasThumb(const QString& thumbUrl)
+{
+    if (!thumbUrl.startsWith("http") || !open())
+        return false;
+
+    return QFile::exists(getThumbFileName(thumbUrl));
+}
+
+QString LinkCardStore::getThumbSource(const QString& thumbUrl)
+{
+    if (!hasThumb(thumbUrl))
+        return thumbUrl;
+
+    return QUrl::fromLocalFile(getThumbFileName(thumbUrl)).toString();
+}
+
+QString LinkCardStore::getLinkThumbSource(const QString& link, const QString& thumbUrl)
+{
+    if (link.isEmpty() || thumbUrl.isEmpty())
+        return thumbUrl;
+
+    const Card* card = getCard(QUrl(link));
+
+    if (!card || !hasThumb(card->mThumb))
+        return thumbUrl;
+
+    return QUrl::fromLocalFile(getThumbFileName(card->mThumb)).toString();
+}
+
+QString LinkCardStore::getIndexFileName() const
+{
+    return QDir(mPath).filePath("link_cards.json");
+}
+
+QString LinkCardStore::getThumbFileName(const QString& thumbUrl) const
+{
+    const QByteArray hash = QCryptographicHash::hash(thumbUrl.toUtf8(), QCryptographicHash::Sha1).toHex();
+    return QDir(mPath).filePath(QString::fromLatin1(hash) + THUMB_EXTENSION);
+}
+
+void LinkCardStore::loadIndex()
+{
+    mCards.clear();
+    QFile file(getIndexFileName());
+
+    if (!file.exists())
+        return;
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qWarning() << "Cannot open file:" << file.fileName();
+        return;
+    }
+
+    const QJsonDocument json = QJsonDocument::fromJson(file.readAll());
+    const QJsonArray cards = json.object().value("cards").toArray();
+
+    for (const auto& cardJson : cards)
+    {
+        const QJsonObject obj = cardJson.toObject();
+        Card card;
+        card.mLink = obj.value("link").toString();
+
+        if (card.mLink.isEmpty())
+            continue;
+
+        card.mTitle = obj.value("title").toString();
+        card.mDescription = obj.value("description").toString();
+        card.mThumb = obj.value("thumb").toString();
+
+        for (const auto& uri : obj.value("associatedUris").toArray())
+            card.mAssociatedUris.push_back(uri.toString());
+
+        card.mETag = obj.value("etag").toString();
+        card.mLastModified = obj.value("lastModified").toString();
+        card.mFetchedAt = QDateTime::fromSecsSinceEpoch(obj.value("fetchedAt").toInteger());
+        mCards[card.mLink] = std::move(card);
+    }
+
+    qDebug() << "Loaded link cards:" << mCards.size();
+}
+
+void LinkCardStore::scheduleSaveIndex()
+{
+    // The timer is not restarted, such that a steady stream of changes still
+    // gets saved.
+    if (!mSaveTimer.isActive())
+        mSaveTimer.start();
+}
+
+void LinkCardStore::saveIndex() const
+{
+    if (mPath.isEmpty())
+        return;
+
+    QJsonArray cards;
+
+    for (const auto& [_, card] : mCards)
+    {
+        QJsonObject obj;
+        obj.insert("link", card.mLink);
+        obj.insert("title", card.mTitle);
+        obj.insert("description", card.mDescription);
+        obj.insert("thumb", card.mThumb);
+
+        if (!card.mAssociatedUris.empty())
+        {
+            QJsonArray uris;
+
+            for (const auto& uri : card.mAssociatedUris)
+                uris.append(uri);
+
+            obj.insert("associatedUris", uris);
+        }
+
+        if (!card.mETag.isEmpty())
+            obj.insert("etag", card.mETag);
+
+        if (!card.mLastModified.isEmpty())
+            obj.insert("lastModified", card.mLastModified);
+
+        obj.insert("fetchedAt", card.mFetchedAt.toSecsSinceEpoch());
+        cards.append(obj);
+    }
+
+    QJsonObject json;
+    json.insert("cards", cards);
+
+    QSaveFile file(getIndexFileName());
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning() << "Cannot open file:" << file.fileName();
+        return;
+    }
+
+    file.write(QJsonDocument(json).toJson(QJsonDocument::Compact));
+
+    if (!file.commit())
+        qWarning() << "Failed to save file:" << file.fileName() << file.errorString();
+}
+
+void LinkCardStore::removeOldCards()
+{
+    const auto now = QDateTime::currentDateTimeUtc();
+    const auto oldSize = mCards.size();
+
+    std::erase_if(mCards, [now](const auto& item){
+        return now - item.second.mFetchedAt > MAX_CARD_AGE; });
+
+    if (mCards.size() > MAX_CARDS)
+    {
+        std::vector<std::pair<QDateTime, QString>> fetchedAt;
+        fetchedAt.reserve(mCards.size());
+
+        for (const auto& [link, card] : mCards)
+            fetchedAt.push_back({ card.mFetchedAt, link });
+
+        std::sort(fetchedAt.begin(), fetchedAt.end());
+
+        for (size_t i = 0; i < fetchedAt.size() - MAX_CARDS; ++i)
+            mCards.erase(fetchedAt[i].second);
+    }
+
+    if (mCards.size() != oldSize)
+    {
+        qDebug() << "Removed link cards:" << oldSize - mCards.size();
+        scheduleSaveIndex();
+    }
+}
+
+void LinkCardStore::removeUnusedThumbs() const
+{
+    std::unordered_set<QString> usedThumbs;
+
+    for (const auto& [_, card] : mCards)
+    {
+        if (!card.mThumb.isEmpty())
+            usedThumbs.insert(QFileInfo(getThumbFileName(card.mThumb)).fileName());
+    }
+
+    const QDir dir(mPath);
+    const QStringList thumbFiles = dir.entryList({ QString("*") + THUMB_EXTENSION }, QDir::Files);
+
+    for (const auto& thumbFile : thumbFiles)
+    {
+        if (!usedThumbs.contains(thumbFile))
+        {
+            qDebug() << "Remove unused thumb:" << thumbFile;
+            QFile::remove(dir.filePath(thumbFile));
+        }
+    }
+}
+
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <QDateTime>
+#include <QImage>
+#include <QTimer>
+#include <QUrl>
+#include <unordered_map>
+
+namespace Skywalker {
+
+// Keeps link cards and their thumbnails on disk, such that a card for a link
+// that was shared before does not need to be read from the web again.
+// All link card readers share this store.
+//
+// A fresh card is used as is. A stale card is revalidated with a conditional
+// request. Cards that have not been revalidated for a long time are removed.
+//
+// Changes to the index are written to disk with a delay, such that a burst of
+// new cards results in a single write.
+class LinkCardStore
+{
+public:
+    struct Card
+    {
+        QString mLink;
+        QString mTitle;
+        QString mDescription;
+        QString mThumb;
+        std::vector<QString> mAssociatedUris;
+
+        // Validators from the HTTP response for conditional requests
+        QString mETag;
+        QString mLastModified;
+
+        QDateTime mFetchedAt;
+    };
+
+    static LinkCardStore& instance();
+
+    LinkCardStore();
+    ~LinkCardStore();
+
+    // Returns nullptr if there is no card for the link.
+    const Card* getCard(const QUrl& url);
+    bool isFresh(const Card& card) const;
+    void putCard(const QUrl& url, const Card& card);
+
+    // The server confirmed that the stored card is still valid.
+    void revalidated(const QUrl& url);
+
+    // Returns a null image if the thumbnail is not stored.
+    QImage getThumb(const QString& thumbUrl);
+    void putThumb(const QString& thumbUrl, const QImage& thumb);
+    bool hasThumb(const QString& thumbUrl);
+
+    // Returns the file URL of the stored thumbnail, or thumbUrl if it is not stored.
+    QString getThumbSource(const QString& thumbUrl);
+
+    // Returns the file URL of the stored thumbnail of the card for the link,
+    // or thumbUrl if there is none.
+    QString getLinkThumbSource(const QString& link, const QString& thumbUrl);
+
+    // Writes pending index changes to disk.
+    void flush();
+
+private:
+    static std::unique_ptr<LinkCardStore> sInstance;
+
+    bool open();
+    QString getIndexFileName() const;
+    QString getThumbFileName(const QString& thumbUrl) const;
+    void loadIndex();
+    void scheduleSaveIndex();
+    void saveIndex() const;
+    void removeOldCards();
+    void removeUnusedThumbs() const;
+
+    QString mPath;
+    bool mOpened = false;
+    std::unordered_map<QString, Card> mCards; // link -> card
+    QTimer mSaveTimer;
+};
+
+}
@@ -31,103 +31,103 @@ void LocalPostModelChanges::updatePostIndexedSecondsAgo()
 void LocalPostModelChanges::updateReplyCountDelta(const QString& cid, int delta)
 {
     mChanges[cid].mReplyCountDelta += delta;
-    replyCountChanged();
+    replyCountChanged(cid);
 }
 
 void LocalPostModelChanges::updateRepostCountDelta(const QString& cid, int delta)
 {
     mChanges[cid].mRepostCountDelta += delta;
-    repostCountChanged();
+    repostCountChanged(cid);
 }
 
 void LocalPostModelChanges::updateQuoteCountDelta(const QString& cid, int delta)
 {
     mChanges[cid].mQuoteCountDelta += delta;
-    quoteCountChanged();
+    quoteCountChanged(cid);
 }
 
 void LocalPostModelChanges::updateRepostUri(const QString& cid, const QString& repostUri)
 {
     mChanges[cid].mRepostUri = repostUri;
-    repostUriChanged();
+    repostUriChanged(cid);
 }
 
 void LocalPostModelChanges::updateLikeCountDelta(const QString& cid, int delta)
 {
     mChanges[cid].mLikeCountDelta += delta;
-    likeCountChanged();
+    likeCountChanged(cid);
 }
 
 void LocalPostModelChanges::updateLikeUri(const QString& cid, const QString& likeUri)
 {
     mChanges[cid].mLikeUri = likeUri;
-    likeUriChanged();
+    likeUriChanged(cid);
 }
 
 void LocalPostModelChanges::updateLikeTransient(const QString& cid, bool transient)
 {
     mChanges[cid].mLikeTransient = transient;
-    likeTransientChanged();
+    likeTransientChanged(cid);
 }
 
 void LocalPostModelChanges::updateRepostTransient(const QString& cid, bool transient)
 {
     mChanges[cid].mRepostTransient = transient;
-    repostTransientChanged();
+    repostTransientChanged(cid);
 }
 
 void LocalPostModelChanges::updateThreadgateUri(const QString& cid, const QString& threadgateUri)
 {
     mChanges[cid].mThreadgateUri = threadgateUri;
-    threadgateUriChanged();
+    threadgateUriChanged(cid);
 }
 
 void LocalPostModelChanges::updateReplyRestriction(const QString& cid, const QEnums::ReplyRestriction replyRestricion)
 {
     mChanges[cid].mReplyRestriction = replyRestricion;
-    replyRestrictionChanged();
+    replyRestrictionChanged(cid);
 }
 
 void LocalPostModelChanges::updateReplyRestrictionLists(const QString& cid, const ListViewBasicList replyRestrictionLists)
 {
     mChanges[cid].mReplyRestrictionLists = replyRestrictionLists;
-    replyRestrictionListsChanged();
+    replyRestrictionListsChanged(cid);
 }
 
 void LocalPostModelChanges::updateHiddenReplies(const QString& cid, const QStringList& hiddenReplies)
 {
     mChanges[cid].mHiddenReplies = hiddenReplies;
-    hiddenRepliesChanged();
+    hiddenRepliesChanged(cid);
 }
 
 void LocalPostModelChanges::updateThreadMuted(const QString& uri, bool muted)
 {
     mUriChanges[uri].mThreadMuted = muted;
-    threadMutedChanged();
+    threadMutedChanged(uri);
 }
 
 void LocalPostModelChanges::updateBookmarked(const QString& cid, bool bookmarked)
 {
     mChanges[cid].mBookmarked = bookmarked;
-    bookmarkedChanged();
+    bookmarkedChanged(cid);
 }
 
 void LocalPostModelChanges::updateBookmarkTransient(const QString& cid, bool transient)
 {
     mChanges[cid].mBookmarkTransient = transient;
-    bookmarkTransientChanged();
+    bookmarkTransientChanged(cid);
 }
 
 void LocalPostModelChanges::updateFeedback(const QString& cid, QEnums::FeedbackType feedback)
 {
     mChanges[cid].mFeedback = feedback;
-    feedbackChanged();
+    feedbackChanged(cid);
 }
 
 void LocalPostModelChanges::updateFeedbackTransient(const QString& cid, QEnums::FeedbackType transient)
 {
     mChanges[cid].mFeedbackTransient = transient;
-    feedbackTransientChanged();
+    feedbackTransientChanged(cid);
 }
 
 bool LocalPostModelChanges::updateDetachedRecord(const QString& cid, const QString& postUri)
@@ -149,26 +149,26 @@ bool LocalPostModelChanges::updateDetachedRecord(const QString& cid, const QStri
         mChanges[cid].mDetachedRecord = RecordView::makeDetachedRecord(postUri);
     }
 
-    detachedRecordChanged();
+    detachedRecordChanged(cid);
     return false;
 }
 
 void LocalPostModelChanges::updateReAttachedRecord(const QString& cid, RecordView::SharedPtr record)
 {
     mChanges[cid].mReAttachedRecord = record;
-    reAttachedRecordChanged();
+    reAttachedRecordChanged(cid);
 }
 
 void LocalPostModelChanges::updateViewerStatePinned(const QString& cid, bool pinned)
 {
     mChanges[cid].mViewerStatePinned = pinned;
-    viewerStatePinnedChanged();
+    viewerStatePinnedChanged(cid);
 }
 
 void LocalPostModelChanges::updatePostDeleted(const QString& cid)
 {
     mChanges[cid].mPostDeleted = true;
-    postDeletedChanged();
+    postDeletedChanged(cid);
 }
 
 }
@@ -85,27 +85,27 @@ public:
 
 protected:
     virtual void postIndexedSecondsAgoChanged() = 0;
-    virtual void likeCountChanged() = 0;
-    virtual void likeUriChanged() = 0;
-    virtual void likeTransientChanged() = 0;
-    virtual void repostTransientChanged() = 0;
-    virtual void replyCountChanged() = 0;
-    virtual void repostCountChanged() = 0;
-    virtual void quoteCountChanged() = 0;
-    virtual void repostUriChanged() = 0;
-    virtual void threadgateUriChanged() = 0;
-    virtual void replyRestrictionChanged() = 0;
-    virtual void replyRestrictionListsChanged() = 0;
-    virtual void hiddenRepliesChanged() = 0;
-    virtual void threadMutedChanged() = 0;
-    virtual void bookmarkedChanged() = 0;
-    virtual void bookmarkTransientChanged() = 0;
-    virtual void feedbackChanged() = 0;
-    virtual void feedbackTransientChanged() = 0;
-    virtual void detachedRecordChanged() = 0;
-    virtual void reAttachedRecordChanged() = 0;
-    virtual void viewerStatePinnedChanged() = 0;
-    virtual void postDeletedChanged() = 0;
+    virtual void likeCountChanged(const QString& cid) = 0;
+    virtual void likeUriChanged(const QString& cid) = 0;
+    virtual void likeTransientChanged(const QString& cid) = 0;
+    virtual void repostTransientChanged(const QString& cid) = 0;
+    virtual void replyCountChanged(const QString& cid) = 0;
+    virtual void repostCountChanged(const QString& cid) = 0;
+    virtual void quoteCountChanged(const QString& cid) = 0;
+    virtual void repostUriChanged(const QString& cid) = 0;
+    virtual void threadgateUriChanged(const QString& cid) = 0;
+    virtual void replyRestrictionChanged(const QString& cid) = 0;
+    virtual void replyRestrictionListsChanged(const QString& cid) = 0;
+    virtual void hiddenRepliesChanged(const QString& cid) = 0;
+    virtual void threadMutedChanged(const QString& uri) = 0;
+    virtual void bookmarkedChanged(const QString& cid) = 0;
+    virtual void bookmarkTransientChanged(const QString& cid) = 0;
+    virtual void feedbackChanged(const QString& cid) = 0;
+    virtual void feedbackTransientChanged(const QString& cid) = 0;
+    virtual void detachedRecordChanged(const QString& cid) = 0;
+    virtual void reAttachedRecordChanged(const QString& cid) = 0;
+    virtual void viewerStatePinnedChanged(const QString& cid) = 0;
+    virtual void postDeletedChanged(const QString& cid) = 0;
 
 private:
     // Mapping from post CID to change
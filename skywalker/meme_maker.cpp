@@ -1,6 +1,7 @@
 // Copyright (C) 2024 Michel de Boer
 // License: GPLv3
 #include "meme_maker.h"
+#include "file_utils.h"
 #include "photo_picker.h"
 #include "text_splitter.h"
 #include <QFont>
@@ -23,19 +24,94 @@ MemeMaker::MemeMaker(QObject* parent) :
     QObject(parent)
 {}
 
-bool MemeMaker::setOrigImage(const QString& imgSource)
+QImage MemeMaker::renderMeme(const QImage& origImage, const QString& topText, const QString& bottomText)
 {
-    mOrigImage = PhotoPicker::loadImage(imgSource);
+    MemeMaker memeMaker;
+    memeMaker.mOrigImage = origImage;
+    memeMaker.mTopText = topText;
+    memeMaker.mBottomText = bottomText;
+    return memeMaker.createMemeImage();
+}
 
-    if (mOrigImage.isNull())
-        return false;
-
-    auto* imageProvider = SharedImageProvider::getProvider(SharedImageProvider::SHARED_IMAGE);
-    const QString memeSource = imageProvider->addImage(mOrigImage);
-    setMemeImgSource(memeSource, imageProvider);
-    setTopText("");
-    setBottomText("");
-    return true;
+void MemeMaker::setOrigImage(const QString& imgSource)
+{
+    mImageWorker.cancel();
+    mOrigImage = {};
+
+    // The permission check may need the GUI thread.
+    if (imgSource.startsWith("file://") && !FileUtils::checkReadMediaPermission())
+    {
+        qWarning() << "No permission to read:" << imgSource;
+        emit setOrigImageFailed();
+        return;
+    }
+
+    mImageWorker.run<QImage>(
+        [imgSource]{ return PhotoPicker::loadImage(imgSource, false); },
+        [this](QImage img){
+            if (img.isNull())
+            {
+                emit setOrigImageFailed();
+                return;
+            }
+
+            mOrigImage = std::move(img);
+            auto* imageProvider = SharedImageProvider::getProvider(SharedImageProvider::SHARED_IMAGE);
+            const QString memeSource = imageProvider->addImage(mOrigImage);
+            setMemeImgSource(memeSource, imageProvider);
+            mTopText.clear();
+            mBottomText.clear();
+            emit topTextChanged();
+            emit bottomTextChanged();
+            emit setOrigImageOk();
+        });
+}
+
+void MemeMaker::makeMemes(const QStringList& imgSources, const QStringList& topTexts, const QStringList& bottomTexts)
+{
+    qDebug() << "Make memes:" << imgSources.size();
+
+    // The permission check may need the GUI thread.
+    const bool readPermission = FileUtils::checkReadMediaPermission();
+
+    mImageWorker.run<std::vector<QImage>>(
+        [imgSources, topTexts, bottomTexts, readPermission]{
+            std::vector<QImage> memes;
+
+            for (int i = 0; i < imgSources.size(); ++i)
+            {
+                const QString& imgSource = imgSources[i];
+                const QString topText = topTexts.value(i);
+                const QString bottomText = bottomTexts.value(i);
+
+                if ((topText.isEmpty() && bottomText.isEmpty()) ||
+                    (imgSource.startsWith("file://") && !readPermission))
+                {
+                    memes.push_back({});
+                    continue;
+                }
+
+                const QImage img = PhotoPicker::loadImage(imgSource, false);
+                memes.push_back(img.isNull() ? img : renderMeme(img, topText, bottomText));
+            }
+
+            return memes;
+        },
+        [this, imgSources](std::vector<QImage> memes){
+            auto* imageProvider = SharedImageProvider::getProvider(SharedImageProvider::SHARED_IMAGE);
+            QStringList memeSources;
+
+            for (int i = 0; i < imgSources.size(); ++i)
+            {
+                // Images without meme, or that cannot be loaded, are used as is.
+                if (memes[i].isNull())
+                    memeSources.push_back(imgSources[i]);
+                else
+                    memeSources.push_back(imageProvider->addImage(std::move(memes[i])));
+            }
+
+            emit makeMemesOk(memeSources);
+        });
 }
 
 QString MemeMaker::getMemeImgSource() const
@@ -74,6 +150,28 @@ void MemeMaker::setBottomText(const QString& text)
     emit bottomTextChanged();
 }
 
+void MemeMaker::addText()
+{
+    if (mOrigImage.isNull())
+        return;
+
+    // Only the latest text is rendered.
+    mImageWorker.cancel();
+
+    mImageWorker.run<QImage>(
+        [origImage=mOrigImage, topText=mTopText, bottomText=mBottomText]{
+            return renderMeme(origImage, topText, bottomText);
+        },
+        [this](QImage memeImage){
+            if (memeImage.isNull())
+                return;
+
+            auto* provider = SharedImageProvider::getProvider(SharedImageProvider::SHARED_IMAGE);
+            const QString source = provider->addImage(std::move(memeImage));
+            setMemeImgSource(source, provider);
+        });
+}
+
 double MemeMaker::fontSizeRatio() const
 {
     return mOrigImage.width() / (float)MOBILE_SCREEN_WIDTH;
@@ -213,7 +311,7 @@ void MemeMaker::moveToBottom(std::vector<QPainterPath>& paths) const
         p.translate(0, dy);
 }
 
-void MemeMaker::addText()
+QImage MemeMaker::createMemeImage() const
 {
     const int x = marginSize();
     const int maxWidth = mOrigImage.width() - 2 * marginSize();
@@ -237,7 +335,7 @@ void MemeMaker::addText()
     if (!painter.begin(&memeImage))
     {
         qWarning() << "Cannot paint on image";
-        return;
+        return {};
     }
 
     QPen pen(Qt::black);
@@ -252,10 +350,7 @@ void MemeMaker::addText()
         painter.drawPath(path);
 
     painter.end();
-
-    auto* provider = SharedImageProvider::getProvider(SharedImageProvider::SHARED_IMAGE);
-    const QString source = provider->addImage(memeImage);
-    setMemeImgSource(source, provider);
+    return memeImage;
 }
 
 }
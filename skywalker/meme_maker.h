@@ -1,6 +1,7 @@
 // Copyright (C) 2024 Michel de Boer
 // License: GPLv3
 #pragma once
+#include "image_worker.h"
 #include "shared_image_provider.h"
 #include <QImage>
 #include <QObject>
@@ -8,6 +9,7 @@
 
 namespace Skywalker {
 
+// Meme images are loaded and rendered on a worker thread.
 class MemeMaker : public QObject
 {
     Q_OBJECT
@@ -19,7 +21,15 @@ class MemeMaker : public QObject
 public:
     explicit MemeMaker(QObject* parent = nullptr);
 
-    Q_INVOKABLE bool setOrigImage(const QString& imgSource);
+    // Thread safe
+    static QImage renderMeme(const QImage& origImage, const QString& topText, const QString& bottomText);
+
+    // Emits setOrigImageOk or setOrigImageFailed
+    Q_INVOKABLE void setOrigImage(const QString& imgSource);
+
+    // Emits makeMemesOk with a source for each image. Images without text
+    // keep their source. The caller owns the created meme images.
+    Q_INVOKABLE void makeMemes(const QStringList& imgSources, const QStringList& topTexts, const QStringList& bottomTexts);
 
     QString getMemeImgSource() const;
     void setMemeImgSource(const QString& source, SharedImageProvider* provider);
@@ -31,6 +41,9 @@ public:
     void setBottomText(const QString& text);
 
 signals:
+    void setOrigImageOk();
+    void setOrigImageFailed();
+    void makeMemesOk(QStringList memeSources);
     void memeImgSourceChanged();
     void topTextChanged();
     void bottomTextChanged();
@@ -44,11 +57,13 @@ private:
     void moveToBottom(std::vector<QPainterPath>& paths) const;
     void center(int maxWidth, QPainterPath& path) const;
     void addText();
+    QImage createMemeImage() const;
 
     QImage mOrigImage;
     SharedImageSource::Ptr mMemeImgSource;
     QString mTopText;
     QString mBottomText;
+    ImageWorker mImageWorker;
 };
 
 }
@@ -66,7 +66,8 @@ void MessageListModel::clear()
     {
         beginRemoveRows({}, 0, mMessages.size() - 1);
         mMessages.clear();
-        mMessageIdToPosIndex.clear();
+        mMessageIdToSeq.clear();
+        mFrontSeq = 0;
         endRemoveRows();
     }
 
@@ -85,6 +86,7 @@ void MessageListModel::addMessages(const ATProto::ChatBskyConvo::GetMessagesOutp
         return;
     }
 
+    const auto oldSize = mMessages.size();
     beginInsertRows({}, 0, messages.size() - 1);
 
     for (const auto& message : messages)
@@ -96,12 +98,19 @@ void MessageListModel::addMessages(const ATProto::ChatBskyConvo::GetMessagesOutp
         }
 
         mMessages.emplace_front(message);
+        indexFront();
         reportActivity(mMessages.front());
     }
 
-    rebuildIndex();
-
     endInsertRows();
+
+    // The grouping roles of the previous first message depend on the previous message.
+    if (oldSize > 0)
+    {
+        const int oldFirstIndex = mMessages.size() - oldSize;
+        changeData({ int(Role::SameSenderAsPrevious), int(Role::SameDateAsPrevious) }, oldFirstIndex, oldFirstIndex);
+    }
+
     qDebug() << "New messages size:" << mMessages.size();
 }
 
@@ -160,10 +169,111 @@ void MessageListModel::updateMessages(const ATProto::ChatBskyConvo::GetMessagesO
         const MessageView updatedMsg(**messageView);
         storedMsg = updatedMsg;
         reportActivity(storedMsg);
-        changeData({}, index, index);
+        changeData({ int(Role::Message) }, index, index);
     }
 }
 
+int MessageListModel::mergeNewMessages(const ATProto::ChatBskyConvo::GetMessagesOutput::MessageList& messages)
+{
+    if (mMessages.empty() || messages.empty())
+        return -1;
+
+    // Find the newest message that we already have.
+    int overlapIndex = -1;
+
+    for (int i = 0; i < (int)messages.size(); ++i)
+    {
+        if (ATProto::isNullVariant(messages[i]))
+            continue;
+
+        const MessageView msg(messages[i]);
+
+        if (getMessageIndexById(msg.getId()) >= 0)
+        {
+            overlapIndex = i;
+            break;
+        }
+    }
+
+    if (overlapIndex < 0)
+    {
+        qDebug() << "No overlap with stored messages";
+        return -1;
+    }
+
+    const MessageView overlapMsg(messages[overlapIndex]);
+
+    if (getMessageIndexById(overlapMsg.getId()) != (int)mMessages.size() - 1)
+    {
+        qDebug() << "Overlap is not the last stored message:" << overlapMsg.getId();
+        return -1;
+    }
+
+    int changed = 0;
+
+    // Unknown message types are not inserted. Filter them before announcing
+    // the number of rows to insert.
+    std::vector<int> newMessageIndexes;
+
+    for (int i = overlapIndex - 1; i >= 0; --i)
+    {
+        if (ATProto::isNullVariant(messages[i]))
+        {
+            qWarning() << "Unknown message";
+            continue;
+        }
+
+        newMessageIndexes.push_back(i);
+    }
+
+    if (!newMessageIndexes.empty())
+    {
+        qDebug() << "New messages:" << newMessageIndexes.size();
+        const int oldLastIndex = (int)mMessages.size() - 1;
+        beginInsertRows({}, mMessages.size(), mMessages.size() + newMessageIndexes.size() - 1);
+
+        for (const int i : newMessageIndexes)
+        {
+            mMessages.emplace_back(messages[i]);
+            indexBack();
+            reportActivity(mMessages.back());
+            ++changed;
+        }
+
+        endInsertRows();
+
+        // The grouping roles of the previous last message depend on the next message.
+        changeData({ int(Role::SameSenderAsNext), int(Role::SameTimeAsNext) }, oldLastIndex, oldLastIndex);
+    }
+
+    // Existing messages could be updated, e.g. reactions
+    for (int i = overlapIndex; i < (int)messages.size(); ++i)
+    {
+        const auto* messageView = std::get_if<ATProto::ChatBskyConvo::MessageView::SharedPtr>(&messages[i]);
+
+        if (!messageView)
+            continue;
+
+        const int index = getMessageIndexById((*messageView)->mId);
+
+        if (index < 0)
+            continue;
+
+        MessageView& storedMsg = mMessages[index];
+
+        if (storedMsg.isDeleted() || (*messageView)->mRev <= storedMsg.getRev())
+            continue;
+
+        qDebug() << "Update existing message:" << storedMsg.getId() << "oldRev:" << storedMsg.getRev() << "newRev:" << (*messageView)->mRev;
+        storedMsg = MessageView(**messageView);
+        reportActivity(storedMsg);
+        changeData({ int(Role::Message) }, index, index);
+        ++changed;
+    }
+
+    return changed;
+}
+
 void MessageListModel::updateMessage(const MessageView& msg)
 {
     qDebug() << "Update message:" << msg.getId() << "rev:" << msg.getRev();
@@ -178,7 +288,7 @@ void MessageListModel::updateMessage(const MessageView& msg)
     qDebug() << "Found message:" << storedMsg.getId() << "rev:" << storedMsg.getRev();
     storedMsg = msg;
     reportActivity(storedMsg);
-    changeData({}, index, index);
+    changeData({ int(Role::Message) }, index, index);
 }
 
 const MessageView* MessageListModel::getLastMessage() const
@@ -206,12 +316,12 @@ QHash<int, QByteArray> MessageListModel::roleNames() const
 
 int MessageListModel::getMessageIndexById(const QString& id) const
 {
-    auto it = mMessageIdToPosIndex.find(id);
+    auto it = mMessageIdToSeq.find(id);
 
-    if (it == mMessageIdToPosIndex.end())
+    if (it == mMessageIdToSeq.end())
         return -1;
 
-    const int index = it->second;
+    const int index = it->second - mFrontSeq;
 
     if (index < 0 || index >= (int)mMessages.size())
     {
@@ -231,15 +341,17 @@ void MessageListModel::setAutoUpdate(bool autoUpdate)
     qDebug() << "Auto update:" << autoUpdate;
 }
 
-void MessageListModel::rebuildIndex()
+void MessageListModel::indexFront()
 {
-    mMessageIdToPosIndex.clear();
+    if (mMessages.size() > 1)
+        --mFrontSeq;
 
-    for (int i = 0; i < (int)mMessages.size(); ++i)
-    {
-        const auto& msg = mMessages[i];
-        mMessageIdToPosIndex[msg.getId()] = i;
-    }
+    mMessageIdToSeq[mMessages.front().getId()] = mFrontSeq;
+}
+
+void MessageListModel::indexBack()
+{
+    mMessageIdToSeq[mMessages.back().getId()] = mFrontSeq + (int)mMessages.size() - 1;
 }
 
 void MessageListModel::changeData(const QList<int>& roles, int begin, int end)
@@ -35,6 +35,11 @@ public:
     void addMessages(const ATProto::ChatBskyConvo::GetMessagesOutput::MessageList& messages, const QString& cursor);
     void updateMessages(const ATProto::ChatBskyConvo::GetMessagesOutput::MessageList& messages, const QString& cursor);
     void updateMessage(const MessageView& msg);
+
+    // Merge the newest messages (newest first) into the model without reloading.
+    // Returns the number of new and updated messages, or -1 if the messages do
+    // not connect to the stored messages and a full reload is needed.
+    int mergeNewMessages(const ATProto::ChatBskyConvo::GetMessagesOutput::MessageList& messages);
     const QString& getCursor() const { return mCursor; }
     Q_INVOKABLE bool isEndOfList() const { return mCursor.isEmpty(); }
     const MessageView* getLastMessage() const;
@@ -48,7 +53,8 @@ protected:
     QHash<int, QByteArray> roleNames() const override;
 
 private:
-    void rebuildIndex();
+    void indexFront();
+    void indexBack();
     void changeData(const QList<int>& roles, int begin = 0, int end = -1);
     void reportActivity(const MessageView& message);
     void reportActivity(const ReactionView& reaction);
@@ -58,7 +64,11 @@ private:
 
     // Ordered from oldest to newest
     std::deque<MessageView> mMessages;
-    std::unordered_map<QString, int> mMessageIdToPosIndex; // to position in mMessages
+
+    // Messages get a sequence number that stays stable when messages are
+    // added at the front or back. Position in mMessages = seq - mFrontSeq.
+    std::unordered_map<QString, int> mMessageIdToSeq;
+    int mFrontSeq = 0;
     QString mCursor;
     std::unordered_map<QString, ChatBasicProfile> mDidMemberMap; // other than user
     bool mAutoUpdate = true;
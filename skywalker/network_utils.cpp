@@ -3,6 +3,7 @@
 #include "network_utils.h"
 #include <QDebug>
 #include <QtGlobal>
+#include <unordered_map>
 
 #ifdef Q_OS_ANDROID
 #include <QJniObject>
@@ -39,4 +40,71 @@ bool isUnmetered()
 #endif
 }
 
+bool isTransientError(QNetworkReply::NetworkError error, int httpStatus)
+{
+    if (httpStatus == 429 || (httpStatus >= 500 && httpStatus <= 599))
+        return true;
+
+    switch (error)
+    {
+    case QNetworkReply::TimeoutError:
+    case QNetworkReply::OperationCanceledError: // transfer time-out
+    case QNetworkReply::ProxyTimeoutError:
+    case QNetworkReply::RemoteHostClosedError:
+    case QNetworkReply::TemporaryNetworkFailureError:
+    case QNetworkReply::NetworkSessionFailedError:
+    case QNetworkReply::UnknownNetworkError:
+    case QNetworkReply::InternalServerError:
+    case QNetworkReply::ServiceUnavailableError:
+    case QNetworkReply::UnknownServerError:
+        return true;
+    default:
+        break;
+    }
+
+    return false;
+}
+
+std::optional<int> getXrpcErrorHttpStatus(const QString& error)
+{
+    static const std::unordered_map<QString, int> XRPC_ERROR_STATUS{
+        { "InvalidRequest", 400 },
+        { "ExpiredToken", 400 },
+        { "InvalidToken", 400 },
+        { "AuthenticationRequired", 401 },
+        { "Forbidden", 403 },
+        { "NotFound", 404 },
+        { "RecordNotFound", 404 },
+        { "PayloadTooLarge", 413 },
+        { "InvalidSwap", 400 },
+        { "BlockedActor", 400 },
+        { "AccountTakedown", 400 },
+        { "AuthFactorTokenRequired", 401 },
+        { "RateLimitExceeded", 429 },
+        { "InternalServerError", 500 },
+        { "MethodNotImplemented", 501 },
+        { "UpstreamFailure", 502 },
+        { "NotEnoughResources", 503 },
+        { "UpstreamTimeout", 504 }
+    };
+
+    auto it = XRPC_ERROR_STATUS.find(error);
+
+    if (it == XRPC_ERROR_STATUS.end())
+        return {};
+
+    return it->second;
+}
+
+bool isTransientXrpcError(const QString& error)
+{
+    const auto httpStatus = getXrpcErrorHttpStatus(error);
+
+    if (httpStatus)
+        return isTransientError(QNetworkReply::NoError, *httpStatus);
+
+    qDebug() << "No XRPC error, network failure:" << error;
+    return isTransientError(QNetworkReply::UnknownNetworkError);
+}
+
 }
@@ -1,10 +1,23 @@
 // Copyright (C) 2024 Michel de Boer
 // License: GPLv3
 #pragma once
+#include <QNetworkReply>
+#include <optional>
 
 namespace Skywalker::NetworkUtils {
 
 int getBandwidthKbps();
 bool isUnmetered();
 
+// A request that failed on a time-out, a temporary network failure, a 5xx
+// response or a 429 (rate limited) response may succeed on a retry.
+bool isTransientError(QNetworkReply::NetworkError error, int httpStatus = 0);
+
+// HTTP status of an XRPC error name as defined by the XRPC spec.
+std::optional<int> getXrpcErrorHttpStatus(const QString& error);
+
+// For errors reported by the ATProto client. The client reports the XRPC error
+// name of an error response. Without a response it reports the network error.
+bool isTransientXrpcError(const QString& error);
+
 }
@@ -166,27 +166,27 @@ signals:
 protected:
     // LocalPostModelChanges
     virtual void postIndexedSecondsAgoChanged() override;
-    virtual void repostTransientChanged() override;
-    virtual void likeCountChanged() override;
-    virtual void likeUriChanged() override;
-    virtual void likeTransientChanged() override;
-    virtual void replyCountChanged() override;
-    virtual void repostCountChanged() override;
-    virtual void quoteCountChanged() override;
-    virtual void repostUriChanged() override;
-    virtual void threadgateUriChanged() override;
-    virtual void replyRestrictionChanged() override;
-    virtual void replyRestrictionListsChanged() override;
-    virtual void hiddenRepliesChanged() override;
-    virtual void threadMutedChanged() override;
-    virtual void bookmarkedChanged() override;
-    virtual void bookmarkTransientChanged() override;
-    virtual void feedbackChanged() override {};
-    virtual void feedbackTransientChanged() override {};
-    virtual void detachedRecordChanged() override;
-    virtual void reAttachedRecordChanged() override;
-    virtual void viewerStatePinnedChanged() override;
-    virtual void postDeletedChanged() override;
+    virtual void repostTransientChanged(const QString& cid) override;
+    virtual void likeCountChanged(const QString& cid) override;
+    virtual void likeUriChanged(const QString& cid) override;
+    virtual void likeTransientChanged(const QString& cid) override;
+    virtual void replyCountChanged(const QString& cid) override;
+    virtual void repostCountChanged(const QString& cid) override;
+    virtual void quoteCountChanged(const QString& cid) override;
+    virtual void repostUriChanged(const QString& cid) override;
+    virtual void threadgateUriChanged(const QString& cid) override;
+    virtual void replyRestrictionChanged(const QString& cid) override;
+    virtual void replyRestrictionListsChanged(const QString& cid) override;
+    virtual void hiddenRepliesChanged(const QString& cid) override;
+    virtual void threadMutedChanged(const QString& uri) override;
+    virtual void bookmarkedChanged(const QString& cid) override;
+    virtual void bookmarkTransientChanged(const QString& cid) override;
+    virtual void feedbackChanged(const QString&) override {};
+    virtual void feedbackTransientChanged(const QString&) override {};
+    virtual void detachedRecordChanged(const QString& cid) override;
+    virtual void reAttachedRecordChanged(const QString& cid) override;
+    virtual void viewerStatePinnedChanged(const QString& cid) override;
+    virtual void postDeletedChanged(const QString& cid) override;
 
     // LocalProfileChanges
     virtual void profileChanged() override {};
@@ -367,7 +367,7 @@ void OffLineMessageChecker::createNotification(const QString channelId, const Ba
 void OffLineMessageChecker::saveSession(const ATProto::ComATProtoServer::Session& session)
 {
     mUserSettings.saveSession(session);
-    mUserSettings.sync();
+    mUserSettings.syncNow();
 }
 
 void OffLineMessageChecker::resumeSession(const QString& did, bool retry)
@@ -593,7 +593,7 @@ void OffLineMessageChecker::checkUnreadNotificationCount()
                 qDebug() << "Unread notification count has been reset by another client";
                 newCount = unread;
                 mUserSettings.setOfflineUnread(mUserDid, 0);
-                mUserSettings.sync();
+                mUserSettings.syncNow();
             }
 
             if (newCount == 0)
@@ -624,7 +624,7 @@ void OffLineMessageChecker::getNotifications(int toRead)
 
             const int prevUnread = mUserSettings.getOfflineUnread(mUserDid);
             mUserSettings.setOfflineUnread(mUserDid, prevUnread + toRead);
-            mUserSettings.sync();
+            mUserSettings.syncNow();
 
             if (!added)
                 checkUnreadChatNotificationCount();
@@ -1279,7 +1279,7 @@ void OffLineMessageChecker::waitForStop(const StoppedCb& stoppedCb)
     }
 
     // Reload settings
-    sUserSettings->sync();
+    sUserSettings->syncNow();
 
     if (!sUserSettings->isOfflineMessageCheckRunning())
     {
@@ -106,7 +106,7 @@ bool pickPhoto(bool pickVideo, int maxItems)
     return true;
 }
 
-QImage loadImage(const QString& imgName)
+QImage loadImage(const QString& imgName, bool checkPermission)
 {
     qDebug() << "Load image:" << imgName;
 
@@ -114,7 +114,7 @@ QImage loadImage(const QString& imgName)
     {
         const QString fileName = imgName.sliced(7);
 
-        if (!FileUtils::checkReadMediaPermission())
+        if (checkPermission && !FileUtils::checkReadMediaPermission())
         {
             qWarning() << "No permission to read:" << fileName;
             return {};
@@ -140,9 +140,9 @@ QImage loadImage(const QString& imgName)
     return {};
 }
 
-QImage cutRect(const QString& imgName, const QRect& rect)
+QImage cutRect(const QString& imgName, const QRect& rect, bool checkPermission)
 {
-    QImage img = loadImage(imgName);
+    QImage img = loadImage(imgName, checkPermission);
 
     if (img.isNull())
         return {};
@@ -13,7 +13,9 @@ std::tuple<QImage, QString /* gif temp file name */, QString /* error */> readIm
 // Start photo pick selector on Android.
 bool pickPhoto(bool pickVideo, int maxItems);
 
-QImage loadImage(const QString& imgName);
+// The read permission check may need the GUI thread. Skip it when loading
+// on a worker thread after checking the permission up front.
+QImage loadImage(const QString& imgName, bool checkPermission = true);
 
 // Create a binary blob (image/*) for uploading an image.
 // { mimetype, image size } is returned
@@ -23,7 +25,7 @@ QImage loadImage(const QString& imgName);
 std::tuple<QString, QSize> createBlob(QByteArray& blob, int maxBytes, const QString& imgName, const QStringList& extraFormats = { "png", "webp" });
 std::tuple<QString, QSize> createBlob(QByteArray& blob, int maxBytes, QImage img, const QStringList& extraFormats = { "png", "webp" }, const QString& fileName = "");
 
-QImage cutRect(const QString& imgName, const QRect& rect);
+QImage cutRect(const QString& imgName, const QRect& rect, bool checkPermission = true);
 
 void savePhoto(ImageReader* imageReader, const QString& sourceUrl, bool cache,
                const std::function<void(const QString&)>& successCb,
@@ -0,0 +1,294 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#include "poll_scheduler.h"
+#include <QPointer>
+
+namespace Skywalker {
+
+using namespace std::chrono_literals;
+
+static constexpr auto RUN_TIMEOUT = 30s;
+
+// A job may run at most this fraction of its interval early or late to
+// share a wake-up with other jobs.
+static constexpr int SLACK_DIVISOR = 5;
+static constexpr auto MAX_SLACK = 30s;
+
+PollScheduler::PollScheduler(QObject* parent) :
+    QObject(parent)
+{
+    mTimer.setSingleShot(true);
+    mTimer.setTimerType(Qt::CoarseTimer);
+    connect(&mTimer, &QTimer::timeout, this, [this]{ runDueJobs(); });
+}
+
+PollScheduler::JobId PollScheduler::addJob(const QString& name, Duration interval, Duration maxInterval, const JobCb& job)
+{
+    Q_ASSERT(interval > 0ms);
+    const JobId id = mNextJobId++;
+    auto& newJob = mJobs[id];
+    newJob.mJob = job;
+    newJob.mBaseInterval = interval;
+    newJob.mMaxInterval = std::max(interval, maxInterval);
+    newJob.mRunTimeout = RUN_TIMEOUT;
+    newJob.mStats.mName = name;
+    newJob.mStats.mInterval = interval;
+    qDebug() << "Added poll job:" << id << name << "interval:" << interval.count() << "max:" << newJob.mMaxInterval.count();
+    return id;
+}
+
+void PollScheduler::removeJob(JobId id)
+{
+    if (mJobs.erase(id))
+        schedule();
+}
+
+void PollScheduler::setRunTimeout(JobId id, Duration timeout)
+{
+    auto it = mJobs.find(id);
+
+    if (it == mJobs.end())
+    {
+        qWarning() << "Unknown poll job:" << id;
+        return;
+    }
+
+    Q_ASSERT(timeout > 0ms);
+    it->second.mRunTimeout = timeout;
+
+    if (it->second.mRunning)
+        schedule();
+}
+
+void PollScheduler::startJob(JobId id)
+{
+    auto it = mJobs.find(id);
+
+    if (it == mJobs.end())
+    {
+        qWarning() << "Unknown poll job:" << id;
+        return;
+    }
+
+    startJob(id, it->second.mBaseInterval);
+}
+
+void PollScheduler::startJob(JobId id, Duration firstDelay)
+{
+    auto it = mJobs.find(id);
+
+    if (it == mJobs.end())
+    {
+        qWarning() << "Unknown poll job:" << id;
+        return;
+    }
+
+    auto& job = it->second;
+    qDebug() << "Start poll job:" << job.mStats.mName << "first delay:" << firstDelay.count();
+    job.mActive = true;
+    job.mRunning = false;
+    ++job.mRunSeq;
+    job.mStats.mInterval = job.mBaseInterval;
+    job.mDue = Clock::now() + firstDelay;
+    schedule();
+}
+
+void PollScheduler::stopJob(JobId id)
+{
+    auto it = mJobs.find(id);
+
+    if (it == mJobs.end())
+        return;
+
+    auto& job = it->second;
+    qDebug() << "Stop poll job:" << job.mStats.mName;
+    job.mActive = false;
+    job.mRunning = false;
+
+    // Results of a run in progress are ignored.
+    ++job.mRunSeq;
+    schedule();
+}
+
+bool PollScheduler::isJobActive(JobId id) const
+{
+    auto it = mJobs.find(id);
+    return it != mJobs.end() && it->second.mActive;
+}
+
+void PollScheduler::resetInterval(JobId id)
+{
+    auto it = mJobs.find(id);
+
+    if (it == mJobs.end())
+        return;
+
+    auto& job = it->second;
+
+    if (job.mStats.mInterval == job.mBaseInterval)
+        return;
+
+    qDebug() << "Reset interval of poll job:" << job.mStats.mName;
+    job.mStats.mInterval = job.mBaseInterval;
+
+    if (!job.mActive || job.mRunning)
+        return;
+
+    job.mDue = std::min(job.mDue, Clock::now() + job.mBaseInterval);
+    schedule();
+}
+
+std::vector<PollScheduler::Stats> PollScheduler::getStats() const
+{
+    std::vector<Stats> stats;
+    stats.reserve(mJobs.size());
+
+    for (const auto& [_, job] : mJobs)
+        stats.push_back(job.mStats);
+
+    return stats;
+}
+
+void PollScheduler::logStats() const
+{
+    for (const auto& [id, job] : mJobs)
+    {
+        const auto& stats = job.mStats;
+        qDebug() << "Poll job:" << id << stats.mName << "active:" << job.mActive
+                 << "interval:" << stats.mInterval.count() << "runs:" << stats.mRuns
+                 << "changed:" << stats.mChanged << "unchanged:" << stats.mUnchanged
+                 << "failed:" << stats.mFailed << "aligned:" << stats.mAligned
+                 << "last run:" << stats.mLastRun;
+    }
+}
+
+PollScheduler::Duration PollScheduler::getSlack(const Job& job)
+{
+    return std::min(job.mStats.mInterval / SLACK_DIVISOR, Duration(MAX_SLACK));
+}
+
+void PollScheduler::runDueJobs()
+{
+    const auto now = Clock::now();
+    std::vector<JobId> dueJobs;
+    std::vector<std::pair<JobId, uint64_t>> timedOutJobs;
+
+    for (const auto& [id, job] : mJobs)
+    {
+        if (!job.mActive)
+            continue;
+
+        if (job.mRunning)
+        {
+            if (now - job.mRunStart >= job.mRunTimeout)
+                timedOutJobs.push_back({id, job.mRunSeq});
+
+            continue;
+        }
+
+        if (job.mDue - getSlack(job) <= now)
+            dueJobs.push_back(id);
+    }
+
+    for (const auto& [id, runSeq] : timedOutJobs)
+    {
+        qWarning() << "Poll job timed out:" << id;
+        jobDone(id, runSeq, Result::FAILED);
+    }
+
+    // Jobs may get removed or stopped by other jobs while running.
+    for (const JobId id : dueJobs)
+    {
+        auto it = mJobs.find(id);
+
+        if (it != mJobs.end() && it->second.mActive && !it->second.mRunning)
+            runJob(id, it->second, now);
+    }
+
+    schedule();
+}
+
+void PollScheduler::runJob(JobId id, Job& job, Clock::time_point now)
+{
+    qDebug() << "Run poll job:" << job.mStats.mName;
+
+    if (now < job.mDue)
+        ++job.mStats.mAligned;
+
+    job.mRunning = true;
+    job.mRunStart = now;
+    job.mDue = now + job.mStats.mInterval;
+    ++job.mStats.mRuns;
+    job.mStats.mLastRun = QDateTime::currentDateTimeUtc();
+    const auto runSeq = ++job.mRunSeq;
+
+    // Copy the callback as the job may get removed while it runs.
+    const JobCb jobCb = job.mJob;
+    jobCb([scheduler=QPointer<PollScheduler>(this), id, runSeq](Result result){
+        if (scheduler)
+            scheduler->jobDone(id, runSeq, result);
+    });
+}
+
+void PollScheduler::jobDone(JobId id, uint64_t runSeq, Result result)
+{
+    auto it = mJobs.find(id);
+
+    if (it == mJobs.end())
+        return;
+
+    auto& job = it->second;
+
+    if (!job.mRunning || job.mRunSeq != runSeq)
+        return;
+
+    job.mRunning = false;
+    auto& stats = job.mStats;
+
+    switch (result)
+    {
+    case Result::CHANGED:
+        ++stats.mChanged;
+        stats.mInterval = job.mBaseInterval;
+        break;
+    case Result::UNCHANGED:
+        ++stats.mUnchanged;
+        stats.mInterval = std::min(stats.mInterval * 2, job.mMaxInterval);
+        break;
+    case Result::FAILED:
+        ++stats.mFailed;
+        stats.mInterval = std::min(stats.mInterval * 2, job.mMaxInterval);
+        break;
+    }
+
+    job.mDue = job.mRunStart + stats.mInterval;
+    schedule();
+}
+
+void PollScheduler::schedule()
+{
+    std::optional<Clock::time_point> wakeUp;
+
+    for (const auto& [_, job] : mJobs)
+    {
+        if (!job.mActive)
+            continue;
+
+        // Wake up as late as allowed, such that more jobs fit in the same wake-up.
+        const auto jobWakeUp = job.mRunning ? job.mRunStart + job.mRunTimeout : job.mDue + getSlack(job);
+
+        if (!wakeUp || jobWakeUp < *wakeUp)
+            wakeUp = jobWakeUp;
+    }
+
+    if (!wakeUp)
+    {
+        mTimer.stop();
+        return;
+    }
+
+    const auto delay = std::chrono::duration_cast<Duration>(*wakeUp - Clock::now());
+    mTimer.start(std::max(delay, Duration(0)));
+}
+
+}
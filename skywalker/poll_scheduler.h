@@ -0,0 +1,97 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <QDateTime>
+#include <QObject>
+#include <QTimer>
+#include <chrono>
+#include <map>
+#include <optional>
+
+namespace Skywalker {
+
+// Runs periodic jobs from a single timer. Jobs that are due within a short
+// window get run in the same wake-up, so background polling wakes up the
+// radio less often. A job reports its result when it is done. When nothing
+// changed or the job failed, its interval doubles up to its max interval.
+class PollScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum class Result
+    {
+        CHANGED,
+        UNCHANGED,
+        FAILED
+    };
+
+    using Duration = std::chrono::milliseconds;
+    using JobId = int;
+    using DoneCb = std::function<void(Result)>;
+    using JobCb = std::function<void(const DoneCb&)>;
+
+    struct Stats
+    {
+        QString mName;
+        Duration mInterval{0};
+        int mRuns = 0;
+        int mChanged = 0;
+        int mUnchanged = 0;
+        int mFailed = 0;
+        int mAligned = 0; // runs started before due time to share a wake-up
+        QDateTime mLastRun;
+    };
+
+    explicit PollScheduler(QObject* parent = nullptr);
+
+    // A job that does not report done within its run timeout (default 30s) is
+    // considered failed. Set maxInterval equal to interval to disable backoff.
+    JobId addJob(const QString& name, Duration interval, Duration maxInterval, const JobCb& job);
+    void removeJob(JobId id);
+
+    // For jobs that do a variable amount of work per run. A new timeout
+    // applies to a running job too.
+    void setRunTimeout(JobId id, Duration timeout);
+
+    // The first run is after the job interval, unless another delay is given.
+    void startJob(JobId id);
+    void startJob(JobId id, Duration firstDelay);
+    void stopJob(JobId id);
+    bool isJobActive(JobId id) const;
+
+    // Go back to the base interval, e.g. on user activity.
+    void resetInterval(JobId id);
+
+    std::vector<Stats> getStats() const;
+    void logStats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Job
+    {
+        JobCb mJob;
+        Duration mBaseInterval{0};
+        Duration mMaxInterval{0};
+        Duration mRunTimeout{0};
+        Clock::time_point mDue;
+        Clock::time_point mRunStart;
+        bool mActive = false;
+        bool mRunning = false;
+        uint64_t mRunSeq = 0;
+        Stats mStats;
+    };
+
+    static Duration getSlack(const Job& job);
+    void runDueJobs();
+    void runJob(JobId id, Job& job, Clock::time_point now);
+    void jobDone(JobId id, uint64_t runSeq, Result result);
+    void schedule();
+
+    std::map<JobId, Job> mJobs;
+    JobId mNextJobId = 1;
+    QTimer mTimer;
+};
+
+}
@@ -18,6 +18,18 @@ namespace Skywalker {
 
 int Post::sNextGapId = 1;
 
+// Callers modify the views they get, e.g. to set the content visibility.
+// Therefore the getters return copies of these views.
+struct Post::EmbedViews
+{
+    bool mCreated = false;
+    QList<ImageView> mImages;
+    VideoView::Ptr mVideo;
+    ExternalView::Ptr mExternal;
+    RecordView::Ptr mRecord;
+    RecordWithMediaView::Ptr mRecordWithMedia;
+};
+
 Post Post::createGapPlaceHolder(const QString& gapCursor)
 {
     Post post;
@@ -132,6 +144,7 @@ Post::Post(const ATProto::AppBskyFeed::FeedViewPost::SharedPtr feedViewPost) :
     if (feedViewPost)
     {
         mPost = feedViewPost->mPost;
+        mEmbedViews = std::make_shared<EmbedViews>();
 
         // Cache authors to minimize network requests for authors later.
         const BasicProfile profile = BasicProfile(mPost->mAuthor);
@@ -151,7 +164,8 @@ Post::Post(const ATProto::AppBskyFeed::FeedViewPost::SharedPtr feedViewPost) :
 }
 
 Post::Post(const ATProto::AppBskyFeed::PostView::SharedPtr postView) :
-    mPost(postView)
+    mPost(postView),
+    mEmbedViews(std::make_shared<EmbedViews>())
 {
     Q_ASSERT(postView);
     const BasicProfile profile = BasicProfile(mPost->mAuthor);
@@ -590,38 +604,72 @@ QString Post::getUnknownEmbedType() const
     return embed->mType;
 }
 
-QList<ImageView> Post::getImages() const
+const Post::EmbedViews* Post::getEmbedViews() const
 {
+    if (!mEmbedViews)
+        return nullptr;
+
+    if (mEmbedViews->mCreated)
+        return mEmbedViews.get();
+
+    auto& views = *mEmbedViews;
+    views.mCreated = true;
+
     if (!mPost || !mPost->mEmbed)
-        return {};
-    
-    if (ATProto::holdsNonNull<ATProto::AppBskyEmbed::ImagesView::SharedPtr>(*mPost->mEmbed))
+        return mEmbedViews.get();
+
+    const auto& embed = *mPost->mEmbed;
+
+    if (ATProto::holdsNonNull<ATProto::AppBskyEmbed::ImagesView::SharedPtr>(embed))
     {
-        const auto& imagesView = std::get<ATProto::AppBskyEmbed::ImagesView::SharedPtr>(*mPost->mEmbed);
-        QList<ImageView> images;
+        const auto& imagesView = std::get<ATProto::AppBskyEmbed::ImagesView::SharedPtr>(embed);
 
         for (const auto& img : imagesView->mImages)
-            images.push_back(ImageView(img));
-
-        return images;
+            views.mImages.push_back(ImageView(img));
     }
-    else if (ATProto::holdsNonNull<ATProto::AppBskyEmbed::GalleryView::SharedPtr>(*mPost->mEmbed))
+    else if (ATProto::holdsNonNull<ATProto::AppBskyEmbed::GalleryView::SharedPtr>(embed))
     {
-        const auto& galleryView = std::get<ATProto::AppBskyEmbed::GalleryView::SharedPtr>(*mPost->mEmbed);
-        QList<ImageView> images;
+        const auto& galleryView = std::get<ATProto::AppBskyEmbed::GalleryView::SharedPtr>(embed);
 
         for (const auto& item : galleryView->mItems)
         {
             const auto* image = std::get_if<ATProto::AppBskyEmbed::GalleryViewImage::SharedPtr>(&item);
 
             if (image)
-                images.push_back(ImageView(*image));
+                views.mImages.push_back(ImageView(*image));
         }
+    }
+    else if (ATProto::holdsNonNull<ATProto::AppBskyEmbed::VideoView::SharedPtr>(embed))
+    {
+        const auto& video = std::get<ATProto::AppBskyEmbed::VideoView::SharedPtr>(embed);
+        views.mVideo = std::make_unique<VideoView>(video);
+    }
+    else if (ATProto::holdsNonNull<ATProto::AppBskyEmbed::ExternalView::SharedPtr>(embed))
+    {
+        const auto& external = std::get<ATProto::AppBskyEmbed::ExternalView::SharedPtr>(embed)->mExternal;
+        views.mExternal = std::make_unique<ExternalView>(external);
+    }
+    else if (ATProto::holdsNonNull<ATProto::AppBskyEmbed::RecordView::SharedPtr>(embed))
+    {
+        const auto& recordView = std::get<ATProto::AppBskyEmbed::RecordView::SharedPtr>(embed);
+        views.mRecord = std::make_unique<RecordView>(*recordView);
+    }
+    else if (ATProto::holdsNonNull<ATProto::AppBskyEmbed::RecordWithMediaView::SharedPtr>(embed))
+    {
+        const auto& recordView = std::get<ATProto::AppBskyEmbed::RecordWithMediaView::SharedPtr>(embed);
+        views.mRecordWithMedia = std::make_unique<RecordWithMediaView>(recordView);
 
-        return images;
+        // Create the record view now, such that clones do not create their own.
+        views.mRecordWithMedia->getRecordPtr();
     }
 
-    return {};
+    return mEmbedViews.get();
+}
+
+QList<ImageView> Post::getImages() const
+{
+    const auto* views = getEmbedViews();
+    return views ? views->mImages : QList<ImageView>{};
 }
 
 bool Post::hasImages(bool includingRecordWithMedia) const
@@ -638,8 +686,8 @@ bool Post::hasImages(bool includingRecordWithMedia) const
     if (!includingRecordWithMedia)
         return false;
 
-    const auto record = getRecordWithMediaView();
-    return record ? record->hasImages() : false;
+    const auto* views = getEmbedViews();
+    return views && views->mRecordWithMedia ? views->mRecordWithMedia->hasImages() : false;
 }
 
 QList<ImageView> Post::getDraftImages() const
@@ -694,14 +742,12 @@ QList<ImageView> Post::getDraftImages() const
 
 VideoView::Ptr Post::getVideoView() const
 {
-    if (!mPost)
-        return {};
+    const auto* views = getEmbedViews();
 
-    if (!mPost->mEmbed || !ATProto::holdsNonNull<ATProto::AppBskyEmbed::VideoView::SharedPtr>(*mPost->mEmbed))
+    if (!views || !views->mVideo)
         return {};
 
-    const auto& video = std::get<ATProto::AppBskyEmbed::VideoView::SharedPtr>(*mPost->mEmbed);
-    return std::make_unique<VideoView>(video);
+    return std::make_unique<VideoView>(*views->mVideo);
 }
 
 bool Post::hasVideo(bool includingRecordWithMedia) const
@@ -715,8 +761,8 @@ bool Post::hasVideo(bool includingRecordWithMedia) const
     if (!includingRecordWithMedia)
         return false;
 
-    const auto record = getRecordWithMediaView();
-    return record ? record->hasVideo() : false;
+    const auto* views = getEmbedViews();
+    return views && views->mRecordWithMedia ? views->mRecordWithMedia->hasVideo() : false;
 }
 
 VideoView::Ptr Post::getDraftVideoView() const
@@ -746,14 +792,12 @@ VideoView::Ptr Post::getDraftVideoView() const
 
 ExternalView::Ptr Post::getExternalView() const
 {
-    if (!mPost)
-        return {};
-    
-    if (!mPost->mEmbed || !ATProto::holdsNonNull<ATProto::AppBskyEmbed::ExternalView::SharedPtr>(*mPost->mEmbed))
+    const auto* views = getEmbedViews();
+
+    if (!views || !views->mExternal)
         return {};
 
-    const auto& external = std::get<ATProto::AppBskyEmbed::ExternalView::SharedPtr>(*mPost->mEmbed)->mExternal;
-    return std::make_unique<ExternalView>(external);
+    return std::make_unique<ExternalView>(*views->mExternal);
 }
 
 bool Post::hasExternal() const
@@ -763,26 +807,22 @@ bool Post::hasExternal() const
 
 RecordView::Ptr Post::getRecordView() const
 {
-    if (!mPost)
-        return {};
-    
-    if (!mPost->mEmbed || !ATProto::holdsNonNull<ATProto::AppBskyEmbed::RecordView::SharedPtr>(*mPost->mEmbed))
+    const auto* views = getEmbedViews();
+
+    if (!views || !views->mRecord)
         return {};
 
-    const auto& recordView = std::get<ATProto::AppBskyEmbed::RecordView::SharedPtr>(*mPost->mEmbed);
-    return std::make_unique<RecordView>(*recordView);
+    return std::make_unique<RecordView>(views->mRecord->clone());
 }
 
 RecordWithMediaView::Ptr Post::getRecordWithMediaView() const
 {
-    if (!mPost)
-        return {};
-    
-    if (!mPost->mEmbed || !ATProto::holdsNonNull<ATProto::AppBskyEmbed::RecordWithMediaView::SharedPtr>(*mPost->mEmbed))
+    const auto* views = getEmbedViews();
+
+    if (!views || !views->mRecordWithMedia)
         return {};
 
-    const auto& recordView = std::get<ATProto::AppBskyEmbed::RecordWithMediaView::SharedPtr>(*mPost->mEmbed);
-    return std::make_unique<RecordWithMediaView>(recordView);
+    return std::make_unique<RecordWithMediaView>(views->mRecordWithMedia->clone());
 }
 
 RecordView::SharedPtr Post::getRecordViewFromRecordOrRecordWithMedia() const
@@ -190,9 +190,16 @@ public:
     QJsonObject toJson() const;
 
 private:
+    struct EmbedViews;
+    const EmbedViews* getEmbedViews() const;
+
     // null is place holder for more posts (gap)
     ATProto::AppBskyFeed::PostView::SharedPtr mPost;
 
+    // Views on mPost->mEmbed, created on first use and shared by all copies
+    // of this post.
+    std::shared_ptr<EmbedViews> mEmbedViews;
+
     // null if the post represents a reply ref.
     ATProto::AppBskyFeed::FeedViewPost::SharedPtr mFeedViewPost;
 
@@ -2,6 +2,7 @@
 // License: GPLv3
 #include "post_feed_model.h"
 #include "definitions.h"
+#include "feed_spill_store.h"
 #include "skywalker.h"
 #include "user_settings.h"
 #include "utils.h"
@@ -534,8 +535,7 @@ void PostFeedModel::addPage(Page::Ptr page)
         {
             // Set end of feed indication on existing row.
             mFeed.back().setEndOfFeed(true);
-            const auto index = createIndex(mFeed.size() - 1, 0);
-            emit dataChanged(index, index, { int(Role::EndOfFeed) });
+            changePhysicalRowData(mFeed.size() - 1, { int(Role::EndOfFeed) });
         }
     }
 
@@ -567,6 +567,9 @@ void PostFeedModel::removeTailPosts(int size)
         return;
     }
 
+    if (mSpillStore)
+        spillTailPages(removeIndexCursorIt);
+
     const size_t removeCount = mFeed.size() - removeIndex;
     removeTailFromFilteredPostModels(removeCount);
 
@@ -1832,4 +1835,47 @@ void PostFeedModel::logIndices() const
         qDebug() << "Gap:" << gapId << "Index:" << index;
 }
 
+// Each page runs from the post after a cursor index up to and including the
+// next cursor index. The page can be fetched with the cursor at its start.
+void PostFeedModel::spillTailPages(std::map<size_t, QString>::const_iterator fromIndexCursorIt) const
+{
+    Q_ASSERT(mSpillStore);
+
+    for (auto it = fromIndexCursorIt; it != mIndexCursorMap.end(); ++it)
+    {
+        const auto nextIt = std::next(it);
+        const size_t startIndex = it->first + 1;
+        const size_t endIndex = nextIt != mIndexCursorMap.end() ? nextIt->first + 1 : mFeed.size();
+        const QString nextCursor = nextIt != mIndexCursorMap.end() ? nextIt->second : QString{};
+        FeedSpillStore::FeedViewPostList feed;
+        std::unordered_set<const ATProto::AppBskyFeed::FeedViewPost*> added;
+        bool hasGap = false;
+
+        for (size_t i = startIndex; i < endIndex; ++i)
+        {
+            const Post& post = mFeed[i];
+
+            if (post.isGap())
+            {
+                hasGap = true;
+                break;
+            }
+
+            // Parent posts are created from the reply refs of their feed view post.
+            const auto feedViewPost = post.getFeedViewPost();
+
+            if (feedViewPost && added.insert(feedViewPost.get()).second)
+                feed.push_back(feedViewPost);
+        }
+
+        if (hasGap)
+        {
+            qDebug() << "Page with gap not spilled, index:" << startIndex;
+            continue;
+        }
+
+        mSpillStore->spillPage(it->second, nextCursor, feed);
+    }
+}
+
 }
@@ -15,6 +15,8 @@
 
 namespace Skywalker {
 
+class FeedSpillStore;
+
 class PostFeedModel : public AbstractPostFeedModel
 {
     Q_OBJECT
@@ -103,6 +105,8 @@ public:
     // Returns 0 otherwise.
     int gapFillFeed(ATProto::AppBskyFeed::OutputFeed::SharedPtr&& feed, int gapId);
 
+    // Pages of removed tail posts are spilled to the spill store if set.
+    void setSpillStore(FeedSpillStore* spillStore) { mSpillStore = spillStore; }
     void removeTailPosts(int size);
     void removeHeadPosts(int size);
     void removePosts(int startIndex, int size);
@@ -227,6 +231,7 @@ private:
 
     void addToIndices(int offset, size_t startAtIndex);
     void logIndices() const;
+    void spillTailPages(std::map<size_t, QString>::const_iterator fromIndexCursorIt) const;
 
     bool mIsHomeFeed = false;
     const ATProto::UserPreferences& mUserPreferences;
@@ -245,6 +250,7 @@ private:
     std::unordered_map<int, size_t> mGapIdIndexMap;
 
     int mLastInsertedRowIndex = -1;
+    FeedSpillStore* mSpillStore = nullptr;
     QString mFeedName;
     GeneratorView mGeneratorView;
     ListViewBasic mListView;
@@ -4,17 +4,26 @@
 #include "file_utils.h"
 #include "jni_callback.h"
 #include "language_utils.h"
+#include "network_utils.h"
+#include "link_card_store.h"
 #include "photo_picker.h"
 #include "shared_image_provider.h"
 #include "skywalker.h"
 #include "temp_file_holder.h"
+#include "upload_progress_device.h"
 #include <atproto/lib/rich_text_master.h>
 #include <QImageReader>
 #include <QMimeDatabase>
 #include <QMimeType>
+#include <QTimer>
 
 namespace Skywalker {
 
+using namespace std::chrono_literals;
+
+static constexpr int MAX_VIDEO_UPLOAD_RETRIES = 2;
+static constexpr auto VIDEO_UPLOAD_RETRY_DELAY = 3s;
+
 PostUtils::PostUtils(QObject* parent) :
     WrappedSkywalker(parent),
     Presence(),
@@ -577,22 +586,39 @@ void PostUtils::continuePost(const PostAttachmentImages& images, ATProto::AppBsk
 {
     if (imgIndex >= images.mFileNames.size())
     {
+        mImageBlobPreparer = nullptr;
         continuePost(post, postFeedContext);
         return;
     }
 
-    emit postProgress(tr("Uploading image #%1").arg(imgIndex + 1));
+    if (imgIndex == 0)
+    {
+        const int MAX_BYTES = images.mFileNames.size() <= ATProto::AppBskyEmbed::Images::MAX_IMAGES ?
+                                  ATProto::AppBskyEmbed::Image::MAX_BYTES :
+                                  ATProto::AppBskyEmbed::GalleryImage::MAX_BYTES;
 
-    const int MAX_BYTES = images.mFileNames.size() <= ATProto::AppBskyEmbed::Images::MAX_IMAGES ?
-                              ATProto::AppBskyEmbed::Image::MAX_BYTES :
-                              ATProto::AppBskyEmbed::GalleryImage::MAX_BYTES;
+        mImageBlobPreparer = std::make_unique<ImageBlobPreparer>();
+        mImageBlobPreparer->prepare(images.mFileNames, MAX_BYTES);
+    }
 
-    const auto& fileName = images.mFileNames[imgIndex];
-    QByteArray blob;
-    const auto [mimeType, imgSize] = PhotoPicker::createBlob(blob, MAX_BYTES, fileName);
+    Q_ASSERT(mImageBlobPreparer);
+    emit postProgress(tr("Preparing image #%1").arg(imgIndex + 1));
 
-    if (blob.isEmpty())
+    mImageBlobPreparer->getBlob(imgIndex,
+        [this, presence=getPresence(), images, post, postFeedContext, imgIndex](const ImageBlobPreparer::Blob& blob){
+            if (presence)
+                continuePost(images, blob, post, postFeedContext, imgIndex);
+        });
+}
+
+void PostUtils::continuePost(const PostAttachmentImages& images, const ImageBlobPreparer::Blob& blob,
+                             ATProto::AppBskyFeed::Record::Post::SharedPtr post,
+                             const PostFeedContext& postFeedContext, int imgIndex)
+{
+    if (blob.mData.isEmpty())
     {
+        // NOTE: we get called from the preparer, so it cannot be deleted here.
+        mImageBlobPreparer->cancel();
         emit postFailed(tr("Could not load image #%1").arg(imgIndex + 1));
         return;
     }
@@ -600,7 +626,10 @@ void PostUtils::continuePost(const PostAttachmentImages& images, ATProto::AppBsk
     if (!bskyClient())
         return;
 
-    bskyClient()->uploadBlob(blob, mimeType,
+    emit postProgress(tr("Uploading image #%1").arg(imgIndex + 1));
+    const QSize imgSize = blob.mSize;
+
+    bskyClient()->uploadBlob(blob.mData, blob.mMimeType,
         [this, presence=getPresence(), imgSize, images, post, postFeedContext, imgIndex](auto blob){
             if (!presence)
                 return;
@@ -620,6 +649,7 @@ void PostUtils::continuePost(const PostAttachmentImages& images, ATProto::AppBsk
                 return;
 
             qDebug() << "Post failed:" << error << " - " << msg;
+            mImageBlobPreparer = nullptr;
             emit postFailed(msg);
         });
 }
@@ -641,12 +671,24 @@ void PostUtils::continuePost(const PostAttachmentLinkCard& card, ATProto::AppBsk
         return;
     }
 
+    const QString& thumbUrl = card.mLinkCard->getThumb();
+    const QImage storedThumb = LinkCardStore::instance().getThumb(thumbUrl);
+
+    if (!storedThumb.isNull())
+    {
+        continuePost(card, storedThumb, post, postFeedContext);
+        return;
+    }
+
     emit postProgress(tr("Retrieving card image"));
 
-    imageReader()->getImage(card.mLinkCard->getThumb(),
-        [this, presence=getPresence(), card, post, postFeedContext](auto image){
-            if (presence)
-                continuePost(card, image, post, postFeedContext);
+    imageReader()->getImage(thumbUrl,
+        [this, presence=getPresence(), card, post, postFeedContext, thumbUrl](auto image){
+            if (!presence)
+                return;
+
+            LinkCardStore::instance().putThumb(thumbUrl, image);
+            continuePost(card, image, post, postFeedContext);
         },
         [this, presence=getPresence(), card, post, postFeedContext](const QString& error){
             if (!presence)
@@ -789,15 +831,67 @@ void PostUtils::continuePost(const PostAttachmentVideo& video, ATProto::AppBskyF
 void PostUtils::continuePost(std::shared_ptr<QIODevice> ioDevice, const PostAttachmentVideo& video,
                              ATProto::AppBskyFeed::Record::Post::SharedPtr post,
                              const PostFeedContext& postFeedContext)
+{
+    Q_ASSERT(ioDevice);
+    const qint64 videoSize = ioDevice->isSequential() ? ioDevice->bytesAvailable() : ioDevice->size();
+    qDebug() << "Video size:" << videoSize;
+
+    // A video over the limits is only rejected after the whole transfer.
+    emit postProgress(tr("Checking limits"));
+
+    getVideoUploadLimits(
+        [this, presence=getPresence(), ioDevice, videoSize, video, post, postFeedContext](const VideoUploadLimits& limits){
+            if (!presence)
+                return;
+
+            // The upload service does the final check on the limits.
+            if (!limits.isValid())
+            {
+                qWarning() << "Could not check limits, continue upload:" << limits.getError() << limits.getMessage();
+                uploadVideo(ioDevice, videoSize, video, post, postFeedContext);
+                return;
+            }
+
+            if (!limits.canUploadBytes(videoSize))
+            {
+                qWarning() << "Cannot upload video:" << videoSize << "remaining:" << limits.getRemainingDailyBytes() << limits.getError() << limits.getMessage();
+
+                if (!limits.getMessage().isEmpty())
+                    emit postFailed(limits.getMessage());
+                else if (limits.canUpload())
+                    emit postFailed(tr("Video exceeds the daily upload limit"));
+                else
+                    emit postFailed(limits.getError());
+
+                return;
+            }
+
+            uploadVideo(ioDevice, videoSize, video, post, postFeedContext);
+        });
+}
+
+void PostUtils::uploadVideo(std::shared_ptr<QIODevice> ioDevice, qint64 videoSize, const PostAttachmentVideo& video,
+                            ATProto::AppBskyFeed::Record::Post::SharedPtr post,
+                            const PostFeedContext& postFeedContext, int retry)
 {
     if (!bskyClient())
         return;
 
     Q_ASSERT(ioDevice);
 
-    qDebug() << "Upload video:" << QSize(video.mWidth, video.mHeight);
-    bskyClient()->uploadVideo(ioDevice.get(),
-        [this, presence=getPresence(), video, post, postFeedContext, ioDevice](ATProto::AppBskyVideo::JobStatus::SharedPtr output){
+    auto uploadDevice = std::make_shared<UploadProgressDevice>(ioDevice, videoSize,
+        [this, presence=getPresence(), video](qint64 bytesRead, qint64 totalBytes){
+            if (!presence)
+                return;
+
+            const int percentage = int(std::min(bytesRead, totalBytes) * 100 / totalBytes);
+            const QString msg = video.mIsGif ? tr("Uploading GIF") : tr("Uploading video");
+            emit postProgress(QString("%1 %2%").arg(msg).arg(percentage));
+        });
+
+    qDebug() << "Upload video:" << QSize(video.mWidth, video.mHeight) << "retry:" << retry;
+    bskyClient()->uploadVideo(uploadDevice.get(),
+        [this, presence=getPresence(), video, post, postFeedContext, uploadDevice](ATProto::AppBskyVideo::JobStatus::SharedPtr output){
             if (!presence)
                 return;
 
@@ -829,10 +923,27 @@ void PostUtils::continuePost(std::shared_ptr<QIODevice> ioDevice, const PostAtta
                     emit postProgress(msg);
                 });
         },
-        [this, presence=getPresence(), ioDevice](const QString& error, const QString& msg){
+        [this, presence=getPresence(), ioDevice, videoSize, video, post, postFeedContext, retry, uploadDevice](const QString& error, const QString& msg){
             if (!presence)
                 return;
 
+            // The video service cannot resume an upload. Start over if the
+            // video can be read again.
+            if (retry < MAX_VIDEO_UPLOAD_RETRIES && NetworkUtils::isTransientXrpcError(error) &&
+                !ioDevice->isSequential() && ioDevice->reset())
+            {
+                qWarning() << "Video upload failed:" << error << " - " << msg << "retry:" << retry + 1;
+                emit postProgress(tr("Upload failed, retrying"));
+
+                QTimer::singleShot(VIDEO_UPLOAD_RETRY_DELAY * (retry + 1),
+                    [this, presence, ioDevice, videoSize, video, post, postFeedContext, retry]{
+                        if (presence)
+                            uploadVideo(ioDevice, videoSize, video, post, postFeedContext, retry + 1);
+                    });
+
+                return;
+            }
+
             qDebug() << "Post failed:" << error << " - " << msg;
             emit postFailed(msg);
         });
@@ -1326,20 +1437,34 @@ void PostUtils::continueSharePhotoToApp(const QString& fileName)
 #endif
 }
 
-QString PostUtils::cutPhotoRect(const QString& source, const QRect& rect, const QSize& scaledSize)
+void PostUtils::cutPhotoRect(const QString& source, const QRect& rect, const QSize& scaledSize)
 {
-    QImage img = PhotoPicker::cutRect(source, rect);
-
-    if (img.isNull())
-        return {};
-
-    img = img.scaled(scaledSize);
-    auto* imgProvider = SharedImageProvider::getProvider(SharedImageProvider::SHARED_IMAGE);
-    return imgProvider->addImage(img);
-}
+    qDebug() << "Cut photo rect:" << source << rect << "scaled:" << scaledSize;
 
+    // The permission check may need the GUI thread.
+    if (source.startsWith("file://") && !FileUtils::checkReadMediaPermission())
+    {
+        qWarning() << "No permission to read:" << source;
+        emit cutPhotoRectFailed(source);
+        return;
+    }
 
+    mImageWorker.run<QImage>(
+        [source, rect, scaledSize]{
+            const QImage img = PhotoPicker::cutRect(source, rect, false);
+            return img.isNull() ? img : img.scaled(scaledSize);
+        },
+        [this, source](QImage img){
+            if (img.isNull())
+            {
+                emit cutPhotoRectFailed(source);
+                return;
+            }
 
+            auto* imgProvider = SharedImageProvider::getProvider(SharedImageProvider::SHARED_IMAGE);
+            emit cutPhotoRectOk(source, imgProvider->addImage(std::move(img)));
+        });
+}
 
 void PostUtils::cacheTags(const QString& text)
 {
@@ -2,7 +2,9 @@
 // License: GPLv3
 #pragma once
 #include "generator_view.h"
+#include "image_blob_preparer.h"
 #include "image_reader.h"
+#include "image_worker.h"
 #include "link_card.h"
 #include "list_view.h"
 #include "post_attachment.h"
@@ -89,7 +91,10 @@ public:
     Q_INVOKABLE void sharePhotoToApp(const QString& sourceUrl);
     Q_INVOKABLE static void dropPhoto(const QString& source);
     Q_INVOKABLE static void dropVideo(const QString& source);
-    Q_INVOKABLE QString cutPhotoRect(const QString& source, const QRect& rect, const QSize& scaledSize);
+
+    // Cuts and scales the photo on a worker thread. The source must be kept
+    // till cutPhotoRectOk or cutPhotoRectFailed.
+    Q_INVOKABLE void cutPhotoRect(const QString& source, const QRect& rect, const QSize& scaledSize);
 
     Q_INVOKABLE void cacheTags(const QString& text);
     Q_INVOKABLE static QString linkiFy(const QString& text, const QString& colorName);
@@ -153,6 +158,8 @@ signals:
     void checkVideoLimitsOk(VideoUploadLimits limits);
     void checkVideoLimitsFailed(QString error);
     void languageIdentified(QString languageCode, int index);
+    void cutPhotoRectOk(QString source, QString cutSource);
+    void cutPhotoRectFailed(QString source);
 
 private:
     void post(const QString& text, const PostAttachment& attachment,
@@ -170,6 +177,9 @@ private:
                       const PostFeedContext& postFeedContext);
     void continuePost(const PostAttachmentImages& images, ATProto::AppBskyFeed::Record::Post::SharedPtr post,
                       const PostFeedContext& postFeedContext, int imgIndex = 0);
+    void continuePost(const PostAttachmentImages& images, const ImageBlobPreparer::Blob& blob,
+                      ATProto::AppBskyFeed::Record::Post::SharedPtr post,
+                      const PostFeedContext& postFeedContext, int imgIndex);
     void continuePost(const PostAttachmentLinkCard& card, ATProto::AppBskyFeed::Record::Post::SharedPtr post,
                       const PostFeedContext& postFeedContext);
     void continuePost(const PostAttachmentLinkCard& card, QImage thumb, ATProto::AppBskyFeed::Record::Post::SharedPtr post,
@@ -179,6 +189,9 @@ private:
     void continuePost(std::shared_ptr<QIODevice> ioDevice, const PostAttachmentVideo& video,
                       ATProto::AppBskyFeed::Record::Post::SharedPtr post,
                       const PostFeedContext& postFeedContext);
+    void uploadVideo(std::shared_ptr<QIODevice> ioDevice, qint64 videoSize, const PostAttachmentVideo& video,
+                     ATProto::AppBskyFeed::Record::Post::SharedPtr post,
+                     const PostFeedContext& postFeedContext, int retry = 0);
     void continuePost(ATProto::AppBskyFeed::Record::Post::SharedPtr post, const PostFeedContext& postFeedContext);
 
     void continueRepost(const QString& uri, const QString& cid,
@@ -202,6 +215,8 @@ private:
     QNetworkAccessManager* mNetwork;
     std::unique_ptr<ATProto::PostMaster> mPostMaster;
     std::unique_ptr<ImageReader> mImageReader;
+    std::unique_ptr<ImageBlobPreparer> mImageBlobPreparer;
+    ImageWorker mImageWorker;
     bool mPickingPhoto = false;
     std::unique_ptr<LanguageUtils> mLanguageUtils;
     std::unordered_map<int, int> mIndexLanguageIdentificationRequestIdMap;
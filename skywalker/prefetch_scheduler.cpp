@@ -0,0 +1,156 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#include "prefetch_scheduler.h"
+#include <QDebug>
+
+namespace Skywalker {
+
+using namespace std::chrono_literals;
+
+static constexpr auto DEFAULT_PAGE_LATENCY = 1500ms;
+static constexpr auto MIN_PAGE_LATENCY = 50ms;
+static constexpr auto MAX_PAGE_LATENCY = 10s;
+static constexpr auto PREFETCH_MARGIN = 500ms;
+static constexpr auto PREFETCH_HORIZON = 10s; // do not schedule further ahead
+static constexpr auto SAMPLE_TIMEOUT = 2s; // older samples do not give a valid velocity
+static constexpr double MIN_VELOCITY = 0.5; // rows per second
+
+PrefetchScheduler::PrefetchScheduler(QObject* parent) :
+    QObject(parent),
+    mPageLatency(DEFAULT_PAGE_LATENCY)
+{
+    mPrefetchTimer.setSingleShot(true);
+    connect(&mPrefetchTimer, &QTimer::timeout, this, [this]{ fetchNow(); });
+}
+
+void PrefetchScheduler::setInProgress(bool inProgress)
+{
+    if (inProgress == mInProgress)
+        return;
+
+    mInProgress = inProgress;
+
+    if (!mInProgress && mFetchStartTime)
+    {
+        const auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - *mFetchStartTime);
+        mFetchStartTime.reset();
+
+        // A fetch that finished immediately did not go to the network, e.g. at the end of the feed.
+        if (latency >= MIN_PAGE_LATENCY)
+        {
+            mPageLatency = std::min((mPageLatency + latency) / 2, std::chrono::duration_cast<std::chrono::milliseconds>(MAX_PAGE_LATENCY));
+            qDebug() << "Page latency:" << mPageLatency / 1ms << "ms";
+        }
+    }
+
+    emit inProgressChanged();
+}
+
+void PrefetchScheduler::setMinRemainingRows(int rows)
+{
+    if (rows == mMinRemainingRows)
+        return;
+
+    mMinRemainingRows = rows;
+    emit minRemainingRowsChanged();
+}
+
+void PrefetchScheduler::reset()
+{
+    cancel();
+    mLastRemainingRows = -1;
+    mLastRowCount = -1;
+    mVelocity = 0.0;
+    mFetchStartTime.reset();
+}
+
+void PrefetchScheduler::updateVelocity(int remainingRows, int rowCount, Clock::time_point now)
+{
+    // When rows got added or removed, the remaining rows jump. Such a sample
+    // says nothing about the scroll velocity.
+    if (mLastRemainingRows >= 0 && rowCount == mLastRowCount)
+    {
+        const auto dt = now - mLastSampleTime;
+
+        if (dt > SAMPLE_TIMEOUT)
+        {
+            mVelocity = 0.0;
+        }
+        else if (dt > 0ms)
+        {
+            const double seconds = std::chrono::duration<double>(dt).count();
+            const double velocity = (mLastRemainingRows - remainingRows) / seconds;
+            mVelocity = (mVelocity + velocity) / 2.0;
+        }
+    }
+
+    mLastSampleTime = now;
+    mLastRemainingRows = remainingRows;
+    mLastRowCount = rowCount;
+}
+
+void PrefetchScheduler::reportPosition(int remainingRows, int rowCount)
+{
+    reportPosition(remainingRows, rowCount, Clock::now());
+}
+
+void PrefetchScheduler::reportPosition(int remainingRows, int rowCount, Clock::time_point now)
+{
+    updateVelocity(remainingRows, rowCount, now);
+
+    if (remainingRows < mMinRemainingRows)
+    {
+        fetchNow();
+        return;
+    }
+
+    if (mVelocity < 0.0)
+    {
+        // User reversed direction
+        cancel();
+        return;
+    }
+
+    if (mVelocity < MIN_VELOCITY)
+        return;
+
+    const auto eta = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::duration<double>(remainingRows / mVelocity));
+    const auto lead = eta - mPageLatency - PREFETCH_MARGIN;
+
+    if (lead <= 0ms)
+    {
+        qDebug() << "Prefetch, remaining:" << remainingRows << "velocity:" << mVelocity << "eta:" << eta / 1ms << "ms";
+        fetchNow();
+    }
+    else if (lead < PREFETCH_HORIZON)
+    {
+        mPrefetchTimer.start(lead);
+    }
+    else
+    {
+        cancel();
+    }
+}
+
+void PrefetchScheduler::cancel()
+{
+    if (mPrefetchTimer.isActive())
+    {
+        qDebug() << "Cancel prefetch";
+        mPrefetchTimer.stop();
+    }
+}
+
+void PrefetchScheduler::fetchNow()
+{
+    mPrefetchTimer.stop();
+
+    if (mInProgress)
+        return;
+
+    mFetchStartTime = Clock::now();
+    emit fetch();
+}
+
+}
@@ -0,0 +1,64 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <QObject>
+#include <QTimer>
+#include <qqmlintegration.h>
+#include <chrono>
+#include <optional>
+
+namespace Skywalker {
+
+// Requests the next page of a list ahead of time based on the scroll velocity,
+// such that the page arrives before the user reaches the end of the list.
+// A scheduled prefetch is cancelled when the user reverses direction.
+// When less than minRemainingRows are left, the next page is requested at once.
+class PrefetchScheduler : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool inProgress READ isInProgress WRITE setInProgress NOTIFY inProgressChanged FINAL)
+    Q_PROPERTY(int minRemainingRows READ getMinRemainingRows WRITE setMinRemainingRows NOTIFY minRemainingRowsChanged FINAL)
+    QML_ELEMENT
+
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit PrefetchScheduler(QObject* parent = nullptr);
+
+    // remainingRows: number of rows between the visible rows and the end of the list
+    Q_INVOKABLE void reportPosition(int remainingRows, int rowCount);
+    void reportPosition(int remainingRows, int rowCount, Clock::time_point now);
+    Q_INVOKABLE void reset();
+
+    bool isInProgress() const { return mInProgress; }
+    void setInProgress(bool inProgress);
+    int getMinRemainingRows() const { return mMinRemainingRows; }
+    void setMinRemainingRows(int rows);
+
+    bool isPrefetchScheduled() const { return mPrefetchTimer.isActive(); }
+    double getVelocity() const { return mVelocity; }
+    std::chrono::milliseconds getPageLatency() const { return mPageLatency; }
+
+signals:
+    void fetch();
+    void inProgressChanged();
+    void minRemainingRowsChanged();
+
+private:
+    void updateVelocity(int remainingRows, int rowCount, Clock::time_point now);
+    void cancel();
+    void fetchNow();
+
+    bool mInProgress = false;
+    int mMinRemainingRows = 10;
+    QTimer mPrefetchTimer;
+
+    Clock::time_point mLastSampleTime;
+    int mLastRemainingRows = -1;
+    int mLastRowCount = -1;
+    double mVelocity = 0.0; // rows per second towards the end of the list
+    std::chrono::milliseconds mPageLatency;
+    std::optional<Clock::time_point> mFetchStartTime;
+};
+
+}
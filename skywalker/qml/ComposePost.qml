@@ -861,7 +861,7 @@ SkyPage {
                         uri: card ? card.link : ""
                         title: card ? card.title : ""
                         description: card ? card.description : ""
-                        thumbUrl: card ? card.thumb : ""
+                        thumbUrl: card ? card.thumbSource : ""
                         createdAt: card ? card.createdAt : nullDate
                         updatedAt: card ? card.updatedAt : nullDate
                         readingTime: card ? card.readingTime : 0
@@ -2036,7 +2036,19 @@ SkyPage {
     }
 
     MemeMaker {
+        property var callbackMakeMemes: (memeSources) => {}
+
         id: memeMaker
+
+        function makeMemesCb(imgSources, topTexts, bottomTexts, cb) {
+            callbackMakeMemes = cb
+            makeMemes(imgSources, topTexts, bottomTexts)
+        }
+
+        onMakeMemesOk: (memeSources) => {
+            callbackMakeMemes(memeSources) // qmllint disable use-proper-function
+            callbackMakeMemes = (memeSources) => {}
+        }
     }
 
     function setPostText(text, embeddedLinks, index, cursorPosition = -1) {
@@ -2423,29 +2435,27 @@ SkyPage {
         dialog.open()
     }
 
-    function getImagesToSend(postItem) {
-        let images = []
+    function getImagesToSend(postItem, cb) {
+        let hasMeme = false
 
         for (let i = 0; i < postItem.images.length; ++i) {
-            if (postItem.imageHasMeme(i)) {
-                if (!memeMaker.setOrigImage(postItem.images[i])) {
-                    console.warn("Cannot load image:", postItem.images[i])
-                    images.push(postItem.images[i])
-                    continue
-                }
+            if (postItem.imageHasMeme(i))
+                hasMeme = true
+        }
 
-                memeMaker.topText = postItem.memeTopTexts[i]
-                memeMaker.bottomText = postItem.memeBottomTexts[i]
-                images.push(memeMaker.memeImgSource)
-                page.tmpImages.push(memeMaker.memeImgSource)
-                memeMaker.releaseMemeOwnership()
-            }
-            else {
-                images.push(postItem.images[i])
-            }
+        if (!hasMeme) {
+            cb(postItem.images)
+            return
         }
 
-        return images
+        memeMaker.makeMemesCb(postItem.images, postItem.memeTopTexts, postItem.memeBottomTexts, (images) => {
+            for (let i = 0; i < images.length; ++i) {
+                if (images[i] !== postItem.images[i])
+                    page.tmpImages.push(images[i])
+            }
+
+            cb(images)
+        })
     }
 
     function sendSinglePost(postItem, parentUri, parentCid, rootUri, rootCid, postIndex, postCount) {
@@ -2566,14 +2576,15 @@ SkyPage {
                         (error) => postFailed(error)),
                 (error) => postFailed(error))
         } else {
-            const images = getImagesToSend(postItem)
-            postUtils.post(postText, images, postItem.altTexts,
-                           parentUri, parentCid,
-                           rootUri, rootCid,
-                           qUri, qCid,
-                           postItem.embeddedLinks,
-                           labels, postItem.language,
-                           postFeedContext);
+            getImagesToSend(postItem, (images) => {
+                postUtils.post(postText, images, postItem.altTexts,
+                               parentUri, parentCid,
+                               rootUri, rootCid,
+                               qUri, qCid,
+                               postItem.embeddedLinks,
+                               labels, postItem.language,
+                               postFeedContext);
+            })
         }
 
         postUtils.cacheTags(postItem.text)
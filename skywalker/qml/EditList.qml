@@ -264,6 +264,26 @@ SkyPage {
         onPhotoPickCanceled: {
             console.debug("Photo pick canceled")
         }
+
+        property var callbackCutPhotoRect: (cutSource) => {}
+
+        // The source photo is dropped when cutting is done.
+        function cutPhoto(source, rect, size, cb) {
+            callbackCutPhotoRect = cb
+            cutPhotoRect(source, rect, size)
+        }
+
+        onCutPhotoRectOk: (source, cutSource) => {
+            callbackCutPhotoRect(cutSource) // qmllint disable use-proper-function
+            callbackCutPhotoRect = (cutSource) => {}
+            dropPhoto(source)
+        }
+
+        onCutPhotoRectFailed: (source) => {
+            callbackCutPhotoRect = (cutSource) => {}
+            dropPhoto(source)
+            skywalker.showStatusMessage(qsTr("Cannot load image"), QEnums.STATUS_LEVEL_ERROR)
+        }
     }
 
     GraphUtils {
@@ -331,11 +351,12 @@ SkyPage {
         })
         page.onSelected.connect((rect) => {
             console.debug(rect)
-            dropCreatedAvatar()
-            createdAvatarSource = postUtils.cutPhotoRect(source, rect, Qt.size(avatarSize, avatarSize))
-            avatar.setUrl(createdAvatarSource)
             root.popStack()
-            postUtils.dropPhoto(source)
+            postUtils.cutPhoto(source, rect, Qt.size(avatarSize, avatarSize), (cutSource) => {
+                dropCreatedAvatar()
+                createdAvatarSource = cutSource
+                avatar.setUrl(createdAvatarSource)
+            })
         })
         root.pushStack(page)
     }
@@ -375,6 +375,26 @@ SkyPage {
         onPhotoPickCanceled: {
             console.debug("Photo pick canceled")
         }
+
+        property var callbackCutPhotoRect: (cutSource) => {}
+
+        // The source photo is dropped when cutting is done.
+        function cutPhoto(source, rect, size, cb) {
+            callbackCutPhotoRect = cb
+            cutPhotoRect(source, rect, size)
+        }
+
+        onCutPhotoRectOk: (source, cutSource) => {
+            callbackCutPhotoRect(cutSource) // qmllint disable use-proper-function
+            callbackCutPhotoRect = (cutSource) => {}
+            dropPhoto(source)
+        }
+
+        onCutPhotoRectFailed: (source) => {
+            callbackCutPhotoRect = (cutSource) => {}
+            dropPhoto(source)
+            skywalker.showStatusMessage(qsTr("Cannot load image"), QEnums.STATUS_LEVEL_ERROR)
+        }
     }
 
     ProfileUtils {
@@ -447,11 +467,12 @@ SkyPage {
         })
         page.onSelected.connect((rect) => {
             console.debug(rect)
-            dropCreatedAvatar()
-            createdAvatarSource = postUtils.cutPhotoRect(source, rect, Qt.size(avatarSize, avatarSize))
-            avatar.setUrl(createdAvatarSource)
             root.popStack()
-            postUtils.dropPhoto(source)
+            postUtils.cutPhoto(source, rect, Qt.size(avatarSize, avatarSize), (cutSource) => {
+                dropCreatedAvatar()
+                createdAvatarSource = cutSource
+                avatar.setUrl(createdAvatarSource)
+            })
         })
         root.pushStack(page)
     }
@@ -477,11 +498,12 @@ SkyPage {
         })
         page.onSelected.connect((rect) => {
             console.debug(rect)
-            dropCreatedBanner()
-            createdBannerSource = postUtils.cutPhotoRect(source, rect, Qt.size(bannerWidth, bannerHeight))
-            banner.setUrl(createdBannerSource)
             root.popStack()
-            postUtils.dropPhoto(source)
+            postUtils.cutPhoto(source, rect, Qt.size(bannerWidth, bannerHeight), (cutSource) => {
+                dropCreatedBanner()
+                createdBannerSource = cutSource
+                banner.setUrl(createdBannerSource)
+            })
         })
         root.pushStack(page)
     }
@@ -38,7 +38,7 @@ Item {
             titleIsHtml: postExternal.hasHtmlTitle()
             description: postExternal.description
             descriptionIsHtml: postExternal.hasHtmlDescription()
-            thumbUrl: postExternal.thumbUrl
+            thumbUrl: postExternal.thumbSource
             createdAt: postExternal.createdAt
             updatedAt: postExternal.updateAt
             readingTime: postExternal.readingTime
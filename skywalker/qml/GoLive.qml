@@ -84,7 +84,7 @@ SkyDialog {
             uri: card ? card.link : ""
             title: card ? card.title : ""
             description: card ? card.description : ""
-            thumbUrl: card ? card.thumb : ""
+            thumbUrl: card ? card.thumbSource : ""
             contentVisibility: QEnums.CONTENT_VISIBILITY_SHOW
             contentWarning: ""
             visible: card
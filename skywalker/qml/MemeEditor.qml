@@ -80,18 +80,21 @@ SkyPage {
 
     MemeMaker {
         id: memeMaker
-    }
 
+        onSetOrigImageOk: {
+            memeMaker.topText = memeTopText
+            memeMaker.bottomText = memeBottomText
+        }
 
-    Component.onCompleted: {
-        if (!memeMaker.setOrigImage(imgSource)) {
+        onSetOrigImageFailed: {
             root.getSkywalker().showStatusMessage(qsTr("Failed to load image"))
             cancel()
-            return
         }
+    }
+
 
-        memeMaker.topText = memeTopText
-        memeMaker.bottomText = memeBottomText
+    Component.onCompleted: {
+        memeMaker.setOrigImage(imgSource)
         topText.setFocus()
     }
 }
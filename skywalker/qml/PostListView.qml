@@ -28,6 +28,10 @@ SkyListView {
 
     id: postListView
     cacheBuffer: Screen.height * 3
+    preloadNextPageFunc: () => model.getFeedNextPage(skywalker)
+    preloadThreshold: skywalker.TIMELINE_NEXT_PAGE_THRESHOLD
+    preloadEnabled: inSync && Boolean(model)
+    reversePreload: reverseFeed
     virtualFooterHeight: userSettings.favoritesBarPosition === QEnums.FAVORITES_BAR_POSITION_BOTTOM ? guiSettings.tabBarHeight : 0
 
     Timer {
@@ -195,19 +199,6 @@ SkyListView {
         if (!model)
             return
 
-        const firstVisibleIndex = getFirstVisibleIndex()
-        const lastVisibleIndex = getLastVisibleIndex()
-
-        if (firstVisibleIndex < 0 || lastVisibleIndex < 0)
-            return
-
-        const remaining = model.reverseFeed ? firstVisibleIndex : count - lastVisibleIndex
-
-        if (remaining < skywalker.TIMELINE_NEXT_PAGE_THRESHOLD && !model.getFeedInProgress) {
-            console.debug("Get next feed page:", model.feedName, "first:", firstVisibleIndex, "last:", lastVisibleIndex, "count:", count, "remain:", remaining)
-            model.getFeedNextPage(skywalker)
-        }
-
         updateUnreadPosts()
     }
 
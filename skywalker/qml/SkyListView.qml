@@ -1,5 +1,6 @@
 import QtQuick
 import QtQuick.Controls
+import skywalker
 
 ListView {
     property bool enableOnScreenCheck: false
@@ -17,6 +18,8 @@ ListView {
     property bool fastMoving: false
     property var preloadNextPageFunc
     property int preloadThreshold: 10
+    property bool preloadEnabled: true
+    property bool reversePreload: false // next page is loaded at the top of the list
 
     signal contentMoved()
 
@@ -78,16 +81,29 @@ ListView {
         }
     }
 
+    PrefetchScheduler {
+        id: prefetchScheduler
+        inProgress: Boolean(model && model.getFeedInProgress)
+        minRemainingRows: preloadThreshold
+
+        onFetch: {
+            console.debug("Preload next page")
+            preloadNextPageFunc()
+        }
+    }
+
     function preloadNextPage() {
-        if (!preloadNextPageFunc)
+        if (!preloadNextPageFunc || !preloadEnabled)
             return
 
+        const firstVisibleIndex = getFirstVisibleIndex()
         const lastVisibleIndex = getLastVisibleIndex()
 
-        if (count - lastVisibleIndex < preloadThreshold && !model.getFeedInProgress) {
-            console.debug("Preload next page")
-            preloadNextPageFunc()
-        }
+        if (firstVisibleIndex < 0 || lastVisibleIndex < 0)
+            return
+
+        const remaining = reversePreload ? firstVisibleIndex : count - lastVisibleIndex
+        prefetchScheduler.reportPosition(remaining, count)
     }
 
     MoveToIndexTimer {
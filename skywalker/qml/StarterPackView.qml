@@ -293,6 +293,8 @@ SkyPage {
         id: graphUtils
         skywalker: page.skywalker
 
+        onCreatedListFromStarterPackProgress: (msg) => skywalker.showStatusMessage(msg, QEnums.STATUS_LEVEL_INFO, 30)
+
         onCreatedListFromStarterPackOk: (pack, listUri, listCid) => {
             skywalker.showStatusMessage(qsTr("List created"), QEnums.STATUS_LEVEL_INFO)
             getListViewTimer.go(listUri)
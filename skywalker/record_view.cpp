@@ -86,6 +86,18 @@ RecordView::RecordView(const ATProto::AppBskyEmbed::RecordView& view)
     mValid = true;
 }
 
+RecordView RecordView::clone() const
+{
+    RecordView view(*this);
+    view.mPrivate = std::make_shared<PrivateData>(*mPrivate);
+
+    // The word index has the images, video and external set by the filters.
+    if (mPrivate->mRecordWordIndex)
+        view.mPrivate->mRecordWordIndex = std::make_shared<RecordWordIndex>(*mPrivate->mRecordWordIndex);
+
+    return view;
+}
+
 QString RecordView::getUri() const
 {
     return mPrivate->mRecord ? mPrivate->mRecord->mUri : QString();
@@ -69,6 +69,9 @@ public:
     RecordView() = default;
     explicit RecordView(const ATProto::AppBskyEmbed::RecordView& view);
 
+    // A copy shares the private data with the original. A clone gets its own.
+    RecordView clone() const;
+
     Q_INVOKABLE bool isNull() const { return !mValid; }
     QString getUri() const;
     QString getCid() const;
@@ -144,7 +147,7 @@ private:
     // Optimal field order as suggested by clang-analyzer
     struct PrivateData
     {
-        RecordWordIndex::Ptr mRecordWordIndex;
+        RecordWordIndex::SharedPtr mRecordWordIndex;
         ATProto::AppBskyEmbed::RecordViewRecord::SharedPtr mRecord;
         ATProto::AppBskyFeed::GeneratorView::SharedPtr mFeed;
         ATProto::AppBskyGraph::ListView::SharedPtr mList;
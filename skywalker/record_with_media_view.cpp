@@ -10,6 +10,16 @@ RecordWithMediaView::RecordWithMediaView(const ATProto::AppBskyEmbed::RecordWith
     mView(view)
 {}
 
+RecordWithMediaView RecordWithMediaView::clone() const
+{
+    RecordWithMediaView view(*this);
+
+    if (mRecordView)
+        view.mRecordView = std::make_shared<RecordView>(mRecordView->clone());
+
+    return view;
+}
+
 RecordView& RecordWithMediaView::getRecord() const
 {
     static RecordView NULL_RECORD_VIEW;
@@ -23,6 +23,9 @@ public:
     RecordWithMediaView() = default;
     RecordWithMediaView(const ATProto::AppBskyEmbed::RecordWithMediaView::SharedPtr& view);
 
+    // Copies share the record view. A clone gets a clone of the record view.
+    RecordWithMediaView clone() const;
+
     RecordView& getRecord() const;
     RecordView::SharedPtr getRecordPtr() const;
     void setRecord(const RecordView::SharedPtr& record);
@@ -12,6 +12,7 @@ class RecordWordIndex : public NormalizedWordIndex
 {
 public:
     using Ptr = std::unique_ptr<RecordWordIndex>;
+    using SharedPtr = std::shared_ptr<RecordWordIndex>;
 
     explicit RecordWordIndex(const ATProto::AppBskyEmbed::RecordViewRecord::SharedPtr& record);
 
@@ -117,8 +117,7 @@ int SearchPostFeedModel::addFeed(ATProto::AppBskyFeed::SearchPostsV2Output::Shar
         if (mCursorNextPage.isEmpty() && !mFeed.empty())
         {
             mFeed.back().setEndOfFeed(true);
-            const auto index = createIndex(mFeed.size() - 1, 0);
-            emit dataChanged(index, index, { int(Role::EndOfFeed) });
+            changePhysicalRowData(mFeed.size() - 1, { int(Role::EndOfFeed) });
 
             setEndOfFeed(true);
             setEndOfFeedFilteredPostModels(true);
@@ -5,6 +5,7 @@
 #include "skywalker.h"
 #include "utils.h"
 #include <atproto/lib/at_regex.h>
+#include <QCache>
 #include <QCollator>
 #include <QTextBoundaryFinder>
 
@@ -16,6 +17,194 @@ static constexpr int MAX_TRENDING_TOPICS = 10;
 static constexpr int MAX_SUGGESTIONS = 10;
 static constexpr int SYNC_PAGE_SIZE = 100;
 
+// Normalizations of short texts, like display names and hashtags, are cached.
+static constexpr int MAX_CACHED_TEXT_SIZE = 64;
+static constexpr int NORMALIZATION_CACHE_SIZE = 256;
+
+// Returns the bitwise or of all UTF-16 code units. The loop has no branches,
+// such that the compiler can vectorize it.
+static char16_t orCodeUnits(QStringView text)
+{
+    const char16_t* data = text.utf16();
+    const qsizetype size = text.size();
+    char16_t bits = 0;
+
+    for (qsizetype i = 0; i < size; ++i)
+        bits |= data[i];
+
+    return bits;
+}
+
+static bool isAscii(QStringView text)
+{
+    return orCodeUnits(text) < 0x80;
+}
+
+static bool isLatin1(QStringView text)
+{
+    return orCodeUnits(text) < 0x100;
+}
+
+namespace {
+
+// Normalization of each Latin-1 character. Latin-1 has no combining characters,
+// so Latin-1 text can be normalized character by character. The table is
+// filled from the full normalization, such that the results are the same.
+class Latin1Normalization
+{
+public:
+    static const Latin1Normalization& instance()
+    {
+        static const Latin1Normalization sInstance;
+        return sInstance;
+    }
+
+    QString normalize(const QString& text) const
+    {
+        const qsizetype size = text.size();
+        qsizetype i = 0;
+
+        // Most text is already normalized, e.g. lower case ASCII.
+        while (i < size && mIsSame[text[i].unicode()])
+            ++i;
+
+        if (i == size)
+            return text;
+
+        QString normalized;
+        normalized.reserve(size);
+        normalized.append(QStringView(text).first(i));
+
+        for (; i < size; ++i)
+        {
+            const char16_t c = text[i].unicode();
+
+            if (mIsSingle[c])
+                normalized.append(QChar(mSingle[c]));
+            else
+                normalized.append(mNormalized[c]);
+        }
+
+        return normalized;
+    }
+
+private:
+    Latin1Normalization()
+    {
+        for (char16_t c = 0; c < 0x100; ++c)
+        {
+            mNormalized[c] = ATProto::RichTextMaster::normalizeText(QString(QChar(c)));
+            mIsSingle[c] = mNormalized[c].size() == 1;
+            mSingle[c] = mIsSingle[c] ? mNormalized[c][0].unicode() : 0;
+            mIsSame[c] = mIsSingle[c] && mSingle[c] == c;
+        }
+    }
+
+    QString mNormalized[0x100];
+    char16_t mSingle[0x100];
+    bool mIsSingle[0x100];
+    bool mIsSame[0x100];
+};
+
+}
+
+static bool isAsciiLetter(char16_t c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static bool isAsciiDigit(char16_t c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// Splits ASCII text into words by the Unicode word boundary rules (UAX #29)
+// for ASCII, giving the same words as QTextBoundaryFinder:
+// - letters and digits form a word together
+// - letters separated by a single ':', '.' or '\'' stay one word, e.g. "don't"
+// - digits separated by a single ',', ';', '.' or '\'' stay one word, e.g. "3.14"
+// Text with '_' (ExtendNumLet) must not be passed here.
+static std::vector<QString> getAsciiWords(const QString& text)
+{
+    std::vector<QString> words;
+    const qsizetype size = text.size();
+    qsizetype i = 0;
+
+    while (i < size)
+    {
+        if (!isAsciiLetter(text[i].unicode()) && !isAsciiDigit(text[i].unicode()))
+        {
+            ++i;
+            continue;
+        }
+
+        qsizetype end = i + 1;
+
+        while (end < size)
+        {
+            const char16_t c = text[end].unicode();
+
+            if (isAsciiLetter(c) || isAsciiDigit(c))
+            {
+                ++end;
+                continue;
+            }
+
+            if (end + 1 >= size)
+                break;
+
+            const char16_t prev = text[end - 1].unicode();
+            const char16_t next = text[end + 1].unicode();
+            const bool midLetter = c == ':' || c == '.' || c == '\'';
+            const bool midNum = c == ',' || c == ';' || c == '.' || c == '\'';
+
+            if ((midLetter && isAsciiLetter(prev) && isAsciiLetter(next)) ||
+                (midNum && isAsciiDigit(prev) && isAsciiDigit(next)))
+            {
+                end += 2;
+                continue;
+            }
+
+            break;
+        }
+
+        words.push_back(text.sliced(i, end - i));
+        i = end;
+    }
+
+    return words;
+}
+
+// Returns a cached result of normalize(text) for short texts.
+template<typename Normalize>
+static QString getCachedNormalization(QCache<QString, QString>& cache, const QString& text, Normalize normalize)
+{
+    if (text.size() > MAX_CACHED_TEXT_SIZE)
+        return normalize(text);
+
+    const QString* cached = cache.object(text);
+
+    if (cached)
+        return *cached;
+
+    QString normalized = normalize(text);
+    cache.insert(text, new QString(normalized));
+    return normalized;
+}
+
+// The text for comparing names without emojis.
+static QString getCompareText(const QString& text)
+{
+    // ASCII characters are not emojis on their own.
+    if (isAscii(text))
+        return SearchUtils::normalizeText(text.trimmed());
+
+    thread_local QCache<QString, QString> cache(NORMALIZATION_CACHE_SIZE);
+
+    return getCachedNormalization(cache, text, [](const QString& t){
+        return SearchUtils::normalizeText(UnicodeFonts::removeEmojis(t).trimmed()); });
+}
+
 std::vector<QString> SearchUtils::combineSingleCharsToWords(const std::vector<QString>& words)
 {
     static const int MIN_COMBINE_SIZE = 3;
@@ -45,15 +234,18 @@ std::vector<QString> SearchUtils::combineSingleCharsToWords(const std::vector<QS
 
 QString SearchUtils::normalizeText(const QString& text)
 {
-    return ATProto::RichTextMaster::normalizeText(text);
+    if (isLatin1(text))
+        return Latin1Normalization::instance().normalize(text);
+
+    thread_local QCache<QString, QString> cache(NORMALIZATION_CACHE_SIZE);
+
+    return getCachedNormalization(cache, text, [](const QString& t){
+        return ATProto::RichTextMaster::normalizeText(t); });
 }
 
 int SearchUtils::normalizedCompare(const QString& lhs, const QString& rhs)
 {
-    const QString cleanedLhs = UnicodeFonts::removeEmojis(lhs).trimmed();
-    const QString cleanedRhs = UnicodeFonts::removeEmojis(rhs).trimmed();
-
-    const int result = QCollator::defaultCompare(normalizeText(cleanedLhs), normalizeText(cleanedRhs));
+    const int result = QCollator::defaultCompare(getCompareText(lhs), getCompareText(rhs));
 
     if (result != 0)
         return result;
@@ -79,6 +271,9 @@ std::vector<QString> SearchUtils::getWords(const QString& text)
     if (text.isEmpty())
         return {};
 
+    if (isAscii(text) && !text.contains('_'))
+        return getAsciiWords(text);
+
     std::vector<QString> words;
     QTextBoundaryFinder boundaryFinder(QTextBoundaryFinder::Word, text);
     int startWordPos = 0;
@@ -213,38 +408,31 @@ void SearchUtils::searchAuthorsTypeahead(const QString& typed, int limit, QEnums
     localSearchAuthorsTypeahead(typed, limit, *matcher);
 
     if (mAuthorTypeaheadList.size() >= limit)
-        return;
+    {
+        // The result of a pending search would overwrite the local results.
+        if (mAuthorTypeahead)
+            mAuthorTypeahead->cancel();
 
-    bskyClient()->searchActorsTypeahead(typed, limit - mAuthorTypeaheadList.size(),
-        [this, presence=getPresence(), matcher](auto searchOutput){
-            if (!presence)
-                return;
+        return;
+    }
 
-            addAuthorTypeaheadList(searchOutput->mActors, *matcher);
-        },
-        [presence=getPresence()](const QString& error, const QString& msg){
-            if (!presence)
-                return;
+    const int remaining = limit - mAuthorTypeaheadList.size();
+    const BasicProfileList localList = mAuthorTypeaheadList;
 
-            qWarning() << "Type ahead search failed:" << error << " - " << msg;
+    authorTypeahead().search(typed, remaining,
+        [this, localList, matcher](const auto& profiles){
+            setAuthorTypeaheadList(localList);
+            addAuthorTypeaheadList(profiles, *matcher);
         });
 }
 
 void SearchUtils::publicSearchAuthorsTypeahead(const QString& typed, int limit)
 {
     setAuthorTypeaheadList({});
-    publicBskyClient()->searchActorsTypeahead(typed, limit,
-        [this, presence=getPresence()](auto searchOutput){
-            if (!presence)
-                return;
-
-            addAuthorTypeaheadList(searchOutput->mActors);
-        },
-        [presence=getPresence()](const QString& error, const QString& msg){
-            if (!presence)
-                return;
-
-            qWarning() << "Type ahead search failed:" << error << " - " << msg;
+    publicAuthorTypeahead().search(typed, limit,
+        [this](const auto& profiles){
+            setAuthorTypeaheadList({});
+            addAuthorTypeaheadList(profiles);
         });
 }
 
@@ -1300,4 +1488,20 @@ ATProto::Client* SearchUtils::publicBskyClient()
     return mPublicBsky.get();
 }
 
+AuthorTypeahead& SearchUtils::authorTypeahead()
+{
+    if (!mAuthorTypeahead)
+        mAuthorTypeahead = std::make_unique<AuthorTypeahead>([this]{ return bskyClient(); });
+
+    return *mAuthorTypeahead;
+}
+
+AuthorTypeahead& SearchUtils::publicAuthorTypeahead()
+{
+    if (!mPublicAuthorTypeahead)
+        mPublicAuthorTypeahead = std::make_unique<AuthorTypeahead>([this]{ return publicBskyClient(); });
+
+    return *mPublicAuthorTypeahead;
+}
+
 }
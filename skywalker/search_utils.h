@@ -2,6 +2,7 @@
 // License: GPLv3
 #pragma once
 #include "author_list_model.h"
+#include "author_typeahead.h"
 #include "feed_list_model.h"
 #include "presence.h"
 #include "profile.h"
@@ -124,6 +125,8 @@ private:
     bool syncPageHasNewPosts(const ATProto::AppBskyFeed::SearchPostsV2Output::SharedPtr& feed, const SearchPostFeedModel& model) const;
     QString processSyncPage(ATProto::AppBskyFeed::SearchPostsV2Output::SharedPtr feed, SearchPostFeedModel& model, const QString& searchKey, QDateTime tillTimestamp, const QString& cid, int maxPages, const QString& cursor);
     ATProto::Client* publicBskyClient();
+    AuthorTypeahead& authorTypeahead();
+    AuthorTypeahead& publicAuthorTypeahead();
 
     BasicProfileList mAuthorTypeaheadList;
     QStringList mHashtagTypeaheadList;
@@ -141,6 +144,8 @@ private:
     QEnums::ContentVisibility mOVerrideAdultVisibility = QEnums::CONTENT_VISIBILITY_SHOW;
     std::optional<int> mSearchPageSize;
     ATProto::Client::SharedPtr mPublicBsky;
+    std::unique_ptr<AuthorTypeahead> mAuthorTypeahead;
+    std::unique_ptr<AuthorTypeahead> mPublicAuthorTypeahead;
 };
 
 }
@@ -3,15 +3,20 @@
 #include "session_manager.h"
 #include "oauth_controller.h"
 #include "skywalker.h"
+#include <QRandomGenerator>
 
 namespace Skywalker {
 
 using namespace std::chrono_literals;
 
 static constexpr auto SESSION_REFRESH_DELAY = 11s;
+static constexpr int SESSION_REFRESH_JITTER_MS = 5000;
 static constexpr auto NOTIFICATION_REFRESH_DELAY = 5s;
 static constexpr auto NOTIFICATION_REFRESH_INTERVAL = 61s;
+static constexpr auto NOTIFICATION_REFRESH_MAX_INTERVAL = 8min;
 static constexpr auto NOTIFICATION_REFRESH_ACTIVE_USER_INTERVAL = 29s;
+static constexpr auto NOTIFICATION_REFRESH_ACTIVE_USER_MAX_INTERVAL = 4min;
+static constexpr auto NOTIFICATION_REFRESH_TIMEOUT = 30s; // per non-active user
 static constexpr auto POST_CACHE_TIMEOUT = 30s;
 
 SessionManager::SessionManager(QObject* parent) :
@@ -30,6 +35,10 @@ SessionManager::SessionManager(Skywalker* skywalker, QObject* parent) :
 
     connect(&mPostCacheTimer, &QTimer::timeout, this, [this]{ clearPostCache(); });
 
+    mNonActiveNotificationJob = mSkywalker->getPollScheduler()->addJob("notifications non-active users",
+        NOTIFICATION_REFRESH_INTERVAL, NOTIFICATION_REFRESH_MAX_INTERVAL,
+        [this](const PollScheduler::DoneCb& done){ refreshNonActiveNotificationCounts(done); });
+
     connect(mUserSettings, &UserSettings::notificationsForAllAccountsChanged, this, [this]{
         if (mUserSettings->getNotificationsForAllAccounts(mSkywalker->getUserDid()))
             enableNotificationsNonActiveUsers();
@@ -40,6 +49,12 @@ SessionManager::SessionManager(Skywalker* skywalker, QObject* parent) :
     });
 }
 
+SessionManager::~SessionManager()
+{
+    if (mSkywalker)
+        mSkywalker->getPollScheduler()->removeJob(mNonActiveNotificationJob);
+}
+
 void SessionManager::resumeAndRefreshNonActiveUsers()
 {
     const auto activeDid = mSkywalker->getUserDid();
@@ -57,6 +72,10 @@ void SessionManager::clear()
     mNonActiveUsers.clear();
     mExpiredUsers.clear();
     mDidSessionMap.clear();
+    mNonActiveNotificationDids.clear();
+
+    if (mSkywalker)
+        mSkywalker->getPollScheduler()->stopJob(mNonActiveNotificationJob);
 
     emit nonActiveUsersChanged();
 
@@ -268,13 +287,19 @@ void SessionManager::clearPostCache()
     }
 }
 
+SessionManager::Session::~Session()
+{
+    if (mPollScheduler)
+        mPollScheduler->removeJob(mRefreshNotificationJob);
+}
+
 SessionManager::Session::Ptr SessionManager::createSession(const QString& did, ATProto::Client::SharedPtr rawBsky, ATProto::Client* bsky)
 {
     Q_ASSERT(!mSkywalker->getUserDid().isEmpty());
     auto session = std::make_unique<Session>();
     session->mSharedBsky = rawBsky;
     session->mBsky = bsky;
-    session->mRefreshNotificationInitialDelayTimer.setSingleShot(true);
+    session->mPollScheduler = mSkywalker->getPollScheduler();
 
     if (did != mSkywalker->getUserDid())
     {
@@ -291,22 +316,6 @@ SessionManager::Session::Ptr SessionManager::createSession(const QString& did, A
         }
     }
 
-    connect(&session->mRefreshNotificationInitialDelayTimer, &QTimer::timeout, this, [this, did]{
-        auto* session = getSession(did);
-
-        if (session)
-        {
-            if (did == mSkywalker->getUserDid())
-                session->mRefreshNotificationTimer.start(NOTIFICATION_REFRESH_ACTIVE_USER_INTERVAL);
-            else
-                session->mRefreshNotificationTimer.start(NOTIFICATION_REFRESH_INTERVAL);
-        }
-    });
-
-    connect(&session->mRefreshNotificationTimer, &QTimer::timeout, this, [this, did]{
-        refreshNotificationCount(did);
-    });
-
     return session;
 }
 
@@ -330,6 +339,7 @@ void SessionManager::deleteSession(const QString& did)
 
     // Do not destroy the active user, it can be in use e.g. in a list of non-active
     // users showing in the UI.
+    stopNotificationRefreshTimers(did);
     auto& session = mDidSessionMap[did];
     NonActiveUser::Ptr nonActiveUser = std::move(session->mNonActiveUser);
     mDidSessionMap.erase(did);
@@ -405,7 +415,11 @@ void SessionManager::startRefreshTimers(const QString& did, int initialDelayCoun
     if (!session)
         return;
 
-    session->mBsky->startAutoRefresh(initialDelayCount * SESSION_REFRESH_DELAY,
+    // Spread token refreshes of multiple accounts, such that they do not all hit
+    // the network at the same moments.
+    const auto jitter = std::chrono::milliseconds(QRandomGenerator::global()->bounded(SESSION_REFRESH_JITTER_MS));
+
+    session->mBsky->startAutoRefresh(initialDelayCount * SESSION_REFRESH_DELAY + jitter,
         [this, did]{
             auto* session = getSession(did);
 
@@ -450,19 +464,45 @@ void SessionManager::startNotificationRefreshTimers(const QString& did, int init
     if (!session)
         return;
 
+    auto* pollScheduler = session->mPollScheduler;
+    pollScheduler->removeJob(session->mRefreshNotificationJob);
+    session->mRefreshNotificationJob = 0;
+
+    if (did != mSkywalker->getUserDid())
+    {
+        // The first refresh is delayed a bit, such that multiple accounts
+        // starting at the same time get refreshed together.
+        mNonActiveNotificationDids.insert(did);
+
+        if (!pollScheduler->isJobActive(mNonActiveNotificationJob))
+            pollScheduler->startJob(mNonActiveNotificationJob, NOTIFICATION_REFRESH_DELAY);
+
+        return;
+    }
+
+    mNonActiveNotificationDids.erase(did);
     refreshNotificationCount(did);
-    session->mRefreshNotificationInitialDelayTimer.start(initialDelayCount * NOTIFICATION_REFRESH_DELAY);
+
+    session->mRefreshNotificationJob = pollScheduler->addJob("notifications " + did,
+        NOTIFICATION_REFRESH_ACTIVE_USER_INTERVAL, NOTIFICATION_REFRESH_ACTIVE_USER_MAX_INTERVAL,
+        [this, did](const PollScheduler::DoneCb& done){ refreshNotificationCount(did, done); });
+    pollScheduler->startJob(session->mRefreshNotificationJob,
+        initialDelayCount * NOTIFICATION_REFRESH_DELAY + NOTIFICATION_REFRESH_ACTIVE_USER_INTERVAL);
 }
 
 void SessionManager::stopNotificationRefreshTimers(const QString& did)
 {
+    auto* pollScheduler = mSkywalker->getPollScheduler();
+
+    if (mNonActiveNotificationDids.erase(did) && mNonActiveNotificationDids.empty())
+        pollScheduler->stopJob(mNonActiveNotificationJob);
+
     auto* session = getSession(did);
 
     if (!session)
         return;
 
-    session->mRefreshNotificationInitialDelayTimer.stop();
-    session->mRefreshNotificationTimer.stop();
+    pollScheduler->stopJob(session->mRefreshNotificationJob);
 }
 
 void SessionManager::enableNotificationsNonActiveUsers()
@@ -491,21 +531,69 @@ void SessionManager::disableNotificatiosNonActiveUsers()
     }
 }
 
-void SessionManager::refreshNotificationCount(const QString& did)
+void SessionManager::refreshNotificationCount(const QString& did, const PollScheduler::DoneCb& doneCb)
 {
     qDebug() << "Refresh notification count:" << did;
     auto* session = getSession(did);
 
     if (!session)
+    {
+        if (doneCb)
+            doneCb(PollScheduler::Result::FAILED);
+
         return;
+    }
 
     session->mBsky->getUnreadNotificationCount({}, {},
-        [this, did](int unread){
+        [this, did, doneCb](int unread){
             qDebug() << "Unread notification count:" << unread << did;
+            auto* session = getSession(did);
+            const bool changed = !session || session->mUnreadNotificationCount - session->mUnreadExtraCount != unread;
             setUnreadNotificationCount(did, unread);
+
+            if (doneCb)
+                doneCb(changed ? PollScheduler::Result::CHANGED : PollScheduler::Result::UNCHANGED);
         },
-        [did](const QString& error, const QString& msg){
+        [did, doneCb](const QString& error, const QString& msg){
             qWarning() << "Failed to get unread notification count:" << error << " - " << msg << "did:" << did;
+
+            if (doneCb)
+                doneCb(PollScheduler::Result::FAILED);
+        });
+}
+
+void SessionManager::refreshNonActiveNotificationCounts(const PollScheduler::DoneCb& doneCb)
+{
+    auto dids = std::make_shared<std::vector<QString>>(mNonActiveNotificationDids.begin(), mNonActiveNotificationDids.end());
+    qDebug() << "Refresh notification counts of non-active users:" << dids->size();
+
+    // The users are refreshed one after the other, so the run may take a while.
+    mSkywalker->getPollScheduler()->setRunTimeout(mNonActiveNotificationJob,
+        NOTIFICATION_REFRESH_TIMEOUT * std::max((int)dids->size(), 1));
+
+    // Sequential requests in a single wake-up instead of a burst of parallel requests.
+    refreshNextNonActiveNotificationCount(dids, 0, false, doneCb);
+}
+
+void SessionManager::refreshNextNonActiveNotificationCount(std::shared_ptr<std::vector<QString>> dids, size_t index, bool changed, const PollScheduler::DoneCb& doneCb)
+{
+    if (index >= dids->size())
+    {
+        doneCb(changed ? PollScheduler::Result::CHANGED : PollScheduler::Result::UNCHANGED);
+        return;
+    }
+
+    const QString& did = (*dids)[index];
+
+    if (!mNonActiveNotificationDids.contains(did))
+    {
+        refreshNextNonActiveNotificationCount(dids, index + 1, changed, doneCb);
+        return;
+    }
+
+    refreshNotificationCount(did,
+        [this, dids, index, changed, doneCb](PollScheduler::Result result){
+            refreshNextNonActiveNotificationCount(dids, index + 1, changed || result == PollScheduler::Result::CHANGED, doneCb);
         });
 }
 
@@ -2,8 +2,10 @@
 // License: GPLv3
 #pragma once
 #include "non_active_user.h"
+#include "poll_scheduler.h"
 #include "user_settings.h"
 #include <unordered_map>
+#include <unordered_set>
 
 namespace Skywalker {
 
@@ -23,6 +25,7 @@ public:
 
     SessionManager(QObject* parent = nullptr);
     explicit SessionManager(Skywalker* skywalker, QObject* parent = nullptr);
+    ~SessionManager();
 
     void clear();
 
@@ -74,6 +77,8 @@ private:
     {
         using Ptr = std::unique_ptr<Session>;
 
+        ~Session();
+
         ATProto::Client* mBsky = nullptr;
 
         // The session may get deleted when refreshing fails. Other components,
@@ -84,8 +89,8 @@ private:
 
         int mUnreadNotificationCount = 0;
         int mUnreadExtraCount = 0;
-        QTimer mRefreshNotificationInitialDelayTimer;
-        QTimer mRefreshNotificationTimer;
+        PollScheduler* mPollScheduler = nullptr;
+        PollScheduler::JobId mRefreshNotificationJob = 0;
         NonActiveUser::Ptr mNonActiveUser;
     };
 
@@ -100,7 +105,9 @@ private:
     void stopNotificationRefreshTimers(const QString& did);
     void enableNotificationsNonActiveUsers();
     void disableNotificatiosNonActiveUsers();
-    void refreshNotificationCount(const QString& did);
+    void refreshNotificationCount(const QString& did, const PollScheduler::DoneCb& doneCb = {});
+    void refreshNonActiveNotificationCounts(const PollScheduler::DoneCb& doneCb);
+    void refreshNextNonActiveNotificationCount(std::shared_ptr<std::vector<QString>> dids, size_t index, bool changed, const PollScheduler::DoneCb& doneCb);
     void updateTokens();
     void clearPostCache();
 
@@ -109,6 +116,10 @@ private:
         const SuccessCb& successCb, const ErrorCb& errorCb);
 
     std::unordered_map<QString, Session::Ptr> mDidSessionMap;
+
+    // Unread counts of non-active users are refreshed together in one job.
+    std::unordered_set<QString> mNonActiveNotificationDids;
+    PollScheduler::JobId mNonActiveNotificationJob = 0;
     Skywalker* mSkywalker = nullptr;
     UserSettings* mUserSettings = nullptr;
     NonActiveUser::List mNonActiveUsers;
@@ -0,0 +1,259 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#include "settings_store.h"
+
+namespace Skywalker {
+
+using namespace std::chrono_literals;
+
+// Changes are collected for at most this interval before being written.
+static constexpr auto FLUSH_DELAY = 3s;
+
+SettingsStore::SettingsStore(QObject* parent) :
+    QObject(parent)
+{
+    const QSettings settings;
+    mFileName = settings.fileName();
+    mFormat = settings.format();
+    load();
+
+    mFlushPool.setMaxThreadCount(1);
+    mFlushTimer.setSingleShot(true);
+    mFlushTimer.setInterval(FLUSH_DELAY);
+    connect(&mFlushTimer, &QTimer::timeout, this, [this]{ flush(); });
+}
+
+SettingsStore::SettingsStore(const QString& fileName, QSettings::Format format, QObject* parent) :
+    QObject(parent),
+    mFileName(fileName),
+    mFormat(format)
+{
+    load();
+
+    mFlushPool.setMaxThreadCount(1);
+    mFlushTimer.setSingleShot(true);
+    mFlushTimer.setInterval(FLUSH_DELAY);
+    connect(&mFlushTimer, &QTimer::timeout, this, [this]{ flush(); });
+}
+
+SettingsStore::~SettingsStore()
+{
+    stop();
+}
+
+void SettingsStore::stop()
+{
+    mFlushTimer.stop();
+    mFlushPool.waitForDone();
+
+    if (!mDirty.empty())
+    {
+        if (writeChanges(mFileName, mFormat, mDirty))
+            mDirty.clear();
+    }
+}
+
+QString SettingsStore::fullKey(const QString& key) const
+{
+    if (mGroups.empty())
+        return key;
+
+    if (key.isEmpty())
+        return mGroups.join('/');
+
+    return mGroups.join('/') + '/' + key;
+}
+
+QVariant SettingsStore::value(const QString& key, const QVariant& defaultValue) const
+{
+    auto it = mValues.find(fullKey(key));
+    return it != mValues.end() ? it->second : defaultValue;
+}
+
+void SettingsStore::setValue(const QString& key, const QVariant& value)
+{
+    const QString k = fullKey(key);
+    auto it = mValues.find(k);
+
+    // Avoid disk writes for values that did not change, e.g. the same sync
+    // timestamp saved on every scroll end.
+    if (it != mValues.end() && it->second == value)
+        return;
+
+    mValues[k] = value;
+    markDirty(k, value);
+}
+
+void SettingsStore::remove(const QString& key)
+{
+    // Like QSettings, remove the key and all its sub keys.
+    const QString k = fullKey(key);
+
+    if (k.isEmpty())
+    {
+        for (const auto& [existingKey, _] : mValues)
+            markDirty(existingKey, {});
+
+        mValues.clear();
+        return;
+    }
+
+    if (mValues.erase(k))
+        markDirty(k, {});
+
+    const QString prefix = k + '/';
+    auto it = mValues.lower_bound(prefix);
+
+    while (it != mValues.end() && it->first.startsWith(prefix))
+    {
+        markDirty(it->first, {});
+        it = mValues.erase(it);
+    }
+}
+
+bool SettingsStore::contains(const QString& key) const
+{
+    return mValues.contains(fullKey(key));
+}
+
+QStringList SettingsStore::allKeys() const
+{
+    QStringList keys;
+
+    if (mGroups.empty())
+    {
+        keys.reserve(mValues.size());
+
+        for (const auto& [key, _] : mValues)
+            keys.push_back(key);
+
+        return keys;
+    }
+
+    const QString prefix = fullKey({}) + '/';
+
+    for (auto it = mValues.lower_bound(prefix); it != mValues.end() && it->first.startsWith(prefix); ++it)
+        keys.push_back(it->first.sliced(prefix.size()));
+
+    return keys;
+}
+
+void SettingsStore::beginGroup(const QString& prefix)
+{
+    mGroups.push_back(prefix);
+}
+
+void SettingsStore::endGroup()
+{
+    if (mGroups.empty())
+    {
+        qWarning() << "No group to end";
+        return;
+    }
+
+    mGroups.pop_back();
+}
+
+void SettingsStore::markDirty(const QString& key, const std::optional<QVariant>& value)
+{
+    mDirty[key] = value;
+    scheduleFlush();
+}
+
+void SettingsStore::scheduleFlush()
+{
+    // Do not restart a running timer, such that a continuous stream of changes
+    // still gets written every FLUSH_DELAY.
+    if (!mFlushTimer.isActive())
+        mFlushTimer.start();
+}
+
+void SettingsStore::sync()
+{
+    mFlushTimer.stop();
+    flush();
+}
+
+void SettingsStore::flush()
+{
+    if (mDirty.empty())
+        return;
+
+    qDebug() << "Flush settings:" << mDirty.size();
+    Changes changes;
+    changes.swap(mDirty);
+
+    mFlushPool.start([this, changes=std::move(changes), fileName=mFileName, format=mFormat]{
+        if (!writeChanges(fileName, format, changes))
+        {
+            QMetaObject::invokeMethod(this, [this, changes]{ restoreFailedChanges(changes); },
+                                      Qt::QueuedConnection);
+        }
+    });
+}
+
+void SettingsStore::syncNow()
+{
+    qDebug() << "Sync settings now, dirty:" << mDirty.size();
+    stop();
+    load();
+}
+
+void SettingsStore::load()
+{
+    QSettings settings(mFileName, mFormat);
+
+    // Pick up changes written by other processes.
+    settings.sync();
+
+    mValues.clear();
+    const QStringList keys = settings.allKeys();
+
+    for (const auto& key : keys)
+        mValues[key] = settings.value(key);
+
+    // Changes not written yet take precedence over the file contents.
+    for (const auto& [key, value] : mDirty)
+    {
+        if (value)
+            mValues[key] = *value;
+        else
+            mValues.erase(key);
+    }
+
+    qDebug() << "Loaded settings:" << mFileName << "keys:" << mValues.size();
+}
+
+bool SettingsStore::writeChanges(const QString& fileName, QSettings::Format format, const Changes& changes)
+{
+    QSettings settings(fileName, format);
+
+    for (const auto& [key, value] : changes)
+    {
+        if (value)
+            settings.setValue(key, *value);
+        else
+            settings.remove(key);
+    }
+
+    settings.sync();
+
+    if (settings.status() != QSettings::NoError)
+    {
+        qWarning() << "Failed to write settings:" << fileName << "status:" << settings.status();
+        return false;
+    }
+
+    return true;
+}
+
+void SettingsStore::restoreFailedChanges(const Changes& changes)
+{
+    // Newer changes for the same keys take precedence.
+    for (const auto& [key, value] : changes)
+        mDirty.try_emplace(key, value);
+
+    scheduleFlush();
+}
+
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <QObject>
+#include <QSettings>
+#include <QThreadPool>
+#include <QTimer>
+#include <map>
+
+namespace Skywalker {
+
+// In-memory settings with the QSettings API subset used by UserSettings.
+// Reads and writes are served from memory. Changed keys are tracked and written
+// in batches to the settings file on a background thread. QSettings writes the
+// file via QSaveFile, i.e. the file is atomically replaced, so a crash during a
+// write leaves the previous file intact.
+class SettingsStore : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit SettingsStore(QObject* parent = nullptr);
+    SettingsStore(const QString& fileName, QSettings::Format format, QObject* parent = nullptr);
+    ~SettingsStore();
+
+    QVariant value(const QString& key, const QVariant& defaultValue = {}) const;
+    void setValue(const QString& key, const QVariant& value);
+    void remove(const QString& key);
+    bool contains(const QString& key) const;
+    QStringList allKeys() const;
+    void beginGroup(const QString& prefix);
+    void endGroup();
+    QString fileName() const { return mFileName; }
+
+    // Start writing changes on the background thread now.
+    void sync();
+
+    // Write changes and reload settings changed by other processes, e.g. the
+    // offline message checker. This blocks the calling thread.
+    void syncNow();
+
+    // Cancel the scheduled flush and write pending changes on the calling
+    // thread, e.g. before the process exits.
+    void stop();
+
+private:
+    using Changes = std::map<QString, std::optional<QVariant>>; // nullopt: removed
+
+    QString fullKey(const QString& key) const;
+    void markDirty(const QString& key, const std::optional<QVariant>& value);
+    void scheduleFlush();
+    void flush();
+    void load();
+    static bool writeChanges(const QString& fileName, QSettings::Format format, const Changes& changes);
+    void restoreFailedChanges(const Changes& changes);
+
+    QString mFileName;
+    QSettings::Format mFormat;
+    std::map<QString, QVariant> mValues;
+    Changes mDirty;
+    QStringList mGroups;
+    QTimer mFlushTimer;
+    QThreadPool mFlushPool;
+};
+
+}
@@ -45,26 +45,41 @@ QString SharedImageProvider::getIdFromSource(const QString& source) const
     return id;
 }
 
-QString SharedImageProvider::addImage(const QImage& image)
+QString SharedImageProvider::addImage(QImage image)
 {
     QMutexLocker locker(&mMutex);
     QString id = QString("SharedImg_%1").arg(mNextId++);
-    mImages[id] = image;
+    mMemoryUsage += image.sizeInBytes();
+    mImages[id] = std::move(image);
     QString source = QString("image://%1/%2").arg(mName, id);
     qDebug() << "Added img source:" << source << "total:" << mImages.size();
+    logMemoryUsage();
     return source;
 }
 
 void SharedImageProvider::removeImage(const QString& source)
+{
+    takeImage(source);
+}
+
+QImage SharedImageProvider::takeImage(const QString& source)
 {
     const QString id = getIdFromSource(source);
 
     if (id.isEmpty())
-        return;
+        return {};
 
     QMutexLocker locker(&mMutex);
-    mImages.erase(id);
+    auto node = mImages.extract(id);
+
+    if (node.empty())
+        return {};
+
+    QImage image = std::move(node.mapped());
+    mMemoryUsage -= image.sizeInBytes();
     qDebug() << "Removed source:" << source << "id:" << id << "total:" << mImages.size();
+    logMemoryUsage();
+    return image;
 }
 
 QImage SharedImageProvider::getImage(const QString& source)
@@ -86,7 +101,7 @@ QImage SharedImageProvider::getImage(const QString& source)
     return it->second;
 }
 
-void SharedImageProvider::replaceImage(const QString& source, const QImage& image)
+void SharedImageProvider::replaceImage(const QString& source, QImage image)
 {
     const QString id = getIdFromSource(source);
 
@@ -102,24 +117,46 @@ void SharedImageProvider::replaceImage(const QString& source, const QImage& imag
         return;
     }
 
-    mImages[id] = image;
+    mMemoryUsage += image.sizeInBytes() - it->second.sizeInBytes();
+    it->second = std::move(image);
     qDebug() << "Replaced image for source:" << source << "id:" << id;
+    logMemoryUsage();
+}
+
+void SharedImageProvider::logMemoryUsage() const
+{
+    // An image not detached has its pixel data shared with holders outside
+    // the provider, e.g. an image being edited.
+    int sharedCount = 0;
+
+    for (const auto& [_, image] : mImages)
+    {
+        if (!image.isDetached())
+            ++sharedCount;
+    }
+
+    qDebug() << "Shared images:" << mImages.size() << "bytes:" << mMemoryUsage << "shared outside provider:" << sharedCount;
 }
 
 QImage SharedImageProvider::requestImage(const QString& id, QSize* size, const QSize& requestedSize)
 {
-    QMutexLocker locker(&mMutex);
-    const auto it = mImages.find(id);
+    QImage img;
 
-    if (it == mImages.end())
-        return {};
+    {
+        // Scale outside the lock, the pixel data is shared.
+        QMutexLocker locker(&mMutex);
+        const auto it = mImages.find(id);
 
-    QImage img = it->second;
+        if (it == mImages.end())
+            return {};
+
+        img = it->second;
+    }
 
     if (size)
         *size = img.size();
 
-    if (requestedSize.isValid())
+    if (requestedSize.isValid() && requestedSize != img.size())
     {
         qDebug() << "Scale img size:" << img.size() << "to:" << requestedSize;
         img = img.scaled(requestedSize);
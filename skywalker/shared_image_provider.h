@@ -9,6 +9,12 @@
 namespace Skywalker {
 
 // For sharing images via app sharing or Android photo picker
+//
+// QImage data is reference counted. Images are handed in and out without
+// copying the pixel data. Pass an image with std::move when the caller does
+// not need it anymore, such that a later change by another holder does not
+// force a deep copy. Use takeImage to get sole ownership of an image for
+// editing in place.
 class SharedImageProvider : public QQuickImageProvider
 {
 public:
@@ -18,18 +24,24 @@ public:
     explicit SharedImageProvider(const QString& name);
     ~SharedImageProvider();
 
-    QString addImage(const QImage& image);
+    QString addImage(QImage image);
     void removeImage(const QString& source);
     QImage getImage(const QString& source);
-    void replaceImage(const QString& source, const QImage& image);
+
+    // Removes the image from the provider and returns it.
+    QImage takeImage(const QString& source);
+
+    void replaceImage(const QString& source, QImage image);
 
     QImage requestImage(const QString& id, QSize* size, const QSize& requestedSize) override;
 
 private:
     QString getIdFromSource(const QString& source) const;
+    void logMemoryUsage() const;
 
     QMutex mMutex;
     std::unordered_map<QString, QImage> mImages; // id -> image
+    qint64 mMemoryUsage = 0;
     int mNextId = 1;
     QString mName;
 
@@ -12,6 +12,7 @@
 #include "font_downloader.h"
 #include "for_you.h"
 #include "jni_callback.h"
+#include "link_card_store.h"
 #include "list_cache.h"
 #include "oauth_controller.h"
 #include "offline_message_checker.h"
@@ -38,6 +39,7 @@ using namespace std::chrono_literals;
 // There is a trade off: short timeout is fast updating timeline, long timeout
 // allows for better reply thread construction as we receive more posts per update.
 static constexpr auto TIMELINE_UPDATE_INTERVAL = 91s;
+static constexpr auto TIMELINE_UPDATE_MAX_INTERVAL = 6min;
 
 static constexpr int TIMELINE_ADD_PAGE_SIZE = 100;
 static constexpr int TIMELINE_GAP_FILL_SIZE = 100;
@@ -55,8 +57,9 @@ static constexpr int SEEN_HASHTAG_INDEX_SIZE = 500;
 Skywalker::Skywalker(QObject* parent) :
     IFeedPager(parent),
     mNetwork(new QNetworkAccessManager(this)),
+    mPollScheduler(this),
     mFollowing(this),
-    mFollowsActivityStore(mFollowing, this),
+    mFollowsActivityStore(mFollowing, mPollScheduler, this),
     mTimelineHide(this),
     mUserSettings(this),
     mSessionManager(this, this),
@@ -68,7 +71,7 @@ Skywalker::Skywalker(QObject* parent) :
     mNotificationListModel(mContentFilter, mMutedWords, &mFollowsActivityStore, this),
     mMentionListModel(mContentFilter, mMutedWords, &mFollowsActivityStore, this),
     mChat(std::make_unique<Chat>(mBsky, mUserDid, mTimelineHide,
-                                 mContentFilter, mFollowsActivityStore, this)),
+                                 mContentFilter, mFollowsActivityStore, mPollScheduler, this)),
     mUserHashtags(USER_HASHTAG_INDEX_SIZE),
     mSeenHashtags(SEEN_HASHTAG_INDEX_SIZE),
     mFavoriteFeeds(this),
@@ -87,9 +90,22 @@ Skywalker::Skywalker(QObject* parent) :
     mTimelineHide.setSkywalker(this);
     mContentFilterPolicies.setSkywalker(this);
     mTimelineModel.setIsHomeFeed(true);
+    mTimelineModel.setSpillStore(&mTimelineSpillStore);
 
     connect(mChat.get(), &Chat::settingsFailed, this, [this](QString error){ showStatusMessage(error, QEnums::STATUS_LEVEL_ERROR); });
-    connect(&mTimelineUpdateTimer, &QTimer::timeout, this, [this]{ updateTimeline(5, TIMELINE_PREPEND_PAGE_SIZE); });
+    mTimelineUpdateJob = mPollScheduler.addJob("timeline", TIMELINE_UPDATE_INTERVAL, TIMELINE_UPDATE_MAX_INTERVAL,
+        [this](const PollScheduler::DoneCb& done){
+            if (isGetTimelineInProgress() || mTimelineModel.rowCount() >= PostFeedModel::MAX_TIMELINE_SIZE)
+            {
+                done(PollScheduler::Result::UNCHANGED);
+                return;
+            }
+
+            const int rowCount = mTimelineModel.rowCount();
+            updateTimeline(5, TIMELINE_PREPEND_PAGE_SIZE, [this, rowCount, done](bool){
+                done(mTimelineModel.rowCount() != rowCount ? PollScheduler::Result::CHANGED : PollScheduler::Result::UNCHANGED);
+            });
+        });
 
     connect(&mSessionManager, &SessionManager::activeSessionExpired, this,
         [this](const QString& msg){
@@ -173,7 +189,8 @@ Skywalker::Skywalker(const QString& did, ATProto::Client::SharedPtr bsky, QObjec
     mBsky(bsky),
     mUserDid(did),
     mIsActiveUser(false),
-    mFollowsActivityStore(mFollowing, this),
+    mPollScheduler(this),
+    mFollowsActivityStore(mFollowing, mPollScheduler, this),
     mTimelineHide(this),
     mUserSettings(this),
     mSessionManager(this, this),
@@ -557,13 +574,13 @@ void Skywalker::switchUser(const QString& did)
 void Skywalker::startTimelineAutoUpdate()
 {
     qDebug() << "Start timeline auto update";
-    mTimelineUpdateTimer.start(TIMELINE_UPDATE_INTERVAL);
+    mPollScheduler.startJob(mTimelineUpdateJob);
 }
 
 void Skywalker::stopTimelineAutoUpdate()
 {
     qDebug() << "Stop timeline auto update";
-    mTimelineUpdateTimer.stop();
+    mPollScheduler.stopJob(mTimelineUpdateJob);
 }
 
 void Skywalker::startRefreshTimers()
@@ -1575,29 +1592,45 @@ void Skywalker::getTimeline(int limit, int maxPages, int minEntries, const QStri
         return;
     }
 
-    setGetTimelineInProgress(true);
-    mBsky->getTimeline(limit, Utils::makeOptionalString(cursor),
-       [this, maxPages, minEntries, cursor](auto feed){
-            setGetTimelineInProgress(false);
-            int addedPosts = 0;
+    const auto timelineReceived = [this, maxPages, minEntries, cursor](auto feed){
+        setGetTimelineInProgress(false);
+        int addedPosts = 0;
 
-            if (cursor.isEmpty())
-            {
-                mTimelineModel.setFeed(std::move(feed));
-                addedPosts = mTimelineModel.rowCount();
-            }
-            else
-            {
-                const int oldRowCount = mTimelineModel.rowCount();
-                mTimelineModel.addFeed(std::move(feed));
-                addedPosts = mTimelineModel.rowCount() - oldRowCount;
-            }
+        if (cursor.isEmpty())
+        {
+            mTimelineModel.setFeed(std::move(feed));
+            addedPosts = mTimelineModel.rowCount();
+        }
+        else
+        {
+            const int oldRowCount = mTimelineModel.rowCount();
+            mTimelineModel.addFeed(std::move(feed));
+            addedPosts = mTimelineModel.rowCount() - oldRowCount;
+        }
 
-            const int postsToAdd = minEntries - addedPosts;
+        const int postsToAdd = minEntries - addedPosts;
 
-            if (postsToAdd > 0)
-                getTimelineNextPage(maxPages - 1, postsToAdd);
-       },
+        if (postsToAdd > 0)
+            getTimelineNextPage(maxPages - 1, postsToAdd);
+    };
+
+    mTimelineSpillStore.open(mUserDid);
+
+    if (!cursor.isEmpty())
+    {
+        auto spilledFeed = mTimelineSpillStore.loadPage(cursor);
+
+        if (spilledFeed)
+        {
+            qDebug() << "Timeline page from spill store:" << cursor;
+            timelineReceived(std::move(spilledFeed));
+            return;
+        }
+    }
+
+    setGetTimelineInProgress(true);
+    mBsky->getTimeline(limit, Utils::makeOptionalString(cursor),
+       timelineReceived,
        [this](const QString& error, const QString& msg){
             qInfo() << "getTimeline FAILED:" << error << " - " << msg;
             setGetTimelineInProgress(false);
@@ -5281,6 +5314,7 @@ void Skywalker::pauseApp()
     mSessionManager.pause();
 
     saveHashtags();
+    LinkCardStore::instance().flush();
     mUserSettings.setOfflineMessageCheckTimestamp(QDateTime{});
     mUserSettings.setOfflineChatCheckRev(mUserDid, mChat->getLastRev());
     mUserSettings.setOfflineJoinRequestCheck(mUserDid, QDateTime::currentDateTime());
@@ -5289,14 +5323,18 @@ void Skywalker::pauseApp()
     mUserSettings.setCheckOfflineChat(mUserDid, mChat->convosLoaded());
 
     mUserSettings.resetNextNotificationId();
-    mUserSettings.sync();
+
+    // The offline message checker runs in another process and reads the settings file.
+    mUserSettings.syncNow();
 
     if (mVerificationUtils)
         mVerificationUtils->saveCache();
 
     OffLineMessageChecker::start(mUserSettings.getNotificationsWifiOnly());
 
-    if (mTimelineUpdateTimer.isActive())
+    mPollScheduler.logStats();
+
+    if (mPollScheduler.isJobActive(mTimelineUpdateJob))
     {
         qDebug() << "Pause timeline auto update";
         stopTimelineAutoUpdate();
@@ -5315,7 +5353,7 @@ void Skywalker::resumeApp()
     qDebug() << "Resume app";
 
     // Make sure any settings changed by the offline checker are reloaded!
-    mUserSettings.sync();
+    mUserSettings.syncNow();
 
     if (mUserDid.isEmpty())
     {
@@ -5620,6 +5658,7 @@ void Skywalker::signOut()
     mEditUserPreferences = nullptr;
     mGlobalContentGroupListModel = nullptr;
     mTimelineModel.reset();
+    mTimelineSpillStore.close();
     mUserDid.clear();
     mUserProfile = {};
     mAnniversary.setFirstAppearance({});
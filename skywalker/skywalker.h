@@ -12,6 +12,7 @@
 #include "favorite_feeds.h"
 #include "feed_list_model.h"
 #include "feed_pager.h"
+#include "feed_spill_store.h"
 #include "following.h"
 #include "follows_activity_store.h"
 #include "graph_utils.h"
@@ -22,6 +23,7 @@
 #include "list_store.h"
 #include "muted_words.h"
 #include "notification_list_model.h"
+#include "poll_scheduler.h"
 #include "post_feed_model.h"
 #include "post_thread_model.h"
 #include "profile_store.h"
@@ -247,6 +249,7 @@ public:
 
     const ATProto::UserPreferences& userPreferences() const { return mUserPreferences; }
     Q_INVOKABLE UserSettings* getUserSettings() { return &mUserSettings; }
+    PollScheduler* getPollScheduler() { return &mPollScheduler; }
     Q_INVOKABLE SessionManager* getSessionManager() { return &mSessionManager; }
     Q_INVOKABLE ShareUtils* getShareUtils();
     Q_INVOKABLE VerificationUtils* getVerificationUtils();
@@ -457,6 +460,7 @@ private:
     bool mIsActiveUser = true;
 
     bool mLoggedOutVisibility = true;
+    PollScheduler mPollScheduler;
     Following mFollowing;
     FollowsActivityStore mFollowsActivityStore;
     ProfileListItemStore mMutedReposts;
@@ -482,7 +486,7 @@ private:
     bool mSignOutInProgress = false;
     Qt::ApplicationState mAppState = Qt::ApplicationInactive;
 
-    QTimer mTimelineUpdateTimer;
+    PollScheduler::JobId mTimelineUpdateJob = 0;
     QDateTime mTimelineUpdatePaused;
 
     // NOTE: update makeLocalModelChange() when you add models
@@ -509,6 +513,7 @@ private:
     HashtagIndex mSeenHashtags;
     FavoriteFeeds mFavoriteFeeds;
     Anniversary mAnniversary;
+    FeedSpillStore mTimelineSpillStore{"timeline_spill"};
     PostFeedModel mTimelineModel;
     bool mTimelineSynced = false;
     std::unique_ptr<OAuthController> mOAuthController;
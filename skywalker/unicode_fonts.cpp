@@ -318,29 +318,8 @@ QString UnicodeFonts::removeEmojis(const QString& text)
 
 bool UnicodeFonts::isEmojiCodePoint(uint c)
 {
-    // These code ranges are a heuristic. Emoji are missing and some are not emoji.
-    // If the grapheme splitting is fast enough, we can drop this.
-    static const std::map<uint, uint> RANGES = {
-        {0x0200D, 0x0200D}, // Zero Width Joiner to combine codepoints
-        {0x02600, 0x026FF}, // Miscellaneous symbols
-        {0x02700, 0x027BF}, // Dingbats
-        {0x0FE0E, 0x0FE0F}, // variation selectors
-        {0x1F1E6, 0x1F1FF}, // Regional indicators used for flags
-        {0x1F300, 0x1F5FF}, // Miscellaneous Symbols and Pictographs
-        {0x1F600, 0x1F64F}, // Emoticons
-        {0x1F680, 0x1F6FF}, // Transport and Map Symbols
-        {0x1F700, 0x1FAFF},
-        {0xE0001, 0xE007F}  // Tag sequences used in flags
-    };
-
-    auto it = RANGES.upper_bound(c);
-
-    if (it == RANGES.begin())
-        return false;
-
-    --it;
-
-    return c >= it->first && c <= it->second;
+    // ASCII characters only occur in emoji as keycap base.
+    return c > 0x7F && EmojiNames::isEmojiCodePoint(c);
 }
 
 bool UnicodeFonts::isEmoji(const QString& grapheme)
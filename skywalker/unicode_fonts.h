@@ -50,7 +50,7 @@ public:
     Q_INVOKABLE static QString turnLastThreadSymbolIntoLink(const QString& text);
     Q_INVOKABLE static QString scaleHtmlImgTags(const QString& text, int width);
 
-    static bool isEmojiCodePoint(uint c); // heuristic
+    static bool isEmojiCodePoint(uint c); // code point occurring in emoji
     static bool isEmoji(const QString& grapheme);
     static bool isKeycapEmoji(const QString& grapheme);
     static QString setEmojiFontCombinedEmojis(const QString& text);
@@ -0,0 +1,85 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#include "upload_progress_device.h"
+#include <QDebug>
+
+namespace Skywalker {
+
+UploadProgressDevice::UploadProgressDevice(std::shared_ptr<QIODevice> source, qint64 totalBytes, const ProgressCb& progressCb) :
+    mSource(std::move(source)),
+    mTotalBytes(totalBytes),
+    mProgressCb(progressCb)
+{
+    Q_ASSERT(mSource);
+    open(QIODevice::ReadOnly);
+}
+
+bool UploadProgressDevice::isSequential() const
+{
+    return mSource->isSequential();
+}
+
+qint64 UploadProgressDevice::size() const
+{
+    return mSource->size();
+}
+
+qint64 UploadProgressDevice::bytesAvailable() const
+{
+    // For a random access device the base class counts till the end of the device.
+    if (!isSequential())
+        return QIODevice::bytesAvailable();
+
+    return QIODevice::bytesAvailable() + mSource->bytesAvailable();
+}
+
+bool UploadProgressDevice::seek(qint64 pos)
+{
+    if (!QIODevice::seek(pos) || !mSource->seek(pos))
+        return false;
+
+    mBytesRead = pos;
+    mLastPercentage = -1;
+    return true;
+}
+
+bool UploadProgressDevice::atEnd() const
+{
+    return QIODevice::atEnd() && mSource->atEnd();
+}
+
+qint64 UploadProgressDevice::readData(char* data, qint64 maxSize)
+{
+    const qint64 bytesRead = mSource->read(data, maxSize);
+
+    if (bytesRead > 0)
+    {
+        mBytesRead += bytesRead;
+        reportProgress();
+    }
+
+    return bytesRead;
+}
+
+qint64 UploadProgressDevice::writeData(const char*, qint64)
+{
+    qWarning() << "Upload device is read only";
+    return -1;
+}
+
+void UploadProgressDevice::reportProgress()
+{
+    if (!mProgressCb || mTotalBytes <= 0)
+        return;
+
+    // Report on whole percentages only to avoid flooding the GUI.
+    const int percentage = int(std::min(mBytesRead, mTotalBytes) * 100 / mTotalBytes);
+
+    if (percentage == mLastPercentage)
+        return;
+
+    mLastPercentage = percentage;
+    mProgressCb(mBytesRead, mTotalBytes);
+}
+
+}
@@ -0,0 +1,40 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <QIODevice>
+#include <functional>
+#include <memory>
+
+namespace Skywalker {
+
+// Reads through a source device and reports how many bytes have been read.
+// An upload streaming from this device reads the bytes as they are sent, so
+// this gives the upload progress.
+class UploadProgressDevice : public QIODevice
+{
+public:
+    using ProgressCb = std::function<void(qint64 bytesRead, qint64 totalBytes)>;
+
+    UploadProgressDevice(std::shared_ptr<QIODevice> source, qint64 totalBytes, const ProgressCb& progressCb);
+
+    bool isSequential() const override;
+    qint64 size() const override;
+    qint64 bytesAvailable() const override;
+    bool seek(qint64 pos) override;
+    bool atEnd() const override;
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override;
+    qint64 writeData(const char* data, qint64 maxSize) override;
+
+private:
+    void reportProgress();
+
+    std::shared_ptr<QIODevice> mSource;
+    qint64 mTotalBytes;
+    qint64 mBytesRead = 0;
+    int mLastPercentage = -1;
+    ProgressCb mProgressCb;
+};
+
+}
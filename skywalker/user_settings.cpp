@@ -1063,9 +1063,9 @@ QEnums::ContentMode UserSettings::getFeedViewMode(const QString& did, const QStr
 
 QStringList UserSettings::getFeedViewUris(const QString& did, const QString& feedKey) const
 {
-    const_cast<QSettings&>(mSettings).beginGroup(key(did, feedKey));
+    const_cast<SettingsStore&>(mSettings).beginGroup(key(did, feedKey));
     QStringList uris = mSettings.allKeys();
-    const_cast<QSettings&>(mSettings).endGroup();
+    const_cast<SettingsStore&>(mSettings).endGroup();
 
     for (auto& uri : uris)
         keyToUri(uri);
@@ -1100,9 +1100,9 @@ QEnums::ContentMode UserSettings::getSearchFeedViewMode(const QString& did, cons
 
 QStringList UserSettings::getSearchFeedViewSearchKeys(const QString& did, const QString& feedKey) const
 {
-    const_cast<QSettings&>(mSettings).beginGroup(key(did, feedKey));
+    const_cast<SettingsStore&>(mSettings).beginGroup(key(did, feedKey));
     QStringList searchKeys = mSettings.allKeys();
-    const_cast<QSettings&>(mSettings).endGroup();
+    const_cast<SettingsStore&>(mSettings).endGroup();
 
     return searchKeys;
 }
@@ -1256,9 +1256,9 @@ void UserSettings::removeContentLabelPrefList(const QString& did, QString listUr
 
 std::vector<std::tuple<QString, QString, QString>> UserSettings::getContentLabelPrefKeys(const QString& did) const
 {
-    const_cast<QSettings&>(mSettings).beginGroup(key(did, "labelpolicy"));
+    const_cast<SettingsStore&>(mSettings).beginGroup(key(did, "labelpolicy"));
     const QStringList keys = mSettings.allKeys();
-    const_cast<QSettings&>(mSettings).endGroup();
+    const_cast<SettingsStore&>(mSettings).endGroup();
 
     std::vector<std::tuple<QString, QString, QString>> result;
     result.reserve(keys.size());
@@ -2036,6 +2036,10 @@ QDateTime UserSettings::getOfflineMessageCheckTimestamp() const
 void UserSettings::setOfflineMessageCheckRunning(bool running)
 {
     mSettings.setValue("offlineMessageCheckRunning", running);
+
+    // The flag is read by the other process (app or offline message checker),
+    // so it cannot wait for the write-behind.
+    mSettings.syncNow();
 }
 
 bool UserSettings::isOfflineMessageCheckRunning() const
@@ -2631,6 +2635,12 @@ void UserSettings::sync()
     mSettings.sync();
 }
 
+void UserSettings::syncNow()
+{
+    qDebug() << "Sync user settings now";
+    mSettings.syncNow();
+}
+
 void UserSettings::syncLater()
 {
     qDebug() << "Sync user settings later";
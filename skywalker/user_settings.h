@@ -6,9 +6,9 @@
 #include "password_encryption.h"
 #include "profile.h"
 #include "search_feed.h"
+#include "settings_store.h"
 #include "uri_with_expiry.h"
 #include <QObject>
-#include <QSettings>
 
 namespace Skywalker {
 
@@ -589,9 +589,13 @@ public:
     QDateTime getLastDraftOrphanCheck(const QString& did) const;
     void updateLastDraftOrphanCheck(const QString& did);
 
+    // Write changes in the background.
     void sync();
     void syncLater();
 
+    // Write changes and reload changes made by other processes. Blocks the caller.
+    void syncNow();
+
 signals:
     void serviceAppViewChanged(QString did);
     void serviceChatChanged(QString did);
@@ -660,7 +664,7 @@ private:
     QStringList getFeedViewUris(const QString& did, const QString& feedKey) const;
     QStringList getSearchFeedViewSearchKeys(const QString& did, const QString& feedKey) const;
 
-    QSettings mSettings;
+    SettingsStore mSettings;
     PasswordEncryption mEncryption;
     std::optional<std::unordered_set<QString>> mSyncFeeds;
     std::optional<std::unordered_set<QString>> mSyncSearchFeeds;
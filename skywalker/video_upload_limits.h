@@ -22,12 +22,17 @@ public:
     explicit VideoUploadLimits(const ATProto::AppBskyVideo::GetUploadLimitsOutput::SharedPtr& limits) : mLimits(limits) {}
     VideoUploadLimits(const QString& error, const QString& message) : mError(error), mMessage(message) {}
 
+    // False when the limits could not be retrieved.
+    bool isValid() const { return mLimits != nullptr; }
     bool canUpload() const { return mLimits ? mLimits->mCanUpload : false; }
     int getRemainingDailyVideos() const { return mLimits ? mLimits->mRemainingDailyVideos.value_or(0) : 0; }
     qint64 getRemainingDailyBytes() const { return mLimits ? mLimits->mRemainingDailyBytes.value_or(0) : 0; }
     QString getError() const { return mLimits ? mLimits->mError.value_or("") : mError; }
     QString getMessage() const { return mLimits ? mLimits->mMessage.value_or("") : mMessage; }
 
+    bool canUploadBytes(qint64 bytes) const {
+        return canUpload() && (!mLimits->mRemainingDailyBytes || bytes <= *mLimits->mRemainingDailyBytes); }
+
 private:
     ATProto::AppBskyVideo::GetUploadLimitsOutput::SharedPtr mLimits;
     QString mError;
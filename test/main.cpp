@@ -1,17 +1,31 @@
 // Copyright (C) 2024 Michel de Boer
 // License: GPLv3
 #include "test_anniversary.h"
+#include "test_author_typeahead.h"
 #include "test_content_filter.h"
+#include "test_draft_index.h"
+#include "test_draft_orphaned_media_checker.h"
 #include "test_expiry_cache.h"
+#include "test_feed_spill_store.h"
 #include "test_filtered_post_feed_model.h"
 #include "test_focus_hashtags.h"
+#include "test_gif_meta_data.h"
+#include "test_graph_utils.h"
 #include "test_hashtag_index.h"
+#include "test_html_head_scanner.h"
+#include "test_image_worker.h"
+#include "test_incremental_facet_parser.h"
+#include "test_link_card_store.h"
 #include "test_muted_words.h"
+#include "test_network_utils.h"
 #include "test_post_feed_model.h"
+#include "test_prefetch_scheduler.h"
 #include "test_search_utils.h"
+#include "test_settings_store.h"
 #include "test_text_differ.h"
 #include "test_text_splitter.h"
 #include "test_unicode_fonts.h"
+#include "test_upload_progress_device.h"
 #include "test_uri_with_expiry.h"
 #include <QtTest/QTest>
 
@@ -20,30 +34,69 @@ int main(int argc, char *argv[])
     TestAnniversary testAnniversary;
     QTest::qExec(&testAnniversary, argc, argv);
 
+    TestAuthorTypeahead testAuthorTypeahead;
+    QTest::qExec(&testAuthorTypeahead, argc, argv);
+
     TestContentFilter testContentFilter;
     QTest::qExec(&testContentFilter, argc, argv);
 
+    TestDraftIndex testDraftIndex;
+    QTest::qExec(&testDraftIndex, argc, argv);
+
+    TestDraftOrphanedMediaChecker testDraftOrphanedMediaChecker;
+    QTest::qExec(&testDraftOrphanedMediaChecker, argc, argv);
+
     TestExpiryCache testExpiryCache;
     QTest::qExec(&testExpiryCache, argc, argv);
 
+    TestFeedSpillStore testFeedSpillStore;
+    QTest::qExec(&testFeedSpillStore, argc, argv);
+
     TestFocusHashTags testFocusHashtags;
     QTest::qExec(&testFocusHashtags, argc, argv);
 
+    TestGifMetaData testGifMetaData;
+    QTest::qExec(&testGifMetaData, argc, argv);
+
+    TestGraphUtils testGraphUtils;
+    QTest::qExec(&testGraphUtils, argc, argv);
+
     TestHashTagIndex testHastTagIndex;
     QTest::qExec(&testHastTagIndex, argc, argv);
 
+    TestHtmlHeadScanner testHtmlHeadScanner;
+    QTest::qExec(&testHtmlHeadScanner, argc, argv);
+
+    TestImageWorker testImageWorker;
+    QTest::qExec(&testImageWorker, argc, argv);
+
+    TestIncrementalFacetParser testIncrementalFacetParser;
+    QTest::qExec(&testIncrementalFacetParser, argc, argv);
+
+    TestLinkCardStore testLinkCardStore;
+    QTest::qExec(&testLinkCardStore, argc, argv);
+
     TestMutedWords testMutedWords;
     QTest::qExec(&testMutedWords, argc, argv);
 
+    TestNetworkUtils testNetworkUtils;
+    QTest::qExec(&testNetworkUtils, argc, argv);
+
     TestPostFeedModel testPostFeedModel;
     QTest::qExec(&testPostFeedModel, argc, argv);
 
     TestFilteredPostFeedModel testFilteredPostFeedModel;
     QTest::qExec(&testFilteredPostFeedModel, argc, argv);
 
+    TestPrefetchScheduler testPrefetchScheduler;
+    QTest::qExec(&testPrefetchScheduler, argc, argv);
+
     TestSearchUtils testSearchUtils;
     QTest::qExec(&testSearchUtils, argc, argv);
 
+    TestSettingsStore testSettingsStore;
+    QTest::qExec(&testSettingsStore, argc, argv);
+
     TestTextDiffer testTextDiffer;
     QTest::qExec(&testTextDiffer, argc, argv);
 
@@ -53,6 +106,9 @@ int main(int argc, char *argv[])
     TestUnicodeFonts testUnicodeFonts;
     QTest::qExec(&testUnicodeFonts, argc, argv);
 
+    TestUploadProgressDevice testUploadProgressDevice;
+    QTest::qExec(&testUploadProgressDevice, argc, argv);
+
     TestUriWithExpiry testUriWithExpiry;
     QTest::qExec(&testUriWithExpiry, argc, argv);
 
@@ -0,0 +1,73 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <author_typeahead.h>
+#include <QtTest/QTest>
+
+using namespace Skywalker;
+using namespace std::chrono_literals;
+
+class TestAuthorTypeahead : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init()
+    {
+        mRequestCount = 0;
+        mResultCount = 0;
+
+        // Without a client the request is counted, but not sent.
+        mTypeahead = std::make_unique<AuthorTypeahead>([this]() -> ATProto::Client* {
+            ++mRequestCount;
+            return nullptr;
+        });
+    }
+
+    void cleanup()
+    {
+        mTypeahead = nullptr;
+    }
+
+    void debounce()
+    {
+        mTypeahead->search("a", 10, resultCb());
+        mTypeahead->search("ab", 10, resultCb());
+        mTypeahead->search("abc", 10, resultCb());
+        QCOMPARE(mRequestCount, 0);
+
+        QTRY_COMPARE(mRequestCount, 1);
+        QTest::qWait(500);
+        QCOMPARE(mRequestCount, 1);
+    }
+
+    void cancelPendingSearch()
+    {
+        mTypeahead->search("ab", 10, resultCb());
+        mTypeahead->cancel();
+
+        QTest::qWait(500);
+        QCOMPARE(mRequestCount, 0);
+        QCOMPARE(mResultCount, 0);
+    }
+
+    void emptySearch()
+    {
+        mTypeahead->search("ab", 10, resultCb());
+        mTypeahead->search("  ", 10, resultCb());
+        QCOMPARE(mResultCount, 1);
+
+        QTest::qWait(500);
+        QCOMPARE(mRequestCount, 0);
+    }
+
+private:
+    AuthorTypeahead::ResultCb resultCb()
+    {
+        return [this](const AuthorTypeahead::ProfileList&){ ++mResultCount; };
+    }
+
+    std::unique_ptr<AuthorTypeahead> mTypeahead;
+    int mRequestCount = 0;
+    int mResultCount = 0;
+};
@@ -0,0 +1,142 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <draft_index.h>
+#include <QTemporaryDir>
+#include <QTimeZone>
+#include <QtTest/QTest>
+
+using namespace Skywalker;
+
+class TestDraftIndex : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init()
+    {
+        mDir = std::make_unique<QTemporaryDir>();
+        QVERIFY(mDir->isValid());
+    }
+
+    void cleanup()
+    {
+        mDir = nullptr;
+    }
+
+    void paging()
+    {
+        DraftIndex index(mDir->path());
+        QVERIFY(!index.exists());
+
+        for (int i = 0; i < 25; ++i)
+            index.putDraft(makeEntry(i));
+
+        QCOMPARE(index.size(), 25);
+
+        // Newest first
+        auto page = index.getEntries(0, 20);
+        QCOMPARE((int)page.size(), 20);
+        QCOMPARE(page.front().mId, getId(24));
+        QCOMPARE(page.back().mId, getId(5));
+
+        page = index.getEntries(20, 20);
+        QCOMPARE((int)page.size(), 5);
+        QCOMPARE(page.front().mId, getId(4));
+        QCOMPARE(page.back().mId, getId(0));
+
+        QVERIFY(index.getEntries(25, 20).empty());
+        QCOMPARE((int)index.getEntries().size(), 25);
+    }
+
+    void saveAndRemove()
+    {
+        {
+            DraftIndex index(mDir->path());
+            index.putDraft(makeEntry(1));
+            index.putDraft(makeEntry(2));
+        }
+
+        DraftIndex index(mDir->path());
+        QVERIFY(index.exists());
+        QCOMPARE(index.size(), 2);
+
+        const auto* entry = index.getEntry(getId(1));
+        QVERIFY(entry);
+        QCOMPARE(entry->mPreviewText, QString("Draft 1"));
+        QCOMPARE(entry->mThumbPath, QString("/pics/1.jpg"));
+        QCOMPARE(entry->mThreadLength, 2);
+        QCOMPARE(entry->mTimestamp, makeEntry(1).mTimestamp);
+
+        // Saving a draft again replaces its entry
+        auto changed = makeEntry(1);
+        changed.mPreviewText = "Changed";
+        index.putDraft(changed);
+        QCOMPARE(index.size(), 2);
+        QCOMPARE(DraftIndex(mDir->path()).getEntry(getId(1))->mPreviewText, QString("Changed"));
+
+        index.removeDraft(getId(1));
+        QCOMPARE(index.size(), 1);
+        QVERIFY(!index.getEntry(getId(1)));
+
+        DraftIndex reloaded(mDir->path());
+        QCOMPARE(reloaded.size(), 1);
+        QVERIFY(!reloaded.getEntry(getId(1)));
+        QVERIFY(reloaded.getEntry(getId(2)));
+    }
+
+    void sync()
+    {
+        {
+            DraftIndex index(mDir->path());
+            index.putDraft(makeEntry(1));
+            index.putDraft(makeEntry(2));
+        }
+
+        // Draft 2 was removed, 3 is not indexed yet and 4 cannot be read.
+        const QStringList files{ getId(1), getId(3), getId(4) };
+        QStringList read;
+        const auto createEntry = [&read](const QString& id) -> std::optional<DraftIndex::Entry> {
+            read.push_back(id);
+
+            if (id == getId(4))
+                return {};
+
+            return makeEntry(3);
+        };
+
+        DraftIndex index(mDir->path());
+        index.sync(files, createEntry);
+        QCOMPARE(read, QStringList({ getId(3), getId(4) }));
+        QCOMPARE(index.size(), 2);
+        QVERIFY(index.getEntry(getId(1)));
+        QVERIFY(!index.getEntry(getId(2)));
+        QVERIFY(index.getEntry(getId(3)));
+
+        // Indexed drafts are not read again.
+        read.clear();
+        DraftIndex reloaded(mDir->path());
+        reloaded.sync({ getId(1), getId(3) }, createEntry);
+        QVERIFY(read.isEmpty());
+        QCOMPARE(reloaded.size(), 2);
+    }
+
+private:
+    static QString getId(int i)
+    {
+        return QString("SWP_%1.json").arg(i, 4, 10, QChar('0'));
+    }
+
+    static DraftIndex::Entry makeEntry(int i)
+    {
+        DraftIndex::Entry entry;
+        entry.mId = getId(i);
+        entry.mTimestamp = QDateTime::fromSecsSinceEpoch(1700000000 + i * 60, QTimeZone::UTC);
+        entry.mPreviewText = QString("Draft %1").arg(i);
+        entry.mThumbPath = QString("/pics/%1.jpg").arg(i);
+        entry.mThreadLength = 2;
+        return entry;
+    }
+
+    std::unique_ptr<QTemporaryDir> mDir;
+};
@@ -0,0 +1,184 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <draft_media_manifest.h>
+#include <draft_orphaned_media_checker.h>
+#include <draft_posts.h>
+#include <file_utils.h>
+#include <QtTest/QTest>
+
+using namespace Skywalker;
+using namespace std::chrono_literals;
+
+class TestDraftOrphanedMediaChecker : public QObject
+{
+    Q_OBJECT
+
+    // Returns one page with the drafts in mDrafts (draft ID -> media file).
+    class Checker : public DraftOrphanedMediaChecker
+    {
+    public:
+        Checker(const QString& userDid, ATProto::Client::SharedPtr& bsky) :
+            DraftOrphanedMediaChecker(userDid, bsky)
+        {}
+
+        std::vector<std::pair<QString, QString>> mDrafts;
+        std::function<void()> mGetDraftsCb;
+        int mGetDraftsCount = 0;
+
+    protected:
+        void getDrafts(const QString&, const GetDraftsSuccessCb& successCb,
+                       const ATProto::Client::ErrorCb&) override
+        {
+            ++mGetDraftsCount;
+
+            if (mGetDraftsCb)
+                mGetDraftsCb();
+
+            auto output = std::make_shared<ATProto::AppBskyDraft::GetDraftsOutput>();
+
+            for (const auto& [draftId, fileName] : mDrafts)
+            {
+                auto image = std::make_shared<ATProto::AppBskyDraft::DraftEmbedImage>();
+                image->mLocalRef = std::make_shared<ATProto::AppBskyDraft::DraftEmbedLocalRef>();
+                image->mLocalRef->mPath = fileName;
+
+                auto post = std::make_shared<ATProto::AppBskyDraft::DraftPost>();
+                post->mEmbedImages.push_back(image);
+
+                auto draftView = std::make_shared<ATProto::AppBskyDraft::DraftView>();
+                draftView->mId = draftId;
+                draftView->mDraft = std::make_shared<ATProto::AppBskyDraft::Draft>();
+                draftView->mDraft->mPosts.push_back(post);
+                output->mDrafts.push_back(draftView);
+            }
+
+            QTimer::singleShot(0, [successCb, output]{ successCb(output); });
+        }
+    };
+
+private slots:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+    }
+
+    void init()
+    {
+        removeManifest();
+        QDir(getMediaPath()).removeRecursively();
+    }
+
+    void cleanup()
+    {
+        init();
+    }
+
+    void manifestAddRemove()
+    {
+        QVERIFY(!DraftMediaManifest(USER_DID).exists());
+
+        DraftMediaManifest manifest(USER_DID);
+        manifest.addDraft("draft1", "20250101000000");
+        manifest.addDraft("draft2", "20250102000000");
+
+        DraftMediaManifest reloaded(USER_DID);
+        QVERIFY(reloaded.exists());
+        QCOMPARE(reloaded.getBaseNames(), (std::unordered_set<QString>{ "20250101000000", "20250102000000" }));
+        QVERIFY(!reloaded.getLastVerification().isValid());
+
+        // A change by one instance is not lost by a change of another instance.
+        DraftMediaManifest(USER_DID).removeDraft("draft1");
+        manifest.addDraft("draft3", "20250103000000");
+        QCOMPARE(DraftMediaManifest(USER_DID).getBaseNames(), (std::unordered_set<QString>{ "20250102000000", "20250103000000" }));
+    }
+
+    void manifestSetDrafts()
+    {
+        DraftMediaManifest manifest(USER_DID);
+        manifest.addDraft("old", "20250101000000");
+        QTest::qWait(5);
+
+        const QDateTime verificationStart = QDateTime::currentDateTimeUtc();
+        DraftMediaManifest(USER_DID).addDraft("new", "20250102000000");
+
+        manifest.setDrafts({ { "verified", "20250103000000" } }, verificationStart);
+        QCOMPARE(manifest.getBaseNames(), (std::unordered_set<QString>{ "20250102000000", "20250103000000" }));
+
+        DraftMediaManifest reloaded(USER_DID);
+        QCOMPARE(reloaded.getBaseNames(), manifest.getBaseNames());
+        QVERIFY(reloaded.getLastVerification().isValid());
+        QVERIFY(reloaded.getLastVerification() >= verificationStart.addSecs(-1));
+    }
+
+    void checkManifest()
+    {
+        DraftMediaManifest(USER_DID).setDrafts({ { "draft1", "20250101000000" } }, QDateTime::currentDateTimeUtc());
+
+        createMediaFile("SWI1_20250101000000-0.jpg", 2h);
+        createMediaFile("SWI1_20250102000000-0.jpg", 2h);
+        createMediaFile("SWI1_20250103000000-0.jpg", 1min);
+
+        ATProto::Client::SharedPtr bsky;
+        auto checker = std::make_unique<Checker>(USER_DID, bsky);
+        bool finished = false;
+        checker->start([&finished]{ finished = true; });
+        QTRY_VERIFY(finished);
+
+        QCOMPARE(checker->mGetDraftsCount, 0);
+        QCOMPARE(getMediaFiles(), (QStringList{ "SWI1_20250101000000-0.jpg", "SWI1_20250103000000-0.jpg" }));
+    }
+
+    void fullVerification()
+    {
+        createMediaFile("SWI1_20250101000000-0.jpg", 2h);
+        createMediaFile("SWI1_20250102000000-0.jpg", 2h);
+        createMediaFile("SWI1_20250103000000-0.jpg", 1min);
+
+        ATProto::Client::SharedPtr bsky;
+        auto checker = std::make_unique<Checker>(USER_DID, bsky);
+        checker->mDrafts = { { "draft1", "SWI1_20250101000000-0.jpg" } };
+
+        // A draft saved on this device while the verification runs.
+        checker->mGetDraftsCb = []{
+            DraftMediaManifest(USER_DID).addDraft("draft4", "20250104000000");
+        };
+
+        bool finished = false;
+        checker->start([&finished]{ finished = true; });
+        QTRY_VERIFY(finished);
+
+        QCOMPARE(checker->mGetDraftsCount, 1);
+        QCOMPARE(getMediaFiles(), (QStringList{ "SWI1_20250101000000-0.jpg", "SWI1_20250103000000-0.jpg" }));
+
+        DraftMediaManifest manifest(USER_DID);
+        QVERIFY(manifest.getLastVerification().isValid());
+        QCOMPARE(manifest.getBaseNames(), (std::unordered_set<QString>{ "20250101000000", "20250104000000" }));
+    }
+
+private:
+    static constexpr char const* USER_DID = "did:plc:test-draft-media";
+
+    static QString getMediaPath()
+    {
+        return DraftPosts::getPictureDraftsPath(DraftPosts::STORAGE_BLUESKY, USER_DID);
+    }
+
+    static void removeManifest()
+    {
+        QFile::remove(QDir(FileUtils::getAppDataPath(USER_DID)).filePath("draft_media_manifest.json"));
+    }
+
+    static void createMediaFile(const QString& fileName, std::chrono::minutes age)
+    {
+        QFile file(QDir(getMediaPath()).filePath(fileName));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write("media");
+        QVERIFY(file.setFileTime(QDateTime::currentDateTimeUtc() - age, QFileDevice::FileModificationTime));
+    }
+
+    static QStringList getMediaFiles()
+    {
+        return QDir(getMediaPath()).entryList(QDir::Files, QDir::Name);
+    }
+};
@@ -0,0 +1,266 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <feed_spill_store.h>
+#include <file_utils.h>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+using namespace Skywalker;
+using namespace std::chrono_literals;
+
+class TestFeedSpillStore : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init()
+    {
+        removeFiles();
+        mNextPostId = 1;
+    }
+
+    void cleanup()
+    {
+        removeFiles();
+    }
+
+    void spillAndLoad()
+    {
+        FeedSpillStore store(STORE_NAME);
+        store.open(USER_DID);
+        QVERIFY(store.isOpen());
+        QVERIFY(!store.loadPage("c1"));
+
+        store.spillPage("c1", "c2", getFeed(3));
+        store.spillPage("c2", "", getFeed(2));
+        QCOMPARE((int)store.size(), 2);
+
+        auto page = store.loadPage("c1");
+        QVERIFY(page);
+        QCOMPARE((int)page->mFeed.size(), 3);
+        QCOMPARE(page->mFeed[0]->mPost->mCid, "cid1");
+        QVERIFY(page->mCursor);
+        QCOMPARE(*page->mCursor, "c2");
+
+        page = store.loadPage("c2");
+        QVERIFY(page);
+        QCOMPARE((int)page->mFeed.size(), 2);
+        QVERIFY(!page->mCursor);
+
+        // The pages are written in the background
+        QTRY_VERIFY(QFileInfo(getDataFileName()).size() > 0);
+        page = store.loadPage("c1");
+        QVERIFY(page);
+        QCOMPARE(page->mFeed[0]->mPost->mCid, "cid1");
+    }
+
+    void reload()
+    {
+        {
+            FeedSpillStore store(STORE_NAME);
+            store.open(USER_DID);
+            store.spillPage("c1", "c2", getFeed(3));
+        }
+
+        FeedSpillStore store(STORE_NAME);
+        store.open(USER_DID);
+        QVERIFY(store.hasPage("c1"));
+
+        const auto page = store.loadPage("c1");
+        QVERIFY(page);
+        QCOMPARE((int)page->mFeed.size(), 3);
+
+        store.clear();
+        QCOMPARE((int)store.size(), 0);
+        QCOMPARE(QFileInfo(getDataFileName()).size(), qint64(0));
+    }
+
+    void removeInvalidPage()
+    {
+        {
+            FeedSpillStore store(STORE_NAME);
+            store.open(USER_DID);
+            store.spillPage("c1", "", getFeed(3));
+        }
+
+        QFile file(getDataFileName());
+        QVERIFY(file.open(QIODevice::ReadWrite));
+        file.write(QByteArray(file.size(), '#'));
+        file.close();
+
+        {
+            FeedSpillStore store(STORE_NAME);
+            store.open(USER_DID);
+            QVERIFY(store.hasPage("c1"));
+            QVERIFY(!store.loadPage("c1"));
+            QVERIFY(!store.hasPage("c1"));
+        }
+
+        // The removal is saved in the index
+        FeedSpillStore store(STORE_NAME);
+        store.open(USER_DID);
+        QVERIFY(!store.hasPage("c1"));
+    }
+
+    void compaction()
+    {
+        spillWithExpiredPage();
+        const qint64 oldDataSize = QFileInfo(getDataFileName()).size();
+
+        // The expired page is removed on opening
+        FeedSpillStore store(STORE_NAME);
+        QSignalSpy spy(&store, &FeedSpillStore::compacted);
+        store.open(USER_DID);
+        QVERIFY(store.isCompacting());
+        QVERIFY(!store.hasPage("old"));
+
+        // Spill a page while compacting
+        store.spillPage("during", "", getFeed(1));
+        QTRY_COMPARE(spy.count(), 1);
+        QVERIFY(!store.isCompacting());
+        QCOMPARE((int)store.size(), 2);
+
+        auto page = store.loadPage("new");
+        QVERIFY(page);
+        QCOMPARE((int)page->mFeed.size(), 2);
+        QCOMPARE(page->mFeed[0]->mPost->mCid, "cid4");
+
+        page = store.loadPage("during");
+        QVERIFY(page);
+        QCOMPARE((int)page->mFeed.size(), 1);
+
+        QVERIFY(QFileInfo(getDataFileName()).size() < oldDataSize);
+        QVERIFY(!QFile::exists(getCompactFileName()));
+
+        // The compacted index is saved
+        store.close();
+        store.open(USER_DID);
+        QCOMPARE((int)store.size(), 2);
+        QVERIFY(store.loadPage("during"));
+    }
+
+    void clearDuringCompaction()
+    {
+        spillWithExpiredPage();
+
+        FeedSpillStore store(STORE_NAME);
+        QSignalSpy spy(&store, &FeedSpillStore::compacted);
+        store.open(USER_DID);
+        QVERIFY(store.isCompacting());
+
+        store.clear();
+        QVERIFY(!store.isCompacting());
+        QTest::qWait(100);
+        QCOMPARE(spy.count(), 0);
+        QCOMPARE((int)store.size(), 0);
+        QCOMPARE(QFileInfo(getDataFileName()).size(), qint64(0));
+        QVERIFY(!QFile::exists(getCompactFileName()));
+    }
+
+private:
+    static constexpr char const* USER_DID = "did:plc:test-spill";
+    static constexpr char const* STORE_NAME = "test_spill";
+
+    static constexpr char const* POST_TEMPLATE = R"##({
+        "post": {
+            "uri": "at://did:plc:foo/app.bsky.feed.post/r%1",
+            "cid": "cid%1",
+            "author": {
+                "did": "did:plc:foo",
+                "handle": "foo.bsky.social"
+            },
+            "record": {
+                "$type": "app.bsky.feed.post",
+                "text": "Hello world!",
+                "createdAt": "2023-11-20T18:46:00.000Z"
+            },
+            "indexedAt": "2023-11-20T18:46:00.000Z"
+        }
+    })##";
+
+    static QString getPath()
+    {
+        return FileUtils::getCachePath(USER_DID);
+    }
+
+    static QString getDataFileName()
+    {
+        return QDir(getPath()).filePath(QString(STORE_NAME) + ".dat");
+    }
+
+    static QString getIndexFileName()
+    {
+        return QDir(getPath()).filePath(QString(STORE_NAME) + "_index.json");
+    }
+
+    static QString getCompactFileName()
+    {
+        return QDir(getPath()).filePath(QString(STORE_NAME) + ".compact");
+    }
+
+    static void removeFiles()
+    {
+        QFile::remove(getDataFileName());
+        QFile::remove(getIndexFileName());
+        QFile::remove(getCompactFileName());
+    }
+
+    // Spills an "old" page with posts 1-3 and a "new" page with posts 4-5.
+    // The "old" page is made expired in the saved index.
+    void spillWithExpiredPage()
+    {
+        {
+            FeedSpillStore store(STORE_NAME);
+            store.open(USER_DID);
+            store.spillPage("old", "new", getFeed(3));
+            store.spillPage("new", "", getFeed(2));
+        }
+
+        QFile file(getIndexFileName());
+        QVERIFY(file.open(QIODevice::ReadOnly));
+        QJsonObject json = QJsonDocument::fromJson(file.readAll()).object();
+        file.close();
+
+        QJsonArray pages = json.value("pages").toArray();
+
+        for (int i = 0; i < pages.size(); ++i)
+        {
+            QJsonObject page = pages[i].toObject();
+
+            if (page.value("cursor").toString() == "old")
+            {
+                page.insert("spilledAt", QDateTime::currentDateTimeUtc().addDays(-2).toSecsSinceEpoch());
+                pages[i] = page;
+            }
+        }
+
+        json.insert("pages", pages);
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        file.write(QJsonDocument(json).toJson(QJsonDocument::Compact));
+    }
+
+    FeedSpillStore::FeedViewPostList getFeed(int numPosts)
+    {
+        QString feedData = R"###({ "feed": [)###";
+
+        for (int i = 1; i <= numPosts; ++i)
+        {
+            feedData += QString(POST_TEMPLATE).arg(QString::number(mNextPostId++));
+
+            if (i < numPosts)
+                feedData += ',';
+        }
+
+        feedData += "]}";
+
+        const auto json = QJsonDocument::fromJson(feedData.toUtf8());
+        return ATProto::AppBskyFeed::OutputFeed::fromJson(json.object())->mFeed;
+    }
+
+    int mNextPostId = 1;
+};
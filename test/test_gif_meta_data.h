@@ -0,0 +1,59 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <gif_meta_data.h>
+#include <QtTest/QTest>
+
+using namespace Skywalker;
+
+class TestGifMetaData : public QObject
+{
+    Q_OBJECT
+private slots:
+    void parse()
+    {
+        const QByteArray gif = createGif({ 10, 0, 25 });
+        GifMetaData metaData;
+        QVERIFY(metaData.parse(gif));
+        QCOMPARE(metaData.getFrameCount(), 3);
+        QCOMPARE(metaData.getFrameDelaysMs(), std::vector<int>({ 100, 0, 250 }));
+    }
+
+    void truncated()
+    {
+        const QByteArray gif = createGif({ 10, 20 });
+        GifMetaData metaData;
+        QVERIFY(metaData.parse(gif.first(gif.size() - 4)));
+        QCOMPARE(metaData.getFrameDelaysMs(), std::vector<int>({ 100 }));
+    }
+
+    void notGif()
+    {
+        GifMetaData metaData;
+        QVERIFY(!metaData.parse("\x89PNG\r\n\x1a\n0000000000"));
+        QVERIFY(!metaData.parse(createGif({})));
+    }
+
+private:
+    // Creates a GIF of 1x1 pixel frames with the given delays in 1/100 sec.
+    static QByteArray createGif(const std::vector<int>& delays)
+    {
+        QByteArray gif("GIF89a");
+        gif.append("\x01\x00\x01\x00\x80\x00\x00", 7); // global color table of 2 colors
+        gif.append("\x00\x00\x00\xff\xff\xff", 6);
+        gif.append("\x21\xff\x0bNETSCAPE2.0\x03\x01\x00\x00\x00", 19);
+
+        for (int delay : delays)
+        {
+            gif.append("\x21\xf9\x04\x00", 4);
+            gif.append(char(delay & 0xff));
+            gif.append(char(delay >> 8));
+            gif.append("\x00\x00", 2);
+            gif.append("\x2c\x00\x00\x00\x00\x01\x00\x01\x00\x00", 10);
+            gif.append("\x02\x02\x44\x01\x00", 5);
+        }
+
+        gif.append('\x3b');
+        return gif;
+    }
+};
@@ -0,0 +1,54 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <graph_utils.h>
+#include <QtTest/QTest>
+
+using namespace Skywalker;
+
+class TestGraphUtils : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void listUsersBatch()
+    {
+        QStringList dids;
+
+        for (int i = 0; i < 250; ++i)
+            dids.push_back(QString("did:plc:user%1").arg(i));
+
+        auto batch = GraphUtils::getListUsersBatch(dids, 0);
+        QCOMPARE((int)batch.size(), 100);
+        QCOMPARE(batch.front(), "did:plc:user0");
+        QCOMPARE(batch.back(), "did:plc:user99");
+
+        batch = GraphUtils::getListUsersBatch(dids, 200);
+        QCOMPARE((int)batch.size(), 50);
+        QCOMPARE(batch.front(), "did:plc:user200");
+
+        batch = GraphUtils::getListUsersBatch(dids, 250);
+        QVERIFY(batch.isEmpty());
+    }
+
+    void listUsersBatchSkipMembers()
+    {
+        const QStringList dids{ "did:plc:a", "did:plc:b", "did:plc:c" };
+
+        auto batch = GraphUtils::getListUsersBatch(dids, 0, { "did:plc:b", "did:plc:other" });
+        QCOMPARE(batch, QStringList({ "did:plc:a", "did:plc:c" }));
+
+        batch = GraphUtils::getListUsersBatch(dids, 0, { "did:plc:a", "did:plc:b", "did:plc:c" });
+        QVERIFY(batch.isEmpty());
+    }
+
+    void retryListUsersBatch()
+    {
+        QVERIFY(GraphUtils::canRetryListUsersBatch("UpstreamFailure", 0));
+        QVERIFY(GraphUtils::canRetryListUsersBatch("RateLimitExceeded", 1));
+        QVERIFY(!GraphUtils::canRetryListUsersBatch("UpstreamFailure", 2));
+        QVERIFY(!GraphUtils::canRetryListUsersBatch("InvalidRequest", 0));
+        QVERIFY(!GraphUtils::canRetryListUsersBatch("InvalidSwap", 0));
+        QVERIFY(!GraphUtils::canRetryListUsersBatch("ExpiredToken", 0));
+    }
+};
@@ -0,0 +1,71 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <html_head_scanner.h>
+#include <QtTest/QTest>
+
+using namespace Skywalker;
+
+class TestHtmlHeadScanner : public QObject
+{
+    Q_OBJECT
+private slots:
+    void scan_data()
+    {
+        QTest::addColumn<int>("chunkSize");
+        QTest::newRow("whole document") << 0;
+        QTest::newRow("chunks of 1") << 1;
+        QTest::newRow("chunks of 7") << 7;
+    }
+
+    void scan()
+    {
+        QFETCH(int, chunkSize);
+        const QByteArray html = R"(<!DOCTYPE html>
+<html><head>
+<!-- <meta property="og:title" content="comment"> -->
+<title>HTML title</title>
+<meta name="description" content='Plain description'>
+<meta content="Twitter title" name="twitter:title">
+<meta property="og:title" content="OG title &amp; more">
+<meta property="og:image:width" content="1200">
+<script>if (a < b && c > d) document.write("<meta property='og:image' content='script'>");</script>
+<meta property=og:image content=https://example.com/img.jpg>
+<link rel="site.standard.document" href="at://did:plc:foo/site.standard.document/1">
+</head>
+<body><meta property="og:description" content="Body description"></body>
+</html>)";
+
+        HtmlHeadScanner scanner;
+
+        if (chunkSize == 0)
+        {
+            scanner.addData(html);
+        }
+        else
+        {
+            for (qsizetype i = 0; i < html.size(); i += chunkSize)
+                scanner.addData(html.mid(i, chunkSize));
+        }
+
+        QVERIFY(scanner.isHeadComplete());
+        QCOMPARE(scanner.getTitle(), "OG title &amp; more");
+        QCOMPARE(scanner.getDescription(), "Plain description");
+        QCOMPARE(scanner.getImage(), "https://example.com/img.jpg");
+        QCOMPARE(scanner.getHtmlTitle(), "HTML title");
+        QCOMPARE(scanner.getStandardSiteDocument(), "at://did:plc:foo/site.standard.document/1");
+        QVERIFY(scanner.getStandardSitePublication().isEmpty());
+    }
+
+    void headNotComplete()
+    {
+        HtmlHeadScanner scanner;
+        scanner.addData("<html><head><meta property=\"og:title\" content=\"Title\"><meta ");
+        QVERIFY(!scanner.isHeadComplete());
+        QCOMPARE(scanner.getTitle(), "Title");
+
+        scanner.addData("property=\"og:description\" content=\"Description\"><body>");
+        QVERIFY(scanner.isHeadComplete());
+        QCOMPARE(scanner.getDescription(), "Description");
+    }
+};
@@ -0,0 +1,121 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <image_worker.h>
+#include <QSemaphore>
+#include <QThread>
+#include <QtTest/QTest>
+
+using namespace Skywalker;
+
+class TestImageWorker : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void cleanup()
+    {
+        ImageWorker::threadPool()->waitForDone();
+        QCoreApplication::processEvents();
+    }
+
+    void result()
+    {
+        ImageWorker worker;
+        QThread* workThread = nullptr;
+        QThread* resultThread = nullptr;
+        int result = 0;
+
+        worker.run<int>(
+            [&workThread]{
+                workThread = QThread::currentThread();
+                return 42;
+            },
+            [&resultThread, &result](int value){
+                resultThread = QThread::currentThread();
+                result = value;
+            });
+
+        QTRY_COMPARE(result, 42);
+        QVERIFY(workThread);
+        QVERIFY(workThread != QThread::currentThread());
+        QCOMPARE(resultThread, QThread::currentThread());
+    }
+
+    void order()
+    {
+        ImageWorker worker;
+        std::vector<int> results;
+
+        for (int i = 0; i < 10; ++i)
+            worker.run<int>([i]{ return i; }, [&results](int value){ results.push_back(value); });
+
+        QTRY_COMPARE((int)results.size(), 10);
+
+        for (int i = 0; i < 10; ++i)
+            QCOMPARE(results[i], i);
+    }
+
+    void cancel()
+    {
+        ImageWorker worker;
+        QSemaphore started;
+        QSemaphore proceed;
+        std::atomic_bool secondRan = false;
+        int results = 0;
+
+        worker.run<int>(
+            [&started, &proceed]{
+                started.release();
+                proceed.acquire();
+                return 1;
+            },
+            [&results](int){ ++results; });
+
+        worker.run<int>(
+            [&secondRan]{
+                secondRan = true;
+                return 2;
+            },
+            [&results](int){ ++results; });
+
+        started.acquire();
+        worker.cancel();
+        proceed.release();
+        ImageWorker::threadPool()->waitForDone();
+        QCoreApplication::processEvents();
+
+        // The result of the running task is dropped, the queued task is skipped.
+        QCOMPARE(results, 0);
+        QVERIFY(!secondRan);
+
+        // Work started after the cancel runs normally.
+        worker.run<int>([]{ return 3; }, [&results](int value){ results = value; });
+        QTRY_COMPARE(results, 3);
+    }
+
+    void destroy()
+    {
+        QSemaphore started;
+        QSemaphore proceed;
+        bool resultDelivered = false;
+
+        {
+            ImageWorker worker;
+            worker.run<int>(
+                [&started, &proceed]{
+                    started.release();
+                    proceed.acquire();
+                    return 1;
+                },
+                [&resultDelivered](int){ resultDelivered = true; });
+
+            started.acquire();
+        }
+
+        proceed.release();
+        ImageWorker::threadPool()->waitForDone();
+        QCoreApplication::processEvents();
+        QVERIFY(!resultDelivered);
+    }
+};
@@ -0,0 +1,60 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <incremental_facet_parser.h>
+#include <QtTest/QTest>
+
+using namespace Skywalker;
+
+class TestIncrementalFacetParser : public QObject
+{
+    Q_OBJECT
+private slots:
+    void parse_data()
+    {
+        QTest::addColumn<QStringList>("edits");
+        QTest::newRow("type mention") << QStringList{"", "@", "@a", "@al", "@alice.bsky.social", "@alice.bsky.social "};
+        QTest::newRow("insert before facets") << QStringList{"#foo @bob.test https://example.com", "x #foo @bob.test https://example.com"};
+        QTest::newRow("insert after facets") << QStringList{"#foo @bob.test", "#foo @bob.test #bar"};
+        QTest::newRow("edit inside link") << QStringList{"see https://example.com now", "see https://examples.com now", "see https://exa now"};
+        QTest::newRow("split word") << QStringList{"hello#world", "hello #world"};
+        QTest::newRow("merge words") << QStringList{"hello #world", "hello#world"};
+        QTest::newRow("delete facet") << QStringList{"a #tag b", "a  b", "a b"};
+        QTest::newRow("replace all") << QStringList{"#foo bar", "@bob.test"};
+        QTest::newRow("newlines") << QStringList{"#foo\n@bob.test", "#foo\n\n@bob.test", "#fo\n\n@bob.test\n$CASH"};
+    }
+
+    void parse()
+    {
+        QFETCH(QStringList, edits);
+        IncrementalFacetParser parser;
+
+        for (const auto& text : edits)
+        {
+            const auto facets = parser.parse(text);
+            const auto expected = ATProto::RichTextMaster::parseFacets(text);
+            QVERIFY2(equalFacets(facets, expected), qPrintable(text));
+        }
+    }
+
+private:
+    bool equalFacets(const std::vector<IncrementalFacetParser::ParsedMatch>& lhs,
+                     const std::vector<IncrementalFacetParser::ParsedMatch>& rhs) const
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            if (lhs[i].mType != rhs[i].mType ||
+                lhs[i].mStartIndex != rhs[i].mStartIndex ||
+                lhs[i].mEndIndex != rhs[i].mEndIndex ||
+                lhs[i].mMatch != rhs[i].mMatch)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
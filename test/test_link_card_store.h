@@ -0,0 +1,165 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <file_utils.h>
+#include <link_card_store.h>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QStandardPaths>
+#include <QtTest/QTest>
+
+using namespace Skywalker;
+
+class TestLinkCardStore : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+    }
+
+    void init()
+    {
+        QDir(getPath()).removeRecursively();
+    }
+
+    void cleanup()
+    {
+        init();
+    }
+
+    void putCard()
+    {
+        LinkCardStore store;
+        QVERIFY(!store.getCard(QUrl("https://example.com/1")));
+
+        store.putCard(QUrl("https://example.com/1"), makeCard("https://example.com/1", "etag1"));
+        const auto* card = store.getCard(QUrl("https://example.com/1"));
+        QVERIFY(card);
+        QCOMPARE(card->mTitle, QString("Title https://example.com/1"));
+        QCOMPARE(card->mAssociatedUris, std::vector<QString>{ "at://did:plc:foo/app.bsky.feed.post/1" });
+        QVERIFY(store.isFresh(*card));
+    }
+
+    void batchedSave()
+    {
+        auto store = std::make_unique<LinkCardStore>();
+
+        for (int i = 0; i < 3; ++i)
+        {
+            const QString link = QString("https://example.com/%1").arg(i);
+            store->putCard(QUrl(link), makeCard(link, QString("etag%1").arg(i)));
+        }
+
+        // Nothing is written till the save delay passed.
+        QVERIFY(!QFile::exists(getIndexFileName()));
+
+        store->flush();
+        QVERIFY(QFile::exists(getIndexFileName()));
+
+        store->revalidated(QUrl("https://example.com/1"));
+        store = nullptr; // pending changes are saved on destruction
+
+        LinkCardStore reloaded;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            const QString link = QString("https://example.com/%1").arg(i);
+            const auto* card = reloaded.getCard(QUrl(link));
+            QVERIFY(card);
+            QCOMPARE(card->mLink, link);
+            QCOMPARE(card->mETag, QString("etag%1").arg(i));
+            QVERIFY(reloaded.isFresh(*card));
+        }
+    }
+
+    void removeOldCards()
+    {
+        QDir().mkpath(getPath());
+        QJsonArray cards;
+        cards.append(makeCardJson("https://example.com/old", QDateTime::currentDateTimeUtc().addDays(-31)));
+        cards.append(makeCardJson("https://example.com/stale", QDateTime::currentDateTimeUtc().addDays(-2)));
+        QJsonObject json;
+        json.insert("cards", cards);
+
+        QFile file(getIndexFileName());
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write(QJsonDocument(json).toJson(QJsonDocument::Compact));
+        file.close();
+
+        LinkCardStore store;
+        QVERIFY(!store.getCard(QUrl("https://example.com/old")));
+
+        const auto* card = store.getCard(QUrl("https://example.com/stale"));
+        QVERIFY(card);
+        QVERIFY(!store.isFresh(*card));
+    }
+
+    void thumbs()
+    {
+        QImage image(16, 16, QImage::Format_RGB32);
+        image.fill(Qt::red);
+
+        {
+            LinkCardStore store;
+            auto card = makeCard("https://example.com/1", "");
+            card.mThumb = "https://example.com/used.jpg";
+            store.putCard(QUrl(card.mLink), card);
+            store.putThumb(card.mThumb, image);
+            store.putThumb("https://example.com/unused.jpg", image);
+            store.putThumb("file:///local.jpg", image);
+
+            QVERIFY(!store.getThumb("https://example.com/used.jpg").isNull());
+            QVERIFY(!store.getThumb("https://example.com/unused.jpg").isNull());
+            QVERIFY(store.getThumb("file:///local.jpg").isNull());
+
+            // Stored thumbs are served from disk.
+            const QString thumbSource = store.getThumbSource("https://example.com/used.jpg");
+            QVERIFY(thumbSource.startsWith("file://"));
+            QVERIFY(!QImage(QUrl(thumbSource).toLocalFile()).isNull());
+            QCOMPARE(store.getThumbSource("https://example.com/other.jpg"), QString("https://example.com/other.jpg"));
+            QCOMPARE(store.getLinkThumbSource(card.mLink, "https://cdn.example.com/thumb.jpg"), thumbSource);
+            QCOMPARE(store.getLinkThumbSource("https://example.com/2", "https://cdn.example.com/thumb.jpg"),
+                     QString("https://cdn.example.com/thumb.jpg"));
+        }
+
+        // Thumbs without a card are removed on opening.
+        LinkCardStore store;
+        QVERIFY(!store.getThumb("https://example.com/used.jpg").isNull());
+        QVERIFY(store.getThumb("https://example.com/unused.jpg").isNull());
+    }
+
+private:
+    static QString getPath()
+    {
+        return FileUtils::getCachePath("link_cards");
+    }
+
+    static QString getIndexFileName()
+    {
+        return QDir(getPath()).filePath("link_cards.json");
+    }
+
+    static LinkCardStore::Card makeCard(const QString& link, const QString& etag)
+    {
+        LinkCardStore::Card card;
+        card.mLink = link;
+        card.mTitle = "Title " + link;
+        card.mDescription = "Description " + link;
+        card.mAssociatedUris.push_back("at://did:plc:foo/app.bsky.feed.post/1");
+        card.mETag = etag;
+        return card;
+    }
+
+    static QJsonObject makeCardJson(const QString& link, const QDateTime& fetchedAt)
+    {
+        QJsonObject obj;
+        obj.insert("link", link);
+        obj.insert("title", "Title " + link);
+        obj.insert("fetchedAt", fetchedAt.toSecsSinceEpoch());
+        return obj;
+    }
+};
@@ -0,0 +1,65 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <network_utils.h>
+#include <QtTest/QTest>
+
+using namespace Skywalker;
+
+class TestNetworkUtils : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void isTransientError_data()
+    {
+        QTest::addColumn<QNetworkReply::NetworkError>("error");
+        QTest::addColumn<int>("httpStatus");
+        QTest::addColumn<bool>("transient");
+
+        QTest::newRow("timeout") << QNetworkReply::TimeoutError << 0 << true;
+        QTest::newRow("transfer timeout") << QNetworkReply::OperationCanceledError << 0 << true;
+        QTest::newRow("temporary failure") << QNetworkReply::TemporaryNetworkFailureError << 0 << true;
+        QTest::newRow("host not found") << QNetworkReply::HostNotFoundError << 0 << false;
+        QTest::newRow("ssl") << QNetworkReply::SslHandshakeFailedError << 0 << false;
+        QTest::newRow("500") << QNetworkReply::InternalServerError << 500 << true;
+        QTest::newRow("503") << QNetworkReply::ServiceUnavailableError << 503 << true;
+        QTest::newRow("504 status only") << QNetworkReply::NoError << 504 << true;
+        QTest::newRow("429") << QNetworkReply::UnknownContentError << 429 << true;
+        QTest::newRow("400") << QNetworkReply::ProtocolInvalidOperationError << 400 << false;
+        QTest::newRow("401") << QNetworkReply::AuthenticationRequiredError << 401 << false;
+        QTest::newRow("413") << QNetworkReply::UnknownContentError << 413 << false;
+    }
+
+    void isTransientError()
+    {
+        QFETCH(QNetworkReply::NetworkError, error);
+        QFETCH(int, httpStatus);
+        QFETCH(bool, transient);
+
+        QCOMPARE(NetworkUtils::isTransientError(error, httpStatus), transient);
+    }
+
+    void isTransientXrpcError_data()
+    {
+        QTest::addColumn<QString>("error");
+        QTest::addColumn<bool>("transient");
+
+        QTest::newRow("InternalServerError") << "InternalServerError" << true;
+        QTest::newRow("UpstreamTimeout") << "UpstreamTimeout" << true;
+        QTest::newRow("RateLimitExceeded") << "RateLimitExceeded" << true;
+        QTest::newRow("InvalidRequest") << "InvalidRequest" << false;
+        QTest::newRow("ExpiredToken") << "ExpiredToken" << false;
+        QTest::newRow("PayloadTooLarge") << "PayloadTooLarge" << false;
+        QTest::newRow("InvalidSwap") << "InvalidSwap" << false;
+        QTest::newRow("network") << "Connection closed" << true;
+    }
+
+    void isTransientXrpcError()
+    {
+        QFETCH(QString, error);
+        QFETCH(bool, transient);
+
+        QCOMPARE(NetworkUtils::isTransientXrpcError(error), transient);
+    }
+};
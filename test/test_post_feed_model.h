@@ -1,13 +1,16 @@
 // Copyright (C) 2023 Michel de Boer
 // License: GPLv3
 #pragma once
+#include <author_cache.h>
 #include <definitions.h>
 #include <focus_hashtags.h>
 #include <follows_activity_store.h>
 #include <list_store.h>
 #include <muted_words.h>
 #include <post_feed_model.h>
+#include <post_thread_cache.h>
 #include <user_settings.h>
+#include <QtTest/QSignalSpy>
 #include <QtTest/QTest>
 
 using namespace Skywalker;
@@ -29,6 +32,7 @@ private slots:
     {
         mPostFeedModel = nullptr;
         mNextPostId = 1;
+        mUserDid.clear();
     }
 
     void setFeed()
@@ -444,7 +448,122 @@ private slots:
         QCOMPARE(index, 0);
     }
 
+    void localChangeTargetsRow()
+    {
+        mPostFeedModel->setFeed(getFeed(3, TEST_DATE));
+        QSignalSpy spy(mPostFeedModel.get(), &QAbstractItemModel::dataChanged);
+
+        mPostFeedModel->updateLikeCountDelta("cid2", 1);
+        QCOMPARE(spy.count(), 1);
+        QCOMPARE(spy[0][0].value<QModelIndex>().row(), 1);
+        QCOMPARE(spy[0][1].value<QModelIndex>().row(), 1);
+
+        const auto index = mPostFeedModel->index(1);
+        QCOMPARE(mPostFeedModel->data(index, int(AbstractPostFeedModel::Role::PostLikeCount)).toInt(), 1);
+
+        mPostFeedModel->updateLikeCountDelta("cidX", 1);
+        QCOMPARE(spy.count(), 1);
+    }
+
+    void authorAddedInvalidatesVisibleRow()
+    {
+        // Replies of the user are never hidden.
+        mUserDid = "did:plc:foo";
+        mPostFeedModel->setFeed(getFeed(REPLY_FEED, {}));
+        mPostFeedModel->setReverseFeed(true);
+
+        // The first post in the feed is the last row in the view.
+        const int row = mPostFeedModel->findPost("cid1");
+        QCOMPARE(row, 2);
+
+        const auto index = mPostFeedModel->index(row);
+        const int role = int(AbstractPostFeedModel::Role::PostReplyToAuthor);
+        QVERIFY(!mPostFeedModel->data(index, role).isValid());
+
+        AuthorCache::instance().put(BasicProfile("did:plc:bar", "bar.bsky.social", "Bar", ""));
+        QSignalSpy spy(mPostFeedModel.get(), &QAbstractItemModel::dataChanged);
+        emit AuthorCache::instance().profileAdded("did:plc:bar");
+
+        QTRY_COMPARE(spy.count(), 1);
+        QCOMPARE(spy[0][0].value<QModelIndex>().row(), row);
+        QCOMPARE(mPostFeedModel->data(index, role).value<BasicProfile>().getDisplayName(), "Bar");
+    }
+
+    void postIsThreadChangedTargetsVisibleRow()
+    {
+        mPostFeedModel->setFeed(getFeed(3, TEST_DATE));
+        mPostFeedModel->setReverseFeed(true);
+
+        // The first post in the feed is the last row in the view.
+        const int row = mPostFeedModel->findPost("cid1");
+        QCOMPARE(row, 2);
+
+        QSignalSpy spy(mPostFeedModel.get(), &QAbstractItemModel::dataChanged);
+        const QString uri = "at://did:plc:foo/app.bsky.feed.post/r1";
+        PostThreadCache::instance().put(uri, true);
+        emit PostThreadCache::instance().postAdded(uri);
+
+        QTRY_COMPARE(spy.count(), 1);
+        QCOMPARE(spy[0][0].value<QModelIndex>().row(), row);
+        QCOMPARE(spy[0][2].value<QList<int>>(), QList<int>{ int(AbstractPostFeedModel::Role::PostIsThread) });
+    }
+
 private:
+    static constexpr char const* REPLY_FEED = R"##({ "feed": [
+        {
+            "post": {
+                "uri": "at://did:plc:foo/app.bsky.feed.post/r1",
+                "cid": "cid1",
+                "author": {
+                    "did": "did:plc:foo",
+                    "handle": "foo.bsky.social"
+                },
+                "record": {
+                    "$type": "app.bsky.feed.post",
+                    "text": "Hello bar!",
+                    "createdAt": "2023-11-20T18:46:00.000Z",
+                    "reply": {
+                        "root": { "uri": "at://did:plc:bar/app.bsky.feed.post/root", "cid": "cidroot" },
+                        "parent": { "uri": "at://did:plc:bar/app.bsky.feed.post/root", "cid": "cidroot" }
+                    }
+                },
+                "indexedAt": "2023-11-20T18:46:00.000Z"
+            }
+        },
+        {
+            "post": {
+                "uri": "at://did:plc:foo/app.bsky.feed.post/r2",
+                "cid": "cid2",
+                "author": {
+                    "did": "did:plc:foo",
+                    "handle": "foo.bsky.social"
+                },
+                "record": {
+                    "$type": "app.bsky.feed.post",
+                    "text": "Hello world!",
+                    "createdAt": "2023-11-20T18:45:59.000Z"
+                },
+                "indexedAt": "2023-11-20T18:45:59.000Z"
+            }
+        },
+        {
+            "post": {
+                "uri": "at://did:plc:foo/app.bsky.feed.post/r3",
+                "cid": "cid3",
+                "author": {
+                    "did": "did:plc:foo",
+                    "handle": "foo.bsky.social"
+                },
+                "record": {
+                    "$type": "app.bsky.feed.post",
+                    "text": "Hello world!",
+                    "createdAt": "2023-11-20T18:45:58.000Z"
+                },
+                "indexedAt": "2023-11-20T18:45:58.000Z"
+            }
+        }
+    ]})##";
+
     static constexpr char const* POST_TEMPLATE = R"##({
         "post": {
             "uri": "at://did:plc:foo/app.bsky.feed.post/r%1",
@@ -499,7 +618,8 @@ private:
 
     QString mUserDid;
     Following mFollowing;
-    FollowsActivityStore mFollowsActivityStore{mFollowing, this};
+    PollScheduler mPollScheduler;
+    FollowsActivityStore mFollowsActivityStore{mFollowing, mPollScheduler, this};
     ListStore mHideLists;
     ListStore mContentFilterPolicies;
     ATProto::UserPreferences mUserPreferences;
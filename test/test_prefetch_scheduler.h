@@ -0,0 +1,124 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <prefetch_scheduler.h>
+#include <QSignalSpy>
+#include <QtTest/QTest>
+
+using namespace Skywalker;
+using namespace std::chrono_literals;
+
+class TestPrefetchScheduler : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init()
+    {
+        mScheduler = std::make_unique<PrefetchScheduler>();
+        mScheduler->setMinRemainingRows(10);
+        mFetchSpy = std::make_unique<QSignalSpy>(mScheduler.get(), &PrefetchScheduler::fetch);
+        mNow = PrefetchScheduler::Clock::now();
+    }
+
+    void cleanup()
+    {
+        mFetchSpy = nullptr;
+        mScheduler = nullptr;
+    }
+
+    void fewRemainingRows()
+    {
+        report(50, 100);
+        QCOMPARE(mFetchSpy->count(), 0);
+
+        report(9, 100, 10s);
+        QCOMPARE(mFetchSpy->count(), 1);
+    }
+
+    void inProgress()
+    {
+        mScheduler->setInProgress(true);
+        report(5, 100);
+        QCOMPARE(mFetchSpy->count(), 0);
+
+        mScheduler->setInProgress(false);
+        report(5, 100, 10s);
+        QCOMPARE(mFetchSpy->count(), 1);
+    }
+
+    void slowScrolling()
+    {
+        report(100, 200);
+        report(99, 200, 1s);
+        QVERIFY(mScheduler->getVelocity() < 1.0);
+        QVERIFY(!mScheduler->isPrefetchScheduled());
+        QCOMPARE(mFetchSpy->count(), 0);
+    }
+
+    void scheduleOnVelocity()
+    {
+        // Averaged 10 rows/s, the end is reached in 8s which is beyond the page latency.
+        report(100, 200);
+        report(80, 200, 1s);
+        QVERIFY(mScheduler->isPrefetchScheduled());
+        QCOMPARE(mFetchSpy->count(), 0);
+
+        // Speeding up, the end is reached before a page would arrive.
+        report(40, 200, 1500ms);
+        QVERIFY(!mScheduler->isPrefetchScheduled());
+        QCOMPARE(mFetchSpy->count(), 1);
+    }
+
+    void scheduledFetch()
+    {
+        // 10 rows/s, the prefetch is due 100ms from now.
+        report(41, 200);
+        report(21, 200, 1s);
+        QVERIFY(mScheduler->isPrefetchScheduled());
+        QTRY_COMPARE(mFetchSpy->count(), 1);
+    }
+
+    void reverseDirection()
+    {
+        report(100, 200);
+        report(80, 200, 1s);
+        QVERIFY(mScheduler->isPrefetchScheduled());
+
+        report(100, 200, 1500ms);
+        QVERIFY(mScheduler->getVelocity() < 0.0);
+        QVERIFY(!mScheduler->isPrefetchScheduled());
+        QCOMPARE(mFetchSpy->count(), 0);
+    }
+
+    void rowsAdded()
+    {
+        // A jump in remaining rows due to a new page is not scrolling.
+        report(100, 200);
+        report(150, 250, 1s);
+        QCOMPARE(mScheduler->getVelocity(), 0.0);
+        QVERIFY(!mScheduler->isPrefetchScheduled());
+    }
+
+    void pageLatency()
+    {
+        const auto defaultLatency = mScheduler->getPageLatency();
+        report(5, 100);
+        QCOMPARE(mFetchSpy->count(), 1);
+
+        mScheduler->setInProgress(true);
+        QTest::qWait(100);
+        mScheduler->setInProgress(false);
+        QVERIFY(mScheduler->getPageLatency() < defaultLatency);
+    }
+
+private:
+    void report(int remainingRows, int rowCount, std::chrono::milliseconds dt = 0ms)
+    {
+        mScheduler->reportPosition(remainingRows, rowCount, mNow + dt);
+    }
+
+    std::unique_ptr<PrefetchScheduler> mScheduler;
+    std::unique_ptr<QSignalSpy> mFetchSpy;
+    PrefetchScheduler::Clock::time_point mNow;
+};
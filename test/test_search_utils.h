@@ -20,6 +20,8 @@ private slots:
         QTest::newRow("emoji") << "😅😂🤣" << "😅😂🤣";
         QTest::newRow("bold sans") << "𝗔𝗕𝗖𝗗𝗘𝗙𝗚𝗛𝗜𝗝𝗞𝗟𝗠𝗡𝗢𝗣𝗤𝗥𝗦𝗧𝗨𝗩𝗪𝗫𝗬𝗭𝟬𝟭𝟮𝟯𝟰𝟱𝟲𝟳𝟴𝟵" << "abcdefghijklmnopqrstuvwxyz0123456789";
         QTest::newRow("math A") << "𝒜" << "a";
+        QTest::newRow("latin-1") << "Ça VA, Zoë? ½" << "ca va, zoe? 1⁄2";
+        QTest::newRow("normalized ascii") << "hello world" << "hello world";
     }
 
     void normalizeText()
@@ -42,6 +44,10 @@ private slots:
         QTest::newRow("combine single letters 1") << "s k y walker" << std::vector<QString>{"s", "k", "y", "walker", "sky"};
         QTest::newRow("combine single letters 2") << "S K Y" << std::vector<QString>{"s", "k", "y", "sky"};
         QTest::newRow("no combine") << "H i" << std::vector<QString>{"h", "i"};
+        QTest::newRow("apostrophe") << "Don't 'stop'" << std::vector<QString>{"don't", "stop"};
+        QTest::newRow("numbers") << "Pi is 3.14, not 1,000; e.g. 42a" << std::vector<QString>{"pi", "is", "3.14", "not", "1,000", "e.g", "42a"};
+        QTest::newRow("url") << "https://bsky.app/profile" << std::vector<QString>{"https", "bsky.app", "profile"};
+        QTest::newRow("latin-1") << "Déjà vu" << std::vector<QString>{"deja", "vu"};
     }
 
     void getWords()
@@ -50,4 +56,12 @@ private slots:
         QFETCH(std::vector<QString>, output);
         QCOMPARE(SearchUtils::getNormalizedWords(input), output);
     }
+
+    void normalizedCompare()
+    {
+        QVERIFY(SearchUtils::normalizedCompare("Ábc", "abd") < 0);
+        QVERIFY(SearchUtils::normalizedCompare("bob", " Alice") > 0);
+        QVERIFY(SearchUtils::normalizedCompare("😀 Zoë", "zoe") != 0);
+        QCOMPARE(SearchUtils::normalizedCompare("Carol", "Carol"), 0);
+    }
 };
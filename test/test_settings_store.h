@@ -0,0 +1,100 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <settings_store.h>
+#include <QTemporaryDir>
+#include <QtTest/QTest>
+
+using namespace Skywalker;
+
+class TestSettingsStore : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init()
+    {
+        mDir = std::make_unique<QTemporaryDir>();
+        QVERIFY(mDir->isValid());
+    }
+
+    void cleanup()
+    {
+        mDir = nullptr;
+    }
+
+    void combinedWrites()
+    {
+        SettingsStore store(getFileName(), QSettings::IniFormat);
+        store.setValue("a", 1);
+        store.setValue("b", "foo");
+        store.setValue("a", 2);
+        store.remove("b");
+        QCOMPARE(store.value("a").toInt(), 2);
+        QVERIFY(!store.contains("b"));
+
+        // Nothing is written before the flush delay.
+        QVERIFY(!fileValue("a").isValid());
+
+        QTRY_COMPARE_WITH_TIMEOUT(fileValue("a").toInt(), 2, 10000);
+        QVERIFY(!fileValue("b").isValid());
+    }
+
+    void syncNow()
+    {
+        SettingsStore store(getFileName(), QSettings::IniFormat);
+        store.setValue("a", 1);
+        store.syncNow();
+        QCOMPARE(fileValue("a").toInt(), 1);
+
+        // Changes from another process are picked up.
+        {
+            QSettings settings(getFileName(), QSettings::IniFormat);
+            settings.setValue("b", 2);
+        }
+
+        QVERIFY(!store.contains("b"));
+        store.syncNow();
+        QCOMPARE(store.value("b").toInt(), 2);
+    }
+
+    void stop()
+    {
+        SettingsStore store(getFileName(), QSettings::IniFormat);
+        store.setValue("a", 1);
+        store.beginGroup("group");
+        store.setValue("b", 2);
+        store.endGroup();
+
+        store.stop();
+        QCOMPARE(fileValue("a").toInt(), 1);
+        QCOMPARE(fileValue("group/b").toInt(), 2);
+    }
+
+    void writeOnDestruction()
+    {
+        {
+            SettingsStore store(getFileName(), QSettings::IniFormat);
+            store.setValue("a", 1);
+        }
+
+        QCOMPARE(fileValue("a").toInt(), 1);
+
+        SettingsStore store(getFileName(), QSettings::IniFormat);
+        QCOMPARE(store.value("a").toInt(), 1);
+    }
+
+private:
+    QString getFileName() const
+    {
+        return mDir->filePath("settings.ini");
+    }
+
+    QVariant fileValue(const QString& key) const
+    {
+        QSettings settings(getFileName(), QSettings::IniFormat);
+        return settings.value(key);
+    }
+
+    std::unique_ptr<QTemporaryDir> mDir;
+};
@@ -1,6 +1,7 @@
 // Copyright (C) 2024 Michel de Boer
 // License: GPLv3
 #pragma once
+#include <emoji_names.h>
 #include <unicode_fonts.h>
 #include <QtTest/QTest>
 
@@ -32,5 +33,36 @@ private slots:
         QFETCH(QStringList, output);
         QCOMPARE(UnicodeFonts::getUniqueEmojis(text), output);
     }
+
+    void emojiNames()
+    {
+        QVERIFY(EmojiNames::isEmoji("😀"));
+        QVERIFY(EmojiNames::isEmoji("🏳️‍🌈"));
+        QVERIFY(EmojiNames::isEmoji("#️⃣"));
+        QVERIFY(!EmojiNames::isEmoji("#"));
+        QVERIFY(!EmojiNames::isEmoji("a"));
+        QVERIFY(!EmojiNames::isEmoji(""));
+        QCOMPARE(EmojiNames::getEmojiName("🤩"), "star-struck");
+        QCOMPARE(EmojiNames::getEmojiName("✨\uFE0F"), "sparkles");
+        QCOMPARE(EmojiNames::getEmojiName("x"), "unknown");
+    }
+
+    void onlyEmojis()
+    {
+        QVERIFY(UnicodeFonts::onlyEmojis("😀🏳️‍🌈"));
+        QVERIFY(!UnicodeFonts::onlyEmojis("😀 "));
+        QVERIFY(UnicodeFonts::hasEmoji("hello 🤩"));
+        QVERIFY(!UnicodeFonts::hasEmoji("hello world"));
+    }
+
+    void emojiCodePoint()
+    {
+        QVERIFY(UnicodeFonts::isEmojiCodePoint(0x1F600));
+        QVERIFY(UnicodeFonts::isEmojiCodePoint(0x200D));
+        QVERIFY(UnicodeFonts::isEmojiCodePoint(0xE0067));
+        QVERIFY(!UnicodeFonts::isEmojiCodePoint('#'));
+        QVERIFY(!UnicodeFonts::isEmojiCodePoint(0x4E00));
+        QVERIFY(!UnicodeFonts::isEmojiCodePoint(0x10FFFF));
+    }
 };
 
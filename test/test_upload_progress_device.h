@@ -0,0 +1,140 @@
+// Copyright (C) 2026 Michel de Boer
+// License: GPLv3
+#pragma once
+#include <upload_progress_device.h>
+#include <QBuffer>
+#include <QtTest/QTest>
+
+using namespace Skywalker;
+
+// Sequential source that returns at most chunkSize bytes per read.
+class ChunkedSource : public QIODevice
+{
+public:
+    ChunkedSource(const QByteArray& data, qint64 chunkSize) :
+        mData(data),
+        mChunkSize(chunkSize)
+    {
+        open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+    }
+
+    bool isSequential() const override { return true; }
+    qint64 bytesAvailable() const override { return mData.size() - mPos + QIODevice::bytesAvailable(); }
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override
+    {
+        const qint64 size = std::min({ maxSize, mChunkSize, qint64(mData.size()) - mPos });
+        memcpy(data, mData.constData() + mPos, size);
+        mPos += size;
+        return size;
+    }
+
+    qint64 writeData(const char*, qint64) override { return -1; }
+
+private:
+    QByteArray mData;
+    qint64 mChunkSize;
+    qint64 mPos = 0;
+};
+
+class TestUploadProgressDevice : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init()
+    {
+        mData.clear();
+
+        for (int i = 0; i < DATA_SIZE; ++i)
+            mData.append(char('a' + i % 26));
+
+        mProgress.clear();
+    }
+
+    void nonSequentialSource()
+    {
+        auto source = std::make_shared<QBuffer>(&mData);
+        QVERIFY(source->open(QIODevice::ReadOnly));
+        UploadProgressDevice device(source, DATA_SIZE, progressCb());
+
+        QVERIFY(!device.isSequential());
+        QCOMPARE(device.size(), qint64(DATA_SIZE));
+        QCOMPARE(device.bytesAvailable(), qint64(DATA_SIZE));
+
+        const QByteArray first = device.read(400);
+        QCOMPARE(first, mData.left(400));
+        QCOMPARE(device.bytesAvailable(), qint64(DATA_SIZE - 400));
+
+        QCOMPARE(device.readAll(), mData.mid(400));
+        QCOMPARE(device.bytesAvailable(), qint64(0));
+        QVERIFY(device.atEnd());
+        QCOMPARE(mProgress.back(), qint64(DATA_SIZE));
+
+        // An upload retry starts over.
+        mProgress.clear();
+        QVERIFY(device.reset());
+        QCOMPARE(device.bytesAvailable(), qint64(DATA_SIZE));
+        QCOMPARE(device.readAll(), mData);
+        QVERIFY(!mProgress.empty());
+        QCOMPARE(mProgress.back(), qint64(DATA_SIZE));
+    }
+
+    void sequentialSource()
+    {
+        auto source = std::make_shared<ChunkedSource>(mData, DATA_SIZE);
+        UploadProgressDevice device(source, DATA_SIZE, progressCb());
+
+        QVERIFY(device.isSequential());
+        QCOMPARE(device.bytesAvailable(), qint64(DATA_SIZE));
+        QCOMPARE(device.readAll(), mData);
+        QCOMPARE(device.bytesAvailable(), qint64(0));
+        QVERIFY(device.atEnd());
+        QCOMPARE(mProgress.back(), qint64(DATA_SIZE));
+    }
+
+    void shortReads()
+    {
+        auto source = std::make_shared<ChunkedSource>(mData, 10);
+        UploadProgressDevice device(source, DATA_SIZE, progressCb());
+        QByteArray data;
+
+        while (!device.atEnd())
+        {
+            const QByteArray chunk = device.read(100);
+            QVERIFY(!chunk.isEmpty());
+            data.append(chunk);
+        }
+
+        QCOMPARE(data, mData);
+
+        // Progress is reported once per whole percentage
+        QCOMPARE((int)mProgress.size(), 100);
+
+        for (int i = 0; i < (int)mProgress.size(); ++i)
+            QCOMPARE(mProgress[i], qint64((i + 1) * 10));
+    }
+
+    void noProgressWithoutSize()
+    {
+        auto source = std::make_shared<ChunkedSource>(mData, 10);
+        UploadProgressDevice device(source, 0, progressCb());
+        QCOMPARE(device.readAll(), mData);
+        QVERIFY(mProgress.empty());
+    }
+
+private:
+    static constexpr int DATA_SIZE = 1000;
+
+    UploadProgressDevice::ProgressCb progressCb()
+    {
+        return [this](qint64 bytesRead, qint64 totalBytes){
+            QCOMPARE(totalBytes, qint64(DATA_SIZE));
+            mProgress.push_back(bytesRead);
+        };
+    }
+
+    QByteArray mData;
+    std::vector<qint64> mProgress;
+};